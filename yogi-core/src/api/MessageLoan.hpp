@@ -0,0 +1,37 @@
+#ifndef YOGI_API_MESSAGELOAN_HPP
+#define YOGI_API_MESSAGELOAN_HPP
+
+#include "../config.h"
+#include "../base/Buffer.hpp"
+#include "../interfaces/IPublicObject.hpp"
+
+
+namespace yogi {
+namespace api {
+
+/***************************************************************************//**
+ * Received message that is lent to the user through the library interface
+ *
+ * The message data stays valid and unchanged until the object is destroyed.
+ ******************************************************************************/
+class MessageLoan : public interfaces::IPublicObject
+{
+private:
+    const base::Buffer m_data;
+
+public:
+    explicit MessageLoan(base::Buffer&& data)
+        : m_data{std::move(data)}
+    {
+    }
+
+    const base::Buffer& data() const
+    {
+        return m_data;
+    }
+};
+
+} // namespace api
+} // namespace yogi
+
+#endif // YOGI_API_MESSAGELOAN_HPP
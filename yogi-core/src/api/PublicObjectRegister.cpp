@@ -1,38 +1,121 @@
 #include "PublicObjectRegister.hpp"
 
+#include <vector>
+#include <limits>
+
 
 namespace yogi {
 namespace api {
 
 std::mutex                        PublicObjectRegister::ms_mutex;
-PublicObjectRegister::objects_map PublicObjectRegister::ms_objects;
+std::atomic<PublicObjectRegister::slot*>
+    PublicObjectRegister::ms_chunks[MAX_CHUNKS];
+std::size_t                       PublicObjectRegister::ms_numSlots = 0;
+std::size_t                       PublicObjectRegister::ms_firstFree
+                                      = NO_FREE_SLOT;
+std::mutex                        PublicObjectRegister::ms_typesMutex;
+std::unordered_map<std::type_index, PublicObjectRegister::type_descriptor*>
+                                  PublicObjectRegister::ms_types;
+
+PublicObjectRegister::type_descriptor*
+PublicObjectRegister::get_type_descriptor(
+    const interfaces::IPublicObject& obj)
+{
+    std::lock_guard<std::mutex> lock(ms_typesMutex);
+
+    // descriptors are never freed since lock-free readers may still use them
+    auto& type = ms_types[std::type_index(typeid(obj))];
+    if (!type) {
+        type = new type_descriptor;
+    }
+
+    return type;
+}
+
+PublicObjectRegister::handle_type PublicObjectRegister::insert(
+    interfaces::public_object_ptr obj)
+{
+    auto type = get_type_descriptor(*obj);
+
+    std::lock_guard<std::mutex> lock(ms_mutex);
+
+    std::size_t idx;
+    if (ms_firstFree != NO_FREE_SLOT) {
+        idx = ms_firstFree;
+        ms_firstFree = find_slot(make_handle(idx, 0))->nextFree;
+    }
+    else {
+        if (ms_numSlots == MAX_CHUNKS * CHUNK_SIZE) {
+            throw ExceptionT<YOGI_ERR_BAD_ALLOCATION>{};
+        }
+
+        idx = ms_numSlots;
+        auto& chunk = ms_chunks[idx >> CHUNK_BITS];
+        if (!chunk.load(std::memory_order_relaxed)) {
+            chunk.store(new slot[CHUNK_SIZE](), std::memory_order_release);
+        }
+
+        ++ms_numSlots;
+    }
+
+    auto& s = *find_slot(make_handle(idx, 0));
+    auto gen = s.generation.load(std::memory_order_relaxed) + 1;
+
+    // readers that see the new object must also see that the slot has been
+    // freed before (see get_s())
+    std::atomic_thread_fence(std::memory_order_release);
+    s.object.store(obj.get(), std::memory_order_relaxed);
+    s.type.store(type, std::memory_order_relaxed);
+    s.owner = std::move(obj);
+    s.generation.store(gen, std::memory_order_release);
+
+    return make_handle(idx, gen);
+}
 
 void PublicObjectRegister::destroy(handle_type handle)
 {
     interfaces::public_object_ptr obj; // destroy object after lock released
 
     std::unique_lock<std::mutex> lock(ms_mutex);
-    auto it = ms_objects.find(handle);
+    auto s = find_slot(handle);
+    if (!s) {
+        throw ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
+    }
 
-    if (it == ms_objects.end()) {
+    auto gen = s->generation.load(std::memory_order_relaxed);
+    if (!(gen & 1) || !generation_matches(handle, gen)) {
         throw ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
     }
 
-    if (!it->second.unique()) {
+    if (!s->owner.unique()) {
         throw ExceptionT<YOGI_ERR_OBJECT_STILL_USED>{};
     }
 
-    obj = it->second;
-    ms_objects.erase(it);
+    s->generation.store(gen + 1, std::memory_order_release);
+    obj = std::move(s->owner);
+
+    auto idx = (reinterpret_cast<std::uintptr_t>(handle) & INDEX_MASK) - 1;
+    s->nextFree  = ms_firstFree;
+    ms_firstFree = idx;
 }
 
 void PublicObjectRegister::clear()
 {
-    objects_map objects;
+    std::vector<interfaces::public_object_ptr> objects;
 
     {{
         std::lock_guard<std::mutex> lock(ms_mutex);
-        std::swap(ms_objects, objects);
+        for (std::size_t idx = 0; idx < ms_numSlots; ++idx) {
+            auto& s = *find_slot(make_handle(idx, 0));
+            auto gen = s.generation.load(std::memory_order_relaxed);
+            if (gen & 1) {
+                s.generation.store(gen + 1, std::memory_order_release);
+                objects.push_back(std::move(s.owner));
+
+                s.nextFree   = ms_firstFree;
+                ms_firstFree = idx;
+            }
+        }
     }}
 
     auto oldSize = std::numeric_limits<std::size_t>::max();
@@ -40,7 +123,7 @@ void PublicObjectRegister::clear()
         oldSize = objects.size();
 
         for (auto it = objects.begin(); it != objects.end(); ) {
-            if (it->second.unique()) {
+            if (it->unique()) {
                 it = objects.erase(it);
             }
             else {
@@ -7,8 +7,12 @@
 #include "ExceptionT.hpp"
 
 #include <mutex>
+#include <atomic>
 #include <unordered_map>
+#include <typeindex>
 #include <algorithm>
+#include <cstdint>
+#include <cstddef>
 
 
 namespace yogi {
@@ -17,35 +21,211 @@ namespace api {
 /***************************************************************************//**
  * Singleton for managing objects that are created, used and destroyed through
  * the shared library interface and referred to via handles
+ *
+ * Handles encode the index of a slot in a table together with the generation
+ * of that slot. Every time an object is destroyed, the generation of its slot
+ * is incremented, so handles to destroyed objects never validate, even if the
+ * slot has been reused for another object in the meantime.
+ *
+ * Looking up objects via get_s() is lock-free: the slots live in chunks that
+ * are never freed and the generation is checked before and after reading a
+ * slot. Type checks compare a per-type tag against a cache that is kept for
+ * each dynamic object type; dynamic_cast is only used the first time a
+ * particular type is requested for a particular dynamic object type.
+ * Creating and destroying objects is serialised by a mutex.
  ******************************************************************************/
 class PublicObjectRegister final
 {
     typedef void* handle_type;
-    typedef std::unordered_map<handle_type, interfaces::public_object_ptr>
-        objects_map;
+
+    class type_descriptor;
+
+    struct slot {
+        std::atomic<std::uintptr_t>           generation; // odd while in use
+        std::atomic<interfaces::IPublicObject*> object;
+        std::atomic<type_descriptor*>           type;
+        interfaces::public_object_ptr           owner;    // guarded by mutex
+        std::size_t                             nextFree; // guarded by mutex
+    };
+
+    struct cast_result {
+        bool           convertible;
+        std::ptrdiff_t offset;
+    };
+
+    class type_descriptor final
+    {
+        enum {
+            MAX_ENTRIES = 16
+        };
+
+        struct entry {
+            std::atomic<const void*> tag;
+            cast_result              result;
+        };
+
+        entry       m_entries[MAX_ENTRIES] = {};
+        std::size_t m_size = 0; // guarded by ms_typesMutex
+
+    public:
+        bool lookup(const void* tag, cast_result* result) const
+        {
+            for (auto& entry : m_entries) {
+                auto entryTag = entry.tag.load(std::memory_order_acquire);
+                if (entryTag == tag) {
+                    *result = entry.result;
+                    return true;
+                }
+
+                if (!entryTag) {
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        void store(const void* tag, cast_result result)
+        {
+            if (m_size < MAX_ENTRIES) {
+                m_entries[m_size].result = result;
+                m_entries[m_size].tag.store(tag, std::memory_order_release);
+                ++m_size;
+            }
+        }
+    };
+
+    template <typename T>
+    struct type_tag {
+        static const char id;
+    };
+
+    static constexpr unsigned    HANDLE_INDEX_BITS  = sizeof(void*) >= 8
+                                                        ? 24 : 20;
+    static constexpr unsigned    CHUNK_BITS         = 12;
+    static constexpr std::size_t CHUNK_SIZE         = 1u << CHUNK_BITS;
+    static constexpr std::size_t MAX_CHUNKS         = 1u << (HANDLE_INDEX_BITS
+                                                        - CHUNK_BITS);
+    static constexpr std::size_t NO_FREE_SLOT       = ~std::size_t{0};
+    static constexpr std::uintptr_t INDEX_MASK      =
+        (std::uintptr_t{1} << HANDLE_INDEX_BITS) - 1;
 
 private:
-    static std::mutex  ms_mutex;
-    static objects_map ms_objects;
+    static std::mutex          ms_mutex;
+    static std::atomic<slot*>  ms_chunks[MAX_CHUNKS];
+    static std::size_t         ms_numSlots;
+    static std::size_t         ms_firstFree;
+    static std::mutex          ms_typesMutex;
+    static std::unordered_map<std::type_index, type_descriptor*> ms_types;
+
+    static handle_type make_handle(std::size_t idx, std::uintptr_t generation)
+    {
+        return reinterpret_cast<handle_type>((generation << HANDLE_INDEX_BITS)
+            | (idx + 1));
+    }
+
+    static slot* find_slot(handle_type handle)
+    {
+        auto idx = (reinterpret_cast<std::uintptr_t>(handle) & INDEX_MASK);
+        if (idx-- == 0) {
+            return nullptr;
+        }
+
+        auto chunk = ms_chunks[idx >> CHUNK_BITS].load(
+            std::memory_order_acquire);
+        return chunk ? &chunk[idx & (CHUNK_SIZE - 1)] : nullptr;
+    }
+
+    static bool generation_matches(handle_type handle, std::uintptr_t gen)
+    {
+        return ((gen << HANDLE_INDEX_BITS) >> HANDLE_INDEX_BITS)
+            == (reinterpret_cast<std::uintptr_t>(handle) >> HANDLE_INDEX_BITS);
+    }
+
+    static bool generation_matches(handle_type handle, const slot& s)
+    {
+        return generation_matches(handle,
+            s.generation.load(std::memory_order_acquire));
+    }
+
+    template <typename TO>
+    static TO* cast(interfaces::IPublicObject* obj, type_descriptor* type)
+    {
+        const void* tag = &type_tag<TO>::id;
+
+        cast_result result;
+        if (!type->lookup(tag, &result)) {
+            result = cast_slow<TO>(obj, type);
+        }
+
+        if (!result.convertible) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<TO*>(reinterpret_cast<char*>(obj)
+            + result.offset);
+    }
+
+    template <typename TO>
+    static cast_result cast_slow(interfaces::IPublicObject* obj,
+        type_descriptor* type)
+    {
+        // the offset of a base class sub-object is the same for all objects
+        // of the same dynamic type, so it only has to be determined once
+        auto p = dynamic_cast<TO*>(obj);
+        cast_result result{p != nullptr, p ? reinterpret_cast<char*>(p)
+            - reinterpret_cast<char*>(obj) : 0};
+
+        std::lock_guard<std::mutex> lock(ms_typesMutex);
+        cast_result existing;
+        if (!type->lookup(&type_tag<TO>::id, &existing)) {
+            type->store(&type_tag<TO>::id, result);
+        }
+
+        return result;
+    }
+
+    static type_descriptor* get_type_descriptor(
+        const interfaces::IPublicObject& obj);
+    static handle_type insert(interfaces::public_object_ptr obj);
 
 public:
     template <typename TO = interfaces::IPublicObject>
     static inline TO& get(handle_type handle)
     {
-        return *static_cast<TO*>(handle);
+        auto s = find_slot(handle);
+        YOGI_ASSERT(s && generation_matches(handle, *s));
+
+        auto p = cast<TO>(s->object.load(std::memory_order_relaxed),
+            s->type.load(std::memory_order_relaxed));
+        YOGI_ASSERT(p);
+
+        return *p;
     }
 
     template <typename TO = interfaces::IPublicObject>
     static TO& get_s(handle_type handle)
     {
-        std::lock_guard<std::mutex> lock(ms_mutex);
-        auto obj = ms_objects.find(handle);
+        auto s = find_slot(handle);
+        if (!s) {
+            throw ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
+        }
 
-        if (obj == ms_objects.end()) {
+        auto gen = s->generation.load(std::memory_order_acquire);
+        if (!(gen & 1) || !generation_matches(handle, gen)) {
             throw ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
         }
 
-        TO* p = dynamic_cast<TO*>(obj->second.get());
+        auto obj  = s->object.load(std::memory_order_relaxed);
+        auto type = s->type.load(std::memory_order_relaxed);
+
+        // make sure the slot has not been reused while reading it
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s->generation.load(std::memory_order_relaxed) != gen) {
+            throw ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
+        }
+
+        TO* p = cast<TO>(obj, type);
         if (!p) {
             throw ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
         }
@@ -56,32 +236,22 @@ public:
     template <typename TO, typename... TArgs>
     static handle_type create(TArgs&&... args)
     {
-        auto obj = std::make_shared<TO>(std::forward<TArgs>(args)...);
-
-        std::lock_guard<std::mutex> lock(ms_mutex);
-
-        handle_type handle = static_cast<handle_type>(obj.get());
-        ms_objects[handle] = obj;
-
-        return handle;
+        return insert(std::make_shared<TO>(std::forward<TArgs>(args)...));
     }
 
     template <typename TO>
     static handle_type add(std::shared_ptr<TO> obj)
     {
-        std::lock_guard<std::mutex> lock(ms_mutex);
-
-        handle_type handle = static_cast<handle_type>(obj.get());
-        YOGI_ASSERT(!ms_objects.count(handle));
-        ms_objects[handle] = obj;
-
-        return handle;
+        return insert(std::move(obj));
     }
 
     static void destroy(handle_type handle);
     static void clear();
 };
 
+template <typename T>
+const char PublicObjectRegister::type_tag<T>::id = 0;
+
 } // namespace api
 } // namespace yogi
 
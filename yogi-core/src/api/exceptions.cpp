@@ -131,6 +131,33 @@ YOGI_EXCEPTION( YOGI_ERR_CONNECTION_CLOSED,
 YOGI_EXCEPTION( YOGI_ERR_UNINITIALIZED,
     "Not yet initialized");
 
+YOGI_EXCEPTION( YOGI_ERR_CURSOR_EXPIRED,
+    "The change cursor refers to changes that are no longer recorded");
+
+YOGI_EXCEPTION( YOGI_ERR_SET_AFFINITY_FAILED,
+    "Setting the CPU affinity of a thread failed");
+
+YOGI_EXCEPTION( YOGI_ERR_WRONG_THREAD,
+    "The function cannot be called from the current thread");
+
+YOGI_EXCEPTION( YOGI_ERR_SET_PRIORITY_FAILED,
+    "Changing the scheduling policy of a thread failed");
+
+YOGI_EXCEPTION( YOGI_ERR_LOCK_MEMORY_FAILED,
+    "Locking the memory of the process failed");
+
+YOGI_EXCEPTION( YOGI_ERR_WOULD_BLOCK,
+    "The operation would block");
+
+YOGI_EXCEPTION( YOGI_ERR_CANNOT_OPEN_FILE,
+    "Opening or creating a file failed");
+
+YOGI_EXCEPTION( YOGI_ERR_NOT_MULTIPLEXED,
+    "The connection has not been assigned as a multiplexed connection");
+
+YOGI_EXCEPTION( YOGI_ERR_MESSAGE_TOO_LARGE,
+    "The message is too large to be sent without blocking");
+
 
 } // namespace api
 } // namespace yogi
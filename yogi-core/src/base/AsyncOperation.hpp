@@ -3,17 +3,69 @@
 
 #include "../config.h"
 #include "../api/ExceptionT.hpp"
+#include "../scheduling/SchedulerStatistics.hpp"
+#include "../scheduling/CallbackExecutor.hpp"
 
 #include <boost/asio/io_service.hpp>
 
 #include <mutex>
 #include <condition_variable>
+#include <tuple>
+#include <utility>
+#include <type_traits>
 
 
 namespace yogi {
 namespace base {
 namespace internal {
 
+// handlers are passed in by the user through the library interface
+template <typename TFn>
+auto invoke_user_handler(TFn&& fn) -> decltype(fn())
+{
+    scheduling::SchedulerStatistics::scoped_measurement measurement{
+        scheduling::SchedulerStatistics::USER_CALLBACK};
+    return fn();
+}
+
+template <typename THandlerFn, typename TArgs, std::size_t... TIndices>
+void invoke_user_handler(THandlerFn& handler, TArgs& args,
+    std::index_sequence<TIndices...>)
+{
+    invoke_user_handler([&] {
+        return handler(std::move(std::get<TIndices>(args))...);
+    });
+}
+
+// handlers that do not return a value get executed by the callback executor of
+// the scheduler running the current thread, if enabled; handlers of the same
+// operation form a sequence so they run one after another in firing order
+template <typename THandlerFn, typename... THandlerArgs>
+void dispatch_user_handler(const void* operation, THandlerFn&& handler,
+    std::function<void ()> done, THandlerArgs&&... handlerArgs)
+{
+    auto executor = scheduling::CallbackExecutor::thread_executor();
+    if (!executor) {
+        invoke_user_handler([&] {
+            return handler(std::forward<THandlerArgs>(handlerArgs)...);
+        });
+
+        done();
+        return;
+    }
+
+    typedef std::tuple<typename std::decay<THandlerArgs>::type...> args_type;
+    executor->execute([
+        handler = std::forward<THandlerFn>(handler),
+        args    = args_type{std::forward<THandlerArgs>(handlerArgs)...},
+        done    = std::move(done)
+    ]() mutable {
+        invoke_user_handler(handler, args,
+            std::index_sequence_for<THandlerArgs...>{});
+        done();
+    }, operation);
+}
+
 template <typename THandlerFn>
 class AsyncOperationBase
 {
@@ -99,8 +151,10 @@ public:
     {
         auto handler = super::take_armed_handler();
         if (handler) {
-            TReturnType result = handler(api::ExceptionT<TErrorCode>{},
-                std::forward<THandlerArgs>(handlerArgs)...);
+            TReturnType result = invoke_user_handler([&] {
+                return handler(api::ExceptionT<TErrorCode>{},
+                    std::forward<THandlerArgs>(handlerArgs)...);
+            });
 
             std::lock_guard<std::mutex> lock{super::m_mutex};
             --super::m_runningOperations;
@@ -118,8 +172,10 @@ public:
     {
         auto handler = super::get_armed_handler();
         if (handler) {
-            return handler(api::ExceptionT<TErrorCode>{},
-                std::forward<THandlerArgs>(handlerArgs)...);
+            return invoke_user_handler([&] {
+                return handler(api::ExceptionT<TErrorCode>{},
+                    std::forward<THandlerArgs>(handlerArgs)...);
+            });
         }
 
         return TReturnType{};
@@ -132,19 +188,24 @@ class AsyncOperationHelper<void, THandlerFn>
 {
     typedef AsyncOperationBase<THandlerFn> super;
 
+private:
+    void finish_operation()
+    {
+        std::lock_guard<std::mutex> lock{super::m_mutex};
+        --super::m_runningOperations;
+
+        super::m_cv.notify_all();
+    }
+
 public:
     template <int TErrorCode, typename... THandlerArgs>
     void fire(THandlerArgs&&... handlerArgs)
     {
         auto handler = super::take_armed_handler();
         if (handler) {
-            handler(api::ExceptionT<TErrorCode>{},
+            dispatch_user_handler(this, std::move(handler),
+                [this] { finish_operation(); }, api::ExceptionT<TErrorCode>{},
                 std::forward<THandlerArgs>(handlerArgs)...);
-
-            std::lock_guard<std::mutex> lock{super::m_mutex};
-            --super::m_runningOperations;
-
-            super::m_cv.notify_all();
         }
     }
 
@@ -153,12 +214,9 @@ public:
     {
         auto handler = super::take_armed_handler();
         if (handler) {
-            handler(e, std::forward<THandlerArgs>(handlerArgs)...);
-
-            std::lock_guard<std::mutex> lock{super::m_mutex};
-            --super::m_runningOperations;
-
-            super::m_cv.notify_all();
+            dispatch_user_handler(this, std::move(handler),
+                [this] { finish_operation(); }, api::Exception{e},
+                std::forward<THandlerArgs>(handlerArgs)...);
         }
     }
 
@@ -167,7 +225,15 @@ public:
     {
         auto handler = super::get_armed_handler();
         if (handler) {
-            handler(api::ExceptionT<TErrorCode>{},
+            // the handler is running until it returns even if the operation
+            // gets disarmed meanwhile
+            {{
+                std::lock_guard<std::mutex> lock{super::m_mutex};
+                ++super::m_runningOperations;
+            }}
+
+            dispatch_user_handler(this, std::move(handler),
+                [this] { finish_operation(); }, api::ExceptionT<TErrorCode>{},
                 std::forward<THandlerArgs>(handlerArgs)...);
         }
     }
@@ -0,0 +1,143 @@
+#ifndef YOGI_BASE_DEADLINEQUEUE_HPP
+#define YOGI_BASE_DEADLINEQUEUE_HPP
+
+#include "../config.h"
+#include "Id.hpp"
+#include "../interfaces/IScheduler.hpp"
+
+#include <boost/asio/steady_timer.hpp>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Tracks the deadlines of a set of objects with a single timer
+ *
+ * The queue is not synchronised itself: all member functions (apart from the
+ * destructor) have to be called with the owner's lock held. Once the earliest
+ * deadline expires, the expired function gets called from a scheduler thread;
+ * it has to acquire the owner's lock and then call pop_expired(). The timer is
+ * only created once the first deadline gets added.
+ ******************************************************************************/
+class DeadlineQueue final
+{
+public:
+    typedef std::chrono::steady_clock clock;
+    typedef clock::time_point         time_point;
+    typedef std::function<void ()>    expired_fn;
+
+private:
+    typedef std::multimap<time_point, Id> queue_type;
+
+    // prevents the expired function from being called after destruction
+    struct guard_type {
+        std::mutex mutex;
+        bool       alive = true;
+    };
+
+    const interfaces::scheduler_ptr            m_scheduler;
+    const std::shared_ptr<guard_type>          m_guard;
+    const expired_fn                           m_expiredFn;
+    std::unique_ptr<boost::asio::steady_timer> m_timer;
+    queue_type                                 m_queue;
+
+private:
+    void restart_timer()
+    {
+        if (m_queue.empty()) {
+            return;
+        }
+
+        if (!m_timer) {
+            m_timer = std::make_unique<boost::asio::steady_timer>(
+                m_scheduler->io_service());
+        }
+
+        m_timer->expires_at(m_queue.begin()->first);
+
+        auto guard = m_guard;
+        m_timer->async_wait([=](const boost::system::error_code& ec) {
+            if (ec) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock{guard->mutex};
+            if (guard->alive) {
+                m_expiredFn();
+            }
+        });
+    }
+
+public:
+    DeadlineQueue(interfaces::IScheduler& scheduler, expired_fn expiredFn)
+        : m_scheduler{scheduler.make_ptr<interfaces::IScheduler>()}
+        , m_guard{std::make_shared<guard_type>()}
+        , m_expiredFn{expiredFn}
+    {
+    }
+
+    ~DeadlineQueue()
+    {
+        std::lock_guard<std::mutex> lock{m_guard->mutex};
+        m_guard->alive = false;
+
+        if (m_timer) {
+            m_timer->cancel();
+        }
+    }
+
+    DeadlineQueue(const DeadlineQueue&) = delete;
+    DeadlineQueue& operator= (const DeadlineQueue&) = delete;
+
+    // returns the deadline which is required to remove the entry again
+    time_point add(std::chrono::milliseconds timeout, Id id)
+    {
+        auto deadline = clock::now() + timeout;
+        auto it = m_queue.emplace(deadline, id);
+        if (it == m_queue.begin()) {
+            restart_timer();
+        }
+
+        return deadline;
+    }
+
+    // the timer is left running; it simply finds nothing to pop
+    void remove(time_point deadline, Id id)
+    {
+        auto range = m_queue.equal_range(deadline);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == id) {
+                m_queue.erase(it);
+                return;
+            }
+        }
+
+        YOGI_NEVER_REACHED;
+    }
+
+    // calls fn(id) for every expired entry after removing it from the queue
+    template <typename TFn>
+    void pop_expired(TFn fn)
+    {
+        auto now = clock::now();
+        while (!m_queue.empty() && m_queue.begin()->first <= now) {
+            auto id = m_queue.begin()->second;
+            m_queue.erase(m_queue.begin());
+            fn(id);
+        }
+
+        restart_timer();
+    }
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_DEADLINEQUEUE_HPP
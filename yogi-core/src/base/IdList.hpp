@@ -0,0 +1,117 @@
+#ifndef YOGI_BASE_IDLIST_HPP
+#define YOGI_BASE_IDLIST_HPP
+
+#include "../config.h"
+#include "Id.hpp"
+
+#include <cstddef>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Links of an element in an IdList
+ ******************************************************************************/
+struct IdListHook
+{
+    Id prev;
+    Id next;
+};
+
+/***************************************************************************//**
+ * Intrusive doubly-linked list of elements of an ObjectRegister
+ *
+ * The list itself only stores the ID of its first element; the links are
+ * stored in a hook member of the elements. Adding and removing elements thus
+ * never allocates memory. An element can be in as many lists at the same time
+ * as it has hooks, but each hook can only be in one list.
+ *
+ * Since the list does not know the register, all functions that follow links
+ * take the register and the hook member as arguments.
+ ******************************************************************************/
+class IdList final
+{
+private:
+    Id          m_head;
+    std::size_t m_size = 0;
+
+public:
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    Id front() const
+    {
+        return m_head;
+    }
+
+    template <typename TRegister, typename TElement>
+    void push_front(TRegister& reg, IdListHook TElement::* hook, Id id)
+    {
+        auto& links = reg[id].*hook;
+        YOGI_ASSERT(!links.prev.valid() && !links.next.valid() && id != m_head);
+
+        links.prev = Id{};
+        links.next = m_head;
+        if (m_head.valid()) {
+            (reg[m_head].*hook).prev = id;
+        }
+
+        m_head = id;
+        ++m_size;
+    }
+
+    template <typename TRegister, typename TElement>
+    void erase(TRegister& reg, IdListHook TElement::* hook, Id id)
+    {
+        YOGI_ASSERT(m_size > 0);
+
+        auto& links = reg[id].*hook;
+        if (links.prev.valid()) {
+            (reg[links.prev].*hook).next = links.next;
+        }
+        else {
+            YOGI_ASSERT(m_head == id);
+            m_head = links.next;
+        }
+
+        if (links.next.valid()) {
+            (reg[links.next].*hook).prev = links.prev;
+        }
+
+        links = IdListHook{};
+        --m_size;
+    }
+
+    // calls fn(id) for every element; fn may remove the element it has been
+    // called with from the list and from the register, but no other elements
+    template <typename TRegister, typename TElement, typename TFn>
+    void foreach(TRegister& reg, IdListHook TElement::* hook, TFn fn) const
+    {
+        auto id = m_head;
+        while (id.valid()) {
+            auto next = (reg[id].*hook).next;
+            fn(id);
+            id = next;
+        }
+    }
+
+    // forgets all elements without touching their hooks
+    void clear()
+    {
+        m_head = Id{};
+        m_size = 0;
+    }
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_IDLIST_HPP
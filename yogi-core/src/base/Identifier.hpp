@@ -2,6 +2,7 @@
 #define YOGI_BASE_IDENTIFIER_HPP
 
 #include "../config.h"
+#include "InternedName.hpp"
 
 #include <string>
 #include <functional>
@@ -13,6 +14,10 @@ namespace base {
 
 /***************************************************************************//**
  * Identifier used to identify terminals
+ *
+ * The name is interned (see InternedName) which makes copying, comparing and
+ * hashing identifiers cheap. Identifiers of wildcard bindings carry a glob
+ * pattern instead of a name and never compare equal to a terminal's identifier.
  ******************************************************************************/
 class Identifier
 {
@@ -22,20 +27,24 @@ public:
 
 private:
     signature_type m_signature;
-    name_type      m_name;
+    InternedName   m_name;
     bool           m_hidden;
+    bool           m_wildcard;
 
 public:
     Identifier()
-        : m_hidden{false}
+        : m_hidden  {false}
+        , m_wildcard{false}
     {
     }
 
     template <typename TSignature, typename TName>
-    Identifier(TSignature&& signature, TName&& name, bool hidden)
+    Identifier(TSignature&& signature, TName&& name, bool hidden,
+        bool wildcard = false)
         : m_signature{std::forward<TSignature>(signature)}
         , m_name     {std::forward<TName>(name)}
         , m_hidden   {hidden}
+        , m_wildcard {wildcard}
     {
     }
 
@@ -45,6 +54,11 @@ public:
     }
 
     const name_type& name() const
+    {
+        return m_name.str();
+    }
+
+    const InternedName& interned_name() const
     {
         return m_name;
     }
@@ -54,9 +68,25 @@ public:
         return m_hidden;
     }
 
+    bool wildcard() const
+    {
+        return m_wildcard;
+    }
+
+    std::size_t hash() const
+    {
+        // combine the precomputed name hash with the remaining fields
+        std::size_t h = m_name.hash();
+        h ^= std::hash<signature_type>{}(m_signature) + 0x9e3779b9
+            + (h << 6) + (h >> 2);
+        h = m_hidden ? ~h : h;
+        return m_wildcard ? h ^ 0x5bd1e995 : h;
+    }
+
     bool operator== (const Identifier& rhs) const
     {
-        return (m_signature == rhs.m_signature) && (m_name == rhs.m_name) && (m_hidden == rhs.m_hidden);
+        return (m_signature == rhs.m_signature) && (m_name == rhs.m_name) && (m_hidden == rhs.m_hidden)
+            && (m_wildcard == rhs.m_wildcard);
     }
 
     bool operator!= (const Identifier& rhs) const
@@ -75,9 +105,7 @@ struct hash<yogi::base::Identifier>
 {
     size_t operator() (const yogi::base::Identifier& identifier) const
     {
-        using namespace yogi::base;
-        return hash<Identifier::signature_type>{}(identifier.signature())
-            ^ hash<Identifier::name_type>{}(identifier.name());
+        return identifier.hash();
     }
 };
 
@@ -88,12 +116,15 @@ inline std::ostream& operator<< (std::ostream& os,
 {
     os << '(' << identifier.signature() << ", " << identifier.name();
     if (identifier.hidden()) {
-        os << ", hidden)";
+        os << ", hidden";
     }
-    else {
-        os << ')';
+
+    if (identifier.wildcard()) {
+        os << ", wildcard";
     }
 
+    os << ')';
+
     return os;
 }
 
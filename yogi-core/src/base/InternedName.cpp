@@ -0,0 +1,132 @@
+#include "InternedName.hpp"
+
+#include <unordered_map>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
+
+
+namespace yogi {
+namespace base {
+namespace {
+
+struct name_key {
+    const char* data;
+    std::size_t size;
+    std::size_t hash;
+
+    bool operator== (const name_key& rhs) const
+    {
+        return size == rhs.size && std::memcmp(data, rhs.data, size) == 0;
+    }
+};
+
+struct name_key_hash {
+    std::size_t operator() (const name_key& key) const
+    {
+        return key.hash;
+    }
+};
+
+struct name_table {
+    std::mutex mutex;
+    std::unordered_map<name_key, InternedName::entry*, name_key_hash> map;
+};
+
+name_table& table()
+{
+    // never destroyed since handles in other static objects may outlive it
+    static name_table* tab = new name_table;
+    return *tab;
+}
+
+std::size_t hash_name(const char* data, std::size_t size)
+{
+    // FNV-1a followed by a finalizer to spread similar path names
+    std::uint64_t h = 14695981039346656037ull;
+    for (std::size_t i = 0; i < size; ++i) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 1099511628211ull;
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+
+    return static_cast<std::size_t>(h);
+}
+
+} // anonymous namespace
+
+InternedName::entry* InternedName::acquire(const char* data, std::size_t size)
+{
+    if (size == 0) {
+        return nullptr;
+    }
+
+    auto hash = hash_name(data, size);
+
+    auto& tab = table();
+    std::lock_guard<std::mutex> lock{tab.mutex};
+
+    auto it = tab.map.find(name_key{data, size, hash});
+    if (it != tab.map.end()) {
+        it->second->refs.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+    }
+
+    auto e = new entry{std::string(data, size), hash, {1}};
+    try {
+        tab.map.emplace(name_key{e->str.data(), size, hash}, e);
+    }
+    catch (...) {
+        delete e;
+        throw;
+    }
+
+    return e;
+}
+
+void InternedName::release(entry* e)
+{
+    if (!e) {
+        return;
+    }
+
+    // fast path: we are definitely not holding the last reference
+    auto refs = e->refs.load(std::memory_order_relaxed);
+    while (refs > 1) {
+        if (e->refs.compare_exchange_weak(refs, refs - 1,
+            std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    // the count may only drop to zero while holding the lock; otherwise
+    // acquire() could hand out an entry that is about to be deleted
+    auto& tab = table();
+    std::lock_guard<std::mutex> lock{tab.mutex};
+
+    if (e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        tab.map.erase(name_key{e->str.data(), e->str.size(), e->hash});
+        delete e;
+    }
+}
+
+const std::string& InternedName::str() const
+{
+    static const std::string empty;
+    return m_entry ? m_entry->str : empty;
+}
+
+std::size_t InternedName::table_size()
+{
+    auto& tab = table();
+    std::lock_guard<std::mutex> lock{tab.mutex};
+    return tab.map.size();
+}
+
+} // namespace base
+} // namespace yogi
@@ -0,0 +1,129 @@
+#ifndef YOGI_BASE_INTERNEDNAME_HPP
+#define YOGI_BASE_INTERNEDNAME_HPP
+
+#include "../config.h"
+
+#include <string>
+#include <atomic>
+#include <utility>
+#include <cstddef>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Handle for a name stored in a process-wide interning table
+ *
+ * Equal names share a single immutable table entry which also holds the
+ * precomputed hash of the name. Thus, copying, comparing and hashing handles
+ * is O(1) and every distinct name is kept in memory only once, no matter how
+ * many leafs, nodes and connections refer to it. Entries get removed from the
+ * table once the last handle referring to them has been destroyed.
+ *
+ * Handles can be used concurrently from different threads.
+ ******************************************************************************/
+class InternedName final
+{
+public:
+    struct entry {
+        const std::string        str;
+        const std::size_t        hash;
+        std::atomic<std::size_t> refs;
+    };
+
+private:
+    entry* m_entry; // nullptr represents the empty name
+
+    static entry* acquire(const char* data, std::size_t size);
+    static void release(entry* e);
+
+public:
+    InternedName()
+        : m_entry{nullptr}
+    {
+    }
+
+    explicit InternedName(const std::string& str)
+        : m_entry{acquire(str.data(), str.size())}
+    {
+    }
+
+    InternedName(const char* data, std::size_t size)
+        : m_entry{acquire(data, size)}
+    {
+    }
+
+    InternedName(const InternedName& other)
+        : m_entry{other.m_entry}
+    {
+        if (m_entry) {
+            m_entry->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    InternedName(InternedName&& other)
+        : m_entry{other.m_entry}
+    {
+        other.m_entry = nullptr;
+    }
+
+    ~InternedName()
+    {
+        release(m_entry);
+    }
+
+    InternedName& operator= (const InternedName& rhs)
+    {
+        InternedName tmp{rhs};
+        std::swap(m_entry, tmp.m_entry);
+        return *this;
+    }
+
+    InternedName& operator= (InternedName&& rhs)
+    {
+        std::swap(m_entry, rhs.m_entry);
+        return *this;
+    }
+
+    /**
+     * Returns the name as a string
+     *
+     * The returned reference stays valid as long as the handle exists.
+     *
+     * @return The name
+     */
+    const std::string& str() const;
+
+    /**
+     * Returns the precomputed hash of the name
+     *
+     * @return Hash of the name
+     */
+    std::size_t hash() const
+    {
+        return m_entry ? m_entry->hash : 0;
+    }
+
+    bool operator== (const InternedName& rhs) const
+    {
+        return m_entry == rhs.m_entry;
+    }
+
+    bool operator!= (const InternedName& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    /**
+     * Returns the number of distinct names currently stored in the table
+     *
+     * @return Number of interned names
+     */
+    static std::size_t table_size();
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_INTERNEDNAME_HPP
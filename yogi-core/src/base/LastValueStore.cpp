@@ -0,0 +1,364 @@
+#include "LastValueStore.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <cstring>
+#include <cstdint>
+
+
+namespace yogi {
+namespace base {
+namespace {
+
+const char FILE_HEADER[8] = {'Y', 'O', 'G', 'I', 'L', 'V', 'S', '1'};
+
+// record layout: key size, value size and checksum as 32 bit numbers in native
+// byte order, followed by the key and the value
+const std::size_t RECORD_HEADER_SIZE = 3 * sizeof(std::uint32_t);
+
+std::uint32_t checksum(const char* key, std::size_t keySize, const char* data,
+    std::size_t size)
+{
+    std::uint32_t hash = 2166136261u;
+    for (auto block : {std::make_pair(key, keySize),
+        std::make_pair(data, size)}) {
+        for (std::size_t i = 0; i < block.second; ++i) {
+            hash = (hash ^ static_cast<unsigned char>(block.first[i]))
+                * 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+} // anonymous namespace
+
+void LastValueStore::append_record(std::vector<char>& buffer,
+    const std::string& key, const char* data, std::size_t size)
+{
+    std::uint32_t header[] = {
+        static_cast<std::uint32_t>(key.size()),
+        static_cast<std::uint32_t>(size),
+        checksum(key.data(), key.size(), data, size)
+    };
+
+    auto headerBytes = reinterpret_cast<const char*>(header);
+    buffer.insert(buffer.end(), headerBytes, headerBytes + sizeof(header));
+    buffer.insert(buffer.end(), key.begin(), key.end());
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+std::size_t LastValueStore::record_size(std::size_t keySize,
+    std::size_t dataSize)
+{
+    return RECORD_HEADER_SIZE + keySize + dataSize;
+}
+
+const LastValueStore::snapshot_index& LastValueStore::snapshot()
+{
+    std::call_once(m_snapshotScanned, [&] { scan_snapshot(); });
+    return m_snapshot;
+}
+
+void LastValueStore::scan_snapshot()
+{
+    m_snapshotValidSize = 0;
+
+    auto begin = static_cast<const char*>(m_region.get_address());
+    auto size  = m_region.get_size();
+    if (!begin || size < sizeof(FILE_HEADER)
+        || std::memcmp(begin, FILE_HEADER, sizeof(FILE_HEADER))) {
+        return;
+    }
+
+    std::size_t pos = sizeof(FILE_HEADER);
+    while (size - pos >= RECORD_HEADER_SIZE) {
+        std::uint32_t header[3];
+        std::memcpy(header, begin + pos, sizeof(header));
+
+        auto keySize  = static_cast<std::size_t>(header[0]);
+        auto dataSize = static_cast<std::size_t>(header[1]);
+        if (size - pos - RECORD_HEADER_SIZE < keySize
+            || size - pos - RECORD_HEADER_SIZE - keySize < dataSize) {
+            break;
+        }
+
+        auto key  = begin + pos + RECORD_HEADER_SIZE;
+        auto data = key + keySize;
+        if (checksum(key, keySize, data, dataSize) != header[2]) {
+            break;
+        }
+
+        m_snapshot[std::string(key, keySize)] = stored_value{data, dataSize,
+            record_size(keySize, dataSize)};
+        pos += record_size(keySize, dataSize);
+    }
+
+    m_snapshotValidSize = pos;
+}
+
+void LastValueStore::thread_fn()
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (!m_stopRequested) {
+        m_cv.wait(lock, [&] { return m_dirty || m_stopRequested; });
+        if (m_stopRequested) {
+            break;
+        }
+
+        // let changes accumulate so that each key gets written at most once
+        // per interval
+        m_cv.wait_for(lock, m_flushInterval, [&] { return m_stopRequested; });
+
+        lock.unlock();
+        write_pending();
+        lock.lock();
+    }
+}
+
+void LastValueStore::write_pending()
+{
+    std::lock_guard<std::mutex> fileLock{m_fileMutex};
+
+    // the file gets rewritten if it is new or has a broken record at the end,
+    // since records appended after that would not be found when scanning
+    if (!m_fileChecked) {
+        if (m_records.empty()) {
+            auto begin = static_cast<const char*>(m_region.get_address());
+            for (auto& value : snapshot()) {
+                auto end = value.second.data + value.second.size;
+                set_record(value.first, record_location{
+                    static_cast<std::size_t>(end - begin)
+                        - value.second.recordSize, value.second.recordSize});
+            }
+        }
+
+        if (m_fileSize == 0 || m_fileSize != m_snapshotValidSize) {
+            if (!compact()) {
+                return;
+            }
+        }
+
+        m_fileChecked = true;
+    }
+
+    if (!m_file) {
+        return;
+    }
+
+    // only swap the changed values out so that put() does not have to wait
+    // while they are being serialized and written
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_writing.swap(m_pending);
+        m_dirty = false;
+    }
+
+    if (m_writing.empty()) {
+        return;
+    }
+
+    m_writeBuffer.clear();
+    for (auto& value : m_writing) {
+        auto offset = m_fileSize + m_writeBuffer.size();
+        append_record(m_writeBuffer, value.first, value.second.data(),
+            value.second.size());
+        set_record(value.first, record_location{offset,
+            m_fileSize + m_writeBuffer.size() - offset});
+    }
+
+    m_writing.clear();
+
+    if (std::fwrite(m_writeBuffer.data(), 1, m_writeBuffer.size(), m_file)
+        != m_writeBuffer.size() || std::fflush(m_file)) {
+        BOOST_LOG_TRIVIAL(error) << "Writing to last value store " << m_path
+            << " failed";
+    }
+
+    m_fileSize += m_writeBuffer.size();
+
+    if (m_fileSize >= MIN_COMPACTION_SIZE
+        && m_fileSize > COMPACTION_FACTOR * m_liveBytes) {
+        compact();
+    }
+}
+
+void LastValueStore::set_record(const std::string& key,
+    record_location location)
+{
+    auto& record = m_records[key];
+    m_liveBytes  = m_liveBytes - record.size + location.size;
+    record       = location;
+}
+
+bool LastValueStore::compact()
+{
+    // the live records get copied from the current file; the mapped snapshot
+    // refers to the old file which stays intact until the mapping gets closed
+    auto tmpPath = m_path + ".tmp";
+    auto source  = std::fopen(m_path.c_str(), "rb");
+    auto file    = std::fopen(tmpPath.c_str(), "wb");
+
+    record_index records;
+    std::size_t size = sizeof(FILE_HEADER);
+    bool ok = source && file
+        && std::fwrite(FILE_HEADER, 1, sizeof(FILE_HEADER), file)
+            == sizeof(FILE_HEADER);
+    for (auto it = m_records.begin(); ok && it != m_records.end(); ++it) {
+        m_writeBuffer.resize(it->second.size);
+        ok = !std::fseek(source, static_cast<long>(it->second.offset),
+                SEEK_SET)
+            && std::fread(m_writeBuffer.data(), 1, m_writeBuffer.size(), source)
+                == m_writeBuffer.size()
+            && std::fwrite(m_writeBuffer.data(), 1, m_writeBuffer.size(), file)
+                == m_writeBuffer.size();
+
+        records[it->first] = record_location{size, it->second.size};
+        size += it->second.size;
+    }
+
+    if (source) {
+        std::fclose(source);
+    }
+
+    if (file) {
+        ok = !std::fclose(file) && ok;
+    }
+
+    boost::system::error_code ec;
+    if (ok) {
+        boost::filesystem::rename(tmpPath, m_path, ec);
+        ok = !ec;
+    }
+
+    if (!ok) {
+        BOOST_LOG_TRIVIAL(error) << "Compacting last value store " << m_path
+            << " failed";
+        boost::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+
+    if (m_file) {
+        std::fclose(m_file);
+    }
+
+    m_records.swap(records);
+    m_fileSize = size;
+
+    return open_for_appending();
+}
+
+bool LastValueStore::open_for_appending()
+{
+    m_file = std::fopen(m_path.c_str(), "ab");
+    if (!m_file) {
+        BOOST_LOG_TRIVIAL(error) << "Could not open last value store "
+            << m_path;
+        return false;
+    }
+
+    return true;
+}
+
+LastValueStore::LastValueStore(std::string path,
+    std::chrono::milliseconds flushInterval)
+    : m_path{std::move(path)}
+    , m_flushInterval{flushInterval}
+    , m_snapshotValidSize{0}
+    , m_dirty{false}
+    , m_stopRequested{false}
+    , m_file{nullptr}
+    , m_fileSize{0}
+    , m_fileChecked{false}
+    , m_liveBytes{sizeof(FILE_HEADER)}
+{
+    if (!open_for_appending()) {
+        throw api::ExceptionT<YOGI_ERR_CANNOT_OPEN_FILE>{};
+    }
+
+    boost::system::error_code ec;
+    m_fileSize = static_cast<std::size_t>(
+        boost::filesystem::file_size(m_path, ec));
+    if (ec) {
+        std::fclose(m_file);
+        throw api::ExceptionT<YOGI_ERR_CANNOT_OPEN_FILE>{};
+    }
+
+    if (m_fileSize > 0) {
+        try {
+            using namespace boost::interprocess;
+            file_mapping mapping{m_path.c_str(), read_only};
+            mapped_region region{mapping, read_only};
+            m_mapping.swap(mapping);
+            m_region.swap(region);
+        }
+        catch (const boost::interprocess::interprocess_exception&) {
+            std::fclose(m_file);
+            throw api::ExceptionT<YOGI_ERR_CANNOT_OPEN_FILE>{};
+        }
+    }
+
+    m_thread = std::thread(&LastValueStore::thread_fn, this);
+}
+
+LastValueStore::~LastValueStore()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stopRequested = true;
+    }
+
+    m_cv.notify_all();
+    m_thread.join();
+
+    write_pending();
+    if (m_file) {
+        std::fclose(m_file);
+    }
+}
+
+bool LastValueStore::find(const std::string& key, const char** data,
+    std::size_t* size)
+{
+    auto& index = snapshot();
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return false;
+    }
+
+    *data = it->second.data;
+    *size = it->second.size;
+    return true;
+}
+
+void LastValueStore::put(const std::string& key, const Buffer& data)
+{
+    bool notify;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_pending[key] = data;
+
+        notify  = !m_dirty;
+        m_dirty = true;
+    }
+
+    if (notify) {
+        m_cv.notify_all();
+    }
+}
+
+void LastValueStore::flush()
+{
+    write_pending();
+}
+
+std::size_t LastValueStore::file_size()
+{
+    std::lock_guard<std::mutex> fileLock{m_fileMutex};
+    return m_fileSize;
+}
+
+} // namespace base
+} // namespace yogi
@@ -0,0 +1,171 @@
+#ifndef YOGI_BASE_LASTVALUESTORE_HPP
+#define YOGI_BASE_LASTVALUESTORE_HPP
+
+#include "../config.h"
+#include "Buffer.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdio>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * File-backed store for the last value of a set of keys
+ *
+ * The file is a log of (key, value) records that only ever gets appended to.
+ * Values stored via put() are only copied into memory; a background thread
+ * appends the latest value of each changed key to the file once per flush
+ * interval, so callers never wait for the disk and keys that change faster
+ * than the flush interval only get written once per interval. Values only stay
+ * in memory until they have been written. Once the file grows to several times
+ * the size of its live records, it gets rewritten by copying just the live
+ * records from the old file.
+ *
+ * The file as it was when the store got opened is mapped into memory and
+ * find() returns pointers into that mapping. The file only gets scanned for
+ * its records when it is first needed, and pages only get read from the disk
+ * when they are accessed. Records that were cut short, for example by a crash
+ * while writing, are ignored.
+ *
+ * A file must not be used by more than one store at a time.
+ ******************************************************************************/
+class LastValueStore final
+{
+public:
+    // the file gets compacted once it is this many times larger than its
+    // live records and above the minimum size
+    enum {
+        COMPACTION_FACTOR   = 4,
+        MIN_COMPACTION_SIZE = 64 * 1024
+    };
+
+private:
+    struct stored_value
+    {
+        const char* data;
+        std::size_t size;
+        std::size_t recordSize;
+    };
+
+    struct record_location
+    {
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    typedef std::unordered_map<std::string, stored_value>    snapshot_index;
+    typedef std::unordered_map<std::string, Buffer>          value_map;
+    typedef std::unordered_map<std::string, record_location> record_index;
+
+    const std::string                         m_path;
+    const std::chrono::milliseconds           m_flushInterval;
+    boost::interprocess::file_mapping         m_mapping;
+    boost::interprocess::mapped_region        m_region;
+    std::once_flag                            m_snapshotScanned;
+    snapshot_index                            m_snapshot;
+    std::size_t                               m_snapshotValidSize;
+
+    std::mutex                                m_mutex;
+    std::condition_variable                   m_cv;
+    value_map                                 m_pending;
+    bool                                      m_dirty;
+    bool                                      m_stopRequested;
+
+    std::mutex                                m_fileMutex;
+    std::FILE*                                m_file;
+    std::size_t                               m_fileSize;
+    bool                                      m_fileChecked;
+    value_map                                 m_writing;
+    record_index                              m_records;
+    std::size_t                               m_liveBytes;
+    std::vector<char>                         m_writeBuffer;
+    std::thread                               m_thread;
+
+private:
+    static void append_record(std::vector<char>& buffer,
+        const std::string& key, const char* data, std::size_t size);
+    static std::size_t record_size(std::size_t keySize, std::size_t dataSize);
+
+    const snapshot_index& snapshot();
+    void scan_snapshot();
+    void thread_fn();
+    void write_pending();
+    void set_record(const std::string& key, record_location location);
+    bool compact();
+    bool open_for_appending();
+
+public:
+    /**
+     * Opens or creates the store file
+     *
+     * @param path          Path of the file
+     * @param flushInterval Time between writes of changed values to the file
+     */
+    LastValueStore(std::string path, std::chrono::milliseconds flushInterval
+        = std::chrono::milliseconds{100});
+
+    /**
+     * Writes the remaining changed values to the file and closes it
+     */
+    ~LastValueStore();
+
+    LastValueStore(const LastValueStore&) = delete;
+    LastValueStore& operator= (const LastValueStore&) = delete;
+
+    const std::string& path() const
+    {
+        return m_path;
+    }
+
+    /**
+     * Looks up the value a key had when the store got opened
+     *
+     * The returned data points into the mapped file and stays valid for the
+     * lifetime of the store. Values stored via put() are not visible here.
+     *
+     * @param key  Key to look up
+     * @param data Set to the start of the value
+     * @param size Set to the size of the value
+     *
+     * @return True if the key has been found
+     */
+    bool find(const std::string& key, const char** data, std::size_t* size);
+
+    /**
+     * Sets the value of a key
+     *
+     * Only copies the value; it gets written to the file asynchronously.
+     *
+     * @param key  Key to set
+     * @param data New value
+     */
+    void put(const std::string& key, const Buffer& data);
+
+    /**
+     * Writes all changed values to the file before returning
+     */
+    void flush();
+
+    /**
+     * Returns the current size of the file
+     *
+     * @return Size of the file in bytes
+     */
+    std::size_t file_size();
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_LASTVALUESTORE_HPP
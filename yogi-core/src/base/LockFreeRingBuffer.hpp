@@ -79,6 +79,13 @@ public:
         return wi == ri;
     }
 
+    std::size_t write_available() const
+    {
+        auto wi = m_writeIdx.load(std::memory_order_relaxed);
+        auto ri = m_readIdx.load(std::memory_order_acquire);
+        return write_available(wi, ri);
+    }
+
     bool full()
     {
         auto wi = m_writeIdx.load(std::memory_order_relaxed);
@@ -0,0 +1,150 @@
+#ifndef YOGI_BASE_MESSAGEHISTORY_HPP
+#define YOGI_BASE_MESSAGEHISTORY_HPP
+
+#include "../config.h"
+#include "Buffer.hpp"
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Ring of the most recent messages, limited by count and total size
+ *
+ * The ring has one slot per message it can hold. Slots are never freed while
+ * the limits stay the same: a new message gets copied into the slot of the
+ * message it evicts, re-using the memory that slot already holds, so that a
+ * history in its steady state does not allocate.
+ ******************************************************************************/
+class MessageHistory final
+{
+public:
+    typedef std::chrono::system_clock clock;
+
+private:
+    struct slot
+    {
+        Buffer            data;
+        clock::time_point time;
+    };
+
+    std::vector<slot> m_slots;
+    std::size_t       m_maxBytes = 0;
+    std::size_t       m_first    = 0;
+    std::size_t       m_size     = 0;
+    std::size_t       m_bytes    = 0;
+
+    slot& at(std::size_t idx)
+    {
+        return m_slots[(m_first + idx) % m_slots.size()];
+    }
+
+    const slot& at(std::size_t idx) const
+    {
+        return m_slots[(m_first + idx) % m_slots.size()];
+    }
+
+    void pop_front()
+    {
+        m_bytes -= at(0).data.size();
+        m_first = (m_first + 1) % m_slots.size();
+        --m_size;
+    }
+
+public:
+    // maxMessages == 0 disables the history; maxBytes == 0 means no size limit
+    void set_limits(std::size_t maxMessages, std::size_t maxBytes)
+    {
+        if (maxMessages == m_slots.size() && maxBytes == m_maxBytes) {
+            return;
+        }
+
+        std::vector<slot> slots(maxMessages);
+        std::size_t n = std::min(m_size, maxMessages);
+        for (std::size_t i = 0; i < n; ++i) {
+            slots[i] = std::move(at(m_size - n + i));
+        }
+
+        m_slots    = std::move(slots);
+        m_maxBytes = maxBytes;
+        m_first    = 0;
+        m_size     = n;
+        m_bytes    = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            m_bytes += m_slots[i].data.size();
+        }
+
+        while (m_maxBytes && m_bytes > m_maxBytes) {
+            pop_front();
+        }
+    }
+
+    bool enabled() const
+    {
+        return !m_slots.empty();
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    std::size_t bytes() const
+    {
+        return m_bytes;
+    }
+
+    // messages larger than the size limit empty the history
+    void push(const Buffer& data, clock::time_point time = clock::now())
+    {
+        if (!enabled()) {
+            return;
+        }
+
+        if (m_maxBytes && data.size() > m_maxBytes) {
+            m_first = m_size = m_bytes = 0;
+            return;
+        }
+
+        if (m_size == m_slots.size()) {
+            pop_front();
+        }
+
+        while (m_maxBytes && m_bytes + data.size() > m_maxBytes) {
+            pop_front();
+        }
+
+        auto& s = at(m_size);
+        s.data = data;
+        s.time = time;
+
+        m_bytes += data.size();
+        ++m_size;
+    }
+
+    // calls fn(data, time) for the most recent messages, oldest first, but at
+    // most maxMessages (0 for all) and only those not older than since
+    template <typename TFn>
+    void foreach_recent(std::size_t maxMessages, clock::time_point since,
+        TFn fn) const
+    {
+        std::size_t first = m_size;
+        while (first > 0 && (!maxMessages || m_size - first < maxMessages)
+            && at(first - 1).time >= since) {
+            --first;
+        }
+
+        for (std::size_t i = first; i < m_size; ++i) {
+            fn(at(i).data, at(i).time);
+        }
+    }
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_MESSAGEHISTORY_HPP
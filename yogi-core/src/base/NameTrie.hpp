@@ -0,0 +1,277 @@
+#ifndef YOGI_BASE_NAMETRIE_HPP
+#define YOGI_BASE_NAMETRIE_HPP
+
+#include "../config.h"
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <set>
+#include <utility>
+#include <algorithm>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Character trie mapping names to values that supports glob queries
+ *
+ * Multiple values can be stored under the same name. Queries use the glob
+ * syntax where '*' matches any (possibly empty) sequence of characters and '?'
+ * matches exactly one character. Since the names are stored in a trie, only
+ * the subtrees that can possibly match a pattern get visited, e.g. a query for
+ * "/sensors/temp*" only looks at names starting with "/sensors/temp".
+ *
+ * @tparam TValue Type of the stored values
+ ******************************************************************************/
+template <typename TValue>
+class NameTrie final
+{
+public:
+    typedef TValue value_type;
+
+private:
+    struct node {
+        std::vector<std::pair<char, std::unique_ptr<node>>> children;
+        std::vector<value_type>                             values;
+
+        node* child(char c) const
+        {
+            auto it = std::lower_bound(children.begin(), children.end(), c,
+                [](const std::pair<char, std::unique_ptr<node>>& child,
+                    char c) { return child.first < c; });
+            return it != children.end() && it->first == c
+                ? it->second.get() : nullptr;
+        }
+
+        node& add_child(char c)
+        {
+            auto it = std::lower_bound(children.begin(), children.end(), c,
+                [](const std::pair<char, std::unique_ptr<node>>& child,
+                    char c) { return child.first < c; });
+            if (it == children.end() || it->first != c) {
+                it = children.emplace(it, c, std::unique_ptr<node>(new node));
+            }
+
+            return *it->second;
+        }
+
+        void remove_child(char c)
+        {
+            children.erase(std::find_if(children.begin(), children.end(),
+                [=](const std::pair<char, std::unique_ptr<node>>& child) {
+                    return child.first == c;
+                }));
+        }
+
+        bool empty() const
+        {
+            return children.empty() && values.empty();
+        }
+    };
+
+    typedef std::set<std::pair<const node*, std::size_t>> visited_set;
+
+    node        m_root;
+    std::size_t m_size;
+
+private:
+    template <typename Fn>
+    static void match(const node& n, const std::string& pattern,
+        std::size_t pos, visited_set& visited, Fn& fn)
+    {
+        // with multiple '*' the same node can be reached in different ways
+        if (!visited.emplace(&n, pos).second) {
+            return;
+        }
+
+        if (pos == pattern.size()) {
+            for (auto& value : n.values) {
+                fn(value);
+            }
+
+            return;
+        }
+
+        switch (pattern[pos]) {
+        case '*':
+            match(n, pattern, pos + 1, visited, fn);
+            for (auto& child : n.children) {
+                match(*child.second, pattern, pos, visited, fn);
+            }
+            break;
+
+        case '?':
+            for (auto& child : n.children) {
+                match(*child.second, pattern, pos + 1, visited, fn);
+            }
+            break;
+
+        default:
+            if (auto child = n.child(pattern[pos])) {
+                match(*child, pattern, pos + 1, visited, fn);
+            }
+            break;
+        }
+    }
+
+    static bool erase(node& n, const std::string& name, std::size_t pos,
+        const value_type& value)
+    {
+        if (pos == name.size()) {
+            auto it = std::find(n.values.begin(), n.values.end(), value);
+            if (it == n.values.end()) {
+                return false;
+            }
+
+            n.values.erase(it);
+            return true;
+        }
+
+        auto child = n.child(name[pos]);
+        if (!child || !erase(*child, name, pos + 1, value)) {
+            return false;
+        }
+
+        if (child->empty()) {
+            n.remove_child(name[pos]);
+        }
+
+        return true;
+    }
+
+public:
+    NameTrie()
+        : m_size{0}
+    {
+    }
+
+    /**
+     * Checks whether a string contains any glob wildcards
+     *
+     * @param str String to check
+     * @return True if \p str contains a '*' or a '?'
+     */
+    static bool is_pattern(const std::string& str)
+    {
+        return str.find_first_of("*?") != std::string::npos;
+    }
+
+    /**
+     * Checks whether a single name matches a glob pattern
+     *
+     * @param pattern Glob pattern
+     * @param name    Name to check
+     * @return True if \p name matches \p pattern
+     */
+    static bool matches(const std::string& pattern, const std::string& name)
+    {
+        // classic greedy matching with backtracking to the last '*'
+        std::size_t p = 0;
+        std::size_t n = 0;
+        std::size_t starP = std::string::npos;
+        std::size_t starN = 0;
+
+        while (n < name.size()) {
+            if (p < pattern.size() && (pattern[p] == '?'
+                || (pattern[p] != '*' && pattern[p] == name[n]))) {
+                ++p;
+                ++n;
+            }
+            else if (p < pattern.size() && pattern[p] == '*') {
+                starP = p++;
+                starN = n;
+            }
+            else if (starP != std::string::npos) {
+                p = starP + 1;
+                n = ++starN;
+            }
+            else {
+                return false;
+            }
+        }
+
+        while (p < pattern.size() && pattern[p] == '*') {
+            ++p;
+        }
+
+        return p == pattern.size();
+    }
+
+    /**
+     * Adds a value under the given name
+     *
+     * @param name  Name to store the value under
+     * @param value The value
+     */
+    void insert(const std::string& name, const value_type& value)
+    {
+        node* n = &m_root;
+        for (char c : name) {
+            n = &n->add_child(c);
+        }
+
+        n->values.push_back(value);
+        ++m_size;
+    }
+
+    /**
+     * Removes a value stored under the given name
+     *
+     * Nodes that become unused are released.
+     *
+     * @param name  Name that the value is stored under
+     * @param value The value to remove
+     * @return True if the value has been found and removed
+     */
+    bool erase(const std::string& name, const value_type& value)
+    {
+        if (!erase(m_root, name, 0, value)) {
+            return false;
+        }
+
+        --m_size;
+        return true;
+    }
+
+    /**
+     * Removes all values and releases all nodes
+     */
+    void clear()
+    {
+        m_root.children.clear();
+        m_root.values.clear();
+        m_size = 0;
+    }
+
+    /**
+     * Returns the number of stored values
+     *
+     * @return Number of stored values
+     */
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Calls \p fn for every value whose name matches the given glob pattern
+     *
+     * The values must not be modified from within \p fn.
+     *
+     * @param pattern Glob pattern
+     * @param fn      Function to call with each matching value
+     */
+    template <typename Fn>
+    void find_matches(const std::string& pattern, Fn fn) const
+    {
+        visited_set visited;
+        match(m_root, pattern, 0, visited, fn);
+    }
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_NAMETRIE_HPP
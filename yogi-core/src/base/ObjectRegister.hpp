@@ -15,6 +15,10 @@ namespace base {
 /***************************************************************************//**
  * Manages a collection of elements that each have a unique ID
  *
+ * Erased elements are reset and their slots and IDs get re-used by subsequent
+ * insertions, so a register that has reached its peak size does not allocate
+ * memory anymore.
+ *
  * @tparam TData Type of the elements' data
  ******************************************************************************/
 template <typename TData>
@@ -24,7 +28,7 @@ public:
     typedef TData                  data_type;
     typedef Id                     id_type;
     typedef std::vector<data_type> lut_type;
-    typedef std::stack<id_type>    id_stack_type;
+    typedef std::stack<id_type, std::vector<id_type>> id_stack_type;
 
 private:
     lut_type      m_lut;
@@ -74,6 +78,17 @@ public:
         m_freeIds.push(id);
     }
 
+    // returns nullptr if the ID has never been handed out; for IDs that are
+    // currently not in use, the reset element gets returned
+    data_type* find_slot(id_type id)
+    {
+        if (!id.valid() || id.number() > m_lut.size()) {
+            return nullptr;
+        }
+
+        return &m_lut[id.number() - 1];
+    }
+
 #ifndef NDEBUG
     // This is not very efficient; use only for debugging
     std::size_t count(id_type id) const
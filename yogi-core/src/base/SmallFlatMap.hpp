@@ -0,0 +1,312 @@
+#ifndef YOGI_BASE_SMALLFLATMAP_HPP
+#define YOGI_BASE_SMALLFLATMAP_HPP
+
+#include "../config.h"
+
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <type_traits>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace yogi {
+namespace base {
+
+/***************************************************************************//**
+ * Compact associative container for a small number of elements
+ *
+ * The elements are kept sorted by key in a contiguous array. Up to N elements
+ * are stored inline without any heap allocation; larger maps spill over to a
+ * single heap buffer. Lookups use binary search.
+ *
+ * In contrast to std::unordered_map, inserting or erasing elements invalidates
+ * all iterators and references into the map.
+ *
+ * @tparam TKey   Type of the keys
+ * @tparam TValue Type of the mapped values
+ * @tparam N      Number of elements stored inline
+ ******************************************************************************/
+template <typename TKey, typename TValue, std::size_t N = 2>
+class SmallFlatMap final
+{
+    static_assert(N > 0, "At least one element must be stored inline");
+
+public:
+    typedef TKey                     key_type;
+    typedef TValue                   mapped_type;
+    typedef std::pair<TKey, TValue>  value_type;
+    typedef value_type*              iterator;
+    typedef const value_type*        const_iterator;
+    typedef std::size_t              size_type;
+
+private:
+    typedef typename std::aligned_storage<sizeof(value_type),
+        alignof(value_type)>::type storage_type;
+
+    value_type*   m_data;
+    std::uint32_t m_size;
+    std::uint32_t m_capacity;
+    storage_type  m_inline[N];
+
+private:
+    value_type* inline_data()
+    {
+        return reinterpret_cast<value_type*>(m_inline);
+    }
+
+    bool is_inline() const
+    {
+        return m_data == reinterpret_cast<const value_type*>(m_inline);
+    }
+
+    iterator lower_bound(const key_type& key)
+    {
+        return std::lower_bound(begin(), end(), key,
+            [](const value_type& val, const key_type& key) {
+                return std::less<key_type>{}(val.first, key);
+            });
+    }
+
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return const_cast<SmallFlatMap*>(this)->lower_bound(key);
+    }
+
+    void relocate(value_type* dest)
+    {
+        for (std::uint32_t i = 0; i < m_size; ++i) {
+            new (dest + i) value_type(std::move(m_data[i]));
+            m_data[i].~value_type();
+        }
+
+        if (!is_inline()) {
+            ::operator delete(m_data);
+        }
+
+        m_data = dest;
+    }
+
+    void grow()
+    {
+        auto capacity = m_capacity * 2;
+        relocate(static_cast<value_type*>(::operator new(capacity
+            * sizeof(value_type))));
+        m_capacity = capacity;
+    }
+
+    void shrink_to_inline()
+    {
+        relocate(inline_data());
+        m_capacity = N;
+    }
+
+    template <typename... TArgs>
+    iterator emplace_at(iterator pos, TArgs&&... args)
+    {
+        auto idx = pos - begin();
+        if (m_size == m_capacity) {
+            grow();
+        }
+
+        new (m_data + m_size) value_type(std::forward<TArgs>(args)...);
+        ++m_size;
+
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+
+public:
+    SmallFlatMap()
+        : m_data    {inline_data()}
+        , m_size    {0}
+        , m_capacity{N}
+    {
+    }
+
+    SmallFlatMap(const SmallFlatMap& other)
+        : SmallFlatMap()
+    {
+        *this = other;
+    }
+
+    SmallFlatMap(SmallFlatMap&& other)
+        : SmallFlatMap()
+    {
+        *this = std::move(other);
+    }
+
+    ~SmallFlatMap()
+    {
+        clear();
+    }
+
+    SmallFlatMap& operator= (const SmallFlatMap& rhs)
+    {
+        if (this != &rhs) {
+            clear();
+            while (m_capacity < rhs.m_size) {
+                grow();
+            }
+
+            for (auto& val : rhs) {
+                new (m_data + m_size) value_type(val);
+                ++m_size;
+            }
+        }
+
+        return *this;
+    }
+
+    SmallFlatMap& operator= (SmallFlatMap&& rhs)
+    {
+        if (this != &rhs) {
+            clear();
+
+            if (rhs.is_inline()) {
+                for (auto& val : rhs) {
+                    new (m_data + m_size) value_type(std::move(val));
+                    ++m_size;
+                }
+
+                rhs.clear();
+            }
+            else {
+                m_data     = rhs.m_data;
+                m_size     = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+
+                rhs.m_data     = rhs.inline_data();
+                rhs.m_size     = 0;
+                rhs.m_capacity = N;
+            }
+        }
+
+        return *this;
+    }
+
+    iterator begin()
+    {
+        return m_data;
+    }
+
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+
+    iterator end()
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    iterator find(const key_type& key)
+    {
+        auto it = lower_bound(key);
+        return it != end() && it->first == key ? it : end();
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        auto it = lower_bound(key);
+        return it != end() && it->first == key ? it : end();
+    }
+
+    size_type count(const key_type& key) const
+    {
+        return find(key) == end() ? 0 : 1;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& val)
+    {
+        auto it = lower_bound(val.first);
+        if (it != end() && it->first == val.first) {
+            return std::make_pair(it, false);
+        }
+
+        return std::make_pair(emplace_at(it, val), true);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& val)
+    {
+        auto it = lower_bound(val.first);
+        if (it != end() && it->first == val.first) {
+            return std::make_pair(it, false);
+        }
+
+        return std::make_pair(emplace_at(it, std::move(val)), true);
+    }
+
+    mapped_type& operator[] (const key_type& key)
+    {
+        auto it = lower_bound(key);
+        if (it == end() || it->first != key) {
+            it = emplace_at(it, key, mapped_type{});
+        }
+
+        return it->second;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        auto idx = pos - begin();
+        auto it  = begin() + idx;
+        std::move(it + 1, end(), it);
+        m_data[--m_size].~value_type();
+
+        // give the heap buffer back once the elements fit inline again
+        if (!is_inline() && m_size <= N) {
+            shrink_to_inline();
+        }
+
+        return begin() + idx;
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+
+        erase(it);
+        return 1;
+    }
+
+    void clear()
+    {
+        for (auto& val : *this) {
+            val.~value_type();
+        }
+
+        m_size = 0;
+
+        if (!is_inline()) {
+            ::operator delete(m_data);
+            m_data     = inline_data();
+            m_capacity = N;
+        }
+    }
+};
+
+} // namespace base
+} // namespace yogi
+
+#endif // YOGI_BASE_SMALLFLATMAP_HPP
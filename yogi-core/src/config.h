@@ -25,15 +25,23 @@
 #endif
 
 // Constants, limits and defaults
-#define YOGI_VERSION                            "0.0.2-alpha"
+#define YOGI_VERSION                            "0.1.0-alpha"
+#define YOGI_MIN_MULTIPLEXING_VERSION           "0.1.0"
 #define YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE     1000
 #define YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE 1
+#define YOGI_MIN_WORK_STEALING_IDLE_WAIT_US     200
+#define YOGI_MAX_WORK_STEALING_IDLE_WAIT_US     1000
+#define YOGI_DEFAULT_BUSY_POLL_SPIN_US          100
+#define YOGI_MIN_AUTO_SCALING_PROBE_INTERVAL_US 1000
+#define YOGI_AUTO_SCALING_GROW_PROBES           3
 #define YOGI_TCP_ACCEPTOR_BACKLOG               5
 #define YOGI_MAX_TCP_IDENTIFICATION_SIZE        16 * 1024
 #define YOGI_VERSION_INFO_SIZE                  20
 #define YOGI_DEFAULT_TCP_PORT                   41772
 #define YOGI_RING_BUFFER_SIZE                   64 * 1024 - 1
 #define YOGI_CACHELINE_SIZE                     64
+#define YOGI_KNOWN_TERMINALS_HISTORY_SIZE       4096
+#define YOGI_MAX_PRODUCER_CONSUMER_BACKLOG      1024
 
 // Debug & development macros
 #ifndef NDEBUG
@@ -2,6 +2,7 @@
 
 #include "../../core/Node.hpp"
 #include "../../core/Leaf.hpp"
+#include "../../base/AsyncOperation.hpp"
 
 #include <boost/log/trivial.hpp>
 
@@ -36,6 +37,19 @@ void LocalConnection::Proxy::send(const interfaces::IMessage& msg)
     m_connection.post_msg(msg, m_channel);
 }
 
+void LocalConnection::Proxy::async_send(const interfaces::IMessage& msg,
+    send_handler_fn handlerFn)
+{
+    m_connection.post_msg(msg, m_channel);
+
+    // posting never blocks, so the message has already been handed over
+    m_channel.sender->receiver->scheduler().post(
+        scheduling::SchedulerStatistics::DISPATCH, [=] {
+            base::internal::dispatch_user_handler(nullptr, handlerFn, [] {},
+                api::ExceptionT<YOGI_OK>{});
+        });
+}
+
 bool LocalConnection::Proxy::remote_is_node() const
 {
     return m_connection.remote_is_node(m_channel);
@@ -91,6 +105,9 @@ void LocalConnection::deliver_msg(const interfaces::message_ptr& msg,
     }
 
     try {
+        scheduling::SchedulerStatistics::scoped_measurement measurement{
+            scheduling::SchedulerStatistics::DISPATCH};
+
         channel.receiver->on_message_received(std::move(*msg),
             *channel.proxy);
     }
@@ -51,6 +51,8 @@ private:
         Proxy(LocalConnection& connection, channel_data& channel);
 
         virtual void send(const interfaces::IMessage& msg) override;
+        virtual void async_send(const interfaces::IMessage& msg,
+            send_handler_fn handlerFn) override;
         virtual bool remote_is_node() const override;
         virtual const std::string& description() const override;
 		virtual const std::string& remote_version() const override;
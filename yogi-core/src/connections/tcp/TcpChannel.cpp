@@ -0,0 +1,123 @@
+#include "TcpChannel.hpp"
+
+#include <boost/log/trivial.hpp>
+
+
+namespace yogi {
+namespace connections {
+namespace tcp {
+
+TcpChannel::TcpChannel(TcpConnection& connection, std::size_t id,
+    interfaces::ICommunicator& communicator, bool remoteIsNode)
+    : m_connection  {connection}
+    , m_communicator{communicator.make_ptr<interfaces::ICommunicator>()}
+    , m_id          {id}
+    , m_description {make_description(connection, id)}
+    , m_ready       {true}
+    , m_remoteIsNode{remoteIsNode}
+    , m_openSent    {true}
+    , m_open        {true}
+{
+    BOOST_LOG_TRIVIAL(info) << m_description << " opened by the remote end";
+}
+
+std::string TcpChannel::make_description(const TcpConnection& connection,
+    std::size_t id)
+{
+    return connection.description() + " (channel " + std::to_string(id) + ")";
+}
+
+TcpChannel::TcpChannel(TcpConnection& connection,
+    interfaces::ICommunicator& communicator)
+    : m_connectionPtr{connection.make_ptr<TcpConnection>()}
+    , m_connection   {connection}
+    , m_communicator {communicator.make_ptr<interfaces::ICommunicator>()}
+    , m_id           {0}
+    , m_ready        {false}
+    , m_remoteIsNode {false}
+    , m_openSent     {false}
+    , m_open         {false}
+{
+    m_connection.open_channel(*this);
+}
+
+TcpChannel::~TcpChannel()
+{
+    // channels opened by the remote end get closed by the connection
+    if (!m_connectionPtr) {
+        return;
+    }
+
+    cancel_await_death();
+    m_awaitDeathOp.await_idle();
+
+    // refused channels have already been disconnected
+    if (m_connection.close_channel(*this)) {
+        m_communicator->on_connection_destroyed(*this);
+    }
+}
+
+std::size_t TcpChannel::id() const
+{
+    return m_id;
+}
+
+void TcpChannel::async_await_death(error_handler_fn handlerFn)
+{
+    m_connection.await_channel_death(*this, handlerFn);
+}
+
+void TcpChannel::cancel_await_death()
+{
+    m_connection.cancel_await_channel_death(*this);
+}
+
+void TcpChannel::send(const interfaces::IMessage& msg)
+{
+    m_connection.send(m_id, msg);
+}
+
+bool TcpChannel::try_send(const interfaces::IMessage& msg)
+{
+    return m_connection.try_send(m_id, msg);
+}
+
+void TcpChannel::async_send(const interfaces::IMessage& msg,
+    send_handler_fn handlerFn)
+{
+    m_connection.async_send(m_id, msg, handlerFn);
+}
+
+void TcpChannel::send_batch(
+    const std::vector<const interfaces::IMessage*>& msgs)
+{
+    m_connection.send_batch(m_id, msgs);
+}
+
+bool TcpChannel::remote_is_node() const
+{
+    if (!m_ready) {
+        throw api::ExceptionT<YOGI_ERR_NOT_READY>{};
+    }
+
+    return m_remoteIsNode;
+}
+
+const std::string& TcpChannel::description() const
+{
+    return m_description;
+}
+
+const std::string& TcpChannel::remote_version() const
+{
+    return m_connection.remote_version();
+}
+
+const std::vector<char>& TcpChannel::remote_identification() const
+{
+    return m_connection.remote_identification();
+}
+
+} // namespace tcp
+} // namespace connections
+} // namespace yogi
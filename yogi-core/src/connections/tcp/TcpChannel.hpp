@@ -0,0 +1,78 @@
+#ifndef YOGI_CONNECTIONS_TCP_TCPCHANNEL_HPP
+#define YOGI_CONNECTIONS_TCP_TCPCHANNEL_HPP
+
+#include "../../config.h"
+#include "../../interfaces/IConnection.hpp"
+#include "../../interfaces/ICommunicator.hpp"
+#include "../../base/AsyncOperation.hpp"
+#include "TcpConnection.hpp"
+
+#include <atomic>
+
+
+namespace yogi {
+namespace connections {
+namespace tcp {
+
+/***************************************************************************//**
+ * Connects a single leaf or node over a multiplexed TcpConnection
+ *
+ * Channels created through the public constructor get opened by the local
+ * end; they keep the connection alive and close the channel when they get
+ * destroyed. If the remote end refuses such a channel, it gets disconnected
+ * from its leaf or node and its death is reported with
+ * YOGI_ERR_CONNECTION_REFUSED. Channels opened by the remote end are owned by
+ * the connection.
+ ******************************************************************************/
+class TcpChannel : public interfaces::IConnection
+{
+    friend class TcpConnection;
+
+    typedef std::function<void (const api::Exception&)> error_handler_fn;
+
+private:
+    const tcp_connection_ptr     m_connectionPtr;
+    TcpConnection&               m_connection;
+    interfaces::communicator_ptr m_communicator;
+    std::size_t                  m_id;
+    std::string                  m_description;
+    std::atomic<bool>            m_ready;
+    std::atomic<bool>            m_remoteIsNode;
+    // guarded by the connection
+    bool                         m_openSent;
+    bool                         m_open;
+    base::AsyncOperation<error_handler_fn> m_awaitDeathOp;
+
+private:
+    TcpChannel(TcpConnection& connection, std::size_t id,
+        interfaces::ICommunicator& communicator, bool remoteIsNode);
+
+    static std::string make_description(const TcpConnection& connection,
+        std::size_t id);
+
+public:
+    TcpChannel(TcpConnection& connection,
+        interfaces::ICommunicator& communicator);
+    virtual ~TcpChannel();
+
+    std::size_t id() const;
+    void async_await_death(error_handler_fn handlerFn);
+    void cancel_await_death();
+
+    virtual void send(const interfaces::IMessage& msg) override;
+    virtual bool try_send(const interfaces::IMessage& msg) override;
+    virtual void async_send(const interfaces::IMessage& msg,
+        send_handler_fn handlerFn) override;
+    virtual void send_batch(const std::vector<const interfaces::IMessage*>&
+        msgs) override;
+    virtual bool remote_is_node() const override;
+    virtual const std::string& description() const override;
+    virtual const std::string& remote_version() const override;
+    virtual const std::vector<char>& remote_identification() const override;
+};
+
+} // namespace tcp
+} // namespace connections
+} // namespace yogi
+
+#endif // YOGI_CONNECTIONS_TCP_TCPCHANNEL_HPP
@@ -115,8 +115,8 @@ TcpClient::TcpClient(interfaces::IScheduler & scheduler,
     identification_buffer identification)
     : super      {scheduler, identification}
     , m_scheduler{scheduler.make_ptr<interfaces::IScheduler>()}
-    , m_resolver {scheduler.io_service()}
-    , m_socket   {scheduler.io_service()}
+    , m_resolver {super::io_service()}
+    , m_socket   {super::io_service()}
 {
 }
 
@@ -136,7 +136,7 @@ void TcpClient::async_connect(std::string host, unsigned short port,
 
     m_connectOp.arm(handlerFn);
 
-    m_socket = boost::asio::ip::tcp::socket{m_scheduler->io_service()};
+    m_socket = boost::asio::ip::tcp::socket{super::io_service()};
     m_handshakeTimeout = handShakeTimeout;
     m_shakingHands = false;
     m_canceled = false;
@@ -1,4 +1,5 @@
 #include "TcpConnection.hpp"
+#include "TcpChannel.hpp"
 #include "../../interfaces/INode.hpp"
 #include "../../yogi_core.h"
 #include "../../serialization/serialize.hpp"
@@ -12,13 +13,29 @@
 
 #include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
+#include <boost/version.hpp>
 
 #include <thread>
+#include <tuple>
+#include <cstdio>
 
 
 namespace yogi {
 namespace connections {
 namespace tcp {
+namespace {
+
+std::tuple<unsigned, unsigned, unsigned> parse_version(
+    const std::string& version)
+{
+    unsigned major = 0, minor = 0, patch = 0;
+    std::sscanf(version.c_str(), "%u.%u.%u", &major, &minor, &patch);
+    return std::make_tuple(major, minor, patch);
+}
+
+} // anonymous namespace
+
+const std::size_t TcpConnection::CONTROL_CHANNEL;
 
 std::string TcpConnection::make_description(
     const boost::asio::ip::tcp::socket& s)
@@ -42,18 +59,29 @@ void TcpConnection::die(const boost::system::error_code& ec, bool* runningFlag)
 
     if (m_alive) {
         m_alive = false;
+        fail_pending_sends();
 
         if (ec == boost::asio::error::eof) {
-            m_awaitDeathOp.fire<YOGI_ERR_CONNECTION_CLOSED>();
+            fire_await_death<YOGI_ERR_CONNECTION_CLOSED>();
         }
         else {
-            m_awaitDeathOp.fire<YOGI_ERR_SOCKET_BROKEN>();
+            fire_await_death<YOGI_ERR_SOCKET_BROKEN>();
         }
     }
 
     m_cv.notify_all();
 }
 
+template <int TErrorCode>
+void TcpConnection::fire_await_death()
+{
+    m_awaitDeathOp.fire<TErrorCode>();
+
+    for (auto& entry : m_channels) {
+        entry.second->m_awaitDeathOp.fire<TErrorCode>();
+    }
+}
+
 void TcpConnection::done(bool* runningFlag)
 {
     YOGI_ASSERT(*runningFlag);
@@ -61,10 +89,130 @@ void TcpConnection::done(bool* runningFlag)
     m_cv.notify_all();
 }
 
+TcpConnection::communicator_type TcpConnection::get_communicator_type(
+    const interfaces::ICommunicator& communicator)
+{
+    return dynamic_cast<const interfaces::INode*>(&communicator)
+        ? COMMUNICATOR_NODE : COMMUNICATOR_LEAF;
+}
+
+interfaces::IScheduler& TcpConnection::deserialization_scheduler()
+{
+    // a multiplexing connection has no communicator of its own
+    return m_communicator ? m_communicator->scheduler() : *m_scheduler;
+}
+
+void TcpConnection::append_serialized_message(std::vector<char>* buffer,
+    std::size_t channel, const interfaces::IMessage& msg)
+{
+    // the size precedes the frame, so the frame gets serialized on its own
+    std::vector<char> frame;
+    if (m_multiplexed) {
+        serialization::serialize(frame, channel);
+    }
+
+    serialization::serialize(frame, msg.type_id());
+    msg.serialize(frame);
+
+    serialization::serialize(*buffer, frame.size());
+    buffer->insert(buffer->end(), frame.begin(), frame.end());
+}
+
+void TcpConnection::write_frames(std::unique_lock<std::recursive_mutex>& lock,
+    const std::vector<char>& data)
+{
+    // keep the order of messages queued via async_send()
+    m_cv.wait(lock, [&] {
+        return !m_alive || (!m_writingFrames && m_pendingSends.empty());
+    });
+
+    if (!m_alive) {
+        return;
+    }
+
+    // the lock gets released while waiting for space in the out buffer, so
+    // nobody else must write to it until all of the data has been written
+    m_writingFrames = true;
+
+    auto it = data.cbegin();
+    m_cv.wait(lock, [&] {
+        if (m_alive) {
+            auto end = m_outBuffer.write(it, data.cend());
+            if (end != it) {
+                it = end;
+                start_async_send_some_data();
+            }
+        }
+
+        return !m_alive || it == data.cend();
+    });
+
+    m_writingFrames = false;
+    m_cv.notify_all();
+
+    if (m_alive) {
+        write_pending_sends();
+    }
+}
+
+void TcpConnection::post_send_handler(send_handler_fn handlerFn,
+    const api::Exception& e)
+{
+    // control frames are queued without a handler
+    if (!handlerFn) {
+        return;
+    }
+
+    m_scheduler->post(scheduling::SchedulerStatistics::DISPATCH, [=] {
+        base::internal::dispatch_user_handler(nullptr, handlerFn, [] {},
+            api::Exception{e});
+    });
+}
+
+void TcpConnection::write_pending_sends()
+{
+    // a frame written by send() or send_batch() must not get interrupted
+    if (m_writingFrames) {
+        return;
+    }
+
+    bool dataWritten = false;
+    while (!m_pendingSends.empty()) {
+        auto& ps = m_pendingSends.front();
+        auto it = m_outBuffer.write(ps.data.cbegin() + ps.bytesWritten,
+            ps.data.cend());
+
+        auto n = static_cast<std::size_t>(it - ps.data.cbegin());
+        dataWritten |= n != ps.bytesWritten;
+        ps.bytesWritten = n;
+
+        if (ps.bytesWritten < ps.data.size()) {
+            break;
+        }
+
+        post_send_handler(std::move(ps.handlerFn), api::ExceptionT<YOGI_OK>{});
+        m_pendingSends.pop_front();
+    }
+
+    if (dataWritten) {
+        start_async_send_some_data();
+    }
+}
+
+void TcpConnection::fail_pending_sends()
+{
+    for (auto& ps : m_pendingSends) {
+        post_send_handler(std::move(ps.handlerFn),
+            api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>{});
+    }
+
+    m_pendingSends.clear();
+}
+
 void TcpConnection::start_send_communicator_type()
 {
-    auto data = std::make_shared<char>(
-        std::dynamic_pointer_cast<interfaces::INode>(m_communicator) ? 1 : 0);
+    auto data = std::make_shared<char>(m_communicator
+        ? get_communicator_type(*m_communicator) : COMMUNICATOR_MULTIPLEXER);
 
     use_socket([&](auto& socket) {
         boost::asio::async_write(socket, boost::asio::buffer(data.get(), 1),
@@ -112,13 +260,36 @@ void TcpConnection::on_receive_communicator_type_completed(
         std::unique_lock<std::mutex> rcvLock{m_receiveMutex};
         std::lock_guard<std::recursive_mutex> lock{m_mutex};
 
-        m_remoteIsNode = *data ? true : false;
+        if (*data == COMMUNICATOR_MULTIPLEXER) {
+            m_multiplexed  = true;
+            m_remoteIsNode = false;
+        }
+        else if (*data == COMMUNICATOR_LEAF || *data == COMMUNICATOR_NODE) {
+            m_remoteIsNode = *data == COMMUNICATOR_NODE;
+        }
+        else {
+            BOOST_LOG_TRIVIAL(error) << m_description << ": Received unknown "
+                "communicator type " << static_cast<int>(*data);
+            die(boost::asio::error::invalid_argument, &m_preMessagingRunning);
+            return;
+        }
+
         m_ready = true;
 
-        if (m_communicator) {
+        // with multiplexing, only the channels get started
+        if (m_communicator && !m_multiplexed) {
             m_communicator->on_connection_started(*this);
         }
 
+        // channels opened before the communicator types have been exchanged
+        for (auto& entry : m_channels) {
+            if (!entry.second->m_openSent) {
+                queue_control_frame(CONTROL_OPEN_CHANNEL, entry.first,
+                    get_communicator_type(*entry.second->m_communicator));
+                entry.second->m_openSent = true;
+            }
+        }
+
         start_async_receive_some_data();
 
         done(&m_preMessagingRunning);
@@ -150,6 +321,9 @@ void TcpConnection::start_async_receive_some_data()
 void TcpConnection::on_receive_some_data_completed(
     const boost::system::error_code& ec, std::size_t bytesReceived)
 {
+    scheduling::SchedulerStatistics::scoped_measurement measurement{
+        scheduling::SchedulerStatistics::TCP_RECEIVE};
+
     if (!ec) {
         std::lock_guard<std::mutex> lock{m_receiveMutex};
 
@@ -202,6 +376,8 @@ void TcpConnection::on_send_some_data_completed(
         m_heartbeatsSinceLastSend = 0;
 
         m_outBuffer.commit_first_read_array(bytesSent);
+        write_pending_sends();
+
         if (m_outBuffer.empty()) {
             done(&m_sendSomeDataRunning);
         }
@@ -222,9 +398,10 @@ void TcpConnection::start_async_deserialization()
         return;
     }
 
-    m_communicator->scheduler().post([&] {
-        deserialize();
-    });
+    deserialization_scheduler().post(
+        scheduling::SchedulerStatistics::DESERIALIZE, [&] {
+            deserialize();
+        });
 
     m_deserializeRunning = true;
 }
@@ -288,17 +465,260 @@ void TcpConnection::wait_for_more_data_to_deserialize()
 
 void TcpConnection::deserialize_message_and_forward_to_communicator()
 {
+    auto it = m_tmpInBuffer.cbegin();
+
+    std::size_t channel = CONTROL_CHANNEL;
+    if (m_multiplexed) {
+        it = serialization::deserialize(m_tmpInBuffer, it, channel);
+        if (channel == CONTROL_CHANNEL) {
+            on_control_frame_received(it);
+            return;
+        }
+    }
+
     interfaces::IMessage::id_type msgTypeId;
-    auto it = serialization::deserialize(m_tmpInBuffer, m_tmpInBuffer.begin(),
-        msgTypeId);
+    it = serialization::deserialize(m_tmpInBuffer, it, msgTypeId);
 
     std::lock_guard<std::mutex> lock{m_receiveMutex};
     if (m_alive) {
-        messaging::MessageRegister::deserialize_and_forward_message(msgTypeId,
-            m_tmpInBuffer, it, *m_communicator, *this);
+        scheduling::SchedulerStatistics::scoped_measurement measurement{
+            scheduling::SchedulerStatistics::DISPATCH};
+
+        if (!m_multiplexed) {
+            messaging::MessageRegister::deserialize_and_forward_message(
+                msgTypeId, m_tmpInBuffer, it, *m_communicator, *this);
+            return;
+        }
+
+        // messages for channels that have just been closed get dropped
+        auto entry = m_channels.find(channel);
+        if (entry != m_channels.end()) {
+            messaging::MessageRegister::deserialize_and_forward_message(
+                msgTypeId, m_tmpInBuffer, it, *entry->second->m_communicator,
+                *entry->second);
+        }
     }
 }
 
+void TcpConnection::on_control_frame_received(
+    std::vector<char>::const_iterator it)
+{
+    auto command = static_cast<control_command>(*it++);
+
+    std::size_t channel;
+    it = serialization::deserialize(m_tmpInBuffer, it, channel);
+
+    std::lock_guard<std::mutex> lock{m_receiveMutex};
+    if (!m_alive) {
+        return;
+    }
+
+    switch (command) {
+    case CONTROL_OPEN_CHANNEL:
+        on_open_channel_received(channel, *it == COMMUNICATOR_NODE);
+        break;
+
+    case CONTROL_CLOSE_CHANNEL:
+        on_close_channel_received(channel);
+        break;
+
+    default:
+        BOOST_LOG_TRIVIAL(error) << m_description << ": Received unknown "
+            "control command " << static_cast<int>(command);
+        break;
+    }
+}
+
+void TcpConnection::on_open_channel_received(std::size_t channel,
+    bool remoteIsNode)
+{
+    // confirmation of a channel that we opened
+    auto entry = m_channels.find(channel);
+    if (entry != m_channels.end()) {
+        auto& ch = *entry->second;
+        ch.m_remoteIsNode = remoteIsNode;
+        ch.m_ready = true;
+        ch.m_communicator->on_connection_started(ch);
+        return;
+    }
+
+    // the remote end opened a new channel
+    if (!m_communicator) {
+        BOOST_LOG_TRIVIAL(error) << m_description << ": Refusing channel "
+            << channel << " since the connection is multiplexing itself";
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        queue_control_frame(CONTROL_CLOSE_CHANNEL, channel);
+        return;
+    }
+
+    std::unique_ptr<TcpChannel> ch{new TcpChannel(*this, channel,
+        *m_communicator, remoteIsNode)};
+
+    try {
+        m_communicator->on_new_connection(*ch);
+    }
+    catch (const api::Exception& e) {
+        BOOST_LOG_TRIVIAL(error) << m_description << ": Refusing channel "
+            << channel << ": " << e.what();
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        queue_control_frame(CONTROL_CLOSE_CHANNEL, channel);
+        return;
+    }
+
+    // the confirmation has to be sent before any messages on the channel
+    {{
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        m_channels[channel] = ch.get();
+        queue_control_frame(CONTROL_OPEN_CHANNEL, channel,
+            get_communicator_type(*m_communicator));
+    }}
+
+    auto& chRef = *ch;
+    m_remoteChannels[channel] = std::move(ch);
+    m_communicator->on_connection_started(chRef);
+}
+
+void TcpConnection::on_close_channel_received(std::size_t channel)
+{
+    auto entry = m_remoteChannels.find(channel);
+    if (entry == m_remoteChannels.end()) {
+        on_channel_refused(channel);
+        return;
+    }
+
+    auto ch = std::move(entry->second);
+    m_remoteChannels.erase(entry);
+
+    {{
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        m_channels.erase(channel);
+    }}
+
+    m_communicator->on_connection_destroyed(*ch);
+}
+
+void TcpConnection::on_channel_refused(std::size_t channel)
+{
+    TcpChannel* ch;
+
+    // the channel cannot get destroyed meanwhile since closing it requires
+    // the receive mutex
+    {{
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        auto entry = m_channels.find(channel);
+        if (entry == m_channels.end()) {
+            return;
+        }
+
+        BOOST_LOG_TRIVIAL(error) << m_description << ": Remote end refused "
+            "channel " << channel;
+
+        ch = entry->second;
+        m_channels.erase(entry);
+        ch->m_open = false;
+        ch->m_awaitDeathOp.fire<YOGI_ERR_CONNECTION_REFUSED>();
+    }}
+
+    ch->m_communicator->on_connection_destroyed(*ch);
+}
+
+void TcpConnection::queue_control_frame(control_command command,
+    std::size_t channel, communicator_type type)
+{
+    std::vector<char> body;
+    serialization::serialize(body, CONTROL_CHANNEL);
+    body.push_back(command);
+    serialization::serialize(body, channel);
+    if (command == CONTROL_OPEN_CHANNEL) {
+        body.push_back(type);
+    }
+
+    // queued like an async_send() so that it keeps its place among the
+    // messages sent on the channels
+    pending_send ps{{}, 0, {}};
+    serialization::serialize(ps.data, body.size());
+    ps.data.insert(ps.data.end(), body.begin(), body.end());
+    m_pendingSends.push_back(std::move(ps));
+
+    write_pending_sends();
+}
+
+bool TcpConnection::remote_supports_multiplexing() const
+{
+    static auto minVersion = parse_version(YOGI_MIN_MULTIPLEXING_VERSION);
+    return parse_version(m_remoteVersion) >= minVersion;
+}
+
+void TcpConnection::open_channel(TcpChannel& channel)
+{
+    std::lock_guard<std::mutex> rcvLock{m_receiveMutex};
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+
+    if (m_communicator) {
+        throw api::ExceptionT<YOGI_ERR_ALREADY_ASSIGNED>{};
+    }
+
+    if (!m_multiplexed) {
+        throw api::ExceptionT<YOGI_ERR_NOT_MULTIPLEXED>{};
+    }
+
+    if (!m_alive) {
+        throw api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>{};
+    }
+
+    auto id = m_lastChannelId + 1;
+    channel.m_id = id;
+    channel.m_description = TcpChannel::make_description(*this, id);
+
+    channel.m_communicator->on_new_connection(channel);
+    m_channels[id] = &channel;
+    m_lastChannelId = id;
+    channel.m_open  = true;
+
+    if (m_ready) {
+        queue_control_frame(CONTROL_OPEN_CHANNEL, id,
+            get_communicator_type(*channel.m_communicator));
+        channel.m_openSent = true;
+    }
+}
+
+bool TcpConnection::close_channel(TcpChannel& channel)
+{
+    std::lock_guard<std::mutex> rcvLock{m_receiveMutex};
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+
+    if (!channel.m_open) {
+        return false;
+    }
+
+    m_channels.erase(channel.m_id);
+    channel.m_open = false;
+
+    if (m_alive && channel.m_openSent) {
+        queue_control_frame(CONTROL_CLOSE_CHANNEL, channel.m_id);
+    }
+
+    return true;
+}
+
+void TcpConnection::await_channel_death(TcpChannel& channel,
+    error_handler_fn handlerFn)
+{
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+
+    if (!m_alive || !channel.m_open) {
+        throw api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>{};
+    }
+
+    channel.m_awaitDeathOp.arm(handlerFn);
+}
+
+void TcpConnection::cancel_await_channel_death(TcpChannel& channel)
+{
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+    channel.m_awaitDeathOp.fire<YOGI_ERR_CANCELED>();
+}
+
 void TcpConnection::start_async_wait()
 {
     if (m_timerRunning) {
@@ -334,6 +754,7 @@ void TcpConnection::on_timeout(const boost::system::error_code& ec)
 
             close_socket();
             m_alive = false;
+            fail_pending_sends();
 
             m_awaitDeathOp.fire<YOGI_ERR_TIMEOUT>();
 
@@ -344,7 +765,9 @@ void TcpConnection::on_timeout(const boost::system::error_code& ec)
             if (m_alive) {
                 ++m_heartbeatsSinceLastReceive;
 
-                if (m_heartbeatsSinceLastSend >= 1) {
+                // queued messages must not be interrupted by a heartbeat
+                if (m_heartbeatsSinceLastSend >= 1 && m_pendingSends.empty()
+                    && !m_writingFrames) {
                     send_heartbeat(lock);
                 }
                 else {
@@ -410,15 +833,23 @@ TcpConnection::TcpConnection(interfaces::IScheduler& scheduler,
     , m_socket                    {std::move(socket)}
     , m_alive                     {true}
     , m_ready                     {false}
+    , m_writingFrames             {false}
     , m_remainingMsgPayload       {0}
     , m_preMessagingRunning       {false}
     , m_sendSomeDataRunning       {false}
     , m_recvSomeDataRunning       {false}
     , m_deserializeRunning        {false}
-    , m_timer                     {scheduler.io_service()}
+    // run the timer on the same event loop as the socket
+#if BOOST_VERSION >= 107000
+    , m_timer                     {m_socket.get_executor()}
+#else
+    , m_timer                     {m_socket.get_io_service()}
+#endif
     , m_timerRunning              {false}
     , m_heartbeatsSinceLastReceive{0}
     , m_heartbeatsSinceLastSend   {0}
+    , m_multiplexed               {false}
+    , m_lastChannelId             {CONTROL_CHANNEL}
 {
     BOOST_LOG_TRIVIAL(info) << "TCP connection to " << m_description
         << " running YOGI " << m_remoteVersion << " successfully created";
@@ -427,15 +858,23 @@ TcpConnection::TcpConnection(interfaces::IScheduler& scheduler,
 TcpConnection::~TcpConnection()
 {
     interfaces::communicator_ptr communicator;
+    decltype(m_remoteChannels) remoteChannels;
 
     {{
         std::unique_lock<std::mutex> rcvLock{m_receiveMutex};
         std::unique_lock<std::recursive_mutex> lock{m_mutex};
         m_alive = false;
+        fail_pending_sends();
         m_cv.notify_all();
         std::swap(m_communicator, communicator);
+        std::swap(m_remoteChannels, remoteChannels);
+        m_channels.clear();
     }}
 
+    for (auto& entry : remoteChannels) {
+        communicator->on_connection_destroyed(*entry.second);
+    }
+
     if (communicator) {
         communicator->on_connection_destroyed(*this);
     }
@@ -471,7 +910,7 @@ void TcpConnection::assign(interfaces::ICommunicator& communicator,
 {
     std::lock_guard<std::recursive_mutex> lock{m_mutex};
 
-    if (m_communicator) {
+    if (m_communicator || m_multiplexed) {
         throw api::ExceptionT<YOGI_ERR_ALREADY_ASSIGNED>{};
     }
 
@@ -494,6 +933,36 @@ void TcpConnection::assign(interfaces::ICommunicator& communicator,
     start_send_communicator_type();
 }
 
+void TcpConnection::assign_multiplexed(std::chrono::milliseconds timeout)
+{
+    std::lock_guard<std::recursive_mutex> lock{m_mutex};
+
+    if (m_communicator || m_multiplexed) {
+        throw api::ExceptionT<YOGI_ERR_ALREADY_ASSIGNED>{};
+    }
+
+    if (!remote_supports_multiplexing()) {
+        throw api::ExceptionT<YOGI_ERR_INCOMPATIBLE_VERSION>{};
+    }
+
+    if (!m_alive) {
+        throw api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>{};
+    }
+
+    if (timeout.count() / 3 == 0) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    if (timeout != timeout.max()) {
+        m_timeout = timeout;
+        start_async_wait();
+    }
+
+    m_multiplexed = true;
+
+    start_send_communicator_type();
+}
+
 void TcpConnection::async_await_death(error_handler_fn handlerFn)
 {
     std::lock_guard<std::recursive_mutex> lock{m_mutex};
@@ -512,49 +981,98 @@ void TcpConnection::cancel_await_death()
     m_awaitDeathOp.fire<YOGI_ERR_CANCELED>();
 }
 
-void TcpConnection::send(const interfaces::IMessage& msg)
+void TcpConnection::send(std::size_t channel, const interfaces::IMessage& msg)
+{
+    std::unique_lock<std::recursive_mutex> lock{m_mutex};
+
+    std::vector<char> data;
+    append_serialized_message(&data, channel, msg);
+    write_frames(lock, data);
+}
+
+void TcpConnection::send_batch(std::size_t channel,
+    const std::vector<const interfaces::IMessage*>& msgs)
+{
+    std::unique_lock<std::recursive_mutex> lock{m_mutex};
+
+    // serialize all messages into one buffer so that they get written to the
+    // socket together
+    std::vector<char> data;
+    for (auto msg : msgs) {
+        append_serialized_message(&data, channel, *msg);
+    }
+
+    write_frames(lock, data);
+}
+
+bool TcpConnection::try_send(std::size_t channel,
+    const interfaces::IMessage& msg)
 {
     std::unique_lock<std::recursive_mutex> lock{m_mutex};
 
     if (!m_alive) {
-        return;
+        return true;
     }
 
-    m_tmpMsgBuffer.clear();
-    msg.serialize(m_tmpMsgBuffer);
+    std::vector<char> data;
+    append_serialized_message(&data, channel, msg);
 
-    m_tmpMsgTypeIdBuffer.clear();
-    serialization::serialize(m_tmpMsgTypeIdBuffer, msg.type_id());
+    // such a message would never fit into the out buffer
+    if (data.size() > m_outBuffer.capacity()) {
+        throw api::ExceptionT<YOGI_ERR_MESSAGE_TOO_LARGE>{};
+    }
 
-    m_tmpMsgSizeBuffer.clear();
-    serialization::serialize(m_tmpMsgSizeBuffer, m_tmpMsgBuffer.size()
-        + m_tmpMsgTypeIdBuffer.size());
+    if (m_writingFrames || !m_pendingSends.empty()
+        || m_outBuffer.write_available() < data.size()) {
+        return false;
+    }
 
-    m_tmpHeaderBuffer.clear();
-    m_tmpHeaderBuffer.insert(m_tmpHeaderBuffer.end(),
-        m_tmpMsgSizeBuffer.begin(), m_tmpMsgSizeBuffer.end());
-    m_tmpHeaderBuffer.insert(m_tmpHeaderBuffer.end(),
-        m_tmpMsgTypeIdBuffer.begin(), m_tmpMsgTypeIdBuffer.end());
+    m_outBuffer.write(data.cbegin(), data.cend());
+    start_async_send_some_data();
 
-    auto it = m_outBuffer.write(m_tmpHeaderBuffer.begin(),
-        m_tmpHeaderBuffer.end());
+    return true;
+}
 
-    if (it != m_tmpHeaderBuffer.end()) {
-        start_async_send_some_data();
+void TcpConnection::async_send(std::size_t channel,
+    const interfaces::IMessage& msg, send_handler_fn handlerFn)
+{
+    std::unique_lock<std::recursive_mutex> lock{m_mutex};
+
+    if (!m_alive) {
+        post_send_handler(handlerFn,
+            api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>{});
+        return;
     }
 
-    m_cv.wait(lock, [&] {
-        return !m_alive || m_outBuffer.write(it, m_tmpHeaderBuffer.end())
-            == m_tmpHeaderBuffer.end();
-    });
+    // whatever does not fit into the out buffer gets written once the socket
+    // has sent some data
+    pending_send ps{{}, 0, handlerFn};
+    append_serialized_message(&ps.data, channel, msg);
+    m_pendingSends.push_back(std::move(ps));
 
-    it = m_outBuffer.write(m_tmpMsgBuffer.begin(), m_tmpMsgBuffer.end());
-    start_async_send_some_data();
+    write_pending_sends();
+}
 
-    m_cv.wait(lock, [&] {
-        return !m_alive || m_outBuffer.write(it, m_tmpMsgBuffer.end())
-            == m_tmpMsgBuffer.end();
-    });
+void TcpConnection::send(const interfaces::IMessage& msg)
+{
+    send(CONTROL_CHANNEL, msg);
+}
+
+bool TcpConnection::try_send(const interfaces::IMessage& msg)
+{
+    return try_send(CONTROL_CHANNEL, msg);
+}
+
+void TcpConnection::async_send(const interfaces::IMessage& msg,
+    send_handler_fn handlerFn)
+{
+    async_send(CONTROL_CHANNEL, msg, handlerFn);
+}
+
+void TcpConnection::send_batch(
+    const std::vector<const interfaces::IMessage*>& msgs)
+{
+    send_batch(CONTROL_CHANNEL, msgs);
 }
 
 bool TcpConnection::remote_is_node() const
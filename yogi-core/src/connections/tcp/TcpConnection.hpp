@@ -14,20 +14,61 @@
 #include <mutex>
 #include <condition_variable>
 #include <functional>
+#include <deque>
+#include <map>
+#include <memory>
 
 
 namespace yogi {
 namespace connections {
 namespace tcp {
 
+class TcpChannel;
+
 /***************************************************************************//**
  * Represents a TCP connection between two nodes or between a node and a leaf
+ *
+ * Instead of being assigned to a single leaf or node, a connection can be
+ * multiplexed. Then, any number of leafs and nodes can communicate over it via
+ * TcpChannels. On the wire, every message is preceded by the ID of its channel
+ * and channel 0 carries the frames that open and close channels. The remote end
+ * learns about the multiplexing when exchanging communicator types and assigns
+ * all channels opened by the multiplexing end to its own leaf or node. Since
+ * older versions would take the multiplexer's communicator type for a node,
+ * multiplexing is only allowed if the remote end runs at least
+ * YOGI_MIN_MULTIPLEXING_VERSION. The socket, the buffers and the heartbeats
+ * are shared by all channels. Each frame gets written to the out buffer as a
+ * whole, so frames sent on different channels at the same time and the frames
+ * opening and closing channels never interleave.
  ******************************************************************************/
 class TcpConnection : public interfaces::IConnection
 {
+    friend class TcpChannel;
+
     typedef std::function<void (const api::Exception&)>
         error_handler_fn;
 
+    // value of the byte exchanged after the handshake
+    enum communicator_type : char {
+        COMMUNICATOR_LEAF        = 0,
+        COMMUNICATOR_NODE        = 1,
+        COMMUNICATOR_MULTIPLEXER = 2
+    };
+
+    enum control_command : char {
+        CONTROL_OPEN_CHANNEL  = 1,
+        CONTROL_CLOSE_CHANNEL = 2
+    };
+
+    // carries all messages if the connection is not multiplexed
+    static const std::size_t CONTROL_CHANNEL = 0;
+
+    struct pending_send {
+        std::vector<char> data;
+        std::size_t       bytesWritten;
+        send_handler_fn   handlerFn;
+    };
+
 private:
     const interfaces::scheduler_ptr        m_scheduler;
     const std::string                      m_remoteVersion;
@@ -46,10 +87,8 @@ private:
 
     std::mutex                             m_receiveMutex;
     base::LockFreeRingBuffer               m_outBuffer;
-    std::vector<char>                      m_tmpMsgTypeIdBuffer;
-    std::vector<char>                      m_tmpMsgSizeBuffer;
-    std::vector<char>                      m_tmpHeaderBuffer;
-    std::vector<char>                      m_tmpMsgBuffer;
+    bool                                   m_writingFrames;
+    std::deque<pending_send>               m_pendingSends;
     base::LockFreeRingBuffer               m_inBuffer;
     size_t					               m_remainingMsgPayload;
     std::vector<char>                      m_tmpInBuffer;
@@ -64,10 +103,27 @@ private:
     std::atomic<int>                       m_heartbeatsSinceLastReceive;
     int                                    m_heartbeatsSinceLastSend;
 
+    bool                                   m_multiplexed;
+    std::size_t                            m_lastChannelId;
+    std::map<std::size_t, TcpChannel*>     m_channels;
+    std::map<std::size_t, std::unique_ptr<TcpChannel>> m_remoteChannels;
+
 private:
     static std::string make_description(const boost::asio::ip::tcp::socket& s);
     void die(const boost::system::error_code& ec, bool* runningFlag);
+    template <int TErrorCode> void fire_await_death();
     void done(bool* runningFlag);
+    static communicator_type get_communicator_type(
+        const interfaces::ICommunicator& communicator);
+    interfaces::IScheduler& deserialization_scheduler();
+    void append_serialized_message(std::vector<char>* buffer,
+        std::size_t channel, const interfaces::IMessage& msg);
+    void write_frames(std::unique_lock<std::recursive_mutex>& lock,
+        const std::vector<char>& data);
+    void post_send_handler(send_handler_fn handlerFn,
+        const api::Exception& e);
+    void write_pending_sends();
+    void fail_pending_sends();
     void start_send_communicator_type();
     void on_send_communicator_type_completed(
         const boost::system::error_code& ec);
@@ -84,6 +140,23 @@ private:
     void deserialize();
     void wait_for_more_data_to_deserialize();
     void deserialize_message_and_forward_to_communicator();
+    void on_control_frame_received(std::vector<char>::const_iterator it);
+    void on_open_channel_received(std::size_t channel, bool remoteIsNode);
+    void on_close_channel_received(std::size_t channel);
+    void on_channel_refused(std::size_t channel);
+    void queue_control_frame(control_command command, std::size_t channel,
+        communicator_type type = COMMUNICATOR_LEAF);
+    bool remote_supports_multiplexing() const;
+    void open_channel(TcpChannel& channel);
+    bool close_channel(TcpChannel& channel);
+    void await_channel_death(TcpChannel& channel, error_handler_fn handlerFn);
+    void cancel_await_channel_death(TcpChannel& channel);
+    void send(std::size_t channel, const interfaces::IMessage& msg);
+    bool try_send(std::size_t channel, const interfaces::IMessage& msg);
+    void async_send(std::size_t channel, const interfaces::IMessage& msg,
+        send_handler_fn handlerFn);
+    void send_batch(std::size_t channel,
+        const std::vector<const interfaces::IMessage*>& msgs);
     void start_async_wait();
     void on_timeout(const boost::system::error_code& ec);
     void close_socket();
@@ -98,10 +171,16 @@ public:
 
     void assign(interfaces::ICommunicator& communicator,
         std::chrono::milliseconds timeout);
+    void assign_multiplexed(std::chrono::milliseconds timeout);
     void async_await_death(error_handler_fn handlerFn);
     void cancel_await_death();
 
     virtual void send(const interfaces::IMessage& msg) override;
+    virtual bool try_send(const interfaces::IMessage& msg) override;
+    virtual void async_send(const interfaces::IMessage& msg,
+        send_handler_fn handlerFn) override;
+    virtual void send_batch(const std::vector<const interfaces::IMessage*>&
+        msgs) override;
     virtual bool remote_is_node() const override;
     virtual const std::string& description() const override;
     virtual const std::string& remote_version() const override;
@@ -300,8 +300,9 @@ TcpConnectionFactory::TcpConnectionFactory(interfaces::IScheduler& scheduler,
     identification_buffer identification)
     : m_scheduler     {scheduler.make_ptr<interfaces::IScheduler>()}
     , m_identification{make_identification(identification)}
-    , m_socket        {scheduler.io_service()}
-    , m_timer         {scheduler.io_service()}
+    , m_ioService     {scheduler.io_service()}
+    , m_socket        {m_ioService}
+    , m_timer         {m_ioService}
 {
 }
 
@@ -37,6 +37,7 @@ private:
     std::unique_ptr<api::Exception> m_firstResult;
     std::string                     m_remoteVersion;
     std::vector<char>               m_buffer;
+    boost::asio::io_service&        m_ioService;
     boost::asio::ip::tcp::socket    m_socket;
     boost::asio::deadline_timer     m_timer;
     bool                            m_canceled;
@@ -74,6 +75,20 @@ protected:
 
     std::unique_lock<std::recursive_mutex> make_lock_guard();
 
+    /**
+     * Returns the event loop that all I/O objects of the factory and the
+     * connections it creates are bound to
+     *
+     * The event loop gets chosen once on construction so that the objects
+     * belonging to one factory do not get spread over different event loops.
+     *
+     * @return Event loop
+     */
+    boost::asio::io_service& io_service()
+    {
+        return m_ioService;
+    }
+
     void start_async_shake_hands(boost::asio::ip::tcp::socket&& socket,
         std::chrono::milliseconds timeout);
     virtual void on_shake_hands_completed(const api::Exception& e,
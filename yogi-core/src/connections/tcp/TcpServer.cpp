@@ -124,8 +124,8 @@ TcpServer::TcpServer(interfaces::IScheduler& scheduler, std::string address,
     : super      {scheduler, identification}
     , m_scheduler{scheduler.make_ptr<interfaces::IScheduler>()}
     , m_endpoint {make_endpoint(address, port)}
-    , m_acceptor {scheduler.io_service()}
-    , m_socket   {scheduler.io_service()}
+    , m_acceptor {super::io_service()}
+    , m_socket   {super::io_service()}
 {
     open_acceptor();
     bind_acceptor();
@@ -154,7 +154,7 @@ void TcpServer::async_accept(accept_handler_fn handlerFn,
 
     m_acceptOp.arm(handlerFn);
 
-    m_socket = boost::asio::ip::tcp::socket{m_scheduler->io_service()};
+    m_socket = boost::asio::ip::tcp::socket{super::io_service()};
     m_handshakeTimeout = handShakeTimeout;
     m_canceled = false;
     start_async_accept();
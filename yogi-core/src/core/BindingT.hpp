@@ -45,13 +45,14 @@ private:
 
 public:
     BindingT(interfaces::ITerminal& terminal,
-        base::Identifier::name_type targets, bool hiddenTargets)
+        base::Identifier::name_type targets, bool hiddenTargets,
+        bool wildcardTargets = false)
         : m_scheduler{terminal.leaf().scheduler()
             .make_ptr<interfaces::IScheduler>()}
         , m_terminal{terminal}
         , m_terminalPointerStore{terminal.make_ptr<interfaces::ITerminal>()}
         , m_identifier{terminal.identifier().signature(), targets,
-            hiddenTargets}
+            hiddenTargets, wildcardTargets}
         , m_state{STATE_RELEASED}
         , m_getStateActive{false}
     {
@@ -0,0 +1,176 @@
+#include "KnownTerminalsIndex.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <tuple>
+
+
+namespace yogi {
+namespace core {
+namespace {
+
+bool chars_equal(char a, char b, bool caseSensitive)
+{
+    if (caseSensitive) {
+        return a == b;
+    }
+
+    return std::tolower(static_cast<unsigned char>(a))
+        == std::tolower(static_cast<unsigned char>(b));
+}
+
+} // anonymous namespace
+
+bool KnownTerminalsIndex::entry_less::operator() (const entry& lhs,
+    const entry& rhs) const
+{
+    return std::forward_as_tuple(lhs.identifier.name(), lhs.type,
+        lhs.identifier.signature()) < std::forward_as_tuple(
+        rhs.identifier.name(), rhs.type, rhs.identifier.signature());
+}
+
+bool KnownTerminalsIndex::entry_less::operator() (const entry& lhs,
+    const std::string& rhs) const
+{
+    return lhs.identifier.name() < rhs;
+}
+
+bool KnownTerminalsIndex::entry_less::operator() (const std::string& lhs,
+    const entry& rhs) const
+{
+    return lhs < rhs.identifier.name();
+}
+
+bool KnownTerminalsIndex::starts_with(const std::string& str,
+    const std::string& prefix, bool caseSensitive)
+{
+    if (str.size() < prefix.size()) {
+        return false;
+    }
+
+    return std::equal(prefix.begin(), prefix.end(), str.begin(),
+        [=](char a, char b) { return chars_equal(a, b, caseSensitive); });
+}
+
+bool KnownTerminalsIndex::contains(const std::string& str,
+    const std::string& substr, bool caseSensitive)
+{
+    return std::search(str.begin(), str.end(), substr.begin(), substr.end(),
+        [=](char a, char b) { return chars_equal(a, b, caseSensitive); })
+        != str.end();
+}
+
+void KnownTerminalsIndex::record_change(const entry& terminal, bool added)
+{
+    if (m_changes.size() == YOGI_KNOWN_TERMINALS_HISTORY_SIZE) {
+        m_changes.pop_front();
+    }
+
+    m_changes.push_back(change{++m_cursor, added, terminal});
+}
+
+KnownTerminalsIndex::KnownTerminalsIndex()
+    : m_cursor{0}
+{
+}
+
+void KnownTerminalsIndex::insert(int type, const base::Identifier& identifier)
+{
+    entry terminal{type, identifier};
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_entries.insert(terminal).second) {
+        record_change(terminal, true);
+    }
+}
+
+void KnownTerminalsIndex::erase(int type, const base::Identifier& identifier)
+{
+    entry terminal{type, identifier};
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_entries.erase(terminal)) {
+        record_change(terminal, false);
+    }
+}
+
+std::size_t KnownTerminalsIndex::size() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_entries.size();
+}
+
+KnownTerminalsIndex::cursor_type KnownTerminalsIndex::cursor() const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_cursor;
+}
+
+KnownTerminalsIndex::cursor_type KnownTerminalsIndex::find(query_mode mode,
+    const std::string& pattern, bool caseSensitive, const entry* after,
+    find_visitor_fn visitorFn) const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    // case-sensitive prefix queries only need to look at the matching range
+    if (mode == QUERY_PREFIX && caseSensitive) {
+        auto it = after && !entry_less{}(*after, pattern)
+            ? m_entries.upper_bound(*after)
+            : m_entries.lower_bound(pattern);
+        for (; it != m_entries.end()
+            && starts_with(it->identifier.name(), pattern, true); ++it) {
+            if (!visitorFn(*it)) {
+                break;
+            }
+        }
+    }
+    else {
+        auto it = after ? m_entries.upper_bound(*after) : m_entries.begin();
+        for (; it != m_entries.end(); ++it) {
+            bool matches = mode == QUERY_PREFIX
+                ? starts_with(it->identifier.name(), pattern, caseSensitive)
+                : contains(it->identifier.name(), pattern, caseSensitive);
+
+            if (matches && !visitorFn(*it)) {
+                break;
+            }
+        }
+    }
+
+    return m_cursor;
+}
+
+KnownTerminalsIndex::cursor_type KnownTerminalsIndex::get_changes(
+    cursor_type since, change_visitor_fn visitorFn) const
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    if (since > m_cursor) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    if (since == m_cursor) {
+        return since;
+    }
+
+    // changes are numbered consecutively, so the first one we need to report
+    // can be found by its distance from the oldest recorded change
+    if (m_changes.empty() || since + 1 < m_changes.front().cursor) {
+        throw api::ExceptionT<YOGI_ERR_CURSOR_EXPIRED>{};
+    }
+
+    auto it = m_changes.begin() + static_cast<std::ptrdiff_t>(
+        since + 1 - m_changes.front().cursor);
+    for (; it != m_changes.end(); ++it) {
+        if (!visitorFn(*it)) {
+            break;
+        }
+
+        since = it->cursor;
+    }
+
+    return since;
+}
+
+} // namespace core
+} // namespace yogi
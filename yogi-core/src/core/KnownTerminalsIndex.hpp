@@ -0,0 +1,101 @@
+#ifndef YOGI_CORE_KNOWNTERMINALSINDEX_HPP
+#define YOGI_CORE_KNOWNTERMINALSINDEX_HPP
+
+#include "../config.h"
+#include "../base/Identifier.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <set>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <functional>
+
+
+namespace yogi {
+namespace core {
+
+/***************************************************************************//**
+ * Name-ordered index over the terminals known to a node
+ *
+ * The entries are kept sorted by name, type and signature (in that order)
+ * which makes prefix queries and paged listings cheap. Pages are continued
+ * after the last entry of the previous page rather than at an offset so that
+ * changes between two queries cannot cause entries to be skipped or repeated.
+ * Every change to the index is assigned a sequence number
+ * (the cursor) and the most recent changes are kept in a bounded history so
+ * that library users can fetch only the delta since their last query.
+ ******************************************************************************/
+class KnownTerminalsIndex
+{
+public:
+    typedef unsigned long long cursor_type;
+
+    struct entry {
+        int              type;
+        base::Identifier identifier;
+    };
+
+    struct change {
+        cursor_type cursor;
+        bool        added;
+        entry       terminal;
+    };
+
+    enum query_mode {
+        QUERY_PREFIX,
+        QUERY_SUBSTRING
+    };
+
+    typedef std::function<bool (const entry&)>  find_visitor_fn;
+    typedef std::function<bool (const change&)> change_visitor_fn;
+
+private:
+    struct entry_less {
+        typedef void is_transparent;
+
+        bool operator() (const entry& lhs, const entry& rhs) const;
+        bool operator() (const entry& lhs, const std::string& rhs) const;
+        bool operator() (const std::string& lhs, const entry& rhs) const;
+    };
+
+    typedef std::set<entry, entry_less> entry_set;
+
+    mutable std::mutex m_mutex;
+    entry_set          m_entries;
+    std::deque<change> m_changes;
+    cursor_type        m_cursor;
+
+private:
+    static bool starts_with(const std::string& str, const std::string& prefix,
+        bool caseSensitive);
+    static bool contains(const std::string& str, const std::string& substr,
+        bool caseSensitive);
+
+    void record_change(const entry& terminal, bool added);
+
+public:
+    KnownTerminalsIndex();
+
+    void insert(int type, const base::Identifier& identifier);
+    void erase(int type, const base::Identifier& identifier);
+
+    std::size_t size() const;
+    cursor_type cursor() const;
+
+    // calls visitorFn for each matching entry in index order, starting after
+    // the given entry (if any); visitorFn returns false to stop the query
+    cursor_type find(query_mode mode, const std::string& pattern,
+        bool caseSensitive, const entry* after, find_visitor_fn visitorFn)
+        const;
+
+    // calls visitorFn for each change after the given cursor; returns the
+    // cursor of the last change accepted by visitorFn
+    cursor_type get_changes(cursor_type since, change_visitor_fn visitorFn)
+        const;
+};
+
+} // namespace core
+} // namespace yogi
+
+#endif // YOGI_CORE_KNOWNTERMINALSINDEX_HPP
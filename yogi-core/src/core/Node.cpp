@@ -31,6 +31,13 @@ void Node::on_known_terminals_changed(int type, base::Identifier identifier,
     info.identifier = identifier;
     info.added      = added;
 
+    if (added) {
+        m_knownTerminalsIndex.insert(type, identifier);
+    }
+    else {
+        m_knownTerminalsIndex.erase(type, identifier);
+    }
+
     std::lock_guard<std::mutex> lock{m_awaitKnownTerminalsChangeOpMutex};
 
     m_awaitKnownTerminalsChangeOp.fire<YOGI_OK>(info);
@@ -175,6 +182,11 @@ Node::known_terminals_vectors Node::get_known_terminals()
     return v;
 }
 
+const KnownTerminalsIndex& Node::known_terminals_index() const
+{
+    return m_knownTerminalsIndex;
+}
+
 void Node::async_await_known_terminals_change(
     await_known_terminals_change_handler_fn handlerFn)
 {
@@ -187,5 +199,27 @@ void Node::cancel_await_known_terminals_change()
         known_terminal_change_info{});
 }
 
+void Node::set_history_limits(std::size_t maxMessages, std::size_t maxBytes)
+{
+    cached_publish_subscribe::NodeLogic<>::cps_set_history_limits(maxMessages,
+        maxBytes);
+    cached_producer_consumer::NodeLogic<>::cps_set_history_limits(maxMessages,
+        maxBytes);
+    cached_master_slave::NodeLogic<>::cps_set_history_limits(maxMessages,
+        maxBytes);
+}
+
+void Node::set_last_value_store(const std::string& path)
+{
+    std::shared_ptr<base::LastValueStore> store;
+    if (!path.empty()) {
+        store = std::make_shared<base::LastValueStore>(path);
+    }
+
+    cached_publish_subscribe::NodeLogic<>::cps_set_last_value_store(store);
+    cached_producer_consumer::NodeLogic<>::cps_set_last_value_store(store);
+    cached_master_slave::NodeLogic<>::cps_set_last_value_store(store);
+}
+
 } // namespace core
 } // namespace yogi
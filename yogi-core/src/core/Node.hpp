@@ -4,6 +4,7 @@
 #include "../config.h"
 #include "../base/AsyncOperation.hpp"
 #include "../interfaces/INode.hpp"
+#include "KnownTerminalsIndex.hpp"
 #include "deaf_mute/NodeLogic.hpp"
 #include "publish_subscribe/NodeLogic.hpp"
 #include "scatter_gather/NodeLogic.hpp"
@@ -60,6 +61,7 @@ public:
 private:
     const interfaces::scheduler_ptr     m_scheduler;
     NodeLogicBase::msg_handler_lut_type m_msgHandlers;
+    KnownTerminalsIndex                 m_knownTerminalsIndex;
 
     std::mutex m_awaitKnownTerminalsChangeOpMutex;
     base::AsyncOperation<await_known_terminals_change_handler_fn>
@@ -86,9 +88,17 @@ public:
         interfaces::IConnection& origin) override;
 
     known_terminals_vectors get_known_terminals();
+    const KnownTerminalsIndex& known_terminals_index() const;
     void async_await_known_terminals_change(
         await_known_terminals_change_handler_fn handlerFn);
     void cancel_await_known_terminals_change();
+
+    // limits the history kept for each cached terminal
+    void set_history_limits(std::size_t maxMessages, std::size_t maxBytes);
+
+    // persists the last message of each cached terminal in the given file;
+    // an empty path stops persisting
+    void set_last_value_store(const std::string& path);
 };
 
 } // namespace core
@@ -6,6 +6,9 @@
 #include "Terminal.hpp"
 #include "logic_types.hpp"
 
+#include <chrono>
+#include <algorithm>
+
 
 namespace yogi {
 namespace core {
@@ -13,18 +16,49 @@ namespace cached_publish_subscribe {
 
 /***************************************************************************//**
  * Implements the logic for publish-subscribe terminals on leafs
+ *
+ * Replays of the history kept by the node are requested once the binding group
+ * is established. The replayed messages get delivered like cached data but do
+ * not replace the cached message since they are usually older than it.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class LeafLogic : public common::PublishSubscribeLeafLogicBaseT<TTypes>
 {
     typedef common::PublishSubscribeLeafLogicBaseT<TTypes> super;
 
+private:
+    void send_replay_request(const typename super::binding_info& bd)
+    {
+        using namespace messaging;
+
+        // only nodes keep a history
+        bd.ext.replayPending = false;
+        if (!super::connection().remote_is_node()) {
+            return;
+        }
+
+        auto now    = base::MessageHistory::clock::now();
+        auto maxAge = std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - bd.ext.replaySince);
+
+        typename TTypes::ReplayRequest msg;
+        msg[fields::mappedId]    = bd.fsm.mapped_id();
+        msg[fields::maxMessages] = bd.ext.replayMaxMessages;
+        msg[fields::maxAge]      = bd.ext.replaySince
+            == base::MessageHistory::clock::time_point{} ? 0
+            : static_cast<std::size_t>(std::max<long long>(maxAge.count(), 1));
+
+        super::connection().send(msg);
+    }
+
 protected:
     LeafLogic(interfaces::IScheduler& scheduler)
         : super{scheduler}
     {
         super::template add_msg_handler<typename TTypes::CachedData>(this,
             &LeafLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::ReplayedData>(this,
+            &LeafLogic::on_message_received);
     }
 
     virtual void on_subscribed(const typename super::terminal_info& tm) override
@@ -42,6 +76,16 @@ protected:
         }
     }
 
+    virtual void on_binding_group_mapping_changed(bool isMapped,
+        const typename super::binding_info& bd) override
+    {
+        super::on_binding_group_mapping_changed(isMapped, bd);
+
+        if (isMapped && bd.ext.replayPending) {
+            send_replay_request(bd);
+        }
+    }
+
     virtual void on_data_received(const typename super::terminal_info& tm,
         base::Buffer&& data) override
     {
@@ -74,6 +118,20 @@ protected:
         on_cached_data_received(info, std::move(msg[fields::data]));
     }
 
+    void on_message_received(typename TTypes::ReplayedData&& msg)
+    {
+        using namespace messaging;
+
+        auto& bindings = super::get_binding_info(msg[fields::subscriptionId])
+            .bindings;
+        if (bindings.empty()) {
+            return;
+        }
+
+        auto& info = super::get_terminal_info(bindings[0]->terminal().id());
+        info.terminal->on_data_received(std::move(msg[fields::data]), true);
+    }
+
     virtual void on_cached_data_received(const typename super::terminal_info& tm,
         base::Buffer&& data)
     {
@@ -93,6 +151,22 @@ public:
         return std::make_pair(info.ext.lastReceivedMessage,
             info.ext.lastReceivedMessageSet);
     }
+
+    // since == time_point{} replays messages of any age
+    void cps_request_replay(base::Id bindingGroupId, std::size_t maxMessages,
+        base::MessageHistory::clock::time_point since)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        bd.ext.replayPending     = true;
+        bd.ext.replayMaxMessages = maxMessages;
+        bd.ext.replaySince       = since;
+
+        if (bd.established) {
+            send_replay_request(bd);
+        }
+    }
 };
 
 } // namespace cached_publish_subscribe
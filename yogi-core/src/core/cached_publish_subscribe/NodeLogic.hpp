@@ -4,6 +4,12 @@
 #include "../../config.h"
 #include "../common/PublishSubscribeNodeLogicBaseT.hpp"
 #include "logic_types.hpp"
+#include "../../base/LastValueStore.hpp"
+
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <string>
 
 
 namespace yogi {
@@ -12,18 +18,124 @@ namespace cached_publish_subscribe {
 
 /***************************************************************************//**
  * Implements the logic for publish-subscribe terminals on leafs
+ *
+ * Besides the last message, each terminal can keep a history of the most
+ * recent messages. Binding owners can ask for a replay of that history which
+ * gets sent to them as cached data in batches.
+ *
+ * If the node has a last value store, the last message of each terminal gets
+ * persisted there. Terminals that have not received anything yet fall back to
+ * the value in the store, so a restarted node can serve cached data before
+ * the terminal's owner publishes again.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class NodeLogic : public common::PublishSubscribeNodeLogicBaseT<TTypes>
 {
     typedef common::PublishSubscribeNodeLogicBaseT<TTypes> super;
 
+    // number of replayed messages handed to the connection in one go
+    enum { REPLAY_BATCH_SIZE = 64 };
+
+    std::size_t m_historyMaxMessages = 0;
+    std::size_t m_historyMaxBytes    = 0;
+
+    std::shared_ptr<base::LastValueStore> m_store;
+
 private:
+    void add_to_history(const typename super::terminal_info& tm,
+        const base::Buffer& data)
+    {
+        tm.ext.history.set_limits(m_historyMaxMessages, m_historyMaxBytes);
+        tm.ext.history.push(data);
+    }
+
+    const std::string& persistent_key(const typename super::terminal_info& tm)
+    {
+        if (tm.ext.persistentKey.empty()) {
+            auto& identifier = super::get_terminal_identifier(tm);
+            tm.ext.persistentKey = typename TTypes::CachedData{}.name();
+            tm.ext.persistentKey += '/';
+            tm.ext.persistentKey += std::to_string(identifier.signature());
+            tm.ext.persistentKey += identifier.hidden() ? "/h/" : "/v/";
+            tm.ext.persistentKey += identifier.name();
+        }
+
+        return tm.ext.persistentKey;
+    }
+
+    void set_last_received_message(const typename super::terminal_info& tm,
+        const base::Buffer& data)
+    {
+        tm.ext.lastReceivedMessage    = data;
+        tm.ext.lastReceivedMessageSet = true;
+
+        if (m_store) {
+            m_store->put(persistent_key(tm), data);
+        }
+    }
+
+    // copies the persisted value into the terminal when it is first needed
+    void load_last_received_message(const typename super::terminal_info& tm)
+    {
+        const char* data;
+        std::size_t size;
+        if (m_store && m_store->find(persistent_key(tm), &data, &size)) {
+            tm.ext.lastReceivedMessage    = base::Buffer{data, size};
+            tm.ext.lastReceivedMessageSet = true;
+        }
+    }
+
+    void replay_history(interfaces::IConnection& connection,
+        base::Id subscriptionId, const typename super::terminal_info& tm,
+        std::size_t maxMessages, std::chrono::milliseconds maxAge)
+    {
+        using namespace messaging;
+
+        tm.ext.history.set_limits(m_historyMaxMessages, m_historyMaxBytes);
+
+        auto since = base::MessageHistory::clock::time_point::min();
+        if (maxAge.count()) {
+            since = base::MessageHistory::clock::now() - maxAge;
+        }
+
+        std::vector<typename TTypes::ReplayedData> msgs;
+        std::vector<const interfaces::IMessage*> msgPtrs;
+        msgs.reserve(REPLAY_BATCH_SIZE);
+        msgPtrs.reserve(REPLAY_BATCH_SIZE);
+
+        auto flush = [&] {
+            connection.send_batch(msgPtrs);
+            msgs.clear();
+            msgPtrs.clear();
+        };
+
+        tm.ext.history.foreach_recent(maxMessages, since,
+            [&](const base::Buffer& data,
+                base::MessageHistory::clock::time_point) {
+                msgs.emplace_back();
+                msgs.back()[fields::subscriptionId] = subscriptionId;
+                msgs.back()[fields::data]           = data;
+                msgPtrs.push_back(&msgs.back());
+
+                if (msgs.size() == REPLAY_BATCH_SIZE) {
+                    flush();
+                }
+            });
+
+        if (!msgs.empty()) {
+            flush();
+        }
+    }
+
     void sendCachedData(interfaces::IConnection& connection,
         base::Id subscriptionId, const typename super::terminal_info& tm)
     {
         using namespace messaging;
 
+        if (!tm.ext.lastReceivedMessageSet) {
+            load_last_received_message(tm);
+        }
+
         if (tm.ext.lastReceivedMessageSet) {
             typename TTypes::CachedData msg;
             msg[fields::subscriptionId] = subscriptionId;
@@ -40,6 +152,8 @@ protected:
     {
         super::template add_msg_handler<typename TTypes::CachedData>(this,
             &NodeLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::ReplayRequest>(this,
+            &NodeLogic::on_message_received);
     }
 
     void on_message_received(typename TTypes::CachedData&& msg,
@@ -48,8 +162,12 @@ protected:
         using namespace messaging;
 
         auto& tm = super::get_terminal_info(msg[fields::subscriptionId]);
-        tm.ext.lastReceivedMessage    = msg[fields::data];
-        tm.ext.lastReceivedMessageSet = true;
+        set_last_received_message(tm, msg[fields::data]);
+
+        // cached data is usually a message that we have seen already
+        if (!tm.ext.history.size()) {
+            add_to_history(tm, msg[fields::data]);
+        }
 
         super::template send_data_to_subscribers<typename TTypes::CachedData>(
             std::move(msg[fields::data]), msg[fields::subscriptionId], origin);
@@ -59,8 +177,8 @@ protected:
         base::Id terminalId, interfaces::IConnection& origin) override
     {
         auto& tm = super::get_terminal_info(terminalId);
-        tm.ext.lastReceivedMessage    = data;
-        tm.ext.lastReceivedMessageSet = true;
+        set_last_received_message(tm, data);
+        add_to_history(tm, data);
 
         super::on_data_received(std::move(data), terminalId, origin);
     }
@@ -93,6 +211,40 @@ protected:
             sendCachedData(connection, mappedId, tm);
         }
     }
+
+    void on_message_received(typename TTypes::ReplayRequest&& msg,
+        interfaces::IConnection& origin)
+    {
+        using namespace messaging;
+
+        auto& bd = super::get_binding_info(msg[fields::mappedId]);
+        auto owner = bd.owningLeafs.find(&origin);
+        if (owner == bd.owningLeafs.end() || !owner->second.is_mapped()
+            || !bd.terminal) {
+            return;
+        }
+
+        replay_history(origin, owner->second.mapped_id(),
+            super::get_terminal_info(bd.terminal), msg[fields::maxMessages],
+            std::chrono::milliseconds{msg[fields::maxAge]});
+    }
+
+public:
+    // applies to the history of every terminal; 0 messages disables it
+    void cps_set_history_limits(std::size_t maxMessages, std::size_t maxBytes)
+    {
+        auto lock = super::make_lock_guard();
+
+        m_historyMaxMessages = maxMessages;
+        m_historyMaxBytes    = maxBytes;
+    }
+
+    // nullptr stops persisting; applies to messages received from now on
+    void cps_set_last_value_store(std::shared_ptr<base::LastValueStore> store)
+    {
+        auto lock = super::make_lock_guard();
+        m_store = store;
+    }
 };
 
 } // namespace cached_publish_subscribe
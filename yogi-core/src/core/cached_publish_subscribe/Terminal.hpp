@@ -19,6 +19,8 @@ class LeafLogic;
 
 /***************************************************************************//**
  * Implements a cached publish-subscribe terminal
+ *
+ * Bindings can request a replay of the recent messages kept by the node.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class Terminal : public common::PublishSubscribeTerminalBaseT<TTypes, true>
@@ -52,6 +54,14 @@ public:
 
         return std::make_pair(true, n);
     }
+
+    void request_replay(base::Id bindingGroupId, std::size_t maxMessages,
+        base::MessageHistory::clock::time_point since)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(super::leaf()));
+        leafLogic.cps_request_replay(bindingGroupId, maxMessages, since);
+    }
 };
 
 } // namespace cached_publish_subscribe
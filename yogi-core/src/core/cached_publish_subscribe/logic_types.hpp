@@ -4,6 +4,9 @@
 #include "../../config.h"
 #include "../common/subscribable_logic_types.hpp"
 #include "../../messaging/messages/CachedPublishSubscribe.hpp"
+#include "../../base/MessageHistory.hpp"
+
+#include <string>
 
 
 namespace yogi {
@@ -36,10 +39,20 @@ struct logic_types
         bool         lastSentMessageSet = false;
     };
 
+    struct leaf_binding_info_ext_type
+    {
+        // replay requested before the binding group got established
+        bool                                    replayPending     = false;
+        std::size_t                             replayMaxMessages = 0;
+        base::MessageHistory::clock::time_point replaySince;
+    };
+
     struct node_terminal_info_ext_type
     {
-        base::Buffer lastReceivedMessage;
-        bool         lastReceivedMessageSet = false;
+        base::Buffer         lastReceivedMessage;
+        bool                 lastReceivedMessageSet = false;
+        base::MessageHistory history;
+        std::string          persistentKey; // set when first needed
     };
 };
 
@@ -14,6 +14,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <mutex>
+#include <condition_variable>
 #include <algorithm>
 
 
@@ -58,6 +59,9 @@ private:
     interfaces::IConnection* m_connection;
     terminal_register        m_terminals;
     binding_register         m_bindings;
+    std::mutex               m_unlockedSendsMutex;
+    std::condition_variable  m_unlockedSendsCv;
+    std::size_t              m_unlockedSends;
 
 private:
     void update_binding_state(binding_info& bd, bool established)
@@ -92,6 +96,7 @@ protected:
     explicit LeafLogicBaseT(interfaces::IScheduler& scheduler)
         : m_scheduler {scheduler.make_ptr<interfaces::IScheduler>()}
         , m_connection{nullptr}
+        , m_unlockedSends{0}
     {
         add_msg_handler<typename TTypes::TerminalDescription>(this,
             &LeafLogicBaseT::on_message_received);
@@ -151,6 +156,48 @@ protected:
         return *m_connection;
     }
 
+    /**
+     * Releases the lock and calls fn with the connection
+     *
+     * Used for sending operations that may block, e.g. while waiting for space
+     * in the send buffer of a TCP connection, so that other threads can use
+     * the leaf logic meanwhile. Connections write every message as a whole,
+     * so concurrent sends do not interleave. The connection does not get
+     * destroyed before fn returns.
+     *
+     * @param lock Lock acquired via make_lock_guard()
+     * @param fn   Function to call with the connection as parameter
+     */
+    template <typename TFn>
+    void send_unlocked(std::unique_lock<std::recursive_mutex>& lock, TFn fn)
+    {
+        auto& conn = connection();
+
+        {{
+            std::lock_guard<std::mutex> sendsLock{m_unlockedSendsMutex};
+            ++m_unlockedSends;
+        }}
+
+        lock.unlock();
+
+        auto finish = [&] {
+            std::lock_guard<std::mutex> sendsLock{m_unlockedSendsMutex};
+            if (--m_unlockedSends == 0) {
+                m_unlockedSendsCv.notify_all();
+            }
+        };
+
+        try {
+            fn(conn);
+        }
+        catch (...) {
+            finish();
+            throw;
+        }
+
+        finish();
+    }
+
     const msg_handler_lut_type& message_handlers() const
     {
         return m_msgHandlers;
@@ -203,6 +250,15 @@ protected:
     {
         auto lock = make_lock_guard();
 
+        // sends that are still running without the lock return once the
+        // connection is dead; no new ones can start while we hold the lock
+        {{
+            std::unique_lock<std::mutex> sendsLock{m_unlockedSendsMutex};
+            m_unlockedSendsCv.wait(sendsLock, [&] {
+                return m_unlockedSends == 0;
+            });
+        }}
+
         // reset the connection pointer
         YOGI_ASSERT(m_connection != nullptr);
         m_connection = nullptr;
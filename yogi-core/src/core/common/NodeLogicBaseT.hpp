@@ -5,6 +5,8 @@
 #include "../../interfaces/IScheduler.hpp"
 #include "../../interfaces/IConnection.hpp"
 #include "../../base/IdentifiedObjectRegister.hpp"
+#include "../../base/NameTrie.hpp"
+#include "../../base/SmallFlatMap.hpp"
 #include "../../messaging/fields/fields.hpp"
 #include "NodeLogicBase.hpp"
 #include "MappedObjectFsm.hpp"
@@ -13,8 +15,10 @@
 #include <boost/log/trivial.hpp>
 
 #include <mutex>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <algorithm>
 #include <functional>
 
@@ -32,7 +36,7 @@ class NodeLogicBaseT : public NodeLogicBase
     typedef NodeLogicBase super;
 
 protected:
-    typedef std::unordered_map<interfaces::IConnection*, MappedObjectFsm>
+    typedef base::SmallFlatMap<interfaces::IConnection*, MappedObjectFsm>
         fsm_map;
     typedef std::unordered_set<interfaces::IConnection*> connections_set;
 
@@ -56,11 +60,28 @@ protected:
         mutable typename TTypes::node_terminal_info_ext_type ext;
     };
 
+    struct wildcard_info
+    {
+        std::unordered_set<base::Id> expansions;
+        connections_set              establishedOwners;
+    };
+
+    // maps the owners of an expansion to the wildcard binding it came from
+    typedef base::SmallFlatMap<interfaces::IConnection*, base::Id, 1>
+        expansion_map;
+
     struct binding_info : public TTypes::node_binding_info_base_type
     {
         fsm_map  owningLeafs; // leafs that have such a binding
         base::Id terminal;    // ID of the associated local terminal
         mutable typename TTypes::node_binding_info_ext_type ext;
+
+        // wildcard bindings get expanded into ordinary bindings for every
+        // matching terminal; the owners of those expansions are mapped to the
+        // ID of the wildcard binding on the leaf. The state is only allocated
+        // for bindings involved in wildcard matching.
+        std::unique_ptr<wildcard_info> wildcard;     // if wildcard binding
+        std::unique_ptr<expansion_map> expandedFrom; // if expansion
     };
 
 protected:
@@ -84,6 +105,10 @@ private:
     terminal_register m_terminals;
     binding_register  m_bindings;
 
+    base::NameTrie<base::Id>     m_terminalNames; // only if wildcards exist
+    std::unordered_set<base::Id> m_wildcardBindings;
+    std::unordered_set<base::Id> m_dirtyWildcardBindings;
+
 private:
     binding_iterator associate(terminal_iterator tm)
     {
@@ -136,6 +161,311 @@ private:
         }
     }
 
+    void add_wildcard_binding(binding_iterator wc)
+    {
+        // the trie is only needed to resolve wildcard bindings, so it only
+        // gets built once the first wildcard binding arrives
+        if (m_wildcardBindings.empty()) {
+            for (auto& tm : m_terminals) {
+                if (!tm.hidden()) {
+                    m_terminalNames.insert(tm.identifier().name(), tm.id());
+                }
+            }
+        }
+
+        wc->wildcard.reset(new wildcard_info);
+        m_wildcardBindings.insert(wc->id());
+    }
+
+    void remove_wildcard_binding(binding_iterator wc)
+    {
+        m_wildcardBindings.erase(wc->id());
+        m_dirtyWildcardBindings.erase(wc->id());
+
+        if (m_wildcardBindings.empty()) {
+            m_terminalNames.clear();
+        }
+    }
+
+    void add_terminal_name(const_terminal_iterator tm)
+    {
+        if (!m_wildcardBindings.empty()) {
+            m_terminalNames.insert(tm->identifier().name(), tm->id());
+        }
+    }
+
+    void remove_terminal_name(const_terminal_iterator tm)
+    {
+        if (!m_wildcardBindings.empty()) {
+            m_terminalNames.erase(tm->identifier().name(), tm->id());
+        }
+    }
+
+    static bool matches_wildcard(const_binding_iterator wc,
+        const base::Identifier& identifier)
+    {
+        auto& pattern = wc->identifier();
+        return pattern.signature() == identifier.signature()
+            && pattern.hidden() == identifier.hidden()
+            && base::NameTrie<base::Id>::matches(pattern.name(),
+                identifier.name());
+    }
+
+    template <typename TMsg>
+    void send_binding_state(const binding_info& bd,
+        const typename fsm_map::value_type& owner)
+    {
+		using namespace messaging;
+
+        // the state of an expansion is reported for the whole wildcard binding
+        // once the current message has been handled
+        if (bd.expandedFrom) {
+            auto wc = bd.expandedFrom->find(owner.first);
+            if (wc != bd.expandedFrom->end()) {
+                m_dirtyWildcardBindings.insert(wc->second);
+                return;
+            }
+        }
+
+        TMsg msg;
+        msg[fields::bindingId] = owner.second.mapped_id();
+        owner.first->send(msg);
+    }
+
+    void add_binding_expansion(binding_iterator wc,
+        interfaces::IConnection& owner, const base::Identifier& identifier,
+        bool notify)
+    {
+        auto wcOwner = wc->owningLeafs.find(&owner);
+        if (wcOwner == wc->owningLeafs.end() || !wcOwner->second.is_mapped()) {
+            return;
+        }
+
+        // an explicit binding of the owner takes precedence
+        auto bd = m_bindings.insert(identifier).first;
+        if (bd->owningLeafs.count(&owner)) {
+            return;
+        }
+
+        auto& fsm = bd->owningLeafs[&owner];
+        fsm.process_rcvd_description(wcOwner->second.mapped_id(), [] {},
+            [](base::Id) {}, [](bool) {});
+
+        if (!bd->expandedFrom) {
+            bd->expandedFrom.reset(new expansion_map);
+        }
+
+        (*bd->expandedFrom)[&owner] = wc->id();
+        wc->wildcard->expansions.insert(bd->id());
+        m_dirtyWildcardBindings.insert(wc->id());
+
+        if (notify) {
+            associate(bd);
+            on_binding_owner_added(owner, bd, fsm.mapped_id());
+        }
+    }
+
+    // returns false if the binding has been removed as a result
+    bool remove_binding_expansion(binding_iterator bd,
+        interfaces::IConnection& owner)
+    {
+        YOGI_ASSERT(bd->expandedFrom);
+        auto from = bd->expandedFrom->find(&owner);
+        YOGI_ASSERT(from != bd->expandedFrom->end());
+
+        auto wcId = from->second;
+        bd->expandedFrom->erase(from);
+        bd->owningLeafs.erase(&owner);
+        on_binding_owner_removed(owner, bd);
+
+        auto stillExpanded = std::any_of(bd->expandedFrom->begin(),
+            bd->expandedFrom->end(),
+            [&](const std::pair<interfaces::IConnection*, base::Id>& from) {
+                return from.second == wcId;
+            });
+
+        if (!stillExpanded) {
+            m_bindings[wcId].wildcard->expansions.erase(bd->id());
+        }
+
+        if (bd->expandedFrom->empty()) {
+            bd->expandedFrom.reset();
+        }
+
+        m_dirtyWildcardBindings.insert(wcId);
+
+        if (bd->owningLeafs.empty()) {
+            disassociate(bd);
+            m_bindings.erase(bd);
+            return false;
+        }
+
+        return true;
+    }
+
+    void expand_wildcard_bindings(const base::Identifier& identifier,
+        interfaces::IConnection* owner, bool notify)
+    {
+        for (auto wcId : m_wildcardBindings) {
+            auto wc = m_bindings.find(wcId);
+            if (!matches_wildcard(wc, identifier)) {
+                continue;
+            }
+
+            for (auto& wcOwner : wc->owningLeafs) {
+                if (!owner || wcOwner.first == owner) {
+                    add_binding_expansion(wc, *wcOwner.first, identifier,
+                        notify);
+                }
+            }
+        }
+    }
+
+    void expand_wildcard_binding(binding_iterator wc,
+        interfaces::IConnection& owner)
+    {
+        // the trie only contains terminals that can be found by identifier
+        std::vector<base::Id> terminals;
+        m_terminalNames.find_matches(wc->identifier().name(),
+            [&](base::Id tmId) { terminals.push_back(tmId); });
+
+        for (auto tmId : terminals) {
+            auto tm = m_terminals.find(tmId);
+            if (tm != m_terminals.end() && !tm->hidden()
+                && matches_wildcard(wc, tm->identifier())) {
+                add_binding_expansion(wc, owner, tm->identifier(), true);
+            }
+        }
+    }
+
+    static bool is_expanded_from(const binding_info& bd,
+        interfaces::IConnection& owner, base::Id wcId)
+    {
+        if (!bd.expandedFrom) {
+            return false;
+        }
+
+        auto from = bd.expandedFrom->find(&owner);
+        return from != bd.expandedFrom->end() && from->second == wcId;
+    }
+
+    void remove_wildcard_binding_expansions(binding_iterator wc,
+        interfaces::IConnection& owner)
+    {
+        std::vector<base::Id> expansions(wc->wildcard->expansions.begin(),
+            wc->wildcard->expansions.end());
+
+        for (auto bdId : expansions) {
+            auto bd = m_bindings.find(bdId);
+            if (is_expanded_from(*bd, owner, wc->id())) {
+                remove_binding_expansion(bd, owner);
+            }
+        }
+
+        wc->wildcard->establishedOwners.erase(&owner);
+    }
+
+    void remap_wildcard_binding_expansions(binding_iterator wc,
+        interfaces::IConnection& owner, base::Id newMappedId)
+    {
+        for (auto bdId : wc->wildcard->expansions) {
+            auto bd = m_bindings.find(bdId);
+            if (!is_expanded_from(*bd, owner, wc->id())) {
+                continue;
+            }
+
+            auto& fsm = bd->owningLeafs[&owner];
+            fsm = MappedObjectFsm{};
+            fsm.process_rcvd_description(newMappedId, [] {}, [](base::Id) {},
+                [](bool) {});
+
+            on_binding_owner_remapped(owner, bd, newMappedId);
+        }
+
+        // the leaf does not know about the state of the binding any more
+        wc->wildcard->establishedOwners.erase(&owner);
+        m_dirtyWildcardBindings.insert(wc->id());
+    }
+
+    void remove_binding_expansions(binding_iterator bd)
+    {
+        if (!bd->expandedFrom) {
+            return;
+        }
+
+        std::vector<interfaces::IConnection*> owners;
+        for (auto& from : *bd->expandedFrom) {
+            owners.push_back(from.first);
+        }
+
+        for (auto owner : owners) {
+            if (!remove_binding_expansion(bd, *owner)) {
+                break;
+            }
+        }
+    }
+
+    bool is_wildcard_binding_established(const_binding_iterator wc,
+        interfaces::IConnection& owner)
+    {
+        for (auto bdId : wc->wildcard->expansions) {
+            auto& bd = m_bindings[bdId];
+            if (!is_expanded_from(bd, owner, wc->id()) || !bd.terminal) {
+                continue;
+            }
+
+            auto& tm = m_terminals[bd.terminal];
+            if (!tm.owningNodes.empty()
+                || tm.owningLeafs.size() > tm.owningLeafs.count(&owner)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void update_wildcard_binding_states()
+    {
+		using namespace messaging;
+
+        for (auto wcId : m_dirtyWildcardBindings) {
+            auto wc = m_bindings.find(wcId);
+            if (wc == m_bindings.end() || !wc->wildcard) {
+                continue;
+            }
+
+            for (auto& owner : wc->owningLeafs) {
+                if (!owner.second.is_mapped()) {
+                    continue;
+                }
+
+                auto& establishedOwners = wc->wildcard->establishedOwners;
+                bool established = is_wildcard_binding_established(wc,
+                    *owner.first);
+                if (established == !!establishedOwners.count(owner.first)) {
+                    continue;
+                }
+
+                if (established) {
+                    establishedOwners.insert(owner.first);
+
+                    typename TTypes::BindingEstablished msg;
+                    msg[fields::bindingId] = owner.second.mapped_id();
+                    owner.first->send(msg);
+                }
+                else {
+                    establishedOwners.erase(owner.first);
+
+                    typename TTypes::BindingReleased msg;
+                    msg[fields::bindingId] = owner.second.mapped_id();
+                    owner.first->send(msg);
+                }
+            }
+        }
+
+        m_dirtyWildcardBindings.clear();
+    }
+
     fsm_map& ownersMap(terminal_iterator tm,
         const interfaces::IConnection& connection)
     {
@@ -156,6 +486,10 @@ private:
                     m_knownTerminalsChangedFn(tm->identifier(), false);
                 }
 
+                if (!tm->hidden()) {
+                    remove_terminal_name(tm);
+                }
+
                 m_terminals.erase(tm);
                 return false;
         }
@@ -258,11 +592,14 @@ private:
 
         // store the binding Id for later
         auto bindingId = tm->binding;
+        bool abandoned = false;
 
         // process the FSM for terminal related stuff
         switch (tm->state) {
         case STATE_OWNERS_1_LEAFS_0_NODES:
         case STATE_OWNERS_0_LEAFS_1_NODES:
+            abandoned = true;
+            remove_terminal_name(tm);
             m_terminals.hide(tm);
             disassociate(tm);
             update_users_for_abandoned_terminal(tm, &connection);
@@ -286,11 +623,12 @@ private:
                 auto& bd = m_bindings[bindingId];
                 for (auto& owner : bd.owningLeafs) {
                     if (owner.first != &connection) {
-                        typename TTypes::BindingReleased msg;
-                        msg[fields::bindingId] = owner.second.mapped_id();
-                        owner.first->send(msg);
+                        send_binding_state<typename TTypes::BindingReleased>(
+                            bd, owner);
                     }
                 }
+
+                remove_binding_expansions(m_bindings.find(bindingId));
             }
 
             return;
@@ -330,22 +668,24 @@ private:
                 auto owner = bd.owningLeafs.find(
                     tm->owningLeafs.begin()->first);
                 if (owner != bd.owningLeafs.end()) {
-                    typename TTypes::BindingReleased msg;
-                    msg[fields::bindingId] = owner->second.mapped_id();
-
-                    owner->first->send(msg);
+                    send_binding_state<typename TTypes::BindingReleased>(bd,
+                        *owner);
                 }
             }
             else if (tm->state == STATE_AWAIT_ACKS) {
                 for (auto& owner : bd.owningLeafs) {
                     if (owner.first != &connection) {
-                        typename TTypes::BindingReleased msg;
-                        msg[fields::bindingId] = owner.second.mapped_id();
-
-                        owner.first->send(msg);
+                        send_binding_state<typename TTypes::BindingReleased>(
+                            bd, owner);
                     }
                 }
             }
+
+            // bindings created for wildcard bindings only exist as long as
+            // the terminal can be found
+            if (abandoned) {
+                remove_binding_expansions(m_bindings.find(bindingId));
+            }
         }
 
         // if the terminal does not have any owners any more, we remove the
@@ -390,6 +730,7 @@ protected:
             interfaces::IConnection& origin) {
             auto lock = make_lock_guard();
             (tgt->*fn)(std::move(static_cast<TMsg&>(msg)), origin);
+            update_wildcard_binding_states();
         };
     }
 
@@ -408,6 +749,13 @@ protected:
         return m_terminals[id];
     }
 
+    static const base::Identifier& get_terminal_identifier(
+        const terminal_info& tm)
+    {
+        return static_cast<const typename terminal_register::element_type&>(
+            tm).identifier();
+    }
+
     const binding_info& get_binding_info(base::Id id)
     {
         return m_bindings[id];
@@ -475,6 +823,14 @@ protected:
             return;
         }
 
+        // remove the expansions of the connection's wildcard bindings
+        for (auto wcId : m_wildcardBindings) {
+            auto wc = m_bindings.find(wcId);
+            if (wc->owningLeafs.count(&connection)) {
+                remove_wildcard_binding_expansions(wc, connection);
+            }
+        }
+
         // remove binding owners
         auto bd = m_bindings.begin();
         while (bd != m_bindings.end()) {
@@ -484,6 +840,10 @@ protected:
 
             if (bd->owningLeafs.empty()) {
                 disassociate(bd);
+                if (bd->wildcard) {
+                    remove_wildcard_binding(bd);
+                }
+
                 bd = m_bindings.erase(bd);
             }
             else {
@@ -506,6 +866,8 @@ protected:
 
             tm = tmpTm;
         }
+
+        update_wildcard_binding_states();
     }
 
     virtual void on_terminal_owner_added(interfaces::IConnection& connection,
@@ -655,6 +1017,13 @@ public:
             YOGI_NEVER_REACHED;
         }
 
+        // expand matching wildcard bindings; the derived classes get
+        // informed about the new binding owners via the terminal owner below
+        if (terminalAdded) {
+            add_terminal_name(tm);
+            expand_wildcard_bindings(tm->identifier(), nullptr, false);
+        }
+
         // try to associate the terminal with a binding
         auto bd = associate(tm);
 
@@ -663,10 +1032,8 @@ public:
             if (tm->state == STATE_JUST_CREATED) {
                 for (auto& owner : bd->owningLeafs) {
                     if (owner.first != &origin) {
-                        typename TTypes::BindingEstablished msg;
-                        msg[fields::bindingId] = owner.second.mapped_id();
-
-                        owner.first->send(msg);
+                        send_binding_state<typename TTypes::BindingEstablished>(
+                            *bd, owner);
                     }
                 }
             }
@@ -675,10 +1042,9 @@ public:
                     if (epOwner.first != &origin) {
                         auto bdOwner = bd->owningLeafs.find(epOwner.first);
                         if (bdOwner != bd->owningLeafs.end()) {
-                            typename TTypes::BindingEstablished msg;
-                            msg[fields::bindingId] = bdOwner->second.mapped_id();
-
-                            bdOwner->first->send(msg);
+                            send_binding_state<
+                                typename TTypes::BindingEstablished>(*bd,
+                                    *bdOwner);
                         }
                         break;
                     }
@@ -818,8 +1184,19 @@ public:
         // we can only receive this message from a leaf
         YOGI_ASSERT(!origin.remote_is_node());
 
-        // create/get the binding and the owner entry
-        auto bd        = m_bindings.insert(msg[fields::identifier]).first;
+        // create/get the binding; an explicit binding replaces a binding that
+        // has been created for one of the leaf's wildcard bindings
+        auto bd = m_bindings.insert(msg[fields::identifier]).first;
+        if (bd->expandedFrom && bd->expandedFrom->count(&origin)) {
+            remove_binding_expansion(bd, origin);
+            bd = m_bindings.insert(msg[fields::identifier]).first;
+        }
+
+        if (!bd->wildcard && bd->identifier().wildcard()) {
+            add_wildcard_binding(bd);
+        }
+
+        // create/get the owner entry
         auto& ownerFsm = bd->owningLeafs[&origin];
 
         // map the binding and add the connection as an owner; if we already
@@ -845,10 +1222,21 @@ public:
         );
 
         if (oldMappedId) {
+            if (bd->wildcard) {
+                remap_wildcard_binding_expansions(bd, origin,
+                    ownerFsm.mapped_id());
+            }
+
             on_binding_owner_remapped(origin, bd, ownerFsm.mapped_id());
             return;
         }
 
+        // wildcard bindings are resolved by binding to all matching terminals
+        if (bd->wildcard) {
+            expand_wildcard_binding(bd, origin);
+            return;
+        }
+
         // try to associate the binding with a terminal
         auto tm = associate(bd);
 
@@ -895,15 +1283,29 @@ public:
             return;
         }
 
+        if (bd->wildcard) {
+            remove_wildcard_binding_expansions(bd, origin);
+        }
+
         // remove the owner
+        auto identifier = bd->identifier();
         bd->owningLeafs.erase(owner);
         on_binding_owner_removed(origin, bd);
 
         // if there are no more binding owners, we remove the binding
         if (bd->owningLeafs.empty()) {
             disassociate(bd);
+            if (bd->wildcard) {
+                remove_wildcard_binding(bd);
+            }
+
             m_bindings.erase(bd);
         }
+
+        // the leaf's wildcard bindings may apply to the terminal now
+        if (m_terminals.find(identifier) != m_terminals.end()) {
+            expand_wildcard_bindings(identifier, &origin, true);
+        }
     }
 };
 
@@ -4,6 +4,8 @@
 #include "../../config.h"
 #include "SubscribableLeafLogicBaseT.hpp"
 
+#include <vector>
+
 
 namespace yogi {
 namespace core {
@@ -30,22 +32,40 @@ protected:
     {
 		using namespace messaging;
 
-        auto& bindings = super::get_binding_info(msg[fields::subscriptionId])
-			.bindings;
+        auto& bd = super::get_binding_info(msg[fields::subscriptionId]);
+        on_binding_data_received(bd);
+
+        auto& bindings = bd.bindings;
         if (bindings.empty()) {
             return;
         }
 
+        if (!accept_binding_data(bd, msg[fields::data])) {
+            return;
+        }
+
         auto& info = super::get_terminal_info(bindings[0]->terminal().id());
         on_data_received(info, std::move(msg[fields::data]));
     }
 
+    // lets inheriting classes drop or hold back the data for a binding group
+    virtual bool accept_binding_data(const typename super::binding_info& bd,
+        const base::Buffer& data)
+    {
+        return true;
+    }
+
     virtual void on_data_received(const typename super::terminal_info& tm,
         base::Buffer&& data)
     {
         tm.terminal->on_data_received(std::move(data), false);
     }
 
+    virtual void on_binding_data_received(
+        const typename super::binding_info& bd)
+    {
+    }
+
     virtual void on_data_published(const typename super::terminal_info& tm,
         base::Buffer&& data)
     {
@@ -59,6 +79,61 @@ public:
 
         auto lock = super::make_lock_guard();
 
+        auto& tm = super::get_terminal_info(terminal.id());
+        if (!tm.subscribed) {
+            on_data_published(tm, std::move(data));
+            return false;
+        }
+
+        typename TTypes::Data msg;
+        msg[fields::subscriptionId] = tm.fsm.mapped_id();
+        msg[fields::data]           = data;
+
+        on_data_published(tm, std::move(data));
+
+        // waiting for the connection must not block the non-blocking
+        // functions and the routing of received messages
+        super::send_unlocked(lock, [&](interfaces::IConnection& conn) {
+            conn.send(msg);
+        });
+
+        return true;
+    }
+
+    bool try_publish(typename TTypes::terminal_type& terminal,
+        base::Buffer&& data)
+    {
+		using namespace messaging;
+
+        auto lock = super::make_lock_guard();
+
+        bool dataSent = false;
+        auto& tm = super::get_terminal_info(terminal.id());
+        if (tm.subscribed) {
+            typename TTypes::Data msg;
+            msg[fields::subscriptionId] = tm.fsm.mapped_id();
+            msg[fields::data]           = data;
+
+            if (!super::connection().try_send(msg)) {
+                throw api::ExceptionT<YOGI_ERR_WOULD_BLOCK>{};
+            }
+
+            dataSent = true;
+        }
+
+        on_data_published(tm, std::move(data));
+
+        return dataSent;
+    }
+
+    bool async_publish(typename TTypes::terminal_type& terminal,
+        base::Buffer&& data,
+        interfaces::IConnection::send_handler_fn handlerFn)
+    {
+		using namespace messaging;
+
+        auto lock = super::make_lock_guard();
+
         bool dataSent = false;
         auto& tm = super::get_terminal_info(terminal.id());
         if (tm.subscribed) {
@@ -66,7 +141,7 @@ public:
             msg[fields::subscriptionId] = tm.fsm.mapped_id();
             msg[fields::data]           = data;
 
-            super::connection().send(msg);
+            super::connection().async_send(msg, handlerFn);
             dataSent = true;
         }
 
@@ -74,6 +149,43 @@ public:
 
         return dataSent;
     }
+
+    bool publish_batch(typename TTypes::terminal_type& terminal,
+        std::vector<base::Buffer>&& data)
+    {
+		using namespace messaging;
+
+        auto lock = super::make_lock_guard();
+
+        auto& tm = super::get_terminal_info(terminal.id());
+        if (!tm.subscribed) {
+            for (auto& buffer : data) {
+                on_data_published(tm, std::move(buffer));
+            }
+
+            return false;
+        }
+
+        std::vector<typename TTypes::Data> msgs(data.size());
+        std::vector<const interfaces::IMessage*> msgPtrs;
+        msgPtrs.reserve(data.size());
+
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            msgs[i][fields::subscriptionId] = tm.fsm.mapped_id();
+            msgs[i][fields::data]           = data[i];
+            msgPtrs.push_back(&msgs[i]);
+        }
+
+        for (auto& buffer : data) {
+            on_data_published(tm, std::move(buffer));
+        }
+
+        super::send_unlocked(lock, [&](interfaces::IConnection& conn) {
+            conn.send_batch(msgPtrs);
+        });
+
+        return true;
+    }
 };
 
 } // namespace common
@@ -42,6 +42,21 @@ protected:
             terminalId, origin);
     }
 
+    // returns false if the data shall not be sent to the subscribing node
+    virtual bool forward_to_subscriber(const typename super::terminal_info& tm,
+        interfaces::IConnection& subscriber, const base::Buffer& data)
+    {
+        return true;
+    }
+
+    // returns false if the data shall not be sent to the binding owner (now)
+    virtual bool forward_to_binding_owner(base::Id bindingId,
+        const typename super::binding_info& bd,
+        interfaces::IConnection& owner, const base::Buffer& data)
+    {
+        return true;
+    }
+
     template <typename TMsg>
     void send_data_to_subscribers(base::Buffer&& data,
         base::Id terminalId, interfaces::IConnection& origin)
@@ -54,7 +69,8 @@ protected:
         auto& tm = super::get_terminal_info(terminalId);
         for (auto& subscriber : tm.subscribers) {
             auto conn = const_cast<interfaces::IConnection*>(subscriber.first);
-            if (conn != &origin) {
+            if (conn != &origin && forward_to_subscriber(tm, *conn,
+                fwMsg[fields::data])) {
                 YOGI_ASSERT(tm.usingNodes.count(conn));
                 YOGI_ASSERT(tm.usingNodes.find(conn)->second.is_mapped());
                 fwMsg[fields::subscriptionId] = subscriber.second;
@@ -65,7 +81,8 @@ protected:
         if (tm.binding) {
             auto& bd = super::get_binding_info(tm.binding);
             for (auto& owner : bd.owningLeafs) {
-                if (owner.first != &origin) {
+                if (owner.first != &origin && forward_to_binding_owner(
+                    tm.binding, bd, *owner.first, fwMsg[fields::data])) {
                     YOGI_ASSERT(owner.second.is_mapped());
                     fwMsg[fields::subscriptionId] = owner.second.mapped_id();
                     owner.first->send(fwMsg);
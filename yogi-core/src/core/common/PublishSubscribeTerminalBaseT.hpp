@@ -5,11 +5,17 @@
 #include "../../base/Buffer.hpp"
 #include "../../base/AsyncOperation.hpp"
 #include "../../api/ExceptionT.hpp"
+#include "../../interfaces/IMessageReceiver.hpp"
+#include "../../interfaces/IConnection.hpp"
 #include "SubscribableTerminalBaseT.hpp"
 
 #include <boost/asio/buffer.hpp>
 
 #include <atomic>
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <cstring>
 
 
 namespace yogi {
@@ -56,9 +62,15 @@ struct PublishSubscribeTerminalBaseHelper<false>
 /***************************************************************************//**
  * Templated base class for terminals based on the publish-subscribe messaging
  * pattern
+ *
+ * Received messages get delivered to the active receive operation. If no
+ * receive operation is active, they get stored in the optional receive queue
+ * and are delivered to the next receive operations. Only one of the single,
+ * batch and loan receive operations can be active at a time.
  ******************************************************************************/
 template <typename TTypes, bool THasCache>
 class PublishSubscribeTerminalBaseT : public SubscribableTerminalBaseT
+                                    , public interfaces::IMessageReceiver
 {
 public:
     typedef TTypes logic_types;
@@ -67,12 +79,148 @@ public:
     typedef internal::PublishSubscribeTerminalBaseHelper<THasCache> helper;
     typedef typename helper::rcv_handler_fn rcv_handler_fn;
 
+private:
+    struct queued_message {
+        base::Buffer data;
+        bool         cached;
+    };
+
 private:
     const base::Id m_id;
 
-    std::recursive_mutex                 m_rcvMutex;
-    boost::asio::mutable_buffers_1       m_rcvBuffer;
-    base::AsyncOperation<rcv_handler_fn> m_rcvPublishedMsgOp;
+    std::recursive_mutex                   m_rcvMutex;
+    boost::asio::mutable_buffers_1         m_rcvBuffer;
+    base::AsyncOperation<rcv_handler_fn>   m_rcvPublishedMsgOp;
+    base::AsyncOperation<batch_handler_fn> m_rcvPublishedMsgsOp;
+    base::AsyncOperation<loan_handler_fn>  m_rcvPublishedMsgLoanOp;
+    std::deque<queued_message>             m_rcvQueue;
+    std::size_t                            m_rcvQueueDepth;
+    overflow_policy                        m_rcvQueuePolicy;
+    std::atomic<unsigned long long>        m_droppedMessages;
+
+private:
+    void deliver_message(const base::Buffer& data, bool cached)
+    {
+        std::size_t n = boost::asio::buffer_copy(m_rcvBuffer,
+            boost::asio::buffer(data.data(), data.size()));
+        m_rcvBuffer = boost::asio::mutable_buffers_1{boost::asio::mutable_buffer{}};
+
+        if (n == data.size()) {
+            helper::template fire_async_operation<YOGI_OK>(
+                &m_rcvPublishedMsgOp, data.size(), cached);
+        }
+        else {
+            helper::template fire_async_operation<YOGI_ERR_BUFFER_TOO_SMALL>(
+                &m_rcvPublishedMsgOp, data.size(), cached);
+        }
+    }
+
+    // writes as many queued messages as possible into the batch buffer
+    void deliver_queued_messages_batch()
+    {
+        auto dst  = boost::asio::buffer_cast<char*>(m_rcvBuffer);
+        auto size = boost::asio::buffer_size(m_rcvBuffer);
+        m_rcvBuffer = boost::asio::mutable_buffers_1{boost::asio::mutable_buffer{}};
+
+        auto required = YOGI_RQ_MESSAGE_HEADER_SIZE
+            + m_rcvQueue.front().data.size();
+        if (required > size) {
+            // keep the message so it can be received with a larger buffer
+            // unless it does not fit into the receive queue
+            if (m_rcvQueue.size() > m_rcvQueueDepth) {
+                m_rcvQueue.pop_front();
+                ++m_droppedMessages;
+            }
+
+            m_rcvPublishedMsgsOp.template fire<YOGI_ERR_BUFFER_TOO_SMALL>(
+                std::size_t{0}, required);
+            return;
+        }
+
+        std::size_t numMessages = 0;
+        std::size_t offset      = 0;
+        while (!m_rcvQueue.empty()) {
+            auto& msg = m_rcvQueue.front();
+            if (YOGI_RQ_MESSAGE_HEADER_SIZE + msg.data.size()
+                > size - offset) {
+                break;
+            }
+
+            auto msgSize = static_cast<std::uint32_t>(msg.data.size());
+            std::memcpy(dst + offset, &msgSize, 4);
+            dst[offset + 4] = msg.cached ? 1 : 0;
+            std::memcpy(dst + offset + YOGI_RQ_MESSAGE_HEADER_SIZE,
+                msg.data.data(), msg.data.size());
+
+            offset += YOGI_RQ_MESSAGE_HEADER_SIZE + msg.data.size();
+            ++numMessages;
+            m_rcvQueue.pop_front();
+        }
+
+        m_rcvPublishedMsgsOp.template fire<YOGI_OK>(numMessages, offset);
+    }
+
+    void deliver_queued_messages()
+    {
+        if (m_rcvQueue.empty()) {
+            return;
+        }
+
+        if (m_rcvPublishedMsgOp.armed()) {
+            auto msg = std::move(m_rcvQueue.front());
+            m_rcvQueue.pop_front();
+            deliver_message(msg.data, msg.cached);
+        }
+        else if (m_rcvPublishedMsgsOp.armed()) {
+            deliver_queued_messages_batch();
+        }
+        else if (m_rcvPublishedMsgLoanOp.armed()) {
+            auto msg = std::move(m_rcvQueue.front());
+            m_rcvQueue.pop_front();
+            m_rcvPublishedMsgLoanOp.template fire<YOGI_OK>(
+                std::move(msg.data), msg.cached);
+        }
+    }
+
+    void check_no_receive_operation_running() const
+    {
+        if (m_rcvPublishedMsgOp.armed() || m_rcvPublishedMsgsOp.armed()
+            || m_rcvPublishedMsgLoanOp.armed()) {
+            throw api::ExceptionT<YOGI_ERR_ASYNC_OPERATION_RUNNING>{};
+        }
+    }
+
+    // queued messages get delivered from a scheduler thread so that the
+    // handler does not run within the call arming the receive operation
+    void post_queued_messages_delivery()
+    {
+        std::weak_ptr<interfaces::IPublicObject> weakSelf
+            = this->shared_from_this();
+
+        leaf().scheduler().post(
+            scheduling::SchedulerStatistics::DISPATCH, [=] {
+                auto self = weakSelf.lock();
+                if (self) {
+                    auto lock = make_lock_guard();
+                    deliver_queued_messages();
+                }
+            });
+    }
+
+    void enqueue_message(base::Buffer&& data, bool cached)
+    {
+        if (m_rcvQueue.size() >= m_rcvQueueDepth) {
+            ++m_droppedMessages;
+
+            if (m_rcvQueuePolicy == DROP_NEWEST || m_rcvQueue.empty()) {
+                return;
+            }
+
+            m_rcvQueue.pop_front();
+        }
+
+        m_rcvQueue.push_back(queued_message{std::move(data), cached});
+    }
 
 protected:
     std::unique_lock<std::recursive_mutex> make_lock_guard()
@@ -86,6 +234,9 @@ protected:
         , m_id{register_me<Leaf, leaf_logic_type>(
 			static_cast<terminal_type&>(*this))}
         , m_rcvBuffer(boost::asio::mutable_buffer{})
+        , m_rcvQueueDepth{0}
+        , m_rcvQueuePolicy{DROP_OLDEST}
+        , m_droppedMessages{0}
     {
     }
 
@@ -94,7 +245,14 @@ public:
     {
         helper::template fire_async_operation<YOGI_ERR_CANCELED>(
             &m_rcvPublishedMsgOp, 0, false);
+        m_rcvPublishedMsgsOp.template fire<YOGI_ERR_CANCELED>(
+            std::size_t{0}, std::size_t{0});
+        m_rcvPublishedMsgLoanOp.template fire<YOGI_ERR_CANCELED>(
+            base::Buffer{}, false);
+
         m_rcvPublishedMsgOp.await_idle();
+        m_rcvPublishedMsgsOp.await_idle();
+        m_rcvPublishedMsgLoanOp.await_idle();
 
         deregister_me<Leaf, TTypes>(static_cast<terminal_type&>(*this));
     }
@@ -112,13 +270,43 @@ public:
             std::move(data));
     }
 
+    bool try_publish(base::Buffer&& data)
+    {
+        auto& leafLogic = static_cast<leaf_logic_type&>(
+			static_cast<Leaf&>(leaf()));
+        return leafLogic.try_publish(static_cast<terminal_type&>(*this),
+            std::move(data));
+    }
+
+    bool async_publish(base::Buffer&& data,
+        interfaces::IConnection::send_handler_fn handlerFn)
+    {
+        auto& leafLogic = static_cast<leaf_logic_type&>(
+			static_cast<Leaf&>(leaf()));
+        return leafLogic.async_publish(static_cast<terminal_type&>(*this),
+            std::move(data), handlerFn);
+    }
+
+    bool publish_batch(std::vector<base::Buffer>&& data)
+    {
+        auto& leafLogic = static_cast<leaf_logic_type&>(
+			static_cast<Leaf&>(leaf()));
+        return leafLogic.publish_batch(static_cast<terminal_type&>(*this),
+            std::move(data));
+    }
+
     void async_receive_published_message(
         boost::asio::mutable_buffers_1 buffer, rcv_handler_fn handlerFn)
     {
         auto lock = make_lock_guard();
+        check_no_receive_operation_running();
 
         m_rcvPublishedMsgOp.arm(handlerFn);
         m_rcvBuffer = buffer;
+
+        if (!m_rcvQueue.empty()) {
+            post_queued_messages_delivery();
+        }
     }
 
     void cancel_receive_published_message()
@@ -131,21 +319,95 @@ public:
         m_rcvBuffer = boost::asio::mutable_buffers_1{boost::asio::mutable_buffer{}};
     }
 
-    void on_data_received(base::Buffer&& data, bool cached)
+    virtual void set_receive_queue(std::size_t depth,
+        overflow_policy policy) override
     {
         auto lock = make_lock_guard();
 
-        std::size_t n = boost::asio::buffer_copy(m_rcvBuffer,
-            boost::asio::buffer(data.data(), data.size()));
+        m_rcvQueueDepth  = depth;
+        m_rcvQueuePolicy = policy;
+
+        while (m_rcvQueue.size() > depth) {
+            if (policy == DROP_OLDEST) {
+                m_rcvQueue.pop_front();
+            }
+            else {
+                m_rcvQueue.pop_back();
+            }
+
+            ++m_droppedMessages;
+        }
+    }
+
+    virtual unsigned long long dropped_messages() const override
+    {
+        return m_droppedMessages;
+    }
+
+    virtual void async_receive_published_messages(
+        boost::asio::mutable_buffers_1 buffer,
+        batch_handler_fn handlerFn) override
+    {
+        auto lock = make_lock_guard();
+        check_no_receive_operation_running();
+
+        m_rcvPublishedMsgsOp.arm(handlerFn);
+        m_rcvBuffer = buffer;
+
+        if (!m_rcvQueue.empty()) {
+            post_queued_messages_delivery();
+        }
+    }
+
+    virtual void cancel_receive_published_messages() override
+    {
+        auto lock = make_lock_guard();
+
+        m_rcvPublishedMsgsOp.template fire<YOGI_ERR_CANCELED>(
+            std::size_t{0}, std::size_t{0});
+
         m_rcvBuffer = boost::asio::mutable_buffers_1{boost::asio::mutable_buffer{}};
+    }
 
-        if (n == data.size()) {
-            helper::template fire_async_operation<YOGI_OK>(
-                &m_rcvPublishedMsgOp, data.size(), cached);
+    virtual void async_receive_published_message_loan(
+        loan_handler_fn handlerFn) override
+    {
+        auto lock = make_lock_guard();
+        check_no_receive_operation_running();
+
+        m_rcvPublishedMsgLoanOp.arm(handlerFn);
+
+        if (!m_rcvQueue.empty()) {
+            post_queued_messages_delivery();
+        }
+    }
+
+    virtual void cancel_receive_published_message_loan() override
+    {
+        auto lock = make_lock_guard();
+
+        m_rcvPublishedMsgLoanOp.template fire<YOGI_ERR_CANCELED>(
+            base::Buffer{}, false);
+    }
+
+    void on_data_received(base::Buffer&& data, bool cached)
+    {
+        auto lock = make_lock_guard();
+
+        // keep the order of messages that are still waiting for delivery
+        if (m_rcvQueue.empty() && m_rcvPublishedMsgOp.armed()) {
+            deliver_message(data, cached);
+        }
+        else if (m_rcvQueue.empty() && m_rcvPublishedMsgsOp.armed()) {
+            m_rcvQueue.push_back(queued_message{std::move(data), cached});
+            deliver_queued_messages_batch();
+        }
+        else if (m_rcvQueue.empty() && m_rcvPublishedMsgLoanOp.armed()) {
+            m_rcvPublishedMsgLoanOp.template fire<YOGI_OK>(std::move(data),
+                cached);
         }
         else {
-            helper::template fire_async_operation<YOGI_ERR_BUFFER_TOO_SMALL>(
-                &m_rcvPublishedMsgOp, data.size(), cached);
+            enqueue_message(std::move(data), cached);
         }
     }
 };
@@ -4,10 +4,9 @@
 #include "../../config.h"
 #include "../../interfaces/IConnection.hpp"
 #include "../../base/Id.hpp"
+#include "../../base/SmallFlatMap.hpp"
 #include "logic_types.hpp"
 
-#include <unordered_map>
-
 
 namespace yogi {
 namespace core {
@@ -22,7 +21,7 @@ struct subscribable_logic_types : public logic_types
 
     struct node_terminal_info_base_type
     {
-        mutable std::unordered_map<interfaces::IConnection*, base::Id>
+        mutable base::SmallFlatMap<interfaces::IConnection*, base::Id>
             subscribers; // nodes
     };
 };
@@ -13,6 +13,10 @@ namespace producer_consumer {
 
 /***************************************************************************//**
  * Implements the logic for producer-consumer terminals on leafs
+ *
+ * Consumers that advertise a capacity compete for the published messages: the
+ * node sends each message to only one of them and at most capacity messages
+ * per consumer can be unacknowledged at a time.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class LeafLogic : public publish_subscribe::LeafLogic<TTypes>
@@ -20,11 +24,65 @@ class LeafLogic : public publish_subscribe::LeafLogic<TTypes>
 public:
     typedef publish_subscribe::LeafLogic<TTypes> super;
 
+private:
+    void send_credit(const typename super::binding_info& bd,
+        std::size_t acknowledged)
+    {
+		using namespace messaging;
+
+        // leafs connected directly to each other do not share messages
+        if (!bd.established || !super::connection().remote_is_node()) {
+            return;
+        }
+
+        typename TTypes::Credit msg;
+        msg[fields::mappedId]     = bd.fsm.mapped_id();
+        msg[fields::capacity]     = bd.ext.capacity;
+        msg[fields::acknowledged] = acknowledged;
+
+        super::connection().send(msg);
+    }
+
 protected:
     LeafLogic(interfaces::IScheduler& scheduler)
         : super{scheduler}
     {
     }
+
+    virtual void on_binding_group_mapping_changed(bool isMapped,
+        const typename super::binding_info& bd) override
+    {
+        super::on_binding_group_mapping_changed(isMapped, bd);
+
+        if (isMapped && bd.ext.capacity) {
+            send_credit(bd, 0);
+        }
+    }
+
+public:
+    void pc_set_consumer_capacity(base::Id bindingGroupId,
+        std::size_t capacity)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        if (bd.ext.capacity != capacity) {
+            bd.ext.capacity = capacity;
+            send_credit(bd, 0);
+        }
+    }
+
+    void pc_acknowledge_messages(base::Id bindingGroupId, std::size_t n)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        if (!bd.ext.capacity) {
+            throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+        }
+
+        send_credit(bd, n);
+    }
 };
 
 } // namespace producer_consumer
@@ -5,6 +5,9 @@
 #include "../publish_subscribe/NodeLogic.hpp"
 #include "logic_types.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 
 namespace yogi {
 namespace core {
@@ -12,17 +15,209 @@ namespace producer_consumer {
 
 /***************************************************************************//**
  * Implements the logic for producer-consumer terminals on leafs
+ *
+ * Messages for consumers that advertised a capacity are queued in the binding
+ * and each one is sent to the consumer with the most credit left. Messages that
+ * a consumer has not acknowledged when its binding or connection goes away are
+ * put back at the front of the queue. Other subscribers and binding owners
+ * still receive every message.
+ *
+ * A message only goes to consumers whose content filter it passes and gets
+ * dropped if it passes none of them. Like with the other receivers, flow
+ * control credit only gets used up by the consumer that gets the message.
+ *
+ * The queue holds at most YOGI_MAX_PRODUCER_CONSUMER_BACKLOG messages; if the
+ * consumers fall behind, the oldest messages get dropped. Once the last
+ * consumer is gone, the queued messages are dropped as well since nobody is
+ * left to take them.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class NodeLogic : public publish_subscribe::NodeLogic<TTypes>
 {
     typedef publish_subscribe::NodeLogic<TTypes> super;
 
+private:
+    // the unacknowledged messages only need to go to another consumer if the
+    // removed one cannot have received them
+    void remove_consumer(const typename super::binding_info& bd,
+        interfaces::IConnection& connection, bool requeueInFlight)
+    {
+        auto consumer = bd.ext.consumers.find(&connection);
+        if (consumer == bd.ext.consumers.end()) {
+            return;
+        }
+
+        if (requeueInFlight) {
+            auto& inFlight = consumer->second.inFlight;
+            bd.ext.backlog.insert(bd.ext.backlog.begin(),
+                std::make_move_iterator(inFlight.begin()),
+                std::make_move_iterator(inFlight.end()));
+        }
+
+        bd.ext.consumers.erase(consumer);
+
+        if (bd.ext.consumers.empty()) {
+            std::deque<base::Buffer>{}.swap(bd.ext.backlog);
+        }
+        else {
+            trim_backlog(bd);
+            dispatch_backlog(bd);
+        }
+    }
+
+    void trim_backlog(const typename super::binding_info& bd)
+    {
+        while (bd.ext.backlog.size() > YOGI_MAX_PRODUCER_CONSUMER_BACKLOG) {
+            bd.ext.backlog.pop_front();
+        }
+    }
+
+    void dispatch_backlog(const typename super::binding_info& bd)
+    {
+		using namespace messaging;
+
+        typename TTypes::Data msg;
+
+        while (!bd.ext.backlog.empty()) {
+            auto        consumer   = bd.ext.consumers.end();
+            base::Id    mappedId;
+            std::size_t bestCredit = 0;
+            bool        wanted     = false;
+
+            for (auto it = bd.ext.consumers.begin();
+                it != bd.ext.consumers.end(); ++it) {
+                auto filter = bd.ext.ownerFilters.find(it->first);
+                if (filter != bd.ext.ownerFilters.end()
+                    && !filter->second.matches(bd.ext.backlog.front())) {
+                    continue;
+                }
+
+                wanted = true;
+
+                auto& info = it->second;
+                if (info.inFlight.size() >= info.capacity) {
+                    continue;
+                }
+
+                auto owner = bd.owningLeafs.find(it->first);
+                if (owner == bd.owningLeafs.end()
+                    || !owner->second.is_mapped()) {
+                    continue;
+                }
+
+                auto credit = info.capacity - info.inFlight.size();
+                if (credit > bestCredit) {
+                    consumer   = it;
+                    mappedId   = owner->second.mapped_id();
+                    bestCredit = credit;
+                }
+            }
+
+            if (!wanted) {
+                bd.ext.backlog.pop_front();
+                continue;
+            }
+
+            if (consumer == bd.ext.consumers.end()) {
+                return;
+            }
+
+            msg[fields::subscriptionId] = mappedId;
+            msg[fields::data]           = std::move(bd.ext.backlog.front());
+            bd.ext.backlog.pop_front();
+
+            consumer->first->send(msg);
+            consumer->second.inFlight.push_back(std::move(msg[fields::data]));
+
+            if (bd.terminal) {
+                this->use_receiver_credit(super::get_terminal_info(
+                    bd.terminal), *consumer->first);
+            }
+        }
+    }
+
 protected:
     NodeLogic(interfaces::IScheduler& scheduler,
         typename super::known_terminals_changed_fn knownTerminalsChangedFn)
         : super{scheduler, knownTerminalsChangedFn}
     {
+        super::template add_msg_handler<typename TTypes::Credit>(this,
+            &NodeLogic::on_message_received);
+    }
+
+    virtual void on_data_received(base::Buffer&& data,
+        base::Id terminalId, interfaces::IConnection& origin) override
+    {
+        using namespace messaging;
+
+        auto& tm = super::get_terminal_info(terminalId);
+        if (!tm.binding || super::get_binding_info(tm.binding)
+            .ext.consumers.empty()) {
+            super::on_data_received(std::move(data), terminalId, origin);
+            return;
+        }
+
+        auto& bd = super::get_binding_info(tm.binding);
+
+        typename TTypes::Data fwMsg;
+        fwMsg[fields::data] = data;
+
+        for (auto& subscriber : tm.subscribers) {
+            auto conn = const_cast<interfaces::IConnection*>(subscriber.first);
+            if (conn != &origin && this->forward_to_subscriber(tm, *conn,
+                fwMsg[fields::data])) {
+                fwMsg[fields::subscriptionId] = subscriber.second;
+                conn->send(fwMsg);
+            }
+        }
+
+        for (auto& owner : bd.owningLeafs) {
+            if (owner.first != &origin && !bd.ext.consumers.count(owner.first)
+                && owner.second.is_mapped() && this->forward_to_binding_owner(
+                tm.binding, bd, *owner.first, fwMsg[fields::data])) {
+                fwMsg[fields::subscriptionId] = owner.second.mapped_id();
+                owner.first->send(fwMsg);
+            }
+        }
+
+        bd.ext.backlog.push_back(std::move(data));
+        trim_backlog(bd);
+        dispatch_backlog(bd);
+
+        this->use_publisher_credit(tm, origin);
+    }
+
+    virtual void on_binding_owner_removed(interfaces::IConnection& connection,
+        typename super::const_binding_iterator bd) override
+    {
+        super::on_binding_owner_removed(connection, bd);
+        remove_consumer(*bd, connection, true);
+    }
+
+    void on_message_received(typename TTypes::Credit&& msg,
+        interfaces::IConnection& origin)
+    {
+        using namespace messaging;
+
+        auto& bd = super::get_binding_info(msg[fields::mappedId]);
+        if (!bd.owningLeafs.count(&origin)) {
+            return;
+        }
+
+        // consumers without a capacity get every message again
+        if (!msg[fields::capacity]) {
+            remove_consumer(bd, origin, false);
+            return;
+        }
+
+        auto& consumer = bd.ext.consumers[&origin];
+        consumer.capacity = msg[fields::capacity];
+
+        auto n = std::min(msg[fields::acknowledged], consumer.inFlight.size());
+        consumer.inFlight.erase(consumer.inFlight.begin(),
+            consumer.inFlight.begin() + static_cast<std::ptrdiff_t>(n));
+
+        dispatch_backlog(bd);
     }
 };
 
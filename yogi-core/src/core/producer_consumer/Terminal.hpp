@@ -3,6 +3,7 @@
 
 #include "../../config.h"
 #include "../publish_subscribe/Terminal.hpp"
+#include "../../interfaces/IBinding.hpp"
 #include "logic_types.hpp"
 
 
@@ -26,6 +27,32 @@ public:
         : super(leaf, identifier)
     {
     }
+
+    // consumer terminals are their own binding (see api::TerminalWithBindingT)
+    void set_consumer_capacity(std::size_t capacity)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+			static_cast<Leaf&>(super::leaf()));
+        leafLogic.pc_set_consumer_capacity(binding_group_id(), capacity);
+    }
+
+    void acknowledge_messages(std::size_t n)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+			static_cast<Leaf&>(super::leaf()));
+        leafLogic.pc_acknowledge_messages(binding_group_id(), n);
+    }
+
+private:
+    base::Id binding_group_id()
+    {
+        auto binding = dynamic_cast<interfaces::IBinding*>(this);
+        if (!binding) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        return binding->group_id();
+    }
 };
 
 } // namespace producer_consumer
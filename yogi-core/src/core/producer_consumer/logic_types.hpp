@@ -4,6 +4,11 @@
 #include "../../config.h"
 #include "../publish_subscribe/logic_types.hpp"
 #include "../../messaging/messages/ProducerConsumer.hpp"
+#include "../../base/Buffer.hpp"
+#include "../../interfaces/IConnection.hpp"
+
+#include <deque>
+#include <unordered_map>
 
 
 namespace yogi {
@@ -26,6 +31,29 @@ struct logic_types
     typedef LeafLogic<logic_types> leaf_logic_type;
     typedef NodeLogic<logic_types> node_logic_type;
     typedef Terminal<logic_types> terminal_type;
+
+    struct leaf_binding_info_ext_type
+        : public publish_subscribe::logic_types<TMessages>
+            ::leaf_binding_info_ext_type
+    {
+        std::size_t capacity = 0; // advertised to the node if non-zero
+    };
+
+    struct consumer_info
+    {
+        std::size_t              capacity = 0;
+        std::deque<base::Buffer> inFlight; // sent but not acknowledged yet
+    };
+
+    struct node_binding_info_ext_type
+        : public publish_subscribe::logic_types<TMessages>
+            ::node_binding_info_ext_type
+    {
+        // consumers competing for the messages and the messages waiting for
+        // one of them to have credit
+        std::unordered_map<interfaces::IConnection*, consumer_info> consumers;
+        std::deque<base::Buffer>                                    backlog;
+    };
 };
 
 } // namespace producer_consumer
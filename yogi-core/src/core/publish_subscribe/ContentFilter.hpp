@@ -0,0 +1,356 @@
+#ifndef YOGI_CORE_PUBLISH_SUBSCRIBE_CONTENTFILTER_HPP
+#define YOGI_CORE_PUBLISH_SUBSCRIBE_CONTENTFILTER_HPP
+
+#include "../../config.h"
+#include "../../base/Buffer.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+
+namespace yogi {
+namespace core {
+namespace publish_subscribe {
+
+/***************************************************************************//**
+ * Predicate on the content of published messages
+ *
+ * A filter consists of alternatives, each of which is a list of conditions
+ * that all have to be met. A message passes the filter if it meets any of the
+ * alternatives; a filter without alternatives lets every message pass.
+ * Conditions either compare a masked byte range at an offset or check that the
+ * little-endian unsigned number at an offset lies within a range. Conditions
+ * that refer to data beyond the end of a message are not met.
+ *
+ * Subscribers declare a single alternative and nodes merge the filters of all
+ * their receivers into one filter for the publishing side.
+ ******************************************************************************/
+class ContentFilter
+{
+public:
+    enum condition_type
+    {
+        CONDITION_MASK  = 1,
+        CONDITION_RANGE = 2,
+    };
+
+    struct condition
+    {
+        condition_type             type;
+        std::size_t                offset;
+        std::vector<unsigned char> value; // MASK: bytes; RANGE: min then max
+        std::vector<unsigned char> mask;  // MASK only
+
+        bool operator== (const condition& rhs) const
+        {
+            return type == rhs.type && offset == rhs.offset
+                && value == rhs.value && mask == rhs.mask;
+        }
+    };
+
+    typedef std::vector<condition> alternative;
+
+    // merging more alternatives than this results in a filter letting
+    // everything pass in order to keep evaluation cheap
+    static const std::size_t MAX_ALTERNATIVES = 32;
+
+private:
+    std::vector<alternative> m_alternatives;
+
+    static std::uint64_t read_number(const unsigned char* data,
+        std::size_t width)
+    {
+        std::uint64_t number = 0;
+        for (std::size_t i = width; i > 0; --i) {
+            number = (number << 8) | data[i - 1];
+        }
+
+        return number;
+    }
+
+    static bool meets(const condition& cond, const base::Buffer& data)
+    {
+        auto width = cond.type == CONDITION_MASK ? cond.value.size()
+            : cond.value.size() / 2;
+        if (cond.offset > data.size() || data.size() - cond.offset < width) {
+            return false;
+        }
+
+        auto bytes = reinterpret_cast<const unsigned char*>(data.data())
+            + cond.offset;
+
+        if (cond.type == CONDITION_MASK) {
+            for (std::size_t i = 0; i < width; ++i) {
+                if ((bytes[i] & cond.mask[i]) != cond.value[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        auto number = read_number(bytes, width);
+        return read_number(cond.value.data(), width) <= number
+            && number <= read_number(cond.value.data() + width, width);
+    }
+
+    static void write_size(std::vector<char>& buffer, std::size_t value)
+    {
+        do {
+            char byte = static_cast<char>(value & 0x7F);
+            value >>= 7;
+            buffer.push_back(static_cast<char>(byte | (value ? 0x80 : 0)));
+        } while (value);
+    }
+
+    static bool read_size(const base::Buffer& buffer, std::size_t& pos,
+        std::size_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; pos < buffer.size() && shift < 64;
+            shift += 7) {
+            auto byte = static_cast<unsigned char>(buffer[pos++]);
+            value |= static_cast<std::size_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool read_bytes(const base::Buffer& buffer, std::size_t& pos,
+        std::size_t n, std::vector<unsigned char>& bytes)
+    {
+        if (buffer.size() - pos < n) {
+            return false;
+        }
+
+        auto first = reinterpret_cast<const unsigned char*>(buffer.data())
+            + pos;
+        bytes.assign(first, first + n);
+        pos += n;
+        return true;
+    }
+
+    static bool read_condition(const base::Buffer& buffer, std::size_t& pos,
+        condition& cond)
+    {
+        std::size_t type, width;
+        if (!read_size(buffer, pos, type) || !read_size(buffer, pos,
+            cond.offset) || !read_size(buffer, pos, width) || !width) {
+            return false;
+        }
+
+        switch (type) {
+        case CONDITION_MASK:
+            cond.type = CONDITION_MASK;
+            return read_bytes(buffer, pos, width, cond.value)
+                && read_bytes(buffer, pos, width, cond.mask);
+
+        case CONDITION_RANGE:
+            cond.type = CONDITION_RANGE;
+            return width <= 8 && read_bytes(buffer, pos, 2 * width,
+                cond.value);
+
+        default:
+            return false;
+        }
+    }
+
+public:
+    ContentFilter()
+    {
+    }
+
+    // parses a filter created by to_buffer(); malformed data results in a
+    // filter letting everything pass
+    explicit ContentFilter(const base::Buffer& buffer)
+    {
+        std::size_t pos = 0;
+        std::size_t numAlternatives;
+        if (!read_size(buffer, pos, numAlternatives)) {
+            return;
+        }
+
+        for (std::size_t i = 0; i < numAlternatives; ++i) {
+            std::size_t numConditions;
+            if (!read_size(buffer, pos, numConditions) || !numConditions) {
+                m_alternatives.clear();
+                return;
+            }
+
+            alternative alt;
+            for (std::size_t j = 0; j < numConditions; ++j) {
+                condition cond;
+                if (!read_condition(buffer, pos, cond)) {
+                    m_alternatives.clear();
+                    return;
+                }
+
+                alt.push_back(std::move(cond));
+            }
+
+            m_alternatives.push_back(std::move(alt));
+        }
+    }
+
+    static condition make_mask_condition(std::size_t offset,
+        const void* value, const void* mask, std::size_t size)
+    {
+        auto valueBytes = static_cast<const unsigned char*>(value);
+        auto maskBytes  = static_cast<const unsigned char*>(mask);
+
+        condition cond;
+        cond.type   = CONDITION_MASK;
+        cond.offset = offset;
+        for (std::size_t i = 0; i < size; ++i) {
+            auto m = maskBytes ? maskBytes[i] : 0xFF;
+            cond.mask.push_back(static_cast<unsigned char>(m));
+            cond.value.push_back(static_cast<unsigned char>(valueBytes[i] & m));
+        }
+
+        return cond;
+    }
+
+    static condition make_range_condition(std::size_t offset,
+        std::size_t width, std::uint64_t min, std::uint64_t max)
+    {
+        YOGI_ASSERT(width > 0 && width <= 8);
+
+        condition cond;
+        cond.type   = CONDITION_RANGE;
+        cond.offset = offset;
+        for (auto number : {min, max}) {
+            for (std::size_t i = 0; i < width; ++i) {
+                cond.value.push_back(
+                    static_cast<unsigned char>(number >> (8 * i)));
+            }
+        }
+
+        return cond;
+    }
+
+    bool lets_everything_pass() const
+    {
+        return m_alternatives.empty();
+    }
+
+    const std::vector<alternative>& alternatives() const
+    {
+        return m_alternatives;
+    }
+
+    // adds a condition to a filter with at most one alternative
+    void add_condition(condition cond)
+    {
+        YOGI_ASSERT(m_alternatives.size() <= 1);
+
+        if (m_alternatives.empty()) {
+            m_alternatives.emplace_back();
+        }
+
+        m_alternatives.front().push_back(std::move(cond));
+    }
+
+    void clear()
+    {
+        m_alternatives.clear();
+    }
+
+    // lets all messages pass that pass this filter or the other one
+    void merge(const ContentFilter& other)
+    {
+        if (lets_everything_pass()) {
+            return;
+        }
+
+        if (other.lets_everything_pass()) {
+            clear();
+            return;
+        }
+
+        for (auto& alt : other.m_alternatives) {
+            if (std::find(m_alternatives.begin(), m_alternatives.end(), alt)
+                == m_alternatives.end()) {
+                if (m_alternatives.size() == MAX_ALTERNATIVES) {
+                    clear();
+                    return;
+                }
+
+                m_alternatives.push_back(alt);
+            }
+        }
+    }
+
+    bool matches(const base::Buffer& data) const
+    {
+        if (lets_everything_pass()) {
+            return true;
+        }
+
+        for (auto& alt : m_alternatives) {
+            bool met = true;
+            for (auto& cond : alt) {
+                if (!meets(cond, data)) {
+                    met = false;
+                    break;
+                }
+            }
+
+            if (met) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    base::Buffer to_buffer() const
+    {
+        std::vector<char> buffer;
+        if (lets_everything_pass()) {
+            return base::Buffer{};
+        }
+
+        write_size(buffer, m_alternatives.size());
+        for (auto& alt : m_alternatives) {
+            write_size(buffer, alt.size());
+            for (auto& cond : alt) {
+                write_size(buffer, cond.type);
+                write_size(buffer, cond.offset);
+                if (cond.type == CONDITION_MASK) {
+                    write_size(buffer, cond.value.size());
+                    buffer.insert(buffer.end(), cond.value.begin(),
+                        cond.value.end());
+                    buffer.insert(buffer.end(), cond.mask.begin(),
+                        cond.mask.end());
+                }
+                else {
+                    write_size(buffer, cond.value.size() / 2);
+                    buffer.insert(buffer.end(), cond.value.begin(),
+                        cond.value.end());
+                }
+            }
+        }
+
+        return base::Buffer{buffer.begin(), buffer.end()};
+    }
+
+    bool operator== (const ContentFilter& rhs) const
+    {
+        return m_alternatives == rhs.m_alternatives;
+    }
+
+    bool operator!= (const ContentFilter& rhs) const
+    {
+        return !(*this == rhs);
+    }
+};
+
+} // namespace publish_subscribe
+} // namespace core
+} // namespace yogi
+
+#endif // YOGI_CORE_PUBLISH_SUBSCRIBE_CONTENTFILTER_HPP
@@ -2,6 +2,8 @@
 #define YOGI_CORE_PUBLISH_SUBSCRIBE_LEAFLOGIC_HPP
 
 #include "../../config.h"
+#include "../../base/ObjectRegister.hpp"
+#include "../../base/DeadlineQueue.hpp"
 #include "../common/PublishSubscribeLeafLogicBaseT.hpp"
 #include "Terminal.hpp"
 #include "logic_types.hpp"
@@ -13,6 +15,16 @@ namespace publish_subscribe {
 
 /***************************************************************************//**
  * Implements the logic for publish-subscribe terminals on leafs
+ *
+ * Binding groups with a receive window grant that many messages to the node
+ * once established and grant credit again whenever half of the window has been
+ * received. The credit granted by the node to a terminal is decremented for
+ * every published message and passed on to the terminal.
+ *
+ * Binding groups can also ask the node to send them only a fraction of the
+ * published messages (see NodeLogic) or only those passing a content filter.
+ * If the leaf is connected directly to another leaf, it filters and decimates
+ * the data it receives itself in the same way.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class LeafLogic : public common::PublishSubscribeLeafLogicBaseT<TTypes>
@@ -20,10 +32,298 @@ class LeafLogic : public common::PublishSubscribeLeafLogicBaseT<TTypes>
 public:
     typedef common::PublishSubscribeLeafLogicBaseT<TTypes> super;
 
+private:
+    base::ObjectRegister<const typename super::binding_info*>
+                        m_decimationTimers;
+    base::DeadlineQueue m_decimationDeadlines;
+
+private:
+    void send_flow_credit(const typename super::binding_info& bd,
+        std::size_t credit, bool unlimited)
+    {
+        using namespace messaging;
+
+        // only nodes aggregate credit
+        if (!bd.established || !super::connection().remote_is_node()) {
+            return;
+        }
+
+        typename TTypes::FlowCredit msg;
+        msg[fields::mappedId]  = bd.fsm.mapped_id();
+        msg[fields::credit]    = credit;
+        msg[fields::unlimited] = unlimited;
+
+        super::connection().send(msg);
+    }
+
+    void send_decimation(const typename super::binding_info& bd)
+    {
+        using namespace messaging;
+
+        if (!bd.established || !super::connection().remote_is_node()) {
+            return;
+        }
+
+        typename TTypes::Decimation msg;
+        msg[fields::mappedId]    = bd.fsm.mapped_id();
+        msg[fields::minInterval] = bd.ext.minInterval;
+        msg[fields::everyNth]    = bd.ext.everyNth;
+
+        super::connection().send(msg);
+    }
+
+    void send_filter(const typename super::binding_info& bd)
+    {
+        using namespace messaging;
+
+        if (!bd.established || !super::connection().remote_is_node()) {
+            return;
+        }
+
+        typename TTypes::Filter msg;
+        msg[fields::mappedId] = bd.fsm.mapped_id();
+        msg[fields::filter]   = bd.ext.filter.to_buffer();
+
+        super::connection().send(msg);
+    }
+
+    void reset_decimation(const typename super::binding_info& bd)
+    {
+        if (bd.ext.timer) {
+            m_decimationDeadlines.remove(bd.ext.deadline, bd.ext.timer);
+            m_decimationTimers.erase(bd.ext.timer);
+            bd.ext.timer = base::Id{};
+        }
+
+        bd.ext.counter       = 0;
+        bd.ext.lastDelivered = base::DeadlineQueue::time_point{};
+        bd.ext.pending       = base::Buffer{};
+    }
+
+    void on_decimation_deadlines_expired()
+    {
+        auto lock = super::make_lock_guard();
+
+        m_decimationDeadlines.pop_expired([&](base::Id timerId) {
+            auto& bd = *m_decimationTimers[timerId];
+            m_decimationTimers.erase(timerId);
+            bd.ext.timer         = base::Id{};
+            bd.ext.lastDelivered = base::DeadlineQueue::clock::now();
+
+            YOGI_ASSERT(!bd.bindings.empty());
+            auto& tm = super::get_terminal_info(
+                bd.bindings[0]->terminal().id());
+            this->on_data_received(tm, std::move(bd.ext.pending));
+        });
+    }
+
+    void update_credit(const typename super::terminal_info& tm, bool limited,
+        std::size_t credit)
+    {
+        tm.ext.creditLimited = limited;
+        tm.ext.credit        = credit;
+        tm.terminal->publish_credit(limited, credit);
+    }
+
 protected:
     LeafLogic(interfaces::IScheduler& scheduler)
         : super{scheduler}
+        , m_decimationDeadlines{scheduler, [this] {
+            on_decimation_deadlines_expired();
+        }}
+    {
+        super::template add_msg_handler<typename TTypes::FlowCredit>(this,
+            &LeafLogic::on_message_received);
+    }
+
+    void on_message_received(typename TTypes::FlowCredit&& msg)
+    {
+        using namespace messaging;
+
+        auto& tm = super::get_terminal_info(msg[fields::mappedId]);
+        if (!tm.terminal) {
+            return;
+        }
+
+        if (msg[fields::unlimited]) {
+            update_credit(tm, false, 0);
+        }
+        else {
+            auto credit = tm.ext.creditLimited ? tm.ext.credit : 0;
+            update_credit(tm, true, credit + msg[fields::credit]);
+        }
+    }
+
+    virtual void on_terminal_mapping_changed(bool isMapped,
+        const typename super::terminal_info& tm) override
+    {
+        super::on_terminal_mapping_changed(isMapped, tm);
+
+        // the node grants credit again once the terminal is mapped
+        if (!isMapped && tm.ext.creditLimited) {
+            update_credit(tm, false, 0);
+        }
+    }
+
+    virtual void on_binding_group_mapping_changed(bool isMapped,
+        const typename super::binding_info& bd) override
+    {
+        super::on_binding_group_mapping_changed(isMapped, bd);
+
+        reset_decimation(bd);
+        bd.ext.receivedUngranted = 0;
+        if (isMapped && bd.ext.receiveWindow) {
+            send_flow_credit(bd, bd.ext.receiveWindow, false);
+        }
+
+        if (isMapped && (bd.ext.minInterval || bd.ext.everyNth)) {
+            send_decimation(bd);
+        }
+
+        if (isMapped && !bd.ext.filter.lets_everything_pass()) {
+            send_filter(bd);
+        }
+    }
+
+    virtual void on_binding_data_received(
+        const typename super::binding_info& bd) override
+    {
+        super::on_binding_data_received(bd);
+
+        if (!bd.ext.receiveWindow) {
+            return;
+        }
+
+        if (++bd.ext.receivedUngranted * 2 >= bd.ext.receiveWindow) {
+            send_flow_credit(bd, bd.ext.receivedUngranted, false);
+            bd.ext.receivedUngranted = 0;
+        }
+    }
+
+    virtual void on_binding_removed(interfaces::IBinding& binding,
+        const typename super::binding_info& bd) override
     {
+        super::on_binding_removed(binding, bd);
+
+        if (bd.bindings.empty()) {
+            reset_decimation(bd);
+        }
+    }
+
+    // nodes filter and decimate the data themselves, so only data sent
+    // directly by another leaf needs to be handled here
+    virtual bool accept_binding_data(const typename super::binding_info& bd,
+        const base::Buffer& data) override
+    {
+        if (super::connection().remote_is_node()) {
+            return true;
+        }
+
+        if (!bd.ext.filter.matches(data)) {
+            return false;
+        }
+
+        if (bd.ext.everyNth) {
+            bool deliver = !bd.ext.counter;
+            bd.ext.counter = (bd.ext.counter + 1) % bd.ext.everyNth;
+            return deliver;
+        }
+
+        if (!bd.ext.minInterval) {
+            return true;
+        }
+
+        // hold the data back if it is too early; the latest data always
+        // replaces any data held back before
+        auto now         = base::DeadlineQueue::clock::now();
+        auto minInterval = std::chrono::milliseconds{bd.ext.minInterval};
+        if (!bd.ext.timer && now - bd.ext.lastDelivered >= minInterval) {
+            bd.ext.lastDelivered = now;
+            return true;
+        }
+
+        bd.ext.pending = data;
+        if (!bd.ext.timer) {
+            bd.ext.timer    = m_decimationTimers.insert(&bd);
+            bd.ext.deadline = m_decimationDeadlines.add(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    bd.ext.lastDelivered + minInterval - now), bd.ext.timer);
+        }
+
+        return false;
+    }
+
+    virtual void on_data_published(const typename super::terminal_info& tm,
+        base::Buffer&& data) override
+    {
+        if (tm.subscribed && tm.ext.creditLimited && tm.ext.credit) {
+            update_credit(tm, true, tm.ext.credit - 1);
+        }
+
+        super::on_data_published(tm, std::move(data));
+    }
+
+public:
+    void ps_set_receive_window(base::Id bindingGroupId, std::size_t window)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        if (bd.ext.receiveWindow == window) {
+            return;
+        }
+
+        // a resized window replaces the credit granted so far
+        if (bd.ext.receiveWindow) {
+            send_flow_credit(bd, 0, true);
+        }
+
+        bd.ext.receiveWindow     = window;
+        bd.ext.receivedUngranted = 0;
+
+        if (window) {
+            send_flow_credit(bd, window, false);
+        }
+    }
+
+    void ps_set_decimation(base::Id bindingGroupId, std::size_t minInterval,
+        std::size_t everyNth)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        if (bd.ext.minInterval == minInterval && bd.ext.everyNth == everyNth) {
+            return;
+        }
+
+        bd.ext.minInterval = minInterval;
+        bd.ext.everyNth    = everyNth;
+        reset_decimation(bd);
+        send_decimation(bd);
+    }
+
+    // conditions added to a binding group all have to be met
+    void ps_add_filter_condition(base::Id bindingGroupId,
+        ContentFilter::condition condition)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        bd.ext.filter.add_condition(std::move(condition));
+        send_filter(bd);
+    }
+
+    void ps_clear_filter(base::Id bindingGroupId)
+    {
+        auto lock = super::make_lock_guard();
+
+        auto& bd = super::get_binding_info(bindingGroupId);
+        if (bd.ext.filter.lets_everything_pass()) {
+            return;
+        }
+
+        bd.ext.filter.clear();
+        send_filter(bd);
     }
 };
 
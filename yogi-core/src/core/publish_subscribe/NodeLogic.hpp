@@ -3,8 +3,14 @@
 
 #include "../../config.h"
 #include "../common/PublishSubscribeNodeLogicBaseT.hpp"
+#include "../../base/ObjectRegister.hpp"
+#include "../../base/DeadlineQueue.hpp"
 #include "logic_types.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+
 
 namespace yogi {
 namespace core {
@@ -12,17 +18,541 @@ namespace publish_subscribe {
 
 /***************************************************************************//**
  * Implements the logic for publish-subscribe terminals on leafs
+ *
+ * Subscribers and binding owners that take part in flow control grant credit
+ * for a number of messages. Every message sent to a receiver uses up one
+ * message of its credit and each terminal owner gets granted the minimum credit
+ * left across all flow-controlled receivers other than itself. Receivers that
+ * do not take part in flow control do not limit the publishers. Since data
+ * dropped by a receiver's content filter does not use up its credit, a
+ * terminal owner that has used up its credit gets granted more right away if
+ * the receivers have credit left.
+ *
+ * Binding owners can ask for decimated data: the node then either sends them
+ * every Nth message only or the first message and, at most once per interval,
+ * the latest message received since. Decimation happens on the node that the
+ * binding owner is connected to. Only the messages actually sent, including
+ * those held back and sent later, use up the binding owner's credit.
+ *
+ * Subscribers and binding owners can restrict the data they receive with a
+ * content filter. Each owning node gets sent the merged filters of all other
+ * receivers so that it can drop data before sending it over the connection.
+ * Receivers without a filter make the merged filter let everything pass.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class NodeLogic : public common::PublishSubscribeNodeLogicBaseT<TTypes>
 {
     typedef common::PublishSubscribeNodeLogicBaseT<TTypes> super;
 
+protected:
+    typedef typename super::terminal_info terminal_info;
+    typedef typename super::binding_info binding_info;
+
+private:
+    struct decimation_timer
+    {
+        base::Id                 binding;
+        interfaces::IConnection* owner;
+    };
+
+    base::ObjectRegister<decimation_timer> m_decimationTimers;
+    base::DeadlineQueue                    m_decimationDeadlines;
+
+    bool is_receiver(const terminal_info& tm,
+        interfaces::IConnection& connection)
+    {
+        if (tm.subscribers.count(&connection)) {
+            return true;
+        }
+
+        return tm.binding && super::get_binding_info(tm.binding)
+            .owningLeafs.count(&connection);
+    }
+
+    void send_flow_credit(interfaces::IConnection& publisher,
+        const terminal_info& tm, std::size_t credit, bool unlimited)
+    {
+        using namespace messaging;
+
+        auto& owners = publisher.remote_is_node() ? tm.owningNodes
+            : tm.owningLeafs;
+        auto owner = owners.find(&publisher);
+        if (owner == owners.end() || !owner->second.is_mapped()) {
+            return;
+        }
+
+        typename TTypes::FlowCredit msg;
+        msg[fields::mappedId]  = owner->second.mapped_id();
+        msg[fields::credit]    = credit;
+        msg[fields::unlimited] = unlimited;
+
+        publisher.send(msg);
+    }
+
+    void update_publisher_credit(interfaces::IConnection& publisher,
+        const terminal_info& tm)
+    {
+        bool        limited = false;
+        std::size_t credit  = 0;
+        for (auto& receiver : tm.ext.receivers) {
+            if (receiver.first != &publisher) {
+                credit  = limited ? std::min(credit, receiver.second)
+                    : receiver.second;
+                limited = true;
+            }
+        }
+
+        auto& granted = tm.ext.publishers[&publisher];
+        if (!limited) {
+            if (granted.limited) {
+                send_flow_credit(publisher, tm, 0, true);
+            }
+
+            tm.ext.publishers.erase(&publisher);
+        }
+        else if (!granted.limited) {
+            granted.limited = true;
+            granted.credit  = credit;
+            send_flow_credit(publisher, tm, credit, false);
+        }
+        else if (credit > granted.credit) {
+            send_flow_credit(publisher, tm, credit - granted.credit, false);
+            granted.credit = credit;
+        }
+    }
+
+    void update_publisher_credits(const terminal_info& tm)
+    {
+        // subscribers may get removed without us being told individually
+        auto& receivers = tm.ext.receivers;
+        for (auto it = receivers.begin(); it != receivers.end(); ) {
+            it = is_receiver(tm, *it->first) ? std::next(it)
+                : receivers.erase(it);
+        }
+
+        for (auto owners : {&tm.owningLeafs, &tm.owningNodes}) {
+            for (auto& owner : *owners) {
+                if (owner.second.is_mapped()) {
+                    update_publisher_credit(*owner.first, tm);
+                }
+            }
+        }
+    }
+
+    typedef std::unordered_map<interfaces::IConnection*, ContentFilter>
+        filter_map;
+
+    ContentFilter merged_filter(const terminal_info& tm,
+        interfaces::IConnection& exception)
+    {
+        ContentFilter merged;
+        bool first      = true;
+        bool everything = false;
+
+        auto include = [&](interfaces::IConnection* receiver,
+            const filter_map& filters) {
+            if (everything || receiver == &exception) {
+                return;
+            }
+
+            auto filter = filters.find(receiver);
+            if (filter == filters.end()) {
+                merged.clear();
+                everything = true;
+            }
+            else if (first) {
+                merged = filter->second;
+                first  = false;
+            }
+            else {
+                merged.merge(filter->second);
+                everything = merged.lets_everything_pass();
+            }
+        };
+
+        for (auto& subscriber : tm.subscribers) {
+            include(const_cast<interfaces::IConnection*>(subscriber.first),
+                tm.ext.subscriberFilters);
+        }
+
+        if (tm.binding) {
+            auto& bd = super::get_binding_info(tm.binding);
+            for (auto& owner : bd.owningLeafs) {
+                include(owner.first, bd.ext.ownerFilters);
+            }
+        }
+
+        return merged;
+    }
+
+    void update_upstream_filters(const terminal_info& tm)
+    {
+        using namespace messaging;
+
+        typename TTypes::Filter msg;
+        for (auto& owner : tm.owningNodes) {
+            if (!owner.second.is_mapped()) {
+                continue;
+            }
+
+            auto filter = merged_filter(tm, *owner.first);
+            auto& sent  = tm.ext.upstreamFilters;
+            auto it     = sent.find(owner.first);
+            if (it == sent.end() ? filter.lets_everything_pass()
+                : it->second == filter) {
+                continue;
+            }
+
+            msg[fields::mappedId] = owner.second.mapped_id();
+            msg[fields::filter]   = filter.to_buffer();
+            owner.first->send(msg);
+
+            if (filter.lets_everything_pass()) {
+                sent.erase(owner.first);
+            }
+            else {
+                sent[owner.first] = std::move(filter);
+            }
+        }
+    }
+
+    void remove_decimation(const binding_info& bd,
+        interfaces::IConnection& owner)
+    {
+        auto it = bd.ext.decimatedOwners.find(&owner);
+        if (it == bd.ext.decimatedOwners.end()) {
+            return;
+        }
+
+        auto& dc = it->second;
+        if (dc.timer) {
+            m_decimationDeadlines.remove(dc.deadline, dc.timer);
+            m_decimationTimers.erase(dc.timer);
+        }
+
+        bd.ext.decimatedOwners.erase(it);
+    }
+
+    // returns false if the data shall not be sent to the owner (now)
+    bool pass_decimation(base::Id bindingId, const binding_info& bd,
+        interfaces::IConnection& owner, const base::Buffer& data)
+    {
+        auto it = bd.ext.decimatedOwners.find(&owner);
+        if (it == bd.ext.decimatedOwners.end()) {
+            return true;
+        }
+
+        auto& dc = it->second;
+        if (dc.everyNth) {
+            bool send = !dc.counter;
+            dc.counter = (dc.counter + 1) % dc.everyNth;
+            return send;
+        }
+
+        // hold the data back if it is too early; the latest data always
+        // replaces any data held back before
+        auto now = base::DeadlineQueue::clock::now();
+        if (!dc.timer && now - dc.lastSent >= dc.minInterval) {
+            dc.lastSent = now;
+            return true;
+        }
+
+        dc.pending = data;
+        if (!dc.timer) {
+            dc.timer    = m_decimationTimers.insert(
+                decimation_timer{bindingId, &owner});
+            dc.deadline = m_decimationDeadlines.add(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    dc.lastSent + dc.minInterval - now), dc.timer);
+        }
+
+        return false;
+    }
+
+    void on_decimation_deadlines_expired()
+    {
+        using namespace messaging;
+
+        auto lock = super::make_lock_guard();
+
+        m_decimationDeadlines.pop_expired([&](base::Id timerId) {
+            auto timer = m_decimationTimers[timerId];
+            m_decimationTimers.erase(timerId);
+
+            auto& bd = super::get_binding_info(timer.binding);
+            auto& dc = bd.ext.decimatedOwners[timer.owner];
+            dc.timer = base::Id{};
+
+            auto owner = bd.owningLeafs.find(timer.owner);
+            if (owner == bd.owningLeafs.end() || !owner->second.is_mapped()) {
+                return;
+            }
+
+            typename TTypes::Data msg;
+            msg[fields::subscriptionId] = owner->second.mapped_id();
+            msg[fields::data]           = std::move(dc.pending);
+
+            timer.owner->send(msg);
+            dc.lastSent = base::DeadlineQueue::clock::now();
+
+            if (bd.terminal) {
+                use_receiver_credit(super::get_terminal_info(bd.terminal),
+                    *timer.owner);
+            }
+        });
+    }
+
 protected:
     NodeLogic(interfaces::IScheduler& scheduler,
         typename super::known_terminals_changed_fn knownTerminalsChangedFn)
         : super{scheduler, knownTerminalsChangedFn}
+        , m_decimationDeadlines{scheduler, [this] {
+            on_decimation_deadlines_expired();
+        }}
+    {
+        super::template add_msg_handler<typename TTypes::FlowCredit>(this,
+            &NodeLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::Decimation>(this,
+            &NodeLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::Filter>(this,
+            &NodeLogic::on_message_received);
+    }
+
+    virtual bool forward_to_subscriber(const terminal_info& tm,
+        interfaces::IConnection& subscriber, const base::Buffer& data) override
+    {
+        auto filter = tm.ext.subscriberFilters.find(&subscriber);
+        if (filter != tm.ext.subscriberFilters.end()
+            && !filter->second.matches(data)) {
+            return false;
+        }
+
+        use_receiver_credit(tm, subscriber);
+        return true;
+    }
+
+    virtual bool forward_to_binding_owner(base::Id bindingId,
+        const binding_info& bd, interfaces::IConnection& owner,
+        const base::Buffer& data) override
     {
+        auto filter = bd.ext.ownerFilters.find(&owner);
+        if (filter != bd.ext.ownerFilters.end()
+            && !filter->second.matches(data)) {
+            return false;
+        }
+
+        if (!pass_decimation(bindingId, bd, owner, data)) {
+            return false;
+        }
+
+        use_receiver_credit(super::get_terminal_info(bd.terminal), owner);
+        return true;
+    }
+
+    virtual void on_data_received(base::Buffer&& data,
+        base::Id terminalId, interfaces::IConnection& origin) override
+    {
+        auto& tm = super::get_terminal_info(terminalId);
+        super::on_data_received(std::move(data), terminalId, origin);
+        use_publisher_credit(tm, origin);
+    }
+
+    // only receivers that actually get sent the data use up their credit
+    void use_receiver_credit(const terminal_info& tm,
+        interfaces::IConnection& receiver)
+    {
+        auto it = tm.ext.receivers.find(&receiver);
+        if (it != tm.ext.receivers.end() && it->second) {
+            --it->second;
+        }
+    }
+
+    void use_publisher_credit(const terminal_info& tm,
+        interfaces::IConnection& publisher)
+    {
+        auto it = tm.ext.publishers.find(&publisher);
+        if (it == tm.ext.publishers.end() || !it->second.credit) {
+            return;
+        }
+
+        // receivers that did not get the data still have credit left
+        if (--it->second.credit == 0) {
+            update_publisher_credit(publisher, tm);
+        }
+    }
+
+    virtual void on_terminal_owner_added(interfaces::IConnection& connection,
+        typename super::const_terminal_iterator tm,
+        const typename TTypes::TerminalDescription& msg) override
+    {
+        super::on_terminal_owner_added(connection, tm, msg);
+
+        tm->ext.publishers.erase(&connection);
+        update_publisher_credit(connection, *tm);
+
+        tm->ext.upstreamFilters.erase(&connection);
+        update_upstream_filters(*tm);
+    }
+
+    virtual void on_terminal_owner_remapped(interfaces::IConnection& connection,
+        typename super::const_terminal_iterator tm, base::Id newMappedId)
+        override
+    {
+        super::on_terminal_owner_remapped(connection, tm, newMappedId);
+
+        tm->ext.publishers.erase(&connection);
+        update_publisher_credit(connection, *tm);
+
+        tm->ext.upstreamFilters.erase(&connection);
+        update_upstream_filters(*tm);
+    }
+
+    virtual void on_terminal_owner_removed(interfaces::IConnection& connection,
+        typename super::const_terminal_iterator tm) override
+    {
+        super::on_terminal_owner_removed(connection, tm);
+
+        tm->ext.publishers.erase(&connection);
+        update_publisher_credits(*tm);
+
+        tm->ext.upstreamFilters.erase(&connection);
+    }
+
+    virtual void on_terminal_user_removed(interfaces::IConnection& connection,
+        typename super::const_terminal_iterator tm) override
+    {
+        tm->ext.subscriberFilters.erase(&connection);
+
+        super::on_terminal_user_removed(connection, tm);
+    }
+
+    virtual void on_binding_owner_added(interfaces::IConnection& connection,
+        typename super::const_binding_iterator bd, base::Id mappedId) override
+    {
+        super::on_binding_owner_added(connection, bd, mappedId);
+
+        if (bd->terminal) {
+            update_upstream_filters(super::get_terminal_info(bd->terminal));
+        }
+    }
+
+    virtual void on_binding_owner_removed(interfaces::IConnection& connection,
+        typename super::const_binding_iterator bd) override
+    {
+        remove_decimation(*bd, connection);
+        bd->ext.ownerFilters.erase(&connection);
+
+        super::on_binding_owner_removed(connection, bd);
+    }
+
+    virtual void on_subscriber_removed(interfaces::IConnection& connection,
+        const terminal_info& tm) override
+    {
+        update_publisher_credits(tm);
+        update_upstream_filters(tm);
+    }
+
+    virtual void on_subscribed(interfaces::IConnection& origin,
+        base::Id subscriptionId, const terminal_info& tm) override
+    {
+        super::on_subscribed(origin, subscriptionId, tm);
+
+        update_upstream_filters(tm);
+    }
+
+    void on_message_received(typename TTypes::FlowCredit&& msg,
+        interfaces::IConnection& origin)
+    {
+        using namespace messaging;
+
+        // leafs refer to their binding and nodes to our terminal
+        const terminal_info* tm;
+        if (origin.remote_is_node()) {
+            tm = &super::get_terminal_info(msg[fields::mappedId]);
+        }
+        else {
+            auto& bd = super::get_binding_info(msg[fields::mappedId]);
+            if (!bd.terminal) {
+                return;
+            }
+
+            tm = &super::get_terminal_info(bd.terminal);
+        }
+
+        if (!is_receiver(*tm, origin)) {
+            return;
+        }
+
+        if (msg[fields::unlimited]) {
+            tm->ext.receivers.erase(&origin);
+        }
+        else {
+            tm->ext.receivers[&origin] += msg[fields::credit];
+        }
+
+        update_publisher_credits(*tm);
+    }
+
+    void on_message_received(typename TTypes::Decimation&& msg,
+        interfaces::IConnection& origin)
+    {
+        using namespace messaging;
+
+        auto& bd = super::get_binding_info(msg[fields::mappedId]);
+        if (!bd.owningLeafs.count(&origin)) {
+            return;
+        }
+
+        remove_decimation(bd, origin);
+        if (!msg[fields::minInterval] && !msg[fields::everyNth]) {
+            return;
+        }
+
+        auto& dc = bd.ext.decimatedOwners[&origin];
+        dc.minInterval = std::chrono::milliseconds{msg[fields::minInterval]};
+        dc.everyNth    = msg[fields::everyNth];
+    }
+
+    void on_message_received(typename TTypes::Filter&& msg,
+        interfaces::IConnection& origin)
+    {
+        using namespace messaging;
+
+        // leafs filter for their binding and nodes for our terminal
+        const terminal_info* tm = nullptr;
+        filter_map*          filters;
+        if (origin.remote_is_node()) {
+            tm = &super::get_terminal_info(msg[fields::mappedId]);
+            if (!tm->usingNodes.count(&origin)) {
+                return;
+            }
+
+            filters = &tm->ext.subscriberFilters;
+        }
+        else {
+            auto& bd = super::get_binding_info(msg[fields::mappedId]);
+            if (!bd.owningLeafs.count(&origin)) {
+                return;
+            }
+
+            if (bd.terminal) {
+                tm = &super::get_terminal_info(bd.terminal);
+            }
+
+            filters = &bd.ext.ownerFilters;
+        }
+
+        ContentFilter filter{msg[fields::filter]};
+        if (filter.lets_everything_pass()) {
+            filters->erase(&origin);
+        }
+        else {
+            (*filters)[&origin] = std::move(filter);
+        }
+
+        if (tm) {
+            update_upstream_filters(*tm);
+        }
     }
 };
 
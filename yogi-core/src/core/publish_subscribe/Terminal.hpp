@@ -11,6 +11,9 @@
 #include <boost/asio/buffer.hpp>
 
 #include <atomic>
+#include <mutex>
+#include <limits>
+#include <algorithm>
 
 
 namespace yogi {
@@ -26,16 +29,102 @@ namespace publish_subscribe {
  * Publish-subscribe terminals implement the publish-subscribe pattern, i.e.
  * terminals can subscribe to other terminals (via bindings) in order to receive
  * data message published by those terminals.
+ *
+ * Bindings can optionally take part in flow control by granting a receive
+ * window. The credit that the nodes grant back to the publishing terminal can
+ * be queried and observed; publishing is not blocked by it.
+ * Bindings can furthermore limit the rate at which they receive messages and
+ * restrict them to messages passing a content filter.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class Terminal : public common::PublishSubscribeTerminalBaseT<TTypes, false>
 {
     typedef common::PublishSubscribeTerminalBaseT<TTypes, false> super;
 
+public:
+    // the credit is -1 if the terminal is not limited by flow control
+    typedef std::function<void (const api::Exception&, int)> credit_handler_fn;
+
+private:
+    mutable std::mutex                      m_creditMutex;
+    int                                     m_credit;
+    base::AsyncOperation<credit_handler_fn> m_awaitCreditChangeOp;
+
 public:
     Terminal(Leaf& leaf, base::Identifier identifier)
         : super(leaf, identifier)
+        , m_credit{-1}
+    {
+    }
+
+    virtual ~Terminal()
+    {
+        m_awaitCreditChangeOp.fire<YOGI_ERR_CANCELED>(-1);
+        m_awaitCreditChangeOp.await_idle();
+    }
+
+    void set_receive_window(base::Id bindingGroupId, std::size_t window)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(super::leaf()));
+        leafLogic.ps_set_receive_window(bindingGroupId, window);
+    }
+
+    // either conflates to the latest message per interval or sends every Nth
+    void set_decimation(base::Id bindingGroupId, std::size_t minInterval,
+        std::size_t everyNth)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(super::leaf()));
+        leafLogic.ps_set_decimation(bindingGroupId, minInterval, everyNth);
+    }
+
+    void add_filter_condition(base::Id bindingGroupId,
+        ContentFilter::condition condition)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(super::leaf()));
+        leafLogic.ps_add_filter_condition(bindingGroupId, std::move(condition));
+    }
+
+    void clear_filter(base::Id bindingGroupId)
+    {
+        auto& leafLogic = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(super::leaf()));
+        leafLogic.ps_clear_filter(bindingGroupId);
+    }
+
+    int available_credit() const
     {
+        std::lock_guard<std::mutex> lock{m_creditMutex};
+        return m_credit;
+    }
+
+    void async_await_credit_change(credit_handler_fn handlerFn)
+    {
+        m_awaitCreditChangeOp.arm(handlerFn);
+    }
+
+    void cancel_await_credit_change()
+    {
+        m_awaitCreditChangeOp.fire<YOGI_ERR_CANCELED>(-1);
+    }
+
+    void publish_credit(bool limited, std::size_t credit)
+    {
+        int newCredit = limited ? static_cast<int>(std::min<std::size_t>(credit,
+            std::numeric_limits<int>::max())) : -1;
+
+        {{
+            std::lock_guard<std::mutex> lock{m_creditMutex};
+            if (m_credit == newCredit) {
+                return;
+            }
+
+            m_credit = newCredit;
+        }}
+
+        m_awaitCreditChangeOp.fire<YOGI_OK>(newCredit);
     }
 };
 
@@ -4,6 +4,12 @@
 #include "../../config.h"
 #include "../common/subscribable_logic_types.hpp"
 #include "../../messaging/messages/PublishSubscribe.hpp"
+#include "../../interfaces/IConnection.hpp"
+#include "../../base/Buffer.hpp"
+#include "ContentFilter.hpp"
+
+#include <unordered_map>
+#include <chrono>
 
 
 namespace yogi {
@@ -27,6 +33,78 @@ struct logic_types
 	typedef LeafLogic<logic_types> leaf_logic_type;
 	typedef NodeLogic<logic_types> node_logic_type;
     typedef Terminal<logic_types> terminal_type;
+
+    struct leaf_terminal_info_ext_type
+    {
+        // publishers are unlimited until a node grants them credit
+        bool        creditLimited = false;
+        std::size_t credit        = 0;
+    };
+
+    struct leaf_binding_info_ext_type
+    {
+        std::size_t receiveWindow     = 0; // flow control is off if zero
+        std::size_t receivedUngranted = 0;
+        std::size_t minInterval       = 0; // in ms; no conflation if zero
+        std::size_t everyNth          = 0; // no decimation if zero
+
+        // decimation state for data received directly from another leaf
+        std::size_t                           counter = 0;
+        std::chrono::steady_clock::time_point lastDelivered;
+        base::Buffer                          pending;
+        base::Id                              timer;
+        std::chrono::steady_clock::time_point deadline;
+
+        // data the binding group is interested in
+        ContentFilter filter;
+    };
+
+    struct advertised_credit
+    {
+        bool        limited = false;
+        std::size_t credit  = 0;
+    };
+
+    struct node_terminal_info_ext_type
+    {
+        // credit left for each flow-controlled subscriber or binding owner
+        std::unordered_map<interfaces::IConnection*, std::size_t> receivers;
+
+        // credit granted to each terminal owner
+        std::unordered_map<interfaces::IConnection*, advertised_credit>
+            publishers;
+
+        // filters declared by subscribing nodes and the merged filters sent
+        // to each owning node
+        std::unordered_map<interfaces::IConnection*, ContentFilter>
+            subscriberFilters;
+        std::unordered_map<interfaces::IConnection*, ContentFilter>
+            upstreamFilters;
+    };
+
+    struct decimation_info
+    {
+        std::chrono::milliseconds             minInterval{0};
+        std::size_t                           everyNth = 0;
+        std::size_t                           counter  = 0;
+        std::chrono::steady_clock::time_point lastSent;
+
+        // latest message held back until the interval has passed
+        base::Buffer                          pending;
+        base::Id                              timer;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    struct node_binding_info_ext_type
+    {
+        // binding owners that only want a fraction of the messages
+        std::unordered_map<interfaces::IConnection*, decimation_info>
+            decimatedOwners;
+
+        // binding owners only interested in some of the messages
+        std::unordered_map<interfaces::IConnection*, ContentFilter>
+            ownerFilters;
+    };
 };
 
 } // namespace publish_subscribe
@@ -2,9 +2,18 @@
 #define YOGI_CORE_SCATTER_GATHER_LEAFLOGIC_HPP
 
 #include "../../config.h"
+#include "../../base/DeadlineQueue.hpp"
+#include "../../base/ObjectRegister.hpp"
+#include "../../base/IdList.hpp"
 #include "../common/SubscribableLeafLogicBaseT.hpp"
 #include "Terminal.hpp"
 #include "logic_types.hpp"
+#include "anycast_policy.hpp"
+#include "gathered_response.hpp"
+#include "operation_id.hpp"
+
+#include <vector>
+#include <algorithm>
 
 
 namespace yogi {
@@ -13,6 +22,12 @@ namespace scatter_gather {
 
 /***************************************************************************//**
  * Implements the logic for scatter-gather terminals on leafs
+ *
+ * Each scattered message that a terminal has to respond to is tracked by a
+ * gather record. The records are kept in a register whose slots get re-used
+ * and are linked into lists per operation, per terminal and per binding group,
+ * so that tracking operations does not allocate memory once the number of
+ * concurrent operations has peaked.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class LeafLogic : public common::SubscribableLeafLogicBaseT<TTypes>
@@ -22,48 +37,242 @@ public:
     typedef typename TTypes::terminal_type terminal_type;
 
 private:
-    base::ObjectRegister<terminal_type*>              m_scatterOperations;
-    std::unordered_multimap<base::Id, terminal_type*> m_gatherOperations;
+    struct scatter_operation_info
+    {
+        terminal_type*                  terminal  = nullptr;
+        base::IdListHook                terminalHook;
+        std::size_t                     quorum    = 0;
+        std::size_t                     responses = 0;
+        base::DeadlineQueue::time_point deadline;
+    };
+
+    // a scattered message received by one terminal
+    struct gather_record
+    {
+        base::Id         operationId;
+        terminal_type*   terminal = nullptr;
+        base::Id         bindingGroupId;
+        base::IdListHook operationHook;
+        base::IdListHook terminalHook;
+        base::IdListHook bindingHook;
+
+        // anycast records only; the request is kept so that the other
+        // bindings of the group can be tried if the terminal cannot answer
+        bool                        anycast = false;
+        base::Buffer                request;
+        std::vector<terminal_type*> triedTerminals;
+    };
+
+    static constexpr base::IdListHook scatter_operation_info::* SCATTER_HOOK
+        = &scatter_operation_info::terminalHook;
+    static constexpr base::IdListHook gather_record::* OPERATION_HOOK
+        = &gather_record::operationHook;
+    static constexpr base::IdListHook gather_record::* TERMINAL_HOOK
+        = &gather_record::terminalHook;
+    static constexpr base::IdListHook gather_record::* BINDING_HOOK
+        = &gather_record::bindingHook;
 
 private:
-    template <typename TMultiMap>
-    void erase_from_multimap(TMultiMap* map,
-        const typename TMultiMap::key_type& key,
-        const typename TMultiMap::mapped_type& value)
+    base::ObjectRegister<scatter_operation_info> m_scatterOperations;
+    base::ObjectRegister<gather_record>          m_gatherRecords;
+    std::vector<base::IdList>                    m_gatherOperations; // by slot
+    base::DeadlineQueue                          m_deadlines;
+
+private:
+    void remove_deadline(base::Id operationId, scatter_operation_info& op)
+    {
+        if (op.deadline != base::DeadlineQueue::time_point{}) {
+            m_deadlines.remove(op.deadline, operationId);
+            op.deadline = base::DeadlineQueue::time_point{};
+        }
+    }
+
+    // stops notifying the terminal; the operation itself stays registered
+    // until the final Gather message arrives since the ID is still in use
+    void detach_scatter_operation(base::Id operationId)
+    {
+        auto& op = m_scatterOperations[operationId];
+        YOGI_ASSERT(op.terminal);
+
+        auto& tm = super::get_terminal_info(op.terminal->id());
+        tm.ext.scatterOperations.erase(m_scatterOperations, SCATTER_HOOK,
+            operationId);
+
+        remove_deadline(operationId, op);
+        op.terminal = nullptr;
+    }
+
+    void erase_scatter_operation(base::Id operationId)
+    {
+        YOGI_ASSERT(m_scatterOperations.count(operationId));
+        remove_deadline(operationId, m_scatterOperations[operationId]);
+        m_scatterOperations.erase(operationId);
+    }
+
+    void on_deadlines_expired()
+    {
+        auto lock = super::make_lock_guard();
+
+        m_deadlines.pop_expired([&](base::Id operationId) {
+            auto& op = m_scatterOperations[operationId];
+            op.deadline = base::DeadlineQueue::time_point{};
+
+            auto terminal = op.terminal;
+            YOGI_ASSERT(terminal);
+            detach_scatter_operation(operationId);
+
+            terminal->on_gathered_message_received(operationId,
+                GATHER_FINISHED | GATHER_TIMEOUT, base::Buffer{});
+        });
+    }
+
+    // the operation IDs are assigned by the node which re-uses their slots,
+    // so the operations can be looked up by the slot; since the node forgets
+    // about an operation before all responders have answered, the records of
+    // a slot may belong to different generations of the operation ID
+    base::IdList& gather_operation(base::Id operationId)
+    {
+        auto slot = operation_slot(operationId);
+        if (slot > m_gatherOperations.size()) {
+            m_gatherOperations.resize(slot);
+        }
+
+        return m_gatherOperations[slot - 1];
+    }
+
+    base::Id add_gather_record(base::Id operationId,
+        const typename super::terminal_info& tm,
+        const typename super::binding_info& bd, base::Id bindingGroupId)
     {
-        YOGI_ASSERT(map->count(key));
+        auto recordId = m_gatherRecords.insert();
+        auto& record  = m_gatherRecords[recordId];
 
-        auto range = map->equal_range(key);
-        auto it = std::find_if(range.first, range.second,
-            [&](const typename TMultiMap::value_type& entry) {
-                return entry.second == value;
+        record.operationId    = operationId;
+        record.terminal       = tm.terminal;
+        record.bindingGroupId = bindingGroupId;
+
+        gather_operation(operationId).push_front(m_gatherRecords,
+            OPERATION_HOOK, recordId);
+        tm.ext.gatherOperations.push_front(m_gatherRecords, TERMINAL_HOOK,
+            recordId);
+        bd.ext.gatherOperations.push_front(m_gatherRecords, BINDING_HOOK,
+            recordId);
+
+        return recordId;
+    }
+
+    // returns true if this was the last record of the operation
+    bool remove_gather_record(base::Id recordId)
+    {
+        auto& record = m_gatherRecords[recordId];
+        auto& tm     = super::get_terminal_info(record.terminal->id());
+        auto& bd     = super::get_binding_info(record.bindingGroupId);
+        auto& op     = gather_operation(record.operationId);
+
+        op.erase(m_gatherRecords, OPERATION_HOOK, recordId);
+        tm.ext.gatherOperations.erase(m_gatherRecords, TERMINAL_HOOK,
+            recordId);
+        bd.ext.gatherOperations.erase(m_gatherRecords, BINDING_HOOK,
+            recordId);
+
+        auto operationId = record.operationId;
+        m_gatherRecords.erase(recordId);
+
+        bool last = true;
+        op.foreach(m_gatherRecords, OPERATION_HOOK, [&](base::Id otherId) {
+            if (m_gatherRecords[otherId].operationId == operationId) {
+                last = false;
             }
-        );
+        });
 
-        YOGI_ASSERT(it != range.second);
-        map->erase(it);
+        return last;
     }
 
-    void remove_all_gather_operations(const typename super::terminal_info& tm)
+    // hands an anycast request that the record's terminal cannot answer to
+    // the next binding of the group; returns false if all have been tried
+    bool try_next_anycast_binding(base::Id recordId)
     {
-        for (auto& entry : tm.ext.gatherOperations) {
-            auto& bd = super::get_binding_info(entry.second);
-            erase_from_multimap(&m_gatherOperations, entry.first, tm.terminal);
+        auto& record = m_gatherRecords[recordId];
+        if (!record.anycast) {
+            return false;
+        }
+
+        record.triedTerminals.push_back(record.terminal);
+
+        auto& bd = super::get_binding_info(record.bindingGroupId);
+        auto& tried = record.triedTerminals;
 
-            YOGI_ASSERT(bd.ext.gatherOperations.count(entry.first));
-            erase_from_multimap(&bd.ext.gatherOperations, entry.first,
-                tm.terminal->id());
+        const typename super::terminal_info* next = nullptr;
+        for (std::size_t i = 0; i < bd.bindings.size() && !next; ++i) {
+            auto idx = (bd.ext.nextAnycastBinding + i) % bd.bindings.size();
+            auto& tm = super::get_terminal_info(
+                bd.bindings[idx]->terminal().id());
+            if (std::find(tried.begin(), tried.end(), tm.terminal)
+                == tried.end()) {
+                next = &tm;
+                bd.ext.nextAnycastBinding += i + 1;
+            }
+        }
+
+        if (!next) {
+            return false;
         }
+
+        auto& oldTm = super::get_terminal_info(record.terminal->id());
+        oldTm.ext.gatherOperations.erase(m_gatherRecords, TERMINAL_HOOK,
+            recordId);
+        next->ext.gatherOperations.push_front(m_gatherRecords, TERMINAL_HOOK,
+            recordId);
+        record.terminal = next->terminal;
+
+        next->terminal->on_scattered_message_received(record.operationId,
+            base::Buffer{record.request});
+
+        return true;
+    }
+
+    base::Id find_gather_record(base::Id operationId,
+        const terminal_type& terminal)
+    {
+        if (!operationId.valid()
+            || operation_slot(operationId) > m_gatherOperations.size()) {
+            return base::Id{};
+        }
+
+        base::Id found;
+        gather_operation(operationId).foreach(m_gatherRecords, OPERATION_HOOK,
+            [&](base::Id recordId) {
+                auto& record = m_gatherRecords[recordId];
+                if (record.operationId == operationId
+                    && record.terminal == &terminal) {
+                    found = recordId;
+                }
+            });
+
+        return found;
+    }
+
+    void remove_all_gather_operations(const typename super::terminal_info& tm)
+    {
+        tm.ext.gatherOperations.foreach(m_gatherRecords, TERMINAL_HOOK,
+            [&](base::Id recordId) {
+                remove_gather_record(recordId);
+            });
     }
 
 protected:
     LeafLogic(interfaces::IScheduler& scheduler)
         : super{scheduler}
+        , m_deadlines{scheduler, [this] {
+            on_deadlines_expired();
+        }}
     {
         super::template add_msg_handler<typename TTypes::Scatter>(this,
             &LeafLogic::on_message_received);
         super::template add_msg_handler<typename TTypes::Gather>(this,
             &LeafLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::GatherBatch>(this,
+            &LeafLogic::on_message_received);
     }
 
     void on_message_received(typename TTypes::Scatter&& msg)
@@ -73,27 +282,35 @@ protected:
         auto& bd = super::get_binding_info(msg[fields::subscriptionId]);
 
         //YOGI_ASSERT(bd.established || bd.fsm.destroyed()); TODO
-        YOGI_ASSERT(!m_gatherOperations.count(msg[fields::operationId]));
-        YOGI_ASSERT(!bd.ext.gatherOperations.count(msg[fields::operationId]));
 
         if (!bd.established) {
             return;
         }
 
-        for (auto& binding : bd.bindings) {
-            auto& tm = super::get_terminal_info(binding->terminal().id());
+        // anycast requests are answered by a single binding of the group and
+        // passed on to the next one if its terminal cannot answer
+        bool anycast = msg[fields::anycast] != ANYCAST_NONE
+            && bd.bindings.size() > 1;
 
-            // store gather operation in leaf
-            m_gatherOperations.insert(std::make_pair(msg[fields::operationId],
-                tm.terminal));
+        auto first = bd.bindings.begin();
+        auto last  = bd.bindings.end();
+        if (anycast) {
+            first += bd.ext.nextAnycastBinding++ % bd.bindings.size();
+            last   = first + 1;
+        }
 
-            // store gather operation in binding group
-            bd.ext.gatherOperations.insert(std::make_pair(
-				msg[fields::operationId], tm.terminal->id()));
+        for (auto it = first; it != last; ++it) {
+            auto binding = *it;
+            auto& tm = super::get_terminal_info(binding->terminal().id());
+
+            auto recordId = add_gather_record(msg[fields::operationId], tm, bd,
+                msg[fields::subscriptionId]);
 
-            // store gather operation in terminal
-            tm.ext.gatherOperations.insert(std::make_pair(
-				msg[fields::operationId], msg[fields::subscriptionId]));
+            if (anycast) {
+                auto& record   = m_gatherRecords[recordId];
+                record.anycast = true;
+                record.request = msg[fields::data];
+            }
 
             // let terminal notify the library user
             tm.terminal->on_scattered_message_received(msg[fields::operationId],
@@ -105,38 +322,79 @@ protected:
     {
 		using namespace messaging;
 
-        auto terminal = m_scatterOperations[msg[fields::operationId]];
+        base::Id operationId = msg[fields::operationId];
+        auto& op = m_scatterOperations[operationId];
 
-        if (terminal) {
-            bool abort = !terminal->on_gathered_message_received(
-                msg[fields::operationId], msg[fields::gatherFlags],
-				std::move(msg[fields::data]));
+        if (op.terminal) {
+            auto terminal = op.terminal;
+            gather_flags flags = msg[fields::gatherFlags];
 
-            if (abort) {
-                auto& tm = super::get_terminal_info(terminal->id());
+            if (op.quorum && is_response(flags)
+                && ++op.responses == op.quorum) {
+                flags |= GATHER_FINISHED | GATHER_QUORUM;
+            }
 
-                YOGI_ASSERT(tm.ext.scatterOperations.count(
-					msg[fields::operationId]));
-                tm.ext.scatterOperations.erase(msg[fields::operationId]);
+            if (flags & GATHER_FINISHED) {
+                detach_scatter_operation(operationId);
+            }
 
-                YOGI_ASSERT(m_scatterOperations.count(
-					msg[fields::operationId]));
-                m_scatterOperations[msg[fields::operationId]] = nullptr;
+            // the handler may start new operations which invalidates op
+            bool abort = !terminal->on_gathered_message_received(operationId,
+                flags, std::move(msg[fields::data]));
 
-                terminal = nullptr;
+            if (abort && m_scatterOperations[operationId].terminal) {
+                detach_scatter_operation(operationId);
             }
         }
 
-        if (msg[fields::gatherFlags] & gather_flags::GATHER_FINISHED) {
-            if (terminal) {
-                auto& tm = super::get_terminal_info(terminal->id());
+        if (msg[fields::gatherFlags] & GATHER_FINISHED) {
+            YOGI_ASSERT(!m_scatterOperations[operationId].terminal);
+            erase_scatter_operation(operationId);
+        }
+    }
+
+    void on_message_received(typename TTypes::GatherBatch&& msg)
+    {
+		using namespace messaging;
+
+        base::Id operationId = msg[fields::operationId];
+        auto& responses = msg[fields::responses];
+        if (responses.empty()) {
+            return;
+        }
+
+        bool finished = !!(responses.back().flags & GATHER_FINISHED);
+        auto& op = m_scatterOperations[operationId];
+
+        if (op.terminal) {
+            auto terminal = op.terminal;
+
+            // responses after the one reaching the quorum get discarded
+            for (auto it = responses.begin(); it != responses.end(); ++it) {
+                if (op.quorum && is_response(it->flags)
+                    && ++op.responses == op.quorum) {
+                    it->flags |= GATHER_FINISHED | GATHER_QUORUM;
+                    responses.erase(it + 1, responses.end());
+                    break;
+                }
+            }
+
+            if (responses.back().flags & GATHER_FINISHED) {
+                detach_scatter_operation(operationId);
+            }
+
+            // the handler may start new operations which invalidates op
+            bool abort = !terminal->on_gathered_messages_received(operationId,
+                std::move(responses));
 
-                YOGI_ASSERT(tm.ext.scatterOperations.count(
-					msg[fields::operationId]));
-                tm.ext.scatterOperations.erase(msg[fields::operationId]);
+            if (abort && m_scatterOperations[operationId].terminal) {
+                detach_scatter_operation(operationId);
             }
+        }
 
-            m_scatterOperations.erase(msg[fields::operationId]);
+        if (finished) {
+            YOGI_ASSERT(!m_scatterOperations[operationId].terminal);
+            erase_scatter_operation(operationId);
         }
     }
 
@@ -144,10 +402,14 @@ protected:
         const typename super::terminal_info& tm) override
     {
         // cleanup scatter operations
-        for (auto& operationId : tm.ext.scatterOperations) {
-            YOGI_ASSERT(m_scatterOperations.count(operationId));
-            m_scatterOperations[operationId] = nullptr;
-        }
+        tm.ext.scatterOperations.foreach(m_scatterOperations, SCATTER_HOOK,
+            [&](base::Id operationId) {
+                auto& op = m_scatterOperations[operationId];
+                remove_deadline(operationId, op);
+                op.terminal = nullptr;
+                tm.ext.scatterOperations.erase(m_scatterOperations,
+                    SCATTER_HOOK, operationId);
+            });
 
         // cleanup gather operations
         remove_all_gather_operations(tm);
@@ -165,21 +427,21 @@ protected:
             gather_flags flags = super::connected() ? GATHER_BINDINGDESTROYED :
                 GATHER_CONNECTIONLOST;
 
-            for (auto& operationId : tm.ext.scatterOperations) {
+            // the handlers may start or cancel other operations
+            auto& ops = tm.ext.scatterOperations;
+            while (!ops.empty()) {
+                auto operationId = ops.front();
+                ops.erase(m_scatterOperations, SCATTER_HOOK, operationId);
+                m_scatterOperations[operationId].terminal = nullptr;
+
                 tm.terminal->on_gathered_message_received(operationId,
                     flags | GATHER_FINISHED, base::Buffer{});
 
-                YOGI_ASSERT(m_scatterOperations.count(operationId));
-                m_scatterOperations.erase(operationId);
+                erase_scatter_operation(operationId);
             }
-
-            tm.ext.scatterOperations.clear();
         }
 
-        if (!tm.ext.gatherOperations.empty()) {
-            remove_all_gather_operations(tm);
-            tm.ext.gatherOperations.clear();
-        }
+        remove_all_gather_operations(tm);
     }
 
     virtual void on_binding_group_mapping_changed(bool isMapped,
@@ -190,16 +452,10 @@ protected:
         if (!bd.ext.gatherOperations.empty()) {
             YOGI_ASSERT(!super::connected() || !isMapped);
 
-            for (auto& entry : bd.ext.gatherOperations) {
-                auto& tm = super::get_terminal_info(entry.second);
-                YOGI_ASSERT(tm.ext.gatherOperations.count(entry.first));
-                tm.ext.gatherOperations.erase(entry.first);
-
-                erase_from_multimap(&m_gatherOperations, entry.first,
-                    tm.terminal);
-            }
-
-            bd.ext.gatherOperations.clear();
+            bd.ext.gatherOperations.foreach(m_gatherRecords, BINDING_HOOK,
+                [&](base::Id recordId) {
+                    remove_gather_record(recordId);
+                });
         }
     }
 
@@ -208,39 +464,42 @@ protected:
     {
 		using namespace messaging;
 
-        auto it = std::begin(bd.ext.gatherOperations);
-        while (it != std::end(bd.ext.gatherOperations)) {
-            auto& tm = super::get_terminal_info(it->second);
-            YOGI_ASSERT(tm.ext.gatherOperations.count(it->first));
-
-            if (tm.terminal->id() == binding.terminal().id()) {
-                tm.ext.gatherOperations.erase(it->first);
+        bd.ext.gatherOperations.foreach(m_gatherRecords, BINDING_HOOK,
+            [&](base::Id recordId) {
+                auto& record = m_gatherRecords[recordId];
+                if (record.terminal->id() != binding.terminal().id()) {
+                    return;
+                }
 
-                erase_from_multimap(&m_gatherOperations, it->first,
-                    tm.terminal);
+                if (try_next_anycast_binding(recordId)) {
+                    return;
+                }
 
-                if (!m_gatherOperations.count(it->first)) {
+                auto operationId = record.operationId;
+                if (remove_gather_record(recordId)) {
                     typename TTypes::Gather msg;
-                    msg[fields::operationId] = it->first;
+                    msg[fields::operationId] = operationId;
                     msg[fields::gatherFlags] = GATHER_BINDINGDESTROYED
-						| GATHER_FINISHED;
+                        | GATHER_FINISHED;
                     msg[fields::data] = base::Buffer{};
 
                     super::connection().send(msg);
                 }
-
-                it = bd.ext.gatherOperations.erase(it);
-            }
-            else {
-                ++it;
-            }
-        }
+            });
     }
 
 public:
+    // a timeout of zero means no deadline; a quorum of zero waits for all
+    // responses; with aggregation, nodes hold responses back for the given
+    // window or, if it is zero, until the operation finishes
     virtual std::pair<base::Id, std::unique_lock<std::recursive_mutex>>
         sg_scatter(typename TTypes::terminal_type& terminal,
-            base::Buffer&& data)
+            base::Buffer&& data,
+            std::chrono::milliseconds timeout = std::chrono::milliseconds{},
+            std::size_t quorum = 0, anycast_policy policy = ANYCAST_NONE,
+            bool aggregate = false,
+            std::chrono::milliseconds aggregationWindow
+                = std::chrono::milliseconds{})
     {
 		using namespace messaging;
 
@@ -254,20 +513,33 @@ public:
         base::Id id;
 
         try {
-            id = m_scatterOperations.insert(&terminal);
+            scatter_operation_info op;
+            op.terminal = &terminal;
+            op.quorum   = quorum;
+            id = m_scatterOperations.insert(std::move(op));
 
-            YOGI_ASSERT(!info.ext.scatterOperations.count(id));
-            info.ext.scatterOperations.insert(id);
+            info.ext.scatterOperations.push_front(m_scatterOperations,
+                SCATTER_HOOK, id);
         }
         catch (...) {
             m_scatterOperations.erase(id);
             throw;
         }
 
+        if (timeout.count()) {
+            m_scatterOperations[id].deadline = m_deadlines.add(timeout, id);
+        }
 
         typename TTypes::Scatter msg;
         msg[fields::subscriptionId] = info.fsm.mapped_id();
         msg[fields::operationId]    = id;
+        msg[fields::timeout]        = static_cast<std::size_t>(
+            timeout.count());
+        msg[fields::quorum]         = quorum;
+        msg[fields::anycast]        = static_cast<std::size_t>(policy);
+        msg[fields::aggregate]      = aggregate;
+        msg[fields::aggregationWindow] = static_cast<std::size_t>(
+            aggregationWindow.count());
         msg[fields::data]           = std::move(data);
 
         super::connection().send(msg);
@@ -280,14 +552,12 @@ public:
     {
         auto lock = super::make_lock_guard();
 
-        auto& info = super::get_terminal_info(terminal.id());
-
-        if (!info.ext.scatterOperations.erase(operationId)) {
+        auto op = m_scatterOperations.find_slot(operationId);
+        if (!op || op->terminal != &terminal) {
             throw api::ExceptionT<YOGI_ERR_INVALID_ID>{};
         }
 
-        YOGI_ASSERT(m_scatterOperations.count(operationId));
-        m_scatterOperations[operationId] = nullptr;
+        detach_scatter_operation(operationId);
 
         return lock;
     }
@@ -303,32 +573,21 @@ public:
         YOGI_ASSERT(!(flags & GATHER_CONNECTIONLOST));
 
         auto fn = [&] {
-            // find operation in terminal
-            auto& tm = super::get_terminal_info(terminal.id());
-            auto tmOpIt = tm.ext.gatherOperations.find(operationId);
-            if (tmOpIt == tm.ext.gatherOperations.end()) {
+            auto recordId = find_gather_record(operationId, terminal);
+            if (!recordId.valid()) {
                 throw api::ExceptionT<YOGI_ERR_INVALID_ID>{};
             }
 
-            // remove operation from binding
-            auto& bd = super::get_binding_info(tmOpIt->second);
-
-            erase_from_multimap(&bd.ext.gatherOperations, operationId,
-                terminal.id());
-
-            // remove operation from terminal
-            tm.ext.gatherOperations.erase(tmOpIt);
-
-            // remove operation from leaf
-            erase_from_multimap(&m_gatherOperations, operationId, &terminal);
+            if (!is_response(flags) && try_next_anycast_binding(recordId)) {
+                return;
+            }
 
-            // send Gather message
             typename TTypes::Gather msg;
             msg[fields::operationId] = operationId;
             msg[fields::gatherFlags] = flags;
             msg[fields::data]        = std::move(data);
 
-            if (!m_gatherOperations.count(operationId)) {
+            if (remove_gather_record(recordId)) {
                 msg[fields::gatherFlags] |= GATHER_FINISHED;
             }
 
@@ -3,8 +3,16 @@
 
 #include "../../config.h"
 #include "../../base/ObjectRegister.hpp"
+#include "../../base/DeadlineQueue.hpp"
+#include "../../base/SmallFlatMap.hpp"
 #include "../common/SubscribableNodeLogicBaseT.hpp"
 #include "logic_types.hpp"
+#include "anycast_policy.hpp"
+#include "operation_id.hpp"
+#include "gathered_response.hpp"
+
+#include <vector>
+#include <unordered_map>
 
 
 namespace yogi {
@@ -13,32 +21,395 @@ namespace scatter_gather {
 
 /***************************************************************************//**
  * Implements the logic for scatter-gather terminals on leafs
+ *
+ * Operations are kept in a register whose slots get re-used and the responders
+ * of an operation are stored inline for the usual small number of them. The
+ * operations of a terminal are linked through the operation records, so that
+ * forwarding a Scatter message and collecting its responses does not allocate
+ * memory once the number of concurrent operations has peaked.
+ *
+ * Since slots get re-used, the operation IDs sent to the responders carry the
+ * generation of their slot (see operation_id.hpp). Thus, an operation can be
+ * erased as soon as it has finished for its source, e.g. because its deadline
+ * has passed, and Gather messages from responders that answer afterwards get
+ * dropped instead of being mistaken for responses to a newer operation.
+ *
+ * If the scattering leaf asks for aggregation, responses are held back and
+ * sent to the source in GatherBatch messages, either when the aggregation
+ * window has passed or when the operation finishes.
  ******************************************************************************/
 template <typename TTypes=logic_types<>>
 class NodeLogic : public common::SubscribableNodeLogicBaseT<TTypes>
 {
     typedef common::SubscribableNodeLogicBaseT<TTypes> super;
 
+    // responder -> subscription ID the Scatter message got sent with
+    typedef base::SmallFlatMap<interfaces::IConnection*, base::Id, 4>
+        responder_map;
+
     struct operation_info_type
     {
-        interfaces::IConnection*                     source;
-        base::Id                                     sourceOperationId;
-        base::Id                                     terminalId;
-        std::unordered_set<interfaces::IConnection*> remainingResponses;
+        interfaces::IConnection*        source;
+        base::Id                        sourceOperationId;
+        base::Id                        terminalId;
+        base::IdListHook                terminalHook; // activeOperations
+        responder_map                   remainingResponses;
+        std::size_t                     quorum    = 0;
+        std::size_t                     responses = 0;
+        base::DeadlineQueue::time_point deadline;
+
+        // anycast operations only; the request is kept for failovers
+        anycast_policy                  policy    = ANYCAST_NONE;
+        base::Buffer                    request;
+        std::size_t                     timeout   = 0;
+        responder_map                   triedResponders;
+        base::DeadlineQueue::time_point dispatchedAt;
+
+        // aggregated operations only; responses not yet sent to the source
+        bool                            aggregate = false;
+        std::chrono::milliseconds       aggregationWindow{};
+        gathered_responses              pendingResponses;
+        base::DeadlineQueue::time_point flushDeadline;
+    };
+
+    static constexpr base::IdListHook operation_info_type::* TERMINAL_HOOK
+        = &operation_info_type::terminalHook;
+
+    struct responder_stats_type
+    {
+        std::size_t                              outstanding = 0;
+        base::DeadlineQueue::clock::duration     latency{};
+    };
+
+    // a responder is a terminal or binding group behind a connection, so
+    // that several of them behind the same node are told apart
+    typedef std::pair<interfaces::IConnection*, base::Id> responder_type;
+
+    struct responder_hash
+    {
+        std::size_t operator()(const responder_type& responder) const
+        {
+            return std::hash<interfaces::IConnection*>{}(responder.first)
+                ^ std::hash<base::Id>{}(responder.second);
+        }
     };
 
 private:
     base::ObjectRegister<operation_info_type> m_operations;
+    std::vector<base::Id::number_type>        m_slotGenerations;
+    base::DeadlineQueue                       m_deadlines;
+    base::DeadlineQueue                       m_flushDeadlines;
+    std::unordered_map<responder_type, responder_stats_type, responder_hash>
+                                              m_responderStats;
+
+private:
+    void remove_deadline(base::Id operationId, operation_info_type& op)
+    {
+        if (op.deadline != base::DeadlineQueue::time_point{}) {
+            m_deadlines.remove(op.deadline, operationId);
+            op.deadline = base::DeadlineQueue::time_point{};
+        }
+    }
+
+    base::Id insert_operation()
+    {
+        auto operationId = m_operations.insert();
+
+        if (m_slotGenerations.size() < operationId.number()) {
+            m_slotGenerations.resize(operationId.number(), 0);
+        }
+
+        return operationId;
+    }
+
+    // the ID that responders get to see for an operation
+    base::Id make_wire_id(base::Id operationId) const
+    {
+        return make_operation_id(operationId,
+            m_slotGenerations[operationId.number() - 1]);
+    }
+
+    // returns an invalid ID if the operation does not exist any more
+    base::Id find_operation(base::Id wireId)
+    {
+        auto slot       = operation_slot(wireId);
+        auto generation = operation_generation(wireId);
+        if (!slot || slot > m_slotGenerations.size()
+            || m_slotGenerations[slot - 1] != generation) {
+            return base::Id{};
+        }
+
+        // the slot may not be in use even if the generation matches
+        auto op = m_operations.find_slot(base::Id{slot});
+        if (!op || !op->source) {
+            return base::Id{};
+        }
+
+        return base::Id{slot};
+    }
+
+    void remove_flush_deadline(base::Id operationId, operation_info_type& op)
+    {
+        if (op.flushDeadline != base::DeadlineQueue::time_point{}) {
+            m_flushDeadlines.remove(op.flushDeadline, operationId);
+            op.flushDeadline = base::DeadlineQueue::time_point{};
+        }
+    }
+
+    // removes an operation once it has finished for its source; responders
+    // that have not answered yet do not count as outstanding any more
+    void erase_operation(base::Id operationId)
+    {
+        auto& op = m_operations[operationId];
+        remove_deadline(operationId, op);
+        remove_flush_deadline(operationId, op);
+
+        auto& tm = super::get_terminal_info(op.terminalId);
+        tm.ext.activeOperations.erase(m_operations, TERMINAL_HOOK,
+            operationId);
+
+        if (op.policy != ANYCAST_NONE) {
+            for (auto& responder : op.remainingResponses) {
+                on_anycast_responder_finished(responder, op, GATHER_FINISHED);
+            }
+        }
+
+        auto& generation = m_slotGenerations[operationId.number() - 1];
+        generation = (generation + 1) & OPERATION_GENERATION_MASK;
+        m_operations.erase(operationId);
+    }
+
+    void flush_responses(base::Id operationId, operation_info_type& op,
+        interfaces::IConnection* source)
+    {
+		using namespace messaging;
+
+        remove_flush_deadline(operationId, op);
+
+        auto& responses = op.pendingResponses;
+        if (responses.size() == 1) {
+            typename TTypes::Gather msg;
+            msg[fields::operationId] = op.sourceOperationId;
+            msg[fields::gatherFlags] = responses.front().flags;
+            msg[fields::data]        = std::move(responses.front().data);
+
+            source->send(msg);
+        }
+        else if (!responses.empty()) {
+            typename TTypes::GatherBatch msg;
+            msg[fields::operationId] = op.sourceOperationId;
+            msg[fields::responses]   = std::move(responses);
+
+            source->send(msg);
+        }
+
+        responses.clear();
+    }
+
+    // passes a response on to the source of the operation; the last response
+    // for the source has to carry the GATHER_FINISHED flag
+    void send_response(base::Id operationId, operation_info_type& op,
+        interfaces::IConnection* source, gather_flags flags,
+        base::Buffer&& data)
+    {
+		using namespace messaging;
+
+        if (!op.aggregate) {
+            typename TTypes::Gather msg;
+            msg[fields::operationId] = op.sourceOperationId;
+            msg[fields::gatherFlags] = flags;
+            msg[fields::data]        = std::move(data);
+
+            source->send(msg);
+            return;
+        }
+
+        op.pendingResponses.push_back(gathered_response{flags,
+            std::move(data)});
+
+        if (flags & GATHER_FINISHED) {
+            flush_responses(operationId, op, source);
+        }
+        else if (op.aggregationWindow.count()
+            && op.flushDeadline == base::DeadlineQueue::time_point{}) {
+            op.flushDeadline = m_flushDeadlines.add(op.aggregationWindow,
+                operationId);
+        }
+    }
+
+    responder_stats_type responder_stats(const responder_type& responder) const
+    {
+        auto it = m_responderStats.find(responder);
+        return it == m_responderStats.end() ? responder_stats_type{}
+                                            : it->second;
+    }
+
+    responder_type select_anycast_responder(
+        const typename super::terminal_info& tm, const operation_info_type& op)
+    {
+        std::vector<responder_type> candidates;
+
+        for (auto& subscriber : tm.subscribers) {
+            auto conn = const_cast<interfaces::IConnection*>(subscriber.first);
+            if (conn != op.source && !op.triedResponders.count(conn)) {
+                candidates.emplace_back(conn, subscriber.second);
+            }
+        }
+
+        if (tm.binding) {
+            auto& bd = super::get_binding_info(tm.binding);
+            for (auto& owner : bd.owningLeafs) {
+                if (owner.first != op.source
+                    && !op.triedResponders.count(owner.first)) {
+                    candidates.emplace_back(owner.first,
+                        owner.second.mapped_id());
+                }
+            }
+        }
+
+        if (candidates.empty()) {
+            return responder_type{nullptr, base::Id{}};
+        }
+
+        // start at the round-robin position so that ties get spread
+        auto start = tm.ext.nextAnycastResponder++ % candidates.size();
+        auto best  = start;
+
+        for (std::size_t i = 1; i < candidates.size(); ++i) {
+            auto idx = (start + i) % candidates.size();
+            auto cur = responder_stats(candidates[idx]);
+            auto bst = responder_stats(candidates[best]);
+
+            switch (op.policy) {
+            case ANYCAST_LEAST_OUTSTANDING:
+                if (cur.outstanding < bst.outstanding) {
+                    best = idx;
+                }
+                break;
+
+            case ANYCAST_LOWEST_LATENCY:
+                if (cur.latency < bst.latency) {
+                    best = idx;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        return candidates[best];
+    }
+
+    // returns false if there is no responder left to try
+    bool dispatch_anycast(base::Id operationId, operation_info_type& op)
+    {
+		using namespace messaging;
+
+        auto& tm = super::get_terminal_info(op.terminalId);
+        auto responder = select_anycast_responder(tm, op);
+        if (!responder.first) {
+            return false;
+        }
+
+        op.triedResponders[responder.first]    = responder.second;
+        op.remainingResponses[responder.first] = responder.second;
+        op.dispatchedAt = base::DeadlineQueue::clock::now();
+        ++m_responderStats[responder].outstanding;
+
+        typename TTypes::Scatter msg;
+        msg[fields::subscriptionId] = responder.second;
+        msg[fields::operationId]    = make_wire_id(operationId);
+        msg[fields::timeout]        = op.timeout;
+        msg[fields::quorum]         = std::size_t{0};
+        msg[fields::anycast]        = static_cast<std::size_t>(op.policy);
+        msg[fields::aggregate]      = false;
+        msg[fields::aggregationWindow] = std::size_t{0};
+        msg[fields::data]           = op.request;
+
+        responder.first->send(msg);
+        return true;
+    }
+
+    void on_anycast_responder_finished(const responder_type& responder,
+        const operation_info_type& op, gather_flags flags)
+    {
+        auto it = m_responderStats.find(responder);
+        if (it == m_responderStats.end()) {
+            return;
+        }
+
+        auto& stats = it->second;
+        if (stats.outstanding) {
+            --stats.outstanding;
+        }
+
+        if (is_response(flags)) {
+            auto sample = base::DeadlineQueue::clock::now() - op.dispatchedAt;
+            stats.latency = stats.latency.count()
+                ? (stats.latency * 7 + sample) / 8 : sample;
+        }
+    }
+
+    // a responder that cannot answer gets replaced by the next candidate
+    bool try_anycast_failover(base::Id operationId, operation_info_type& op,
+        interfaces::IConnection* failedResponder)
+    {
+        if (op.policy == ANYCAST_NONE) {
+            return false;
+        }
+
+        if (!dispatch_anycast(operationId, op)) {
+            return false;
+        }
+
+        op.remainingResponses.erase(failedResponder);
+        return true;
+    }
+
+    void on_deadlines_expired()
+    {
+        auto lock = super::make_lock_guard();
+
+        m_deadlines.pop_expired([&](base::Id operationId) {
+            auto& op = m_operations[operationId];
+            op.deadline = base::DeadlineQueue::time_point{};
+
+            send_response(operationId, op, op.source,
+                GATHER_FINISHED | GATHER_TIMEOUT, base::Buffer{});
+            erase_operation(operationId);
+        });
+    }
+
+    void on_flush_deadlines_expired()
+    {
+        auto lock = super::make_lock_guard();
+
+        m_flushDeadlines.pop_expired([&](base::Id operationId) {
+            auto& op = m_operations[operationId];
+            op.flushDeadline = base::DeadlineQueue::time_point{};
+
+            flush_responses(operationId, op, op.source);
+        });
+    }
 
 protected:
     NodeLogic(interfaces::IScheduler& scheduler,
         typename super::known_terminals_changed_fn knownTerminalsChangedFn)
         : super{scheduler, knownTerminalsChangedFn}
+        , m_deadlines{scheduler, [this] {
+            on_deadlines_expired();
+        }}
+        , m_flushDeadlines{scheduler, [this] {
+            on_flush_deadlines_expired();
+        }}
     {
         super::template add_msg_handler<typename TTypes::Scatter>(this,
             &NodeLogic::on_message_received);
         super::template add_msg_handler<typename TTypes::Gather>(this,
             &NodeLogic::on_message_received);
+        super::template add_msg_handler<typename TTypes::GatherBatch>(this,
+            &NodeLogic::on_message_received);
     }
 
     virtual void on_subscriber_removed(interfaces::IConnection& conn,
@@ -47,48 +418,60 @@ protected:
 		using namespace messaging;
 
 		bool connectionIsAlive = super::is_connection_alive(conn);
+        if (!connectionIsAlive) {
+            for (auto it = m_responderStats.begin();
+                it != m_responderStats.end(); ) {
+                if (it->first.first == &conn) {
+                    it = m_responderStats.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
 
-        auto opIdIt = tm.ext.activeOperations.begin();
-        while (opIdIt != tm.ext.activeOperations.end()) {
-            auto operationId = *opIdIt;
-            auto& op         = m_operations[operationId];
-
-			bool opErased = false;
-			if (&conn != op.source) {
-				if (!connectionIsAlive || !conn.remote_is_node()) {
-					if (op.remainingResponses.erase(&conn)) {
-						interfaces::IConnection* opSource = op.source;
+        tm.ext.activeOperations.foreach(m_operations, TERMINAL_HOOK,
+            [&](base::Id operationId) {
+                auto& op = m_operations[operationId];
+                if (&conn == op.source
+                    || (connectionIsAlive && conn.remote_is_node())) {
+                    return;
+                }
 
-                        typename TTypes::Gather msg;
-						msg[fields::operationId] = op.sourceOperationId;
-						msg[fields::data]        = base::Buffer{};
+                if (op.policy != ANYCAST_NONE
+                    && op.remainingResponses.count(&conn)) {
+                    if (connectionIsAlive) {
+                        on_anycast_responder_finished(responder_type{&conn,
+                            op.remainingResponses[&conn]}, op,
+                            GATHER_BINDINGDESTROYED);
+                    }
+
+                    if (try_anycast_failover(operationId, op, &conn)) {
+                        return;
+                    }
+                }
 
-						if (conn.remote_is_node() || !connectionIsAlive) {
-							msg[fields::gatherFlags] = GATHER_CONNECTIONLOST;
-						}
-						else {
-							msg[fields::gatherFlags] = GATHER_BINDINGDESTROYED;
-						}
+                if (!op.remainingResponses.erase(&conn)) {
+                    return;
+                }
 
-						if (op.remainingResponses.empty()) {
-							opIdIt   = tm.ext.activeOperations.erase(opIdIt);
-							opErased = true;
+                gather_flags flags = GATHER_BINDINGDESTROYED;
+                if (conn.remote_is_node() || !connectionIsAlive) {
+                    flags = GATHER_CONNECTIONLOST;
+                }
 
-							m_operations.erase(operationId);
-							msg[fields::gatherFlags] |= GATHER_FINISHED;
-						}
+                bool lastResponse = op.remainingResponses.empty();
+                if (lastResponse) {
+                    flags |= GATHER_FINISHED;
+                }
 
-						if (opSource) {
-							opSource->send(msg);
-						}
-					}
-				}
-			}
+                send_response(operationId, op, op.source, flags,
+                    base::Buffer{});
 
-			if (!opErased) {
-				++opIdIt;
-			}
-        }
+                if (lastResponse) {
+                    erase_operation(operationId);
+                }
+            });
     }
 
     virtual void on_terminal_owner_removed(interfaces::IConnection& conn,
@@ -96,17 +479,13 @@ protected:
     {
         super::on_terminal_owner_removed(conn, tm);
 
-        auto operationIt = tm->ext.activeOperations.begin();
-        while (operationIt != tm->ext.activeOperations.end()) {
-            auto& op = m_operations[*operationIt];
-            if (op.source == &conn) {
-                op.source = nullptr;
-                operationIt = tm->ext.activeOperations.erase(operationIt);
-            }
-            else {
-                ++operationIt;
-            }
-        }
+        // nobody is interested in the responses any more
+        tm->ext.activeOperations.foreach(m_operations, TERMINAL_HOOK,
+            [&](base::Id operationId) {
+                if (m_operations[operationId].source == &conn) {
+                    erase_operation(operationId);
+                }
+            });
     }
 
     void on_message_received(typename TTypes::Scatter&& msg,
@@ -116,41 +495,56 @@ protected:
 
         auto& tm = super::get_terminal_info(msg[fields::subscriptionId]);
 
-        auto operationId = m_operations.insert();
+        auto operationId = insert_operation();
         auto& op         = m_operations[operationId];
 
         op.source            = &origin;
         op.sourceOperationId = msg[fields::operationId];
         op.terminalId        = msg[fields::subscriptionId];
-
-        msg[fields::operationId] = operationId;
-
-        for (auto& subscriber : tm.subscribers) {
-            auto conn = const_cast<interfaces::IConnection*>(subscriber.first);
-            if (conn != &origin) {
-                YOGI_ASSERT(tm.usingNodes.count(conn));
-                YOGI_ASSERT(tm.usingNodes.find(conn)->second.is_mapped());
-                YOGI_ASSERT(!op.remainingResponses.count(conn));
-
-                op.remainingResponses.insert(conn);
-
-                msg[fields::subscriptionId] = subscriber.second;
-                conn->send(msg);
-            }
+        op.quorum            = msg[fields::quorum];
+        op.policy            = static_cast<anycast_policy>(
+            msg[fields::anycast]);
+        op.aggregate         = msg[fields::aggregate];
+        op.aggregationWindow = std::chrono::milliseconds{
+            msg[fields::aggregationWindow]};
+
+        msg[fields::operationId] = make_wire_id(operationId);
+
+        if (op.policy != ANYCAST_NONE) {
+            op.request = std::move(msg[fields::data]);
+            op.timeout = msg[fields::timeout];
+            dispatch_anycast(operationId, op);
         }
+        else {
+            for (auto& subscriber : tm.subscribers) {
+                auto conn = const_cast<interfaces::IConnection*>(
+                    subscriber.first);
+                if (conn != &origin) {
+                    YOGI_ASSERT(tm.usingNodes.count(conn));
+                    YOGI_ASSERT(tm.usingNodes.find(conn)->second.is_mapped());
+                    YOGI_ASSERT(!op.remainingResponses.count(conn));
+
+                    op.remainingResponses[conn] = subscriber.second;
+
+                    msg[fields::subscriptionId] = subscriber.second;
+                    conn->send(msg);
+                }
+            }
 
-        if (tm.binding) {
-            auto& bd = super::get_binding_info(tm.binding);
+            if (tm.binding) {
+                auto& bd = super::get_binding_info(tm.binding);
 
-            for (auto& owner : bd.owningLeafs) {
-                if (owner.first != &origin) {
-                    YOGI_ASSERT(owner.second.is_mapped());
-                    YOGI_ASSERT(!op.remainingResponses.count(owner.first));
+                for (auto& owner : bd.owningLeafs) {
+                    if (owner.first != &origin) {
+                        YOGI_ASSERT(owner.second.is_mapped());
+                        YOGI_ASSERT(!op.remainingResponses.count(owner.first));
 
-                    op.remainingResponses.insert(owner.first);
+                        op.remainingResponses[owner.first]
+                            = owner.second.mapped_id();
 
-                    msg[fields::subscriptionId] = owner.second.mapped_id();
-                    owner.first->send(msg);
+                        msg[fields::subscriptionId] = owner.second.mapped_id();
+                        owner.first->send(msg);
+                    }
                 }
             }
         }
@@ -161,42 +555,86 @@ protected:
 			m_operations.erase(operationId);
 		}
 		else {
-			YOGI_ASSERT(!tm.ext.activeOperations.count(operationId));
-			tm.ext.activeOperations.insert(operationId);
+			tm.ext.activeOperations.push_front(m_operations, TERMINAL_HOOK,
+                operationId);
+
+            if (msg[fields::timeout]) {
+                op.deadline = m_deadlines.add(std::chrono::milliseconds{
+                    msg[fields::timeout]}, operationId);
+            }
 		}
     }
 
-    void on_message_received(typename TTypes::Gather&& msg,
-        interfaces::IConnection& origin)
+    void on_response_received(base::Id wireId, gather_flags flags,
+        base::Buffer&& data, interfaces::IConnection& origin)
     {
-		using namespace messaging;
+        // responses arriving after the operation has finished get dropped
+        auto operationId = find_operation(wireId);
+        if (!operationId) {
+            return;
+        }
 
-        base::Id operationId = msg[fields::operationId];
         auto& op = m_operations[operationId];
-        YOGI_ASSERT(op.remainingResponses.count(&origin));
+        if (!op.remainingResponses.count(&origin)) {
+            return;
+        }
 
-        interfaces::IConnection* opSource = op.source;
-        msg[fields::operationId] = op.sourceOperationId;
+        if (op.policy != ANYCAST_NONE && (flags & GATHER_FINISHED)) {
+            on_anycast_responder_finished(responder_type{&origin,
+                op.remainingResponses[&origin]}, op, flags);
 
-        if (msg[fields::gatherFlags] & GATHER_FINISHED) {
-            op.remainingResponses.erase(&origin);
+            if (!is_response(flags) && !(flags & GATHER_TIMEOUT)
+                && try_anycast_failover(operationId, op, &origin)) {
+                return;
+            }
+        }
 
-            if (op.remainingResponses.empty()) {
-                if (opSource) {
-                    auto& tm = super::get_terminal_info(op.terminalId);
-                    YOGI_ASSERT(tm.ext.activeOperations.count(operationId));
-                    tm.ext.activeOperations.erase(operationId);
-                }
+        // deadlines and quorums reached by other nodes only concern their
+        // share of the responses
+        flags &= ~(GATHER_TIMEOUT | GATHER_QUORUM);
 
-                m_operations.erase(operationId);
-            }
-            else {
-                msg[fields::gatherFlags] &= ~GATHER_FINISHED;
+        bool quorumReached = op.quorum && is_response(flags)
+            && ++op.responses == op.quorum;
+
+        bool lastResponse = false;
+        if (flags & GATHER_FINISHED) {
+            op.remainingResponses.erase(&origin);
+            lastResponse = op.remainingResponses.empty();
+
+            if (!lastResponse) {
+                flags &= ~GATHER_FINISHED;
             }
         }
 
-        if (opSource) {
-            opSource->send(msg);
+        if (quorumReached) {
+            flags |= GATHER_FINISHED | GATHER_QUORUM;
+        }
+
+        send_response(operationId, op, op.source, flags, std::move(data));
+
+        if (lastResponse || quorumReached) {
+            erase_operation(operationId);
+        }
+    }
+
+    void on_message_received(typename TTypes::Gather&& msg,
+        interfaces::IConnection& origin)
+    {
+		using namespace messaging;
+
+        on_response_received(msg[fields::operationId],
+            msg[fields::gatherFlags], std::move(msg[fields::data]), origin);
+    }
+
+    void on_message_received(typename TTypes::GatherBatch&& msg,
+        interfaces::IConnection& origin)
+    {
+		using namespace messaging;
+
+        // only the last response of a batch can finish the operation
+        for (auto& response : msg[fields::responses]) {
+            on_response_received(msg[fields::operationId], response.flags,
+                std::move(response.data), origin);
         }
     }
 };
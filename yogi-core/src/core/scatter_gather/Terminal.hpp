@@ -9,10 +9,15 @@
 #include "../common/SubscribableTerminalBaseT.hpp"
 #include "logic_types.hpp"
 #include "gather_flags.hpp"
+#include "anycast_policy.hpp"
+#include "gathered_response.hpp"
 
 #include <boost/asio/buffer.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <unordered_map>
 
@@ -36,8 +41,17 @@ public:
     typedef std::function<void (const api::Exception&, base::Id,
         std::size_t)> receive_scattered_message_handler_fn;
 
+    // parameters are the combined flags of the responses, the number of
+    // responses and the number of bytes written
+    typedef std::function<bool (const api::Exception&, base::Id,
+        gather_flags, std::size_t, std::size_t)>
+        receive_gathered_messages_handler_fn;
+
+    // only one of the two operations is armed for a task
     struct task_type {
         base::AsyncOperation<receive_gathered_message_handler_fn> operation;
+        base::AsyncOperation<receive_gathered_messages_handler_fn>
+            batchOperation;
         boost::asio::mutable_buffers_1 gatherBuffer{
             boost::asio::mutable_buffer{}};
     };
@@ -54,6 +68,81 @@ private:
     boost::asio::mutable_buffers_1                             m_replyBuffer;
     base::AsyncOperation<receive_scattered_message_handler_fn> m_replyOp;
 
+private:
+    task_type& add_task(base::Id id, boost::asio::mutable_buffers_1 gathBuf)
+    {
+        YOGI_ASSERT(!m_tasks.count(id));
+        auto taskIt = m_tasks.emplace(std::make_pair(id,
+            std::make_unique<task_type>())).first;
+        auto& task = *taskIt->second;
+
+        task.gatherBuffer = gathBuf;
+        return task;
+    }
+
+    static void write_response(char* dst, std::size_t size,
+        const gathered_response& response)
+    {
+        char header[YOGI_SG_RESPONSE_HEADER_SIZE];
+        auto dataSize = static_cast<std::uint32_t>(response.data.size());
+        std::memcpy(header, &dataSize, 4);
+        header[4] = static_cast<char>(response.flags);
+
+        auto n = std::min(size, sizeof(header));
+        std::memcpy(dst, header, n);
+        std::memcpy(dst + n, response.data.data(),
+            std::min(size - n, response.data.size()));
+    }
+
+    // fills as many responses as possible into the gather buffer for each
+    // call of the handler; returns false if the handler aborted the operation
+    bool deliver_batch(base::Id operationId, task_type& task,
+        const gathered_responses& responses)
+    {
+        auto dst  = boost::asio::buffer_cast<char*>(task.gatherBuffer);
+        auto size = boost::asio::buffer_size(task.gatherBuffer);
+
+        auto it = responses.begin();
+        while (it != responses.end()) {
+            gather_flags flags = GATHER_NO_FLAGS;
+            std::size_t numResponses = 0;
+            std::size_t offset       = 0;
+
+            for (; it != responses.end(); ++it) {
+                auto required = YOGI_SG_RESPONSE_HEADER_SIZE + it->data.size();
+                if (required > size - offset) {
+                    break;
+                }
+
+                write_response(dst + offset, required, *it);
+                flags  |= it->flags;
+                offset += required;
+                ++numResponses;
+            }
+
+            bool proceed;
+            if (numResponses) {
+                proceed = task.batchOperation.template fire_and_reload<
+                    YOGI_OK>(operationId, flags, numResponses, offset);
+            }
+            else {
+                // the buffer gets the beginning of the response
+                write_response(dst, size, *it);
+                proceed = task.batchOperation.template fire_and_reload<
+                    YOGI_ERR_BUFFER_TOO_SMALL>(operationId, it->flags,
+                        std::size_t{1},
+                        YOGI_SG_RESPONSE_HEADER_SIZE + it->data.size());
+                ++it;
+            }
+
+            if (!proceed) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
 public:
     template <typename _TBase = SubscribableTerminalBaseT>
     Terminal(Leaf& leaf, base::Identifier identifier)
@@ -76,6 +165,9 @@ public:
             task.operation.template fire<YOGI_ERR_CANCELED>(entry.first,
                 GATHER_NO_FLAGS, 0);
             task.operation.await_idle();
+            task.batchOperation.template fire<YOGI_ERR_CANCELED>(entry.first,
+                GATHER_NO_FLAGS, std::size_t{0}, std::size_t{0});
+            task.batchOperation.await_idle();
         }
 
         m_replyOp.fire<YOGI_ERR_CANCELED>(base::Id{}, 0);
@@ -87,26 +179,27 @@ public:
         return m_id;
     }
 
+    // the operation finishes with GATHER_TIMEOUT once the timeout expires or
+    // with GATHER_QUORUM after quorum responses (zero disables either limit);
+    // with an anycast policy, only a single responder gets the message
     base::Id async_scatter_gather(base::Buffer&& scatData,
         boost::asio::mutable_buffers_1 gathBuf,
-        receive_gathered_message_handler_fn handlerFn)
+        receive_gathered_message_handler_fn handlerFn,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds{},
+        std::size_t quorum = 0, anycast_policy policy = ANYCAST_NONE)
     {
         // res.second holds LeafLogic lock guard
         auto res = static_cast<typename TTypes::leaf_logic_type&>(
             static_cast<Leaf&>(leaf())).sg_scatter(
                 static_cast<typename TTypes::terminal_type&>(*this),
-                std::move(scatData));
+                std::move(scatData), timeout, quorum, policy);
         base::Id id = res.first;
 
         std::lock_guard<std::recursive_mutex> lock{m_tasksMutex};
 
-        YOGI_ASSERT(!m_tasks.count(id));
-        auto taskIt = m_tasks.emplace(std::make_pair(id,
-            std::make_unique<task_type>())).first;
-        auto& task = *taskIt->second;
+        auto& task = add_task(id, gathBuf);
 
         try {
-            task.gatherBuffer = gathBuf;
             task.operation.arm(handlerFn);
         }
         catch (...) {
@@ -117,6 +210,31 @@ public:
         return id;
     }
 
+    // like async_scatter_gather() but the handler receives one or more
+    // responses at once; with aggregation, nodes combine the responses into
+    // batches as well (see LeafLogic::sg_scatter())
+    base::Id async_scatter_gather_batched(base::Buffer&& scatData,
+        boost::asio::mutable_buffers_1 gathBuf,
+        receive_gathered_messages_handler_fn handlerFn,
+        std::chrono::milliseconds timeout, std::size_t quorum,
+        bool aggregate, std::chrono::milliseconds aggregationWindow)
+    {
+        // res.second holds LeafLogic lock guard
+        auto res = static_cast<typename TTypes::leaf_logic_type&>(
+            static_cast<Leaf&>(leaf())).sg_scatter(
+                static_cast<typename TTypes::terminal_type&>(*this),
+                std::move(scatData), timeout, quorum, ANYCAST_NONE, aggregate,
+                aggregationWindow);
+        base::Id id = res.first;
+
+        std::lock_guard<std::recursive_mutex> lock{m_tasksMutex};
+
+        auto& task = add_task(id, gathBuf);
+        task.batchOperation.arm(handlerFn);
+
+        return id;
+    }
+
     void cancel_scatter_gather(base::Id operationId)
     {
         auto lock_ = static_cast<typename TTypes::leaf_logic_type&>(
@@ -132,6 +250,8 @@ public:
 
         task.operation.template fire<YOGI_ERR_CANCELED>(operationId,
             GATHER_NO_FLAGS, 0);
+        task.batchOperation.template fire<YOGI_ERR_CANCELED>(operationId,
+            GATHER_NO_FLAGS, std::size_t{0}, std::size_t{0});
 
         m_tasks.erase(taskIt);
     }
@@ -214,11 +334,15 @@ public:
         YOGI_ASSERT(taskIt != m_tasks.end());
         auto& task = *taskIt->second;
 
-        std::size_t n = boost::asio::buffer_copy(task.gatherBuffer,
-            boost::asio::buffer(data.data(), data.size()));
-
         bool abort;
-        if (n == data.size()) {
+        if (task.batchOperation.armed()) {
+            gathered_responses responses(1);
+            responses.front().flags = flags;
+            responses.front().data  = std::move(data);
+            abort = !deliver_batch(operationId, task, responses);
+        }
+        else if (boost::asio::buffer_copy(task.gatherBuffer,
+            boost::asio::buffer(data.data(), data.size())) == data.size()) {
             abort = !task.operation.template fire_and_reload<YOGI_OK>(operationId,
                 flags, data.size());
         }
@@ -229,6 +353,46 @@ public:
 
         if (abort || (flags & GATHER_FINISHED)) {
             task.operation.disarm();
+            task.batchOperation.disarm();
+            m_tasks.erase(taskIt);
+        }
+
+        mst_threadHasLeafLock = false;
+
+        return !abort;
+    }
+
+    // responses from a GatherBatch message; only the last one can have the
+    // GATHER_FINISHED flag set
+    virtual bool on_gathered_messages_received(base::Id operationId,
+        gathered_responses&& responses)
+    {
+        YOGI_ASSERT(!responses.empty());
+
+        std::unique_lock<std::recursive_mutex> lock{m_tasksMutex};
+
+        auto taskIt = m_tasks.find(operationId);
+        YOGI_ASSERT(taskIt != m_tasks.end());
+        auto& task = *taskIt->second;
+
+        if (!task.batchOperation.armed()) {
+            lock.unlock();
+
+            for (auto& response : responses) {
+                if (!on_gathered_message_received(operationId, response.flags,
+                    std::move(response.data))) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        mst_threadHasLeafLock = true;
+
+        bool abort = !deliver_batch(operationId, task, responses);
+        if (abort || (responses.back().flags & GATHER_FINISHED)) {
+            task.batchOperation.disarm();
             m_tasks.erase(taskIt);
         }
 
@@ -0,0 +1,24 @@
+#ifndef YOGI_CORE_SCATTER_GATHER_ANYCAST_POLICY_HPP
+#define YOGI_CORE_SCATTER_GATHER_ANYCAST_POLICY_HPP
+
+#include "../../config.h"
+
+
+namespace yogi {
+namespace core {
+namespace scatter_gather {
+
+// how a node picks the single responder for a scattered message
+enum anycast_policy
+{
+    ANYCAST_NONE              = 0, // scatter to all responders
+    ANYCAST_ROUND_ROBIN       = 1,
+    ANYCAST_LEAST_OUTSTANDING = 2,
+    ANYCAST_LOWEST_LATENCY    = 3,
+};
+
+} // namespace scatter_gather
+} // namespace core
+} // namespace yogi
+
+#endif // YOGI_CORE_SCATTER_GATHER_ANYCAST_POLICY_HPP
@@ -19,6 +19,8 @@ enum gather_flags
     GATHER_DEAF             = (1<<2),
     GATHER_BINDINGDESTROYED = (1<<3),
     GATHER_CONNECTIONLOST   = (1<<4),
+    GATHER_TIMEOUT          = (1<<5),
+    GATHER_QUORUM           = (1<<6),
 };
 
 inline gather_flags operator& (gather_flags a, gather_flags b)
@@ -46,6 +48,13 @@ inline gather_flags& operator&= (gather_flags& a, gather_flags b)
     return a = a & b;
 }
 
+// true if the gathered message carries an actual response from a terminal
+inline bool is_response(gather_flags flags)
+{
+    return !(flags & (GATHER_IGNORED | GATHER_DEAF | GATHER_BINDINGDESTROYED
+        | GATHER_CONNECTIONLOST | GATHER_TIMEOUT));
+}
+
 } // namespace scatter_gather
 } // namespace core
 } // namespace yogi
@@ -77,6 +86,12 @@ inline std::ostream& operator<< (std::ostream& os,
 		if (flags & GATHER_CONNECTIONLOST) {
 			v.push_back("CONNECTIONLOST");
 		}
+		if (flags & GATHER_TIMEOUT) {
+			v.push_back("TIMEOUT");
+		}
+		if (flags & GATHER_QUORUM) {
+			v.push_back("QUORUM");
+		}
 	}
 
 	for (std::size_t i = 0; i < v.size(); ++i) {
@@ -0,0 +1,52 @@
+#ifndef YOGI_CORE_SCATTER_GATHER_GATHERED_RESPONSE_HPP
+#define YOGI_CORE_SCATTER_GATHER_GATHERED_RESPONSE_HPP
+
+#include "../../config.h"
+#include "../../base/Buffer.hpp"
+#include "gather_flags.hpp"
+
+#include <ostream>
+#include <vector>
+
+
+namespace yogi {
+namespace core {
+namespace scatter_gather {
+
+// a single response within a batch of responses aggregated by a node
+struct gathered_response
+{
+    gather_flags flags = GATHER_NO_FLAGS;
+    base::Buffer data;
+};
+
+inline bool operator== (const gathered_response& lhs,
+    const gathered_response& rhs)
+{
+    return lhs.flags == rhs.flags && lhs.data == rhs.data;
+}
+
+typedef std::vector<gathered_response> gathered_responses;
+
+// found via ADL since the element type lives in this namespace
+inline std::ostream& operator<< (std::ostream& os,
+    const gathered_responses& responses)
+{
+    os << "[";
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+        os << "(" << responses[i].flags << ", ";
+        ::operator<<(os, responses[i].data) << ")";
+        if (i < responses.size() - 1) {
+            os << ", ";
+        }
+    }
+    os << "]";
+
+    return os;
+}
+
+} // namespace scatter_gather
+} // namespace core
+} // namespace yogi
+
+#endif // YOGI_CORE_SCATTER_GATHER_GATHERED_RESPONSE_HPP
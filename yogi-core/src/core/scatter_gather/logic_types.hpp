@@ -4,10 +4,7 @@
 #include "../../config.h"
 #include "../common/subscribable_logic_types.hpp"
 #include "../../messaging/messages/ScatterGather.hpp"
-
-#include <unordered_map>
-#include <unordered_set>
-#include <algorithm>
+#include "../../base/IdList.hpp"
 
 
 namespace yogi {
@@ -32,24 +29,23 @@ struct logic_types
 	typedef NodeLogic<logic_types> node_logic_type;
 	typedef Terminal<logic_types> terminal_type;
 
-    typedef std::unordered_set<base::Id>                operations_set;
-    typedef std::unordered_map<base::Id, base::Id>      operations_map;
-    typedef std::unordered_multimap<base::Id, base::Id> operations_multimap;
-
+    // the lists link the operation records kept by the leaf and node logic
     struct leaf_terminal_info_ext_type
     {
-        operations_set scatterOperations; // operation ID
-        operations_map gatherOperations;  // operation ID -> binding group ID
+        base::IdList scatterOperations;
+        base::IdList gatherOperations;
     };
 
     struct leaf_binding_info_ext_type
     {
-        operations_multimap gatherOperations; // operation ID -> terminal ID
+        base::IdList gatherOperations;
+        std::size_t  nextAnycastBinding = 0;
     };
 
     struct node_terminal_info_ext_type
     {
-        std::unordered_set<base::Id> activeOperations;
+        base::IdList activeOperations;
+        std::size_t  nextAnycastResponder = 0;
     };
 };
 
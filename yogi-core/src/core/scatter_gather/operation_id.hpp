@@ -0,0 +1,49 @@
+#ifndef YOGI_CORE_SCATTER_GATHER_OPERATION_ID_HPP
+#define YOGI_CORE_SCATTER_GATHER_OPERATION_ID_HPP
+
+#include "../../config.h"
+#include "../../base/Id.hpp"
+
+
+namespace yogi {
+namespace core {
+namespace scatter_gather {
+
+// Operation IDs that nodes send to responders consist of the slot of the
+// operation in the node's register (lower 20 bits) and the generation of that
+// slot (next 11 bits). Thus, the ID of an operation that has been erased does
+// not come back when its slot gets re-used. Both parts together stay below
+// 2^31 so the ID fits into a 32-bit number and into the five bytes that
+// serialize_one() uses at most for numbers.
+static const unsigned OPERATION_SLOT_BITS = 20;
+
+static const base::Id::number_type OPERATION_SLOT_MASK
+    = (base::Id::number_type{1} << OPERATION_SLOT_BITS) - 1;
+
+static const base::Id::number_type OPERATION_GENERATION_MASK
+    = (base::Id::number_type{1} << 11) - 1;
+
+inline base::Id make_operation_id(base::Id slot,
+    base::Id::number_type generation)
+{
+    YOGI_ASSERT(slot.number() <= OPERATION_SLOT_MASK);
+    return base::Id{slot.number()
+        | ((generation & OPERATION_GENERATION_MASK) << OPERATION_SLOT_BITS)};
+}
+
+inline base::Id::number_type operation_slot(base::Id operationId)
+{
+    return operationId.number() & OPERATION_SLOT_MASK;
+}
+
+inline base::Id::number_type operation_generation(base::Id operationId)
+{
+    return (operationId.number() >> OPERATION_SLOT_BITS)
+        & OPERATION_GENERATION_MASK;
+}
+
+} // namespace scatter_gather
+} // namespace core
+} // namespace yogi
+
+#endif // YOGI_CORE_SCATTER_GATHER_OPERATION_ID_HPP
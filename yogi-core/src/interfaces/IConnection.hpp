@@ -4,6 +4,10 @@
 #include "../config.h"
 #include "IMessage.hpp"
 #include "IConnectionLike.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <vector>
+#include <functional>
 
 
 namespace yogi {
@@ -17,7 +21,32 @@ namespace interfaces {
  ******************************************************************************/
 struct IConnection : public IConnectionLike
 {
+    typedef std::function<void (const api::Exception&)> send_handler_fn;
+
     virtual void send(const IMessage& msg) =0;
+
+    // returns false instead of blocking if the message cannot be handed over
+    // to the transport immediately; throws YOGI_ERR_MESSAGE_TOO_LARGE if the
+    // message can never be handed over at once
+    virtual bool try_send(const IMessage& msg)
+    {
+        send(msg);
+        return true;
+    }
+
+    // never blocks; the handler gets called from a scheduler thread once the
+    // message has been handed over to the transport
+    virtual void async_send(const IMessage& msg, send_handler_fn handlerFn) =0;
+
+    // sends the messages in order; connections may coalesce them into a
+    // single write
+    virtual void send_batch(const std::vector<const IMessage*>& msgs)
+    {
+        for (auto msg : msgs) {
+            send(*msg);
+        }
+    }
+
     virtual bool remote_is_node() const =0;
 };
 
@@ -0,0 +1,59 @@
+#ifndef YOGI_INTERFACES_IMESSAGERECEIVER_HPP
+#define YOGI_INTERFACES_IMESSAGERECEIVER_HPP
+
+#include "../config.h"
+#include "../api/ExceptionT.hpp"
+#include "../base/Buffer.hpp"
+
+#include <boost/asio/buffer.hpp>
+
+#include <functional>
+#include <cstddef>
+
+
+namespace yogi {
+namespace interfaces {
+
+/***************************************************************************//**
+ * Interface for terminals that receive published messages
+ *
+ * Messages that arrive without a receive operation being active can be
+ * buffered in a bounded receive queue. The batch receive operation fills as
+ * many queued messages as possible into a single buffer. The loan receive
+ * operation hands over the received buffer itself instead of copying it.
+ ******************************************************************************/
+struct IMessageReceiver
+{
+    enum overflow_policy {
+        DROP_OLDEST = YOGI_RQ_DROPOLDEST,
+        DROP_NEWEST = YOGI_RQ_DROPNEWEST
+    };
+
+    // parameters are the number of messages and the number of bytes written
+    typedef std::function<void (const api::Exception&, std::size_t,
+        std::size_t)> batch_handler_fn;
+
+    // parameters are the received data and the cached flag
+    typedef std::function<void (const api::Exception&, base::Buffer&&,
+        bool)> loan_handler_fn;
+
+    virtual ~IMessageReceiver() = default;
+
+    // a depth of zero disables the queue
+    virtual void set_receive_queue(std::size_t depth,
+        overflow_policy policy) =0;
+    virtual unsigned long long dropped_messages() const =0;
+
+    virtual void async_receive_published_messages(
+        boost::asio::mutable_buffers_1 buffer, batch_handler_fn handlerFn) =0;
+    virtual void cancel_receive_published_messages() =0;
+
+    virtual void async_receive_published_message_loan(
+        loan_handler_fn handlerFn) =0;
+    virtual void cancel_receive_published_message_loan() =0;
+};
+
+} // namespace interfaces
+} // namespace yogi
+
+#endif // YOGI_INTERFACES_IMESSAGERECEIVER_HPP
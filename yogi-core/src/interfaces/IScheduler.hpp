@@ -3,6 +3,9 @@
 
 #include "../config.h"
 #include "IPublicObject.hpp"
+#include "../scheduling/SchedulerStatistics.hpp"
+#include "../scheduling/CallbackExecutor.hpp"
+#include "../scheduling/IdleThreadCounter.hpp"
 
 #include <boost/asio/io_service.hpp>
 
@@ -20,6 +23,18 @@ struct IScheduler : virtual public IPublicObject
 {
     virtual boost::asio::io_service& io_service() =0;
 
+    // statistics recorded by the scheduler or nullptr if not supported
+    virtual scheduling::SchedulerStatistics* statistics()
+    {
+        return nullptr;
+    }
+
+    // executor for user callbacks or nullptr if not supported
+    virtual scheduling::CallbackExecutor* callback_executor()
+    {
+        return nullptr;
+    }
+
     template <typename TFn>
     void dispatch(TFn fn)
     {
@@ -29,7 +44,31 @@ struct IScheduler : virtual public IPublicObject
     template <typename TFn>
     void post(TFn fn)
     {
-        io_service().post(fn);
+        post(scheduling::SchedulerStatistics::OTHER, std::move(fn));
+    }
+
+    template <typename TFn>
+    void post(scheduling::SchedulerStatistics::handler_category category,
+        TFn fn)
+    {
+        auto stats = statistics();
+        if (stats && stats->enabled()) {
+            auto posted = scheduling::SchedulerStatistics::clock::now();
+            io_service().post([=]() mutable {
+                scheduling::IdleThreadCounter::mark_thread_busy();
+                auto start = scheduling::SchedulerStatistics::clock::now();
+                stats->record_queue_delay(category, start - posted);
+                fn();
+                stats->record_runtime(category,
+                    scheduling::SchedulerStatistics::clock::now() - start);
+            });
+        }
+        else {
+            io_service().post([fn]() mutable {
+                scheduling::IdleThreadCounter::mark_thread_busy();
+                fn();
+            });
+        }
     }
 };
 
@@ -0,0 +1,34 @@
+#ifndef YOGI_INTERFACES_ITHREADPOOLSCHEDULER_HPP
+#define YOGI_INTERFACES_ITHREADPOOLSCHEDULER_HPP
+
+#include "../config.h"
+#include "IScheduler.hpp"
+
+#include <vector>
+#include <cstddef>
+
+
+namespace yogi {
+namespace interfaces {
+
+/***************************************************************************//**
+ * Interface for schedulers that execute operations on a thread pool which can
+ * be configured at runtime
+ ******************************************************************************/
+struct IThreadPoolScheduler : public IScheduler
+{
+    virtual void resize_thread_pool(std::size_t numThreads) =0;
+
+    // the i-th thread gets pinned to cpus[i % cpus.size()]; an empty vector
+    // removes the pinning
+    virtual void set_cpu_affinity(const std::vector<int>& cpus) =0;
+
+    // priorities greater than zero make the threads run under a real-time
+    // scheduling policy; zero reverts them to the default policy
+    virtual void set_realtime_priority(int priority) =0;
+};
+
+} // namespace interfaces
+} // namespace yogi
+
+#endif // YOGI_INTERFACES_ITHREADPOOLSCHEDULER_HPP
@@ -238,7 +238,35 @@ class MessageRegister
 		messages::ServiceClient::Subscribe,
 		messages::ServiceClient::Unsubscribe,
 		messages::ServiceClient::Scatter,
-		messages::ServiceClient::Gather
+		messages::ServiceClient::Gather,
+
+        // the type IDs are the indices in this list, so messages added since
+        // version 0.0.2 go to the end where they do not shift the IDs of the
+        // existing ones (the version has been bumped nonetheless)
+        messages::ProducerConsumer::Credit,
+
+        messages::PublishSubscribe::FlowCredit,
+        messages::ProducerConsumer::FlowCredit,
+        messages::MasterSlave::FlowCredit,
+
+        messages::PublishSubscribe::Decimation,
+        messages::ProducerConsumer::Decimation,
+        messages::MasterSlave::Decimation,
+
+        messages::PublishSubscribe::Filter,
+        messages::ProducerConsumer::Filter,
+        messages::MasterSlave::Filter,
+
+        messages::CachedPublishSubscribe::ReplayRequest,
+        messages::CachedProducerConsumer::ReplayRequest,
+        messages::CachedMasterSlave::ReplayRequest,
+
+        messages::ScatterGather::GatherBatch,
+        messages::ServiceClient::GatherBatch,
+
+        messages::CachedPublishSubscribe::ReplayedData,
+        messages::CachedProducerConsumer::ReplayedData,
+        messages::CachedMasterSlave::ReplayedData
 	>
 {
 };
@@ -6,6 +6,7 @@
 #include "../../base/Identifier.hpp"
 #include "../../base/Buffer.hpp"
 #include "../../core/scatter_gather/gather_flags.hpp"
+#include "../../core/scatter_gather/gathered_response.hpp"
 
 
 namespace yogi {
@@ -57,6 +58,81 @@ static struct GatherFlags {
 	static inline const char* name() { return "gatherFlags"; };
 } gatherFlags;
 
+static struct Timeout {
+	typedef std::size_t type; // milliseconds; 0 for infinity
+	static inline const char* name() { return "timeout"; };
+} timeout;
+
+static struct Quorum {
+	typedef std::size_t type; // 0 for all responses
+	static inline const char* name() { return "quorum"; };
+} quorum;
+
+static struct Anycast {
+	typedef std::size_t type; // core::scatter_gather::anycast_policy
+	static inline const char* name() { return "anycast"; };
+} anycast;
+
+static struct Aggregate {
+	typedef bool type; // true to let nodes batch the responses
+	static inline const char* name() { return "aggregate"; };
+} aggregate;
+
+static struct AggregationWindow {
+	typedef std::size_t type; // milliseconds; 0 for until finished
+	static inline const char* name() { return "aggregationWindow"; };
+} aggregationWindow;
+
+static struct Responses {
+	typedef core::scatter_gather::gathered_responses type;
+	static inline const char* name() { return "responses"; };
+} responses;
+
+static struct Capacity {
+	typedef std::size_t type; // 0 for receiving every message
+	static inline const char* name() { return "capacity"; };
+} capacity;
+
+static struct Acknowledged {
+	typedef std::size_t type; // number of messages
+	static inline const char* name() { return "acknowledged"; };
+} acknowledged;
+
+static struct Credit {
+	typedef std::size_t type; // number of messages
+	static inline const char* name() { return "credit"; };
+} credit;
+
+static struct Unlimited {
+	typedef bool type; // true to lift a previously granted credit limit
+	static inline const char* name() { return "unlimited"; };
+} unlimited;
+
+static struct MinInterval {
+	typedef std::size_t type; // milliseconds; 0 for no conflation
+	static inline const char* name() { return "minInterval"; };
+} minInterval;
+
+static struct EveryNth {
+	typedef std::size_t type; // 0 for no decimation
+	static inline const char* name() { return "everyNth"; };
+} everyNth;
+
+static struct Filter {
+	typedef base::Buffer type; // core::publish_subscribe::ContentFilter
+	static inline const char* name() { return "filter"; };
+} filter;
+
+static struct MaxMessages {
+	typedef std::size_t type; // 0 for no limit
+	static inline const char* name() { return "maxMessages"; };
+} maxMessages;
+
+static struct MaxAge {
+	typedef std::size_t type; // milliseconds; 0 for no limit
+	static inline const char* name() { return "maxAge"; };
+} maxAge;
+
 } // namespace fields
 } // namespace messaging
 } // namespace yogi
@@ -73,6 +73,14 @@ struct CachedMasterSlave {
     struct CachedData : public InheritedMessage<CachedData,
         CachedPublishSubscribe::CachedData
     > { YOGI_MESSAGE_NAME("CachedMasterSlave::CachedData"); };
+
+    struct ReplayRequest : public InheritedMessage<ReplayRequest,
+        CachedPublishSubscribe::ReplayRequest
+    > { YOGI_MESSAGE_NAME("CachedMasterSlave::ReplayRequest"); };
+
+    struct ReplayedData : public InheritedMessage<ReplayedData,
+        CachedPublishSubscribe::ReplayedData
+    > { YOGI_MESSAGE_NAME("CachedMasterSlave::ReplayedData"); };
 }; // struct CachedMasterSlave
 
 } // namespace messages
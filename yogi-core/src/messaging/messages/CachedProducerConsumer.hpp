@@ -73,6 +73,14 @@ struct CachedProducerConsumer {
     struct CachedData : public InheritedMessage<CachedData,
         CachedPublishSubscribe::CachedData
     > { YOGI_MESSAGE_NAME("CachedProducerConsumer::CachedData"); };
+
+    struct ReplayRequest : public InheritedMessage<ReplayRequest,
+        CachedPublishSubscribe::ReplayRequest
+    > { YOGI_MESSAGE_NAME("CachedProducerConsumer::ReplayRequest"); };
+
+    struct ReplayedData : public InheritedMessage<ReplayedData,
+        CachedPublishSubscribe::ReplayedData
+    > { YOGI_MESSAGE_NAME("CachedProducerConsumer::ReplayedData"); };
 }; // struct CachedProducerConsumer
 
 } // namespace messages
@@ -74,6 +74,18 @@ struct CachedPublishSubscribe {
         fields::SubscriptionId,
         fields::Data
     > { YOGI_MESSAGE_NAME("CachedPublishSubscribe::CachedData"); };
+
+    struct ReplayRequest : public Message<ReplayRequest,
+        fields::MappedId,
+        fields::MaxMessages,
+        fields::MaxAge
+    > { YOGI_MESSAGE_NAME("CachedPublishSubscribe::ReplayRequest"); };
+
+    // replayed history; unlike cached data it does not update the cache
+    struct ReplayedData : public Message<ReplayedData,
+        fields::SubscriptionId,
+        fields::Data
+    > { YOGI_MESSAGE_NAME("CachedPublishSubscribe::ReplayedData"); };
 }; // struct CachedPublishSubscribe
 
 } // namespace messages
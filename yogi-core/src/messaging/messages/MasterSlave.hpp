@@ -69,6 +69,18 @@ struct MasterSlave {
     struct Data : public InheritedMessage<Data,
         PublishSubscribe::Data
     > { YOGI_MESSAGE_NAME("MasterSlave::Data"); };
+
+    struct FlowCredit : public InheritedMessage<FlowCredit,
+        PublishSubscribe::FlowCredit
+    > { YOGI_MESSAGE_NAME("MasterSlave::FlowCredit"); };
+
+    struct Decimation : public InheritedMessage<Decimation,
+        PublishSubscribe::Decimation
+    > { YOGI_MESSAGE_NAME("MasterSlave::Decimation"); };
+
+    struct Filter : public InheritedMessage<Filter,
+        PublishSubscribe::Filter
+    > { YOGI_MESSAGE_NAME("MasterSlave::Filter"); };
 }; // struct MasterSlave
 
 } // namespace messages
@@ -69,6 +69,24 @@ struct ProducerConsumer {
     struct Data : public InheritedMessage<Data,
         PublishSubscribe::Data
     > { YOGI_MESSAGE_NAME("ProducerConsumer::Data"); };
+
+    struct Credit : public Message<Credit,
+        fields::MappedId,
+        fields::Capacity,
+        fields::Acknowledged
+    > { YOGI_MESSAGE_NAME("ProducerConsumer::Credit"); };
+
+    struct FlowCredit : public InheritedMessage<FlowCredit,
+        PublishSubscribe::FlowCredit
+    > { YOGI_MESSAGE_NAME("ProducerConsumer::FlowCredit"); };
+
+    struct Decimation : public InheritedMessage<Decimation,
+        PublishSubscribe::Decimation
+    > { YOGI_MESSAGE_NAME("ProducerConsumer::Decimation"); };
+
+    struct Filter : public InheritedMessage<Filter,
+        PublishSubscribe::Filter
+    > { YOGI_MESSAGE_NAME("ProducerConsumer::Filter"); };
 }; // struct ProducerConsumer
 
 } // namespace messages
@@ -71,6 +71,23 @@ struct PublishSubscribe {
 		fields::SubscriptionId,
 		fields::Data
     > { YOGI_MESSAGE_NAME("PublishSubscribe::Data"); };
+
+	struct FlowCredit : public Message<FlowCredit,
+		fields::MappedId,
+		fields::Credit,
+		fields::Unlimited
+    > { YOGI_MESSAGE_NAME("PublishSubscribe::FlowCredit"); };
+
+	struct Decimation : public Message<Decimation,
+		fields::MappedId,
+		fields::MinInterval,
+		fields::EveryNth
+    > { YOGI_MESSAGE_NAME("PublishSubscribe::Decimation"); };
+
+	struct Filter : public Message<Filter,
+		fields::MappedId,
+		fields::Filter
+    > { YOGI_MESSAGE_NAME("PublishSubscribe::Filter"); };
 }; // struct PublishSubscribe
 
 } // namespace messages
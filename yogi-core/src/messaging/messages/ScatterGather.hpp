@@ -69,6 +69,11 @@ struct ScatterGather {
 	struct Scatter : public Message<Scatter,
 		fields::SubscriptionId,
 		fields::OperationId,
+		fields::Timeout,
+		fields::Quorum,
+		fields::Anycast,
+		fields::Aggregate,
+		fields::AggregationWindow,
 		fields::Data
     > { YOGI_MESSAGE_NAME("ScatterGather::Scatter"); };
 
@@ -77,6 +82,12 @@ struct ScatterGather {
 		fields::GatherFlags,
 		fields::Data
     > { YOGI_MESSAGE_NAME("ScatterGather::Gather"); };
+
+	// several responses to one operation, aggregated by a node
+	struct GatherBatch : public Message<GatherBatch,
+		fields::OperationId,
+		fields::Responses
+    > { YOGI_MESSAGE_NAME("ScatterGather::GatherBatch"); };
 }; // struct ScatterGather
 
 } // namespace messages
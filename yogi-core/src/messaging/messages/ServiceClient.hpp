@@ -73,6 +73,10 @@ struct ServiceClient {
     struct Gather : public InheritedMessage<Gather,
         ScatterGather::Gather
     > { YOGI_MESSAGE_NAME("ServiceClient::Gather"); };
+
+    struct GatherBatch : public InheritedMessage<GatherBatch,
+        ScatterGather::GatherBatch
+    > { YOGI_MESSAGE_NAME("ServiceClient::GatherBatch"); };
 }; // struct ServiceClient
 
 } // namespace messages
@@ -0,0 +1,156 @@
+#include "BusyPollScheduler.hpp"
+#include "set_thread_affinity.hpp"
+#include "set_thread_priority.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <chrono>
+
+
+namespace yogi {
+namespace scheduling {
+
+void BusyPollScheduler::thread_fn(poll_thread& th)
+{
+    SchedulerStatistics::set_thread_statistics(&m_statistics);
+    CallbackExecutor::set_thread_executor(&m_callbackExecutor);
+
+    while (!th.exitRequested.load(std::memory_order_relaxed)) {
+        if (m_ioService.poll() || spin(th)) {
+            continue;
+        }
+
+        // park until the next handler becomes ready
+        m_ioService.run_one();
+    }
+
+    th.finished = true;
+}
+
+bool BusyPollScheduler::spin(poll_thread& th)
+{
+    auto spinUs   = m_spinUs.load(std::memory_order_relaxed);
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::microseconds(spinUs);
+
+    while (!th.exitRequested.load(std::memory_order_relaxed)) {
+        if (m_ioService.poll_one()) {
+            return true;
+        }
+
+        if (spinUs >= 0 && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    return false;
+}
+
+void BusyPollScheduler::stop_thread(poll_thread& th)
+{
+    th.exitRequested = true;
+
+    // the no-op handlers may be picked up by other threads, so we keep posting
+    // them until the thread has woken up
+    while (!th.finished) {
+        m_ioService.post([] {});
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
+    th.thread.join();
+}
+
+BusyPollScheduler::BusyPollScheduler()
+    : m_work            {m_ioService}
+    , m_spinUs          {YOGI_DEFAULT_BUSY_POLL_SPIN_US}
+    , m_priority        {0}
+    , m_callbackExecutor{&m_statistics}
+{
+    resize_thread_pool(YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE);
+}
+
+BusyPollScheduler::~BusyPollScheduler()
+{
+    for (auto& th : m_threads) {
+        th->exitRequested = true;
+    }
+
+    m_ioService.stop();
+    for (auto& th : m_threads) {
+        th->thread.join();
+    }
+}
+
+void BusyPollScheduler::resize_thread_pool(std::size_t numThreads)
+{
+    if (numThreads < 1 || numThreads > YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    // remove threads
+    while (m_threads.size() > numThreads) {
+        stop_thread(*m_threads.back());
+        m_threads.pop_back();
+    }
+
+    // create new threads
+    while (m_threads.size() < numThreads) {
+        auto th = std::make_unique<poll_thread>();
+        th->thread = std::thread(&BusyPollScheduler::thread_fn, this,
+            std::ref(*th));
+
+        if (!m_cpus.empty()) {
+            set_thread_affinity(th->thread, m_threads.size(), m_cpus);
+        }
+
+        if (m_priority) {
+            set_thread_priority(th->thread, m_priority);
+        }
+
+        m_threads.push_back(std::move(th));
+    }
+}
+
+void BusyPollScheduler::set_cpu_affinity(const std::vector<int>& cpus)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_cpus = cpus;
+
+    for (std::size_t i = 0; i < m_threads.size(); ++i) {
+        set_thread_affinity(m_threads[i]->thread, i, m_cpus);
+    }
+}
+
+void BusyPollScheduler::set_realtime_priority(int priority)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto& th : m_threads) {
+        set_thread_priority(th->thread, priority);
+    }
+
+    m_priority = priority;
+}
+
+void BusyPollScheduler::set_spin_duration(long long spinUs)
+{
+    m_spinUs = spinUs;
+}
+
+boost::asio::io_service& BusyPollScheduler::io_service()
+{
+    return m_ioService;
+}
+
+SchedulerStatistics* BusyPollScheduler::statistics()
+{
+    return &m_statistics;
+}
+
+CallbackExecutor* BusyPollScheduler::callback_executor()
+{
+    return &m_callbackExecutor;
+}
+
+} // namespace scheduling
+} // namespace yogi
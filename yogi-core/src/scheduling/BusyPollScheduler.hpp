@@ -0,0 +1,80 @@
+#ifndef YOGI_SCHEDULING_BUSYPOLLSCHEDULER_HPP
+#define YOGI_SCHEDULING_BUSYPOLLSCHEDULER_HPP
+
+#include "../config.h"
+#include "../interfaces/IThreadPoolScheduler.hpp"
+#include "SchedulerStatistics.hpp"
+#include "CallbackExecutor.hpp"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Scheduler for low latencies whose threads poll for work instead of blocking
+ *
+ * Threads that run out of work keep polling the completion queue for a
+ * configurable spin duration before they park, i.e. block until the next
+ * handler becomes ready. A handler that becomes ready while a thread is
+ * spinning gets executed without the delay of waking up a blocked thread.
+ * With a negative spin duration, threads never park and keep their CPUs
+ * busy all the time.
+ ******************************************************************************/
+class BusyPollScheduler : public interfaces::IThreadPoolScheduler
+{
+    struct poll_thread {
+        std::thread       thread;
+        std::atomic<bool> exitRequested;
+        std::atomic<bool> finished;
+
+        poll_thread()
+            : exitRequested{false}
+            , finished     {false}
+        {
+        }
+    };
+
+    typedef std::unique_ptr<poll_thread> poll_thread_ptr;
+
+private:
+    boost::asio::io_service       m_ioService;
+    boost::asio::io_service::work m_work;
+    std::vector<poll_thread_ptr>  m_threads;
+    std::atomic<long long>        m_spinUs;
+    std::vector<int>              m_cpus;
+    int                           m_priority;
+    SchedulerStatistics           m_statistics;
+    CallbackExecutor              m_callbackExecutor;
+    std::mutex                    m_mutex;
+
+private:
+    void thread_fn(poll_thread& th);
+    bool spin(poll_thread& th);
+    void stop_thread(poll_thread& th);
+
+public:
+    BusyPollScheduler();
+    virtual ~BusyPollScheduler();
+
+    virtual void resize_thread_pool(std::size_t numThreads) override;
+    virtual void set_cpu_affinity(const std::vector<int>& cpus) override;
+    virtual void set_realtime_priority(int priority) override;
+
+    // negative values make idle threads spin forever
+    void set_spin_duration(long long spinUs);
+
+    virtual boost::asio::io_service& io_service() override;
+    virtual SchedulerStatistics* statistics() override;
+    virtual CallbackExecutor* callback_executor() override;
+};
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_BUSYPOLLSCHEDULER_HPP
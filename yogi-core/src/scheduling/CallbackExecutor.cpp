@@ -0,0 +1,186 @@
+#include "CallbackExecutor.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <algorithm>
+
+
+namespace yogi {
+namespace scheduling {
+
+thread_local CallbackExecutor* CallbackExecutor::ms_threadExecutor = nullptr;
+thread_local CallbackExecutor* CallbackExecutor::ms_executingExecutor
+    = nullptr;
+
+void CallbackExecutor::thread_fn()
+{
+    SchedulerStatistics::set_thread_statistics(m_statistics);
+    ms_executingExecutor = this;
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true) {
+        auto it = m_queue.end();
+        m_callbackQueuedCv.wait(lock, [&] {
+            it = find_ready_callback();
+            return it != m_queue.end() || (m_stopRequested && m_queue.empty());
+        });
+
+        // queued callbacks get executed even if the thread has to stop
+        if (it == m_queue.end()) {
+            break;
+        }
+
+        auto callback = std::move(*it);
+        m_queue.erase(it);
+        if (callback.sequence) {
+            m_sequences[callback.sequence].running = true;
+        }
+
+        m_callbackTakenCv.notify_all();
+        lock.unlock();
+
+        if (m_statistics && m_statistics->enabled()
+            && callback.queued != SchedulerStatistics::clock::time_point{}) {
+            m_statistics->record_queue_delay(
+                SchedulerStatistics::USER_CALLBACK,
+                SchedulerStatistics::clock::now() - callback.queued);
+        }
+
+        callback.fn();
+        callback.fn = callback_fn{};
+
+        lock.lock();
+        finish_callback(callback.sequence);
+    }
+}
+
+CallbackExecutor::queue_type::iterator CallbackExecutor::find_ready_callback()
+{
+    // the first queued callback of a sequence is the next one to execute
+    // unless another callback of the same sequence is still running
+    return std::find_if(m_queue.begin(), m_queue.end(),
+        [&](const queued_callback& callback) {
+            return !callback.sequence
+                || !m_sequences[callback.sequence].running;
+        });
+}
+
+void CallbackExecutor::finish_callback(const void* sequence)
+{
+    if (!sequence) {
+        return;
+    }
+
+    auto it = m_sequences.find(sequence);
+    YOGI_ASSERT(it != m_sequences.end());
+    if (--it->second.pending == 0) {
+        m_sequences.erase(it);
+    }
+    else {
+        it->second.running = false;
+        m_callbackQueuedCv.notify_all();
+    }
+
+    m_callbackTakenCv.notify_all();
+}
+
+void CallbackExecutor::stop_threads()
+{
+    {{
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_enabled = false;
+        m_stopRequested = true;
+        m_callbackQueuedCv.notify_all();
+        m_callbackTakenCv.notify_all();
+    }}
+
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+
+    m_threads.clear();
+    m_stopRequested = false;
+}
+
+CallbackExecutor::CallbackExecutor(SchedulerStatistics* statistics)
+    : m_statistics    {statistics}
+    , m_enabled       {false}
+    , m_maxQueueSize  {0}
+    , m_overflowPolicy{BLOCK}
+    , m_stopRequested {false}
+{
+}
+
+CallbackExecutor::~CallbackExecutor()
+{
+    stop_threads();
+}
+
+void CallbackExecutor::configure(std::size_t numThreads,
+    std::size_t maxQueueSize, overflow_policy overflowPolicy)
+{
+    if (numThreads > YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE
+        || (numThreads > 0 && maxQueueSize == 0)) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    // a thread cannot wait for itself to terminate
+    if (ms_executingExecutor == this) {
+        throw api::ExceptionT<YOGI_ERR_WRONG_THREAD>{};
+    }
+
+    std::lock_guard<std::mutex> configLock{m_configMutex};
+    stop_threads();
+
+    {{
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_maxQueueSize   = maxQueueSize;
+        m_overflowPolicy = overflowPolicy;
+        m_enabled        = numThreads > 0;
+    }}
+
+    for (std::size_t i = 0; i < numThreads; ++i) {
+        m_threads.push_back(std::thread(&CallbackExecutor::thread_fn, this));
+    }
+}
+
+void CallbackExecutor::execute(callback_fn fn, const void* sequence)
+{
+    {{
+        std::unique_lock<std::mutex> lock{m_mutex};
+        if (m_enabled && ms_executingExecutor != this) {
+            // running the callback inline would overtake pending callbacks of
+            // the same sequence
+            auto mustQueue = [&] {
+                return sequence && m_sequences.count(sequence);
+            };
+
+            if (m_queue.size() >= m_maxQueueSize
+                && (m_overflowPolicy == BLOCK || mustQueue())) {
+                m_callbackTakenCv.wait(lock, [&] {
+                    return m_queue.size() < m_maxQueueSize || !m_enabled;
+                });
+            }
+
+            if (m_enabled && m_queue.size() < m_maxQueueSize) {
+                auto queued = m_statistics && m_statistics->enabled()
+                    ? SchedulerStatistics::clock::now()
+                    : SchedulerStatistics::clock::time_point{};
+
+                if (sequence) {
+                    auto& state = m_sequences[sequence];
+                    ++state.pending;
+                }
+
+                m_queue.push_back(queued_callback{std::move(fn), sequence,
+                    queued});
+                m_callbackQueuedCv.notify_one();
+                return;
+            }
+        }
+    }}
+
+    fn();
+}
+
+} // namespace scheduling
+} // namespace yogi
@@ -0,0 +1,141 @@
+#ifndef YOGI_SCHEDULING_CALLBACKEXECUTOR_HPP
+#define YOGI_SCHEDULING_CALLBACKEXECUTOR_HPP
+
+#include "../config.h"
+#include "SchedulerStatistics.hpp"
+
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Executes user callbacks on a separate thread pool with a bounded queue
+ *
+ * Each scheduler owns a callback executor which is disabled by default. When
+ * enabled, completion handlers passed in by the user get queued instead of
+ * being executed on the scheduler's threads, so slow handlers cannot delay
+ * I/O and message routing. If the queue is full, the overflow policy decides
+ * whether the scheduler thread waits for space in the queue or executes the
+ * handler itself.
+ *
+ * Callbacks can belong to a sequence, e.g. all handlers of an asynchronous
+ * operation that gets reloaded after every call. Callbacks of the same
+ * sequence never run concurrently and get executed in the order in which they
+ * have been queued, even with multiple threads. They are never executed
+ * inline while other callbacks of their sequence are pending.
+ ******************************************************************************/
+class CallbackExecutor final
+{
+public:
+    typedef std::function<void ()> callback_fn;
+
+    enum overflow_policy {
+        BLOCK      = YOGI_OP_BLOCK,
+        RUN_INLINE = YOGI_OP_RUNINLINE
+    };
+
+private:
+    struct queued_callback {
+        callback_fn                            fn;
+        const void*                            sequence;
+        SchedulerStatistics::clock::time_point queued;
+    };
+
+    struct sequence_state {
+        std::size_t pending; // queued or running callbacks
+        bool        running;
+    };
+
+    typedef std::deque<queued_callback> queue_type;
+
+    static thread_local CallbackExecutor* ms_threadExecutor;
+    static thread_local CallbackExecutor* ms_executingExecutor;
+
+    SchedulerStatistics* const  m_statistics;
+    std::atomic<bool>           m_enabled;
+    std::mutex                  m_configMutex;
+    std::mutex                  m_mutex;
+    std::condition_variable     m_callbackQueuedCv;
+    std::condition_variable     m_callbackTakenCv;
+    queue_type                  m_queue;
+    std::unordered_map<const void*, sequence_state> m_sequences;
+    std::size_t                 m_maxQueueSize;
+    overflow_policy             m_overflowPolicy;
+    bool                        m_stopRequested;
+    std::vector<std::thread>    m_threads;
+
+private:
+    void thread_fn();
+    queue_type::iterator find_ready_callback();
+    void finish_callback(const void* sequence);
+    void stop_threads();
+
+public:
+    explicit CallbackExecutor(SchedulerStatistics* statistics = nullptr);
+    ~CallbackExecutor();
+
+    /**
+     * Makes the executor the destination for user callbacks fired on the
+     * calling thread
+     *
+     * Schedulers call this function at the start of each of their threads.
+     *
+     * @param executor Executor to use or nullptr
+     */
+    static void set_thread_executor(CallbackExecutor* executor)
+    {
+        ms_threadExecutor = executor;
+    }
+
+    // returns the executor for user callbacks fired on the calling thread
+    // or nullptr if callbacks should be executed directly
+    static CallbackExecutor* thread_executor()
+    {
+        auto executor = ms_threadExecutor;
+        return executor && executor->enabled() ? executor : nullptr;
+    }
+
+    bool enabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Configures the executor
+     *
+     * Queued callbacks get executed before the old threads terminate. Setting
+     * the number of threads to zero disables the executor.
+     *
+     * @param numThreads     Number of threads executing callbacks
+     * @param maxQueueSize   Maximum number of queued callbacks
+     * @param overflowPolicy What to do if the queue is full
+     */
+    void configure(std::size_t numThreads, std::size_t maxQueueSize,
+        overflow_policy overflowPolicy);
+
+    /**
+     * Queues a callback or executes it directly if the executor is disabled
+     * or if the queue is full and the overflow policy is RUN_INLINE
+     *
+     * If other callbacks of the same sequence are pending, a full queue always
+     * blocks the caller.
+     *
+     * @param fn       Callback to execute
+     * @param sequence Sequence the callback belongs to or nullptr
+     */
+    void execute(callback_fn fn, const void* sequence = nullptr);
+};
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_CALLBACKEXECUTOR_HPP
@@ -0,0 +1,10 @@
+#include "IdleThreadCounter.hpp"
+
+
+namespace yogi {
+namespace scheduling {
+
+thread_local IdleThreadCounter* IdleThreadCounter::ms_waitingOn = nullptr;
+
+} // namespace scheduling
+} // namespace yogi
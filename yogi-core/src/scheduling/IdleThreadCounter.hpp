@@ -0,0 +1,66 @@
+#ifndef YOGI_SCHEDULING_IDLETHREADCOUNTER_HPP
+#define YOGI_SCHEDULING_IDLETHREADCOUNTER_HPP
+
+#include "../config.h"
+
+#include <atomic>
+#include <cstddef>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Counts the threads of a scheduler that are waiting for a handler
+ *
+ * The io_service executes the next handler on the same call that waits for it,
+ * so a thread marks itself as waiting before that call and handlers posted via
+ * IScheduler::post() mark the thread running them as busy as soon as they
+ * start. This way, threads executing long-running handlers do not count as
+ * waiting.
+ ******************************************************************************/
+class IdleThreadCounter final
+{
+    static thread_local IdleThreadCounter* ms_waitingOn;
+
+    std::atomic<std::size_t> m_count;
+
+public:
+    IdleThreadCounter()
+        : m_count{0}
+    {
+    }
+
+    IdleThreadCounter(const IdleThreadCounter&) = delete;
+    void operator= (const IdleThreadCounter&) = delete;
+
+    // marks the calling thread as busy if it has been waiting
+    static void mark_thread_busy()
+    {
+        if (ms_waitingOn) {
+            --ms_waitingOn->m_count;
+            ms_waitingOn = nullptr;
+        }
+    }
+
+    void begin_wait()
+    {
+        ++m_count;
+        ms_waitingOn = this;
+    }
+
+    void end_wait()
+    {
+        mark_thread_busy();
+    }
+
+    std::size_t count() const
+    {
+        return m_count;
+    }
+};
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_IDLETHREADCOUNTER_HPP
@@ -1,32 +1,209 @@
 #include "MultiThreadedScheduler.hpp"
+#include "set_thread_affinity.hpp"
+#include "set_thread_priority.hpp"
 #include "../api/ExceptionT.hpp"
 
 #include <algorithm>
+#include <memory>
 
 
 namespace yogi {
 namespace scheduling {
 
+thread_local bool MultiThreadedScheduler::mst_exitRequested = false;
+
 void MultiThreadedScheduler::thread_fn()
 {
-    try {
-        m_ioService.run();
+    SchedulerStatistics::set_thread_statistics(&m_statistics);
+    CallbackExecutor::set_thread_executor(&m_callbackExecutor);
+
+    while (!mst_exitRequested) {
+        if (m_ioService.poll_one()) {
+            continue;
+        }
+
+        // the thread counts as idle while it waits for the next handler; the
+        // handler marks it as busy once it starts
+        m_idleThreads.begin_wait();
+        auto n = m_ioService.run_one();
+        m_idleThreads.end_wait();
+
+        if (!n) {
+            return; // scheduler is being destroyed
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_terminatedThreads.push_back(std::this_thread::get_id());
+    m_cv.notify_all();
+}
+
+void MultiThreadedScheduler::supervisor_fn()
+{
+    struct probe {
+        clock::time_point            posted;
+        std::atomic<clock::duration> delay;
+        std::atomic<bool>            done;
+
+        probe()
+            : posted{clock::now()}
+            , delay {clock::duration::zero()}
+            , done  {false}
+        {
+        }
+    };
+
+    std::shared_ptr<probe> lastProbe;
+    int  numHighDelays = 0;
+    auto idleSince     = clock::now();
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (m_autoScaling.enabled) {
+        auto interval = std::max<clock::duration>(
+            m_autoScaling.queueDelayThreshold,
+            std::chrono::microseconds(YOGI_MIN_AUTO_SCALING_PROBE_INTERVAL_US));
+        m_supervisorCv.wait_for(lock, interval);
+        if (!m_autoScaling.enabled) {
+            break;
+        }
+
+        auto now = clock::now();
+
+        // measure the queue delay; a probe that has not been executed yet
+        // counts with the time it has been waiting so far
+        bool delayHigh;
+        if (lastProbe && !lastProbe->done) {
+            delayHigh = now - lastProbe->posted
+                >= m_autoScaling.queueDelayThreshold;
+        }
+        else {
+            delayHigh = lastProbe && lastProbe->delay.load()
+                >= m_autoScaling.queueDelayThreshold;
+
+            auto p = std::make_shared<probe>();
+            m_ioService.post([p] {
+                p->delay = clock::now() - p->posted;
+                p->done  = true;
+            });
+
+            lastProbe = p;
+        }
+
+        // grow if the queue delay stays above the threshold
+        if (delayHigh) {
+            idleSince = now;
+
+            if (++numHighDelays >= YOGI_AUTO_SCALING_GROW_PROBES
+                && m_threads.size() < m_autoScaling.maxThreads) {
+                add_threads(1);
+                numHighDelays = 0;
+            }
+        }
+        // shrink if some thread has been waiting during a whole idle period
+        else {
+            numHighDelays = 0;
+
+            if (m_idleThreads.count() == 0) {
+                idleSince = now;
+            }
+            else if (now - idleSince >= m_autoScaling.idleTimeout) {
+                if (m_threads.size() > m_autoScaling.minThreads) {
+                    remove_threads(1, lock);
+                }
+
+                idleSince = clock::now();
+            }
+        }
+    }
+}
+
+void MultiThreadedScheduler::add_threads(std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        m_threads.push_back(std::thread(&MultiThreadedScheduler::thread_fn,
+            this));
+
+        if (m_priority) {
+            set_thread_priority(m_threads.back(), m_priority);
+        }
+    }
+
+    if (!m_cpus.empty()) {
+        apply_cpu_affinity();
+    }
+}
+
+void MultiThreadedScheduler::remove_threads(std::size_t n,
+    std::unique_lock<std::mutex>& lock)
+{
+    // whichever threads execute these handlers terminate
+    for (std::size_t i = 0; i < n; ++i) {
+        m_ioService.post([] { mst_exitRequested = true; });
+    }
+
+    m_cv.wait(lock, [&]{ return m_terminatedThreads.size() == n; });
+
+    for (auto& id : m_terminatedThreads) {
+        auto it = std::find_if(m_threads.begin(), m_threads.end(),
+            [&](const std::thread& th){ return th.get_id() == id; });
+        it->join();
+        m_threads.erase(it);
+    }
+
+    m_terminatedThreads.clear();
+
+    if (!m_cpus.empty()) {
+        apply_cpu_affinity();
+    }
+}
+
+void MultiThreadedScheduler::set_thread_pool_size(std::size_t n,
+    std::unique_lock<std::mutex>& lock)
+{
+    if (n < m_threads.size()) {
+        remove_threads(m_threads.size() - n, lock);
+    }
+    else if (n > m_threads.size()) {
+        add_threads(n - m_threads.size());
     }
-    catch (const exit_thread_exception&) {
-        std::lock_guard<std::mutex> lock{m_mutex};
-        m_terminatedThreads.push_back(std::this_thread::get_id());
-        m_cv.notify_one();
+}
+
+void MultiThreadedScheduler::apply_cpu_affinity()
+{
+    for (std::size_t i = 0; i < m_threads.size(); ++i) {
+        set_thread_affinity(m_threads[i], i, m_cpus);
+    }
+}
+
+void MultiThreadedScheduler::stop_supervisor(
+    std::unique_lock<std::mutex>& lock)
+{
+    m_autoScaling.enabled = false;
+    m_supervisorCv.notify_all();
+
+    auto supervisor = std::move(m_supervisor);
+    if (supervisor.joinable()) {
+        lock.unlock();
+        supervisor.join();
+        lock.lock();
     }
 }
 
 MultiThreadedScheduler::MultiThreadedScheduler()
-    : m_work{m_ioService}
+    : m_work            {m_ioService}
+    , m_priority        {0}
+    , m_callbackExecutor{&m_statistics}
 {
     resize_thread_pool(YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE);
 }
 
 MultiThreadedScheduler::~MultiThreadedScheduler()
 {
+    {{
+        std::unique_lock<std::mutex> lock{m_mutex};
+        stop_supervisor(lock);
+    }}
+
     m_ioService.stop();
     for (auto& thread : m_threads) {
         thread.join();
@@ -40,35 +217,63 @@ void MultiThreadedScheduler::resize_thread_pool(std::size_t numThreads)
     }
 
     std::unique_lock<std::mutex> lock{m_mutex};
+    stop_supervisor(lock);
+    set_thread_pool_size(numThreads, lock);
+}
 
-    // remove threads
-    if (numThreads < m_threads.size()) {
-        // terminate some threads
-        for (auto i = m_threads.size(); i > numThreads; --i) {
-            m_ioService.post([]{ throw exit_thread_exception(); });
-        }
+void MultiThreadedScheduler::set_cpu_affinity(const std::vector<int>& cpus)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_cpus = cpus;
+    apply_cpu_affinity();
+}
 
-        // wait for the threads to terminate
-        auto diff = m_threads.size() - numThreads;
-        m_cv.wait(lock, [&]{ return m_terminatedThreads.size() == diff; });
+void MultiThreadedScheduler::set_realtime_priority(int priority)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto& thread : m_threads) {
+        set_thread_priority(thread, priority);
+    }
 
-        // join the terminated threads
-        for (auto& id : m_terminatedThreads) {
-            auto it = std::find_if(m_threads.begin(), m_threads.end(),
-                [&](const std::thread& th){ return th.get_id() == id; });
-            it->join();
-            m_threads.erase(it);
-        }
+    m_priority = priority;
+}
 
-        m_terminatedThreads.clear();
-    }
-    // create new threads
-    else if (numThreads > m_threads.size()) {
-        for (auto i = m_threads.size(); i < numThreads; ++i) {
-            m_threads.push_back(std::thread(&MultiThreadedScheduler::thread_fn,
-                this));
-        }
+std::size_t MultiThreadedScheduler::thread_pool_size()
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_threads.size();
+}
+
+void MultiThreadedScheduler::enable_auto_scaling(std::size_t minThreads,
+    std::size_t maxThreads, clock::duration queueDelayThreshold,
+    clock::duration idleTimeout)
+{
+    if (minThreads < 1 || minThreads > maxThreads
+        || maxThreads > YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE
+        || queueDelayThreshold <= clock::duration::zero()
+        || idleTimeout <= clock::duration::zero()) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
     }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    stop_supervisor(lock);
+
+    auto n = std::min(std::max(m_threads.size(), minThreads), maxThreads);
+    set_thread_pool_size(n, lock);
+
+    m_autoScaling.enabled             = true;
+    m_autoScaling.minThreads          = minThreads;
+    m_autoScaling.maxThreads          = maxThreads;
+    m_autoScaling.queueDelayThreshold = queueDelayThreshold;
+    m_autoScaling.idleTimeout         = idleTimeout;
+
+    m_supervisor = std::thread(&MultiThreadedScheduler::supervisor_fn, this);
+}
+
+void MultiThreadedScheduler::disable_auto_scaling()
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    stop_supervisor(lock);
 }
 
 boost::asio::io_service& MultiThreadedScheduler::io_service()
@@ -76,5 +281,15 @@ boost::asio::io_service& MultiThreadedScheduler::io_service()
     return m_ioService;
 }
 
+SchedulerStatistics* MultiThreadedScheduler::statistics()
+{
+    return &m_statistics;
+}
+
+CallbackExecutor* MultiThreadedScheduler::callback_executor()
+{
+    return &m_callbackExecutor;
+}
+
 } // namespace scheduling
 } // namespace yogi
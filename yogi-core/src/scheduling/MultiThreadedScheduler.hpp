@@ -2,12 +2,17 @@
 #define YOGI_SCHEDULING_MULTITHREADEDSCHEDULER_HPP
 
 #include "../config.h"
-#include "../interfaces/IScheduler.hpp"
+#include "../interfaces/IThreadPoolScheduler.hpp"
+#include "SchedulerStatistics.hpp"
+#include "CallbackExecutor.hpp"
+#include "IdleThreadCounter.hpp"
 
 #include <vector>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 
 namespace yogi {
@@ -15,29 +20,85 @@ namespace scheduling {
 
 /***************************************************************************//**
  * Scheduler built around a runtime-resizable thread pool
+ *
+ * The thread pool can optionally be scaled automatically. In this case, a
+ * supervisor thread periodically posts a probe handler in order to measure
+ * the queue delay. The pool grows by one thread whenever the queue delay
+ * stays above a threshold and shrinks by one thread whenever at least one
+ * thread was waiting for work during a whole idle period. Threads executing
+ * handlers do not count as waiting, even if they block for a long time.
  ******************************************************************************/
-class MultiThreadedScheduler : public interfaces::IScheduler
+class MultiThreadedScheduler : public interfaces::IThreadPoolScheduler
 {
-    struct exit_thread_exception {};
+    typedef std::chrono::steady_clock clock;
+
+    struct auto_scaling_settings {
+        bool            enabled = false;
+        std::size_t     minThreads;
+        std::size_t     maxThreads;
+        clock::duration queueDelayThreshold;
+        clock::duration idleTimeout;
+    };
+
+    static thread_local bool mst_exitRequested;
 
 private:
     boost::asio::io_service       m_ioService;
     boost::asio::io_service::work m_work;
     std::vector<std::thread>      m_threads;
     std::vector<std::thread::id>  m_terminatedThreads;
+    IdleThreadCounter             m_idleThreads;
     std::mutex                    m_mutex;
     std::condition_variable       m_cv;
+    std::vector<int>              m_cpus;
+    int                           m_priority;
+    auto_scaling_settings         m_autoScaling;
+    std::thread                   m_supervisor;
+    std::condition_variable       m_supervisorCv;
+    SchedulerStatistics           m_statistics;
+    CallbackExecutor              m_callbackExecutor;
 
 private:
     void thread_fn();
+    void supervisor_fn();
+    void add_threads(std::size_t n);
+    void remove_threads(std::size_t n, std::unique_lock<std::mutex>& lock);
+    void set_thread_pool_size(std::size_t n,
+        std::unique_lock<std::mutex>& lock);
+    void apply_cpu_affinity();
+    void stop_supervisor(std::unique_lock<std::mutex>& lock);
 
 public:
     MultiThreadedScheduler();
     virtual ~MultiThreadedScheduler();
 
-    void resize_thread_pool(std::size_t numThreads);
+    virtual void resize_thread_pool(std::size_t numThreads) override;
+    virtual void set_cpu_affinity(const std::vector<int>& cpus) override;
+    virtual void set_realtime_priority(int priority) override;
+
+    std::size_t thread_pool_size();
+
+    /**
+     * Enables automatic scaling of the thread pool
+     *
+     * The thread pool gets resized immediately if its current size is outside
+     * of the given limits. Calling resize_thread_pool() disables automatic
+     * scaling.
+     *
+     * @param minThreads          Minimum number of threads
+     * @param maxThreads          Maximum number of threads
+     * @param queueDelayThreshold Queue delay above which the pool grows
+     * @param idleTimeout         Period of idleness after which the pool
+     *                            shrinks
+     */
+    void enable_auto_scaling(std::size_t minThreads, std::size_t maxThreads,
+        clock::duration queueDelayThreshold, clock::duration idleTimeout);
+
+    void disable_auto_scaling();
 
     virtual boost::asio::io_service& io_service() override;
+    virtual SchedulerStatistics* statistics() override;
+    virtual CallbackExecutor* callback_executor() override;
 };
 
 } // namespace scheduling
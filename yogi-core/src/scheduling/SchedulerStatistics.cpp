@@ -0,0 +1,53 @@
+#include "SchedulerStatistics.hpp"
+
+
+namespace yogi {
+namespace scheduling {
+
+thread_local SchedulerStatistics* SchedulerStatistics::ms_threadStatistics
+    = nullptr;
+
+void SchedulerStatistics::add_sample(std::atomic<std::uint64_t>* buckets,
+    clock::duration duration)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+        duration).count();
+
+    int bucket = 0;
+    while (us > 0 && bucket < NUM_BUCKETS - 1) {
+        us >>= 1;
+        ++bucket;
+    }
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+SchedulerStatistics::SchedulerStatistics()
+    : m_enabled{false}
+{
+    reset();
+}
+
+void SchedulerStatistics::get_histograms(handler_category category,
+    histogram* queueDelays, histogram* runtimes) const
+{
+    auto& hists = m_histograms[category];
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        (*queueDelays)[i] = hists.queueDelays[i].load(
+            std::memory_order_relaxed);
+        (*runtimes)[i] = hists.runtimes[i].load(std::memory_order_relaxed);
+    }
+}
+
+void SchedulerStatistics::reset()
+{
+    for (auto& hists : m_histograms) {
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            hists.queueDelays[i].store(0, std::memory_order_relaxed);
+            hists.runtimes[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace scheduling
+} // namespace yogi
@@ -0,0 +1,140 @@
+#ifndef YOGI_SCHEDULING_SCHEDULERSTATISTICS_HPP
+#define YOGI_SCHEDULING_SCHEDULERSTATISTICS_HPP
+
+#include "../config.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Histograms of the queue delay and runtime of handlers executed by a
+ * scheduler
+ *
+ * The histograms are broken down by handler category. Bucket 0 counts
+ * durations below 1 us and bucket i counts durations between 2^(i-1) us and
+ * 2^i us; the last bucket also counts all longer durations.
+ *
+ * Recording is disabled by default. While disabled, measuring a handler costs
+ * a single relaxed atomic load. Runtimes are inclusive, i.e. the runtime of a
+ * handler includes the runtime of all handlers executed from within it.
+ ******************************************************************************/
+class SchedulerStatistics final
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    enum handler_category {
+        TCP_RECEIVE   = YOGI_HC_TCPRECEIVE,
+        DESERIALIZE   = YOGI_HC_DESERIALIZE,
+        DISPATCH      = YOGI_HC_DISPATCH,
+        USER_CALLBACK = YOGI_HC_USERCALLBACK,
+        OTHER         = YOGI_HC_OTHER,
+        NUM_CATEGORIES
+    };
+
+    enum {
+        NUM_BUCKETS = YOGI_HISTOGRAM_BUCKETS
+    };
+
+    typedef std::uint64_t histogram[NUM_BUCKETS];
+
+    /***********************************************************************//**
+     * Measures the runtime of the enclosing scope and records it in the
+     * statistics of the scheduler running the current thread
+     **************************************************************************/
+    class scoped_measurement final
+    {
+        SchedulerStatistics* m_stats;
+        handler_category     m_category;
+        clock::time_point    m_start;
+
+    public:
+        explicit scoped_measurement(handler_category category)
+            : m_stats{ms_threadStatistics}
+            , m_category{category}
+        {
+            if (m_stats && m_stats->enabled()) {
+                m_start = clock::now();
+            }
+            else {
+                m_stats = nullptr;
+            }
+        }
+
+        scoped_measurement(const scoped_measurement&) = delete;
+        void operator= (const scoped_measurement&) = delete;
+
+        ~scoped_measurement()
+        {
+            if (m_stats) {
+                m_stats->record_runtime(m_category, clock::now() - m_start);
+            }
+        }
+    };
+
+private:
+    struct category_histograms {
+        std::atomic<std::uint64_t> queueDelays[NUM_BUCKETS];
+        std::atomic<std::uint64_t> runtimes[NUM_BUCKETS];
+    };
+
+    static thread_local SchedulerStatistics* ms_threadStatistics;
+
+    std::atomic<bool>   m_enabled;
+    category_histograms m_histograms[NUM_CATEGORIES];
+
+    static void add_sample(std::atomic<std::uint64_t>* buckets,
+        clock::duration duration);
+
+public:
+    SchedulerStatistics();
+
+    /**
+     * Makes the statistics the destination for scoped_measurement objects
+     * created on the calling thread
+     *
+     * Schedulers call this function at the start of each of their threads.
+     *
+     * @param stats Statistics to use or nullptr
+     */
+    static void set_thread_statistics(SchedulerStatistics* stats)
+    {
+        ms_threadStatistics = stats;
+    }
+
+    bool enabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    void set_enabled(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void record_queue_delay(handler_category category,
+        clock::duration delay)
+    {
+        add_sample(m_histograms[category].queueDelays, delay);
+    }
+
+    void record_runtime(handler_category category, clock::duration runtime)
+    {
+        add_sample(m_histograms[category].runtimes, runtime);
+    }
+
+    void get_histograms(handler_category category, histogram* queueDelays,
+        histogram* runtimes) const;
+
+    void reset();
+};
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_SCHEDULERSTATISTICS_HPP
@@ -0,0 +1,204 @@
+#include "WorkStealingScheduler.hpp"
+#include "set_thread_affinity.hpp"
+#include "set_thread_priority.hpp"
+#include "../api/ExceptionT.hpp"
+
+#include <algorithm>
+
+
+namespace yogi {
+namespace scheduling {
+
+void WorkStealingScheduler::thread_fn(std::size_t idx)
+{
+    SchedulerStatistics::set_thread_statistics(&m_statistics);
+    CallbackExecutor::set_thread_executor(&m_callbackExecutor);
+
+    auto& loop = *m_loops[idx];
+
+    long long waitUs = YOGI_MIN_WORK_STEALING_IDLE_WAIT_US;
+    while (!loop.exitRequested.load(std::memory_order_relaxed)) {
+        if (run_own_handler(idx) || steal_handler(idx)
+            || wait_for_work(idx, waitUs)) {
+            waitUs = YOGI_MIN_WORK_STEALING_IDLE_WAIT_US;
+        }
+        else {
+            waitUs = std::min<long long>(waitUs * 2,
+                YOGI_MAX_WORK_STEALING_IDLE_WAIT_US);
+        }
+    }
+}
+
+bool WorkStealingScheduler::poll_one(event_loop& loop)
+{
+    // expirations of the idle timer do not count as work; the counter may
+    // also change due to another thread polling the same event loop in which
+    // case we only lose a chance to reset the back-off
+    auto wakeups = loop.idleWakeups.load(std::memory_order_relaxed);
+    return loop.ioService.poll_one()
+        && loop.idleWakeups.load(std::memory_order_relaxed) == wakeups;
+}
+
+bool WorkStealingScheduler::run_own_handler(std::size_t idx)
+{
+    // the event loops of removed threads are adopted by the remaining ones
+    auto numThreads = m_numThreads.load(std::memory_order_relaxed);
+    auto numLoops   = m_numLoops.load(std::memory_order_acquire);
+
+    for (auto i = idx; i < numLoops; i += numThreads) {
+        if (poll_one(*m_loops[i])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool WorkStealingScheduler::steal_handler(std::size_t idx)
+{
+    auto numLoops = m_numLoops.load(std::memory_order_acquire);
+    for (std::size_t i = 1; i < numLoops; ++i) {
+        if (poll_one(*m_loops[(idx + i) % numLoops])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool WorkStealingScheduler::wait_for_work(std::size_t idx, long long waitUs)
+{
+    // block until either our own event loop gets work or the timer expires and
+    // we look for work to steal again; a timer that is still pending from an
+    // earlier wait is not re-armed since that would cancel it and produce an
+    // extra handler
+    auto& loop = *m_loops[idx];
+    if (!loop.idleTimerArmed.exchange(true)) {
+        loop.idleTimer.expires_from_now(
+            boost::posix_time::microseconds(waitUs));
+        loop.idleTimer.async_wait([&loop](const boost::system::error_code&) {
+            loop.idleWakeups.fetch_add(1, std::memory_order_relaxed);
+            loop.idleTimerArmed = false;
+        });
+    }
+
+    auto wakeups = loop.idleWakeups.load(std::memory_order_relaxed);
+    return loop.ioService.run_one()
+        && loop.idleWakeups.load(std::memory_order_relaxed) == wakeups;
+}
+
+WorkStealingScheduler::WorkStealingScheduler()
+    : m_loops           (YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE)
+    , m_numLoops        {0}
+    , m_numThreads      {0}
+    , m_nextHome        {0}
+    , m_priority        {0}
+    , m_callbackExecutor{&m_statistics}
+{
+    resize_thread_pool(YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE);
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    auto numLoops = m_numLoops.load();
+    for (std::size_t i = 0; i < numLoops; ++i) {
+        m_loops[i]->exitRequested = true;
+        m_loops[i]->ioService.stop();
+    }
+
+    for (std::size_t i = 0; i < numLoops; ++i) {
+        if (m_loops[i]->thread.joinable()) {
+            m_loops[i]->thread.join();
+        }
+    }
+}
+
+void WorkStealingScheduler::resize_thread_pool(std::size_t numThreads)
+{
+    if (numThreads < 1 || numThreads > YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    auto oldNumThreads = m_numThreads.load();
+
+    // remove threads
+    if (numThreads < oldNumThreads) {
+        m_numThreads = numThreads;
+
+        for (auto i = numThreads; i < oldNumThreads; ++i) {
+            auto& loop = *m_loops[i];
+            loop.exitRequested = true;
+            loop.ioService.post([] {}); // wake up the thread
+        }
+
+        for (auto i = numThreads; i < oldNumThreads; ++i) {
+            m_loops[i]->thread.join();
+        }
+    }
+    // create new threads
+    else if (numThreads > oldNumThreads) {
+        for (auto i = m_numLoops.load(); i < numThreads; ++i) {
+            m_loops[i] = std::make_unique<event_loop>();
+            m_numLoops.store(i + 1, std::memory_order_release);
+        }
+
+        m_numThreads = numThreads;
+
+        for (auto i = oldNumThreads; i < numThreads; ++i) {
+            auto& loop = *m_loops[i];
+            loop.exitRequested = false;
+            loop.thread = std::thread(&WorkStealingScheduler::thread_fn, this,
+                i);
+
+            if (!m_cpus.empty()) {
+                set_thread_affinity(loop.thread, i, m_cpus);
+            }
+
+            if (m_priority) {
+                set_thread_priority(loop.thread, m_priority);
+            }
+        }
+    }
+}
+
+void WorkStealingScheduler::set_cpu_affinity(const std::vector<int>& cpus)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_cpus = cpus;
+
+    for (std::size_t i = 0; i < m_numThreads; ++i) {
+        set_thread_affinity(m_loops[i]->thread, i, m_cpus);
+    }
+}
+
+void WorkStealingScheduler::set_realtime_priority(int priority)
+{
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (std::size_t i = 0; i < m_numThreads; ++i) {
+        set_thread_priority(m_loops[i]->thread, priority);
+    }
+
+    m_priority = priority;
+}
+
+boost::asio::io_service& WorkStealingScheduler::io_service()
+{
+    auto numThreads = m_numThreads.load(std::memory_order_relaxed);
+    auto home = m_nextHome.fetch_add(1, std::memory_order_relaxed) % numThreads;
+    return m_loops[home]->ioService;
+}
+
+SchedulerStatistics* WorkStealingScheduler::statistics()
+{
+    return &m_statistics;
+}
+
+CallbackExecutor* WorkStealingScheduler::callback_executor()
+{
+    return &m_callbackExecutor;
+}
+
+} // namespace scheduling
+} // namespace yogi
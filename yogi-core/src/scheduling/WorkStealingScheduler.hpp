@@ -0,0 +1,105 @@
+#ifndef YOGI_SCHEDULING_WORKSTEALINGSCHEDULER_HPP
+#define YOGI_SCHEDULING_WORKSTEALINGSCHEDULER_HPP
+
+#include "../config.h"
+#include "../interfaces/IThreadPoolScheduler.hpp"
+#include "SchedulerStatistics.hpp"
+#include "CallbackExecutor.hpp"
+
+#include <boost/asio/deadline_timer.hpp>
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Scheduler with one event loop per thread and work-stealing between them
+ *
+ * Every thread owns an event loop (io_service). Objects requesting an
+ * io_service via io_service(), e.g. connections and their strands, get bound
+ * to the event loops of the active threads in a round-robin fashion and thus
+ * have a home thread. Objects consisting of multiple I/O objects bind all of
+ * them to the same event loop. Threads first execute handlers from their own
+ * event loop; if there is nothing to do, they execute ready handlers from the
+ * other event loops. Idle threads wake up periodically to look for work to
+ * steal, backing off exponentially while there is none. The expirations of
+ * these idle timers do not count as work.
+ *
+ * Event loops are never destroyed while the scheduler exists since objects are
+ * bound to them. If the thread pool shrinks, the event loops of the removed
+ * threads get adopted by the remaining threads.
+ ******************************************************************************/
+class WorkStealingScheduler : public interfaces::IThreadPoolScheduler
+{
+    struct event_loop {
+        boost::asio::io_service       ioService;
+        boost::asio::io_service::work work;
+        boost::asio::deadline_timer   idleTimer;
+        std::atomic<bool>             idleTimerArmed;
+        std::atomic<std::size_t>      idleWakeups;
+        std::thread                   thread;
+        std::atomic<bool>             exitRequested;
+
+        event_loop()
+            : work          {ioService}
+            , idleTimer     {ioService}
+            , idleTimerArmed{false}
+            , idleWakeups   {0}
+            , exitRequested {false}
+        {
+        }
+    };
+
+    typedef std::unique_ptr<event_loop> event_loop_ptr;
+
+private:
+    std::vector<event_loop_ptr> m_loops; // never reallocated
+    std::atomic<std::size_t>    m_numLoops;
+    std::atomic<std::size_t>    m_numThreads;
+    std::atomic<std::size_t>    m_nextHome;
+    std::vector<int>            m_cpus;
+    int                         m_priority;
+    SchedulerStatistics         m_statistics;
+    CallbackExecutor            m_callbackExecutor;
+    std::mutex                  m_mutex;
+
+private:
+    void thread_fn(std::size_t idx);
+    bool poll_one(event_loop& loop);
+    bool run_own_handler(std::size_t idx);
+    bool steal_handler(std::size_t idx);
+    bool wait_for_work(std::size_t idx, long long waitUs);
+
+public:
+    WorkStealingScheduler();
+    virtual ~WorkStealingScheduler();
+
+    virtual void resize_thread_pool(std::size_t numThreads) override;
+    virtual void set_cpu_affinity(const std::vector<int>& cpus) override;
+    virtual void set_realtime_priority(int priority) override;
+
+    /**
+     * Returns the event loop to bind a new object to
+     *
+     * Successive calls return the event loops of the active threads in a
+     * round-robin fashion. Objects consisting of multiple I/O objects must
+     * call this function only once and bind all of their I/O objects to the
+     * returned event loop.
+     *
+     * @return Event loop
+     */
+    virtual boost::asio::io_service& io_service() override;
+    virtual SchedulerStatistics* statistics() override;
+    virtual CallbackExecutor* callback_executor() override;
+};
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_WORKSTEALINGSCHEDULER_HPP
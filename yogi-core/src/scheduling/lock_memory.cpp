@@ -0,0 +1,27 @@
+#include "lock_memory.hpp"
+#include "../api/ExceptionT.hpp"
+
+#ifndef _WIN32
+#   include <sys/mman.h>
+#endif
+
+
+namespace yogi {
+namespace scheduling {
+
+void lock_memory(bool lock)
+{
+#ifdef _WIN32
+    if (lock) {
+        throw api::ExceptionT<YOGI_ERR_LOCK_MEMORY_FAILED>{};
+    }
+#else
+    int res = lock ? mlockall(MCL_CURRENT | MCL_FUTURE) : munlockall();
+    if (res) {
+        throw api::ExceptionT<YOGI_ERR_LOCK_MEMORY_FAILED>{};
+    }
+#endif
+}
+
+} // namespace scheduling
+} // namespace yogi
@@ -0,0 +1,23 @@
+#ifndef YOGI_SCHEDULING_LOCK_MEMORY_HPP
+#define YOGI_SCHEDULING_LOCK_MEMORY_HPP
+
+#include "../config.h"
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Locks all current and future pages of the process into RAM or unlocks them
+ *
+ * Locked pages cannot be swapped out, so accessing them never causes a page
+ * fault to disk. This is only supported on POSIX systems.
+ *
+ * @param lock True to lock and false to unlock the memory
+ ******************************************************************************/
+void lock_memory(bool lock);
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_LOCK_MEMORY_HPP
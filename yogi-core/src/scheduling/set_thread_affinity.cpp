@@ -0,0 +1,52 @@
+#include "set_thread_affinity.hpp"
+#include "../api/ExceptionT.hpp"
+
+#if defined(_WIN32)
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+
+namespace yogi {
+namespace scheduling {
+
+void set_thread_affinity(std::thread& thread, std::size_t idx,
+    const std::vector<int>& cpus)
+{
+    int cpu = cpus.empty() ? -1 : cpus[idx % cpus.size()];
+
+#if defined(_WIN32)
+    DWORD_PTR mask = cpu < 0 ? ~DWORD_PTR{0} : DWORD_PTR{1} << cpu;
+    if (cpu >= static_cast<int>(sizeof(mask) * 8)
+        || !SetThreadAffinityMask(thread.native_handle(), mask)) {
+        throw api::ExceptionT<YOGI_ERR_SET_AFFINITY_FAILED>{};
+    }
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpu < 0) {
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            CPU_SET(i, &set);
+        }
+    }
+    else if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &set);
+    }
+    else {
+        throw api::ExceptionT<YOGI_ERR_SET_AFFINITY_FAILED>{};
+    }
+
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set)) {
+        throw api::ExceptionT<YOGI_ERR_SET_AFFINITY_FAILED>{};
+    }
+#else
+    if (cpu >= 0) {
+        throw api::ExceptionT<YOGI_ERR_SET_AFFINITY_FAILED>{};
+    }
+#endif
+}
+
+} // namespace scheduling
+} // namespace yogi
@@ -0,0 +1,30 @@
+#ifndef YOGI_SCHEDULING_SET_THREAD_AFFINITY_HPP
+#define YOGI_SCHEDULING_SET_THREAD_AFFINITY_HPP
+
+#include "../config.h"
+
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Pins the idx-th thread of a thread pool to one of the given CPUs
+ *
+ * The thread gets pinned to cpus[idx % cpus.size()]. If \p cpus is empty, the
+ * thread is allowed to run on all CPUs.
+ *
+ * @param thread Thread to pin
+ * @param idx    Index of the thread in its thread pool
+ * @param cpus   CPUs to choose from
+ ******************************************************************************/
+void set_thread_affinity(std::thread& thread, std::size_t idx,
+    const std::vector<int>& cpus);
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_SET_THREAD_AFFINITY_HPP
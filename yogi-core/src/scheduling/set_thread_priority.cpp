@@ -0,0 +1,42 @@
+#include "set_thread_priority.hpp"
+#include "../api/ExceptionT.hpp"
+
+#if defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+
+namespace yogi {
+namespace scheduling {
+
+void set_thread_priority(std::thread& thread, int priority)
+{
+    if (priority < 0) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+#if defined(_WIN32)
+    int winPriority = priority ? THREAD_PRIORITY_TIME_CRITICAL
+                               : THREAD_PRIORITY_NORMAL;
+    if (!SetThreadPriority(thread.native_handle(), winPriority)) {
+        throw api::ExceptionT<YOGI_ERR_SET_PRIORITY_FAILED>{};
+    }
+#else
+    int policy = priority ? SCHED_FIFO : SCHED_OTHER;
+    if (priority > sched_get_priority_max(policy)) {
+        throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+    }
+
+    sched_param param = {};
+    param.sched_priority = priority;
+    if (pthread_setschedparam(thread.native_handle(), policy, &param)) {
+        throw api::ExceptionT<YOGI_ERR_SET_PRIORITY_FAILED>{};
+    }
+#endif
+}
+
+} // namespace scheduling
+} // namespace yogi
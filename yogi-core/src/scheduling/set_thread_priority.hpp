@@ -0,0 +1,27 @@
+#ifndef YOGI_SCHEDULING_SET_THREAD_PRIORITY_HPP
+#define YOGI_SCHEDULING_SET_THREAD_PRIORITY_HPP
+
+#include "../config.h"
+
+#include <thread>
+
+
+namespace yogi {
+namespace scheduling {
+
+/***************************************************************************//**
+ * Changes the scheduling policy of a thread
+ *
+ * A priority greater than zero makes the thread run under a real-time policy
+ * (SCHED_FIFO on Linux) with the given priority. Zero reverts the thread to
+ * the default time-sharing policy.
+ *
+ * @param thread   Thread to change
+ * @param priority Real-time priority or zero
+ ******************************************************************************/
+void set_thread_priority(std::thread& thread, int priority);
+
+} // namespace scheduling
+} // namespace yogi
+
+#endif // YOGI_SCHEDULING_SET_THREAD_PRIORITY_HPP
@@ -6,6 +6,7 @@
 #include "../base/Identifier.hpp"
 #include "../base/Buffer.hpp"
 #include "../core/scatter_gather/gather_flags.hpp"
+#include "../core/scatter_gather/gathered_response.hpp"
 
 #include <vector>
 
@@ -60,20 +61,22 @@ inline void deserialize_one<base::Identifier>(const std::vector<char>& buffer,
     base::Identifier::signature_type signature = 0;
     deserialize_one(buffer, it, signature);
 
-    bool hidden;
-    deserialize_one(buffer, it, hidden);
+    char flags = *it++;
+    bool hidden   = !!(flags & 1);
+    bool wildcard = !!(flags & 2);
 
     std::size_t nameSize;
     deserialize_one(buffer, it, nameSize);
 
-    base::Identifier::name_type name;
+    // intern the name straight from the buffer to avoid a temporary string
     YOGI_ASSERT(std::distance(it, buffer.end()) >= 0);
     YOGI_ASSERT(static_cast<std::size_t>(std::distance(it, buffer.end()))
         >= nameSize);
-    name.assign(it, it + nameSize);
+    base::InternedName name{buffer.data() + std::distance(buffer.begin(), it),
+        nameSize};
     it += nameSize;
 
-    value = base::Identifier{signature, name, hidden};
+    value = base::Identifier{signature, std::move(name), hidden, wildcard};
 }
 
 template <>
@@ -99,6 +102,21 @@ inline void deserialize_one<core::scatter_gather::gather_flags>(
     value = static_cast<core::scatter_gather::gather_flags>(byte);
 }
 
+template <>
+inline void deserialize_one<core::scatter_gather::gathered_responses>(
+    const std::vector<char>& buffer, std::vector<char>::const_iterator& it,
+    core::scatter_gather::gathered_responses& value)
+{
+    std::size_t size;
+    deserialize_one(buffer, it, size);
+
+    value.resize(size);
+    for (auto& response : value) {
+        deserialize_one(buffer, it, response.flags);
+        deserialize_one(buffer, it, response.data);
+    }
+}
+
 } // namespace serialization
 } // namespace yogi
 
@@ -6,6 +6,7 @@
 #include "../base/Identifier.hpp"
 #include "../base/Buffer.hpp"
 #include "../core/scatter_gather/gather_flags.hpp"
+#include "../core/scatter_gather/gathered_response.hpp"
 
 #include <vector>
 
@@ -51,8 +52,10 @@ template <>
 inline void serialize_one<base::Identifier>(std::vector<char>& buffer,
     const base::Identifier& value)
 {
+    // the hidden and the wildcard flag share a single byte
     serialize_one(buffer, value.signature());
-    serialize_one(buffer, value.hidden());
+    buffer.push_back(static_cast<char>((value.hidden() ? 1 : 0)
+        | (value.wildcard() ? 2 : 0)));
     serialize_one(buffer, value.name().size());
     buffer.insert(buffer.end(), value.name().begin(), value.name().end());
 }
@@ -73,6 +76,18 @@ inline void serialize_one<core::scatter_gather::gather_flags>(
     buffer.push_back(static_cast<char>(value));
 }
 
+template <>
+inline void serialize_one<core::scatter_gather::gathered_responses>(
+    std::vector<char>& buffer,
+    const core::scatter_gather::gathered_responses& value)
+{
+    serialize_one(buffer, value.size());
+    for (auto& response : value) {
+        serialize_one(buffer, response.flags);
+        serialize_one(buffer, response.data);
+    }
+}
+
 } // namespace serialization
 } // namespace yogi
 
@@ -1,5 +1,8 @@
 #include "config.h"
 #include "scheduling/MultiThreadedScheduler.hpp"
+#include "scheduling/WorkStealingScheduler.hpp"
+#include "scheduling/BusyPollScheduler.hpp"
+#include "scheduling/lock_memory.hpp"
 #include "core/Node.hpp"
 #include "core/Leaf.hpp"
 #include "core/BindingT.hpp"
@@ -15,8 +18,10 @@
 #include "connections/local/LocalConnection.hpp"
 #include "connections/tcp/TcpServer.hpp"
 #include "connections/tcp/TcpClient.hpp"
+#include "connections/tcp/TcpChannel.hpp"
 #include "api/PublicObjectRegister.hpp"
 #include "api/TerminalWithBindingT.hpp"
+#include "api/MessageLoan.hpp"
 #include "api/evaluate.hpp"
 using namespace yogi;
 
@@ -29,6 +34,7 @@ using namespace yogi;
 
 #include <atomic>
 #include <sstream>
+#include <algorithm>
 
 #define CHECK_INITIALIZED()                                \
 {{                                                         \
@@ -112,7 +118,12 @@ void param_to_stream<unsigned>(std::ostringstream& oss, unsigned param)
 template <>
 void param_to_stream<const char*>(std::ostringstream& oss, const char* param)
 {
-    oss << "\"" << param << "\"";
+    if (param) {
+        oss << "\"" << param << "\"";
+    }
+    else {
+        oss << "NULL";
+    }
 }
 
 template <typename... Params>
@@ -204,6 +215,80 @@ std::chrono::milliseconds int_to_timeout(int timeout)
 	}
 }
 
+bool write_terminal_description(char* buffer, std::size_t bufferSize,
+    std::size_t* bufferOffset, int type, const base::Identifier& identifier)
+{
+    auto size = 1 + 4 + identifier.name().size() + 1;
+    if (size > bufferSize - *bufferOffset) {
+        return false;
+    }
+
+    auto dst = buffer + *bufferOffset;
+    dst[0] = static_cast<char>(type);
+
+    std::uint32_t signature = static_cast<std::uint32_t>(
+        identifier.signature());
+    std::copy_n(reinterpret_cast<char*>(&signature), 4, dst + 1);
+
+    std::copy(identifier.name().begin(), identifier.name().end(), dst + 5);
+    dst[size - 1] = '\0';
+
+    *bufferOffset += size;
+    return true;
+}
+
+core::KnownTerminalsIndex::entry read_terminal_description(const void* data)
+{
+    auto src = static_cast<const char*>(data);
+
+    std::uint32_t signature;
+    std::copy_n(src + 1, 4, reinterpret_cast<char*>(&signature));
+
+    return core::KnownTerminalsIndex::entry{static_cast<int>(src[0]),
+        base::Identifier{signature, std::string{src + 5}, false}};
+}
+
+scheduling::SchedulerStatistics& get_scheduler_statistics(void* scheduler)
+{
+    auto stats = api::PublicObjectRegister::get_s<interfaces::IScheduler>(
+        scheduler).statistics();
+    if (!stats) {
+        throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+    }
+
+    return *stats;
+}
+
+std::vector<base::Buffer> make_batch_buffers(const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    std::vector<base::Buffer> batch;
+    batch.reserve(numBuffers);
+
+    for (unsigned i = 0; i < numBuffers; ++i) {
+        if (buffers[i] == nullptr && bufferSizes[i] != 0) {
+            throw api::ExceptionT<YOGI_ERR_INVALID_PARAM>{};
+        }
+
+        batch.emplace_back(buffers[i],
+            static_cast<std::size_t>(bufferSizes[i]));
+    }
+
+    return batch;
+}
+
+core::publish_subscribe::Terminal<>& get_ps_terminal_of_binding(
+    interfaces::IBinding& binding)
+{
+    auto terminal = dynamic_cast<core::publish_subscribe::Terminal<>*>(
+        &binding.terminal());
+    if (!terminal) {
+        throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+    }
+
+    return *terminal;
+}
+
 } // anonymous namespace
 
 YOGI_API const char* YOGI_GetVersion()
@@ -306,6 +391,33 @@ YOGI_API int YOGI_CreateScheduler(void** scheduler)
     }, __FUNCTION__, scheduler);
 }
 
+YOGI_API int YOGI_CreateSchedulerEx(void** scheduler, int type)
+{
+    CHECK_INITIALIZED();
+    CHECK_PARAM(scheduler);
+    CHECK_PARAM(type == YOGI_ST_SHAREDQUEUE || type == YOGI_ST_WORKSTEALING
+        || type == YOGI_ST_BUSYPOLL);
+
+    return evaluate([&] {
+        switch (type) {
+        case YOGI_ST_SHAREDQUEUE:
+            *scheduler = api::PublicObjectRegister::create<
+                scheduling::MultiThreadedScheduler>();
+            break;
+
+        case YOGI_ST_WORKSTEALING:
+            *scheduler = api::PublicObjectRegister::create<
+                scheduling::WorkStealingScheduler>();
+            break;
+
+        case YOGI_ST_BUSYPOLL:
+            *scheduler = api::PublicObjectRegister::create<
+                scheduling::BusyPollScheduler>();
+            break;
+        }
+    }, __FUNCTION__, scheduler, type);
+}
+
 YOGI_API int YOGI_SetSchedulerThreadPoolSize(void* scheduler,
     unsigned numThreads)
 {
@@ -314,11 +426,147 @@ YOGI_API int YOGI_SetSchedulerThreadPoolSize(void* scheduler,
     CHECK_PARAM(numThreads > 0);
 
     return evaluate([&] {
-        api::PublicObjectRegister::get_s<scheduling::MultiThreadedScheduler>(
+        api::PublicObjectRegister::get_s<interfaces::IThreadPoolScheduler>(
             scheduler).resize_thread_pool(static_cast<std::size_t>(numThreads));
     }, __FUNCTION__, scheduler, numThreads);
 }
 
+YOGI_API int YOGI_SetSchedulerAutoScaling(void* scheduler, unsigned minThreads,
+    unsigned maxThreads, unsigned queueDelayUs, unsigned idleTimeoutMs)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+    CHECK_PARAM(maxThreads == 0 || (minThreads > 0 && minThreads <= maxThreads
+        && maxThreads <= YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE));
+    CHECK_PARAM(maxThreads == 0 || (queueDelayUs > 0 && idleTimeoutMs > 0));
+
+    return evaluate([&] {
+        auto& scheduler_ = api::PublicObjectRegister::get_s<
+            scheduling::MultiThreadedScheduler>(scheduler);
+
+        if (maxThreads) {
+            scheduler_.enable_auto_scaling(minThreads, maxThreads,
+                std::chrono::microseconds(queueDelayUs),
+                std::chrono::milliseconds(idleTimeoutMs));
+        }
+        else {
+            scheduler_.disable_auto_scaling();
+        }
+    }, __FUNCTION__, scheduler, minThreads, maxThreads, queueDelayUs,
+        idleTimeoutMs);
+}
+
+YOGI_API int YOGI_SetSchedulerCpuAffinity(void* scheduler, const int* cpus,
+    unsigned numCpus)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+    CHECK_PARAM(cpus || numCpus == 0);
+    CHECK_PARAM(std::all_of(cpus, cpus + numCpus, [](int cpu) {
+        return cpu >= 0; }));
+
+    return evaluate([&] {
+        api::PublicObjectRegister::get_s<interfaces::IThreadPoolScheduler>(
+            scheduler).set_cpu_affinity(std::vector<int>(cpus,
+                cpus + numCpus));
+    }, __FUNCTION__, scheduler, cpus, numCpus);
+}
+
+YOGI_API int YOGI_SetSchedulerRealtimePriority(void* scheduler, int priority)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+    CHECK_PARAM(priority >= 0);
+
+    return evaluate([&] {
+        api::PublicObjectRegister::get_s<interfaces::IThreadPoolScheduler>(
+            scheduler).set_realtime_priority(priority);
+    }, __FUNCTION__, scheduler, priority);
+}
+
+YOGI_API int YOGI_SetSchedulerSpinDuration(void* scheduler, int spinUs)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+
+    return evaluate([&] {
+        api::PublicObjectRegister::get_s<scheduling::BusyPollScheduler>(
+            scheduler).set_spin_duration(spinUs);
+    }, __FUNCTION__, scheduler, spinUs);
+}
+
+YOGI_API int YOGI_LockMemory(int lock)
+{
+    return evaluate([&] {
+        scheduling::lock_memory(!!lock);
+    }, __FUNCTION__, lock);
+}
+
+YOGI_API int YOGI_EnableSchedulerStatistics(void* scheduler, int enabled)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+
+    return evaluate([&] {
+        get_scheduler_statistics(scheduler).set_enabled(!!enabled);
+    }, __FUNCTION__, scheduler, enabled);
+}
+
+YOGI_API int YOGI_GetSchedulerStatistics(void* scheduler, int category,
+    unsigned long long* queueDelays, unsigned long long* runtimes)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+    CHECK_PARAM(category >= 0
+        && category < scheduling::SchedulerStatistics::NUM_CATEGORIES);
+    CHECK_PARAM(queueDelays);
+    CHECK_PARAM(runtimes);
+
+    return evaluate([&] {
+        scheduling::SchedulerStatistics::histogram delayHist;
+        scheduling::SchedulerStatistics::histogram runtimeHist;
+        get_scheduler_statistics(scheduler).get_histograms(
+            static_cast<scheduling::SchedulerStatistics::handler_category>(
+                category), &delayHist, &runtimeHist);
+
+        std::copy(std::begin(delayHist), std::end(delayHist), queueDelays);
+        std::copy(std::begin(runtimeHist), std::end(runtimeHist), runtimes);
+    }, __FUNCTION__, scheduler, category, queueDelays, runtimes);
+}
+
+YOGI_API int YOGI_ResetSchedulerStatistics(void* scheduler)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+
+    return evaluate([&] {
+        get_scheduler_statistics(scheduler).reset();
+    }, __FUNCTION__, scheduler);
+}
+
+YOGI_API int YOGI_SetSchedulerCallbackExecutor(void* scheduler,
+    unsigned numThreads, unsigned queueSize, int overflowPolicy)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(scheduler);
+    CHECK_PARAM(numThreads <= YOGI_MAX_SCHEDULER_THREAD_POOL_SIZE);
+    CHECK_PARAM(numThreads == 0 || queueSize > 0);
+    CHECK_PARAM(overflowPolicy == YOGI_OP_BLOCK
+        || overflowPolicy == YOGI_OP_RUNINLINE);
+
+    return evaluate([&] {
+        auto executor = api::PublicObjectRegister::get_s<
+            interfaces::IScheduler>(scheduler).callback_executor();
+        if (!executor) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        executor->configure(numThreads, queueSize,
+            static_cast<scheduling::CallbackExecutor::overflow_policy>(
+                overflowPolicy));
+    }, __FUNCTION__, scheduler, numThreads, queueSize, overflowPolicy);
+}
+
 YOGI_API int YOGI_CreateNode(void** node, void* scheduler)
 {
     CHECK_INITIALIZED();
@@ -346,46 +594,156 @@ YOGI_API int YOGI_GetKnownTerminals(void* node, void* buffer,
         auto buffer_ = static_cast<char*>(buffer);
         auto bufferSize_ = static_cast<std::size_t>(bufferSize);
 
-        std::vector<char> tmp;
         std::size_t bufferOffset = 0;
+        bool bufferTooSmall = false;
         *numTerminals = 0;
 
-        auto convertFn = [&](char type, std::vector<base::Identifier>& tms) {
-            for (auto& identifier : tms) {
-                tmp.resize(1 + 4 + identifier.name().size() + 1);
-                if (tmp.size() > bufferSize_ - bufferOffset) {
-                    throw api::ExceptionT<YOGI_ERR_BUFFER_TOO_SMALL>{};
+        node_.known_terminals_index().find(
+            core::KnownTerminalsIndex::QUERY_PREFIX, std::string{}, true,
+            nullptr, [&](const core::KnownTerminalsIndex::entry& terminal) {
+                if (!write_terminal_description(buffer_, bufferSize_,
+                    &bufferOffset, terminal.type, terminal.identifier)) {
+                    bufferTooSmall = true;
+                    return false;
                 }
 
-                tmp[0] = type;
+                ++*numTerminals;
+                return true;
+            });
+
+        if (bufferTooSmall) {
+            throw api::ExceptionT<YOGI_ERR_BUFFER_TOO_SMALL>{};
+        }
+    }, __FUNCTION__, node, buffer, bufferSize, numTerminals);
+}
+
+YOGI_API int YOGI_FindKnownTerminals(void* node, int mode,
+    const char* pattern, const void* startAfter, unsigned maxTerminals,
+    void* buffer, unsigned bufferSize, unsigned* numTerminals,
+    unsigned long long* cursor)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(node);
+    CHECK_PARAM(pattern);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(numTerminals);
+
+    return evaluate([&] {
+        CHECK_FLAGS_THROW(mode, YOGI_KT_SUBSTRING | YOGI_KT_IGNORECASE);
+
+        auto& node_ = api::PublicObjectRegister::get_s<core::Node>(node);
+        auto buffer_ = static_cast<char*>(buffer);
+        auto bufferSize_ = static_cast<std::size_t>(bufferSize);
+
+        auto queryMode = (mode & YOGI_KT_SUBSTRING)
+            ? core::KnownTerminalsIndex::QUERY_SUBSTRING
+            : core::KnownTerminalsIndex::QUERY_PREFIX;
+        bool caseSensitive = !(mode & YOGI_KT_IGNORECASE);
+
+        core::KnownTerminalsIndex::entry after{};
+        if (startAfter) {
+            after = read_terminal_description(startAfter);
+        }
 
-                std::uint32_t signature = static_cast<std::uint32_t>(
-                    identifier.signature());
-                std::copy_n(reinterpret_cast<char*>(&signature), 4, tmp.begin()
-                    + 1);
+        std::size_t bufferOffset = 0;
+        bool bufferTooSmall = false;
+        *numTerminals = 0;
 
-                std::copy(identifier.name().begin(), identifier.name().end(),
-                    tmp.begin() + 5);
-                tmp.back() = '\0';
+        auto cursor_ = node_.known_terminals_index().find(queryMode, pattern,
+            caseSensitive, startAfter ? &after : nullptr,
+            [&](const core::KnownTerminalsIndex::entry& terminal) {
+                if (maxTerminals && *numTerminals == maxTerminals) {
+                    return false;
+                }
 
-                std::copy(tmp.begin(), tmp.end(), buffer_ + bufferOffset);
-                bufferOffset += tmp.size();
+                if (!write_terminal_description(buffer_, bufferSize_,
+                    &bufferOffset, terminal.type, terminal.identifier)) {
+                    bufferTooSmall = true;
+                    return false;
+                }
 
                 ++*numTerminals;
-            }
-        };
-
-        auto v = node_.get_known_terminals();
-        convertFn(YOGI_TM_DEAFMUTE,               v.deafMute);
-        convertFn(YOGI_TM_PUBLISHSUBSCRIBE,       v.publishSubscribe);
-        convertFn(YOGI_TM_SCATTERGATHER,          v.scatterGather);
-        convertFn(YOGI_TM_CACHEDPUBLISHSUBSCRIBE, v.cachedPublishSubscribe);
-        convertFn(YOGI_TM_PRODUCER,               v.producerConsumer);
-        convertFn(YOGI_TM_CACHEDPRODUCER,         v.cachedProducerConsumer);
-        convertFn(YOGI_TM_MASTER,                 v.masterSlave);
-        convertFn(YOGI_TM_CACHEDMASTER,           v.cachedMasterSlave);
-        convertFn(YOGI_TM_SERVICE,                v.serviceClient);
-    }, __FUNCTION__, node, buffer, bufferSize, numTerminals);
+                return true;
+            });
+
+        if (cursor) {
+            *cursor = cursor_;
+        }
+
+        if (bufferTooSmall) {
+            throw api::ExceptionT<YOGI_ERR_BUFFER_TOO_SMALL>{};
+        }
+    }, __FUNCTION__, node, mode, pattern, startAfter, maxTerminals, buffer,
+        bufferSize, numTerminals, cursor);
+}
+
+YOGI_API int YOGI_GetKnownTerminalsChanges(void* node,
+    unsigned long long* cursor, void* buffer, unsigned bufferSize,
+    unsigned* numChanges)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(node);
+    CHECK_PARAM(cursor);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(numChanges);
+
+    return evaluate([&] {
+        auto& node_ = api::PublicObjectRegister::get_s<core::Node>(node);
+        auto buffer_ = static_cast<char*>(buffer);
+        auto bufferSize_ = static_cast<std::size_t>(bufferSize);
+
+        std::size_t bufferOffset = 0;
+        bool bufferTooSmall = false;
+        *numChanges = 0;
+
+        *cursor = node_.known_terminals_index().get_changes(*cursor,
+            [&](const core::KnownTerminalsIndex::change& change) {
+                if (bufferOffset == bufferSize_) {
+                    bufferTooSmall = true;
+                    return false;
+                }
+
+                buffer_[bufferOffset] = (change.added ? 1 : 0);
+                std::size_t offset = bufferOffset + 1;
+                if (!write_terminal_description(buffer_, bufferSize_, &offset,
+                    change.terminal.type, change.terminal.identifier)) {
+                    bufferTooSmall = true;
+                    return false;
+                }
+
+                bufferOffset = offset;
+                ++*numChanges;
+                return true;
+            });
+
+        if (bufferTooSmall) {
+            throw api::ExceptionT<YOGI_ERR_BUFFER_TOO_SMALL>{};
+        }
+    }, __FUNCTION__, node, cursor, buffer, bufferSize, numChanges);
+}
+
+YOGI_API int YOGI_SetHistoryLimits(void* node, unsigned maxMessages,
+    unsigned maxBytes)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(node);
+
+    return evaluate([&] {
+        auto& node_ = api::PublicObjectRegister::get_s<core::Node>(node);
+        node_.set_history_limits(static_cast<std::size_t>(maxMessages),
+            static_cast<std::size_t>(maxBytes));
+    }, __FUNCTION__, node, maxMessages, maxBytes);
+}
+
+YOGI_API int YOGI_SetLastValueStore(void* node, const char* path)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(node);
+
+    return evaluate([&] {
+        auto& node_ = api::PublicObjectRegister::get_s<core::Node>(node);
+        node_.set_last_value_store(path ? path : std::string{});
+    }, __FUNCTION__, node, path);
 }
 
 YOGI_API int YOGI_AsyncAwaitKnownTerminalsChange(void* node, void* buffer,
@@ -638,98 +996,233 @@ YOGI_API int YOGI_CancelAwaitSubscriptionStateChange(void* terminal)
     }, __FUNCTION__, terminal);
 }
 
-YOGI_API int YOGI_CreateBinding(void** binding, void* terminal,
-    const char* targets)
+YOGI_API int YOGI_SetReceiveQueue(void* terminal, unsigned depth,
+    int overflowPolicy)
 {
     CHECK_INITIALIZED();
-    CHECK_PARAM(binding);
     CHECK_HANDLE(terminal);
-    CHECK_PARAM(targets);
-    CHECK_PARAM(*targets != '\0');
+    CHECK_PARAM(overflowPolicy == YOGI_RQ_DROPOLDEST
+        || overflowPolicy == YOGI_RQ_DROPNEWEST);
 
     return evaluate([&] {
-        auto& terminal_ = api::PublicObjectRegister::get_s<interfaces::ITerminal>(
-            terminal);
-
-        if (dynamic_cast<core::deaf_mute::Terminal<>*>(&terminal_)) {
-            typedef core::deaf_mute::Terminal<>                  tm_type;
-            typedef core::BindingT<core::deaf_mute::LeafLogic<>> bd_type;
-
-            *binding = api::PublicObjectRegister::create<bd_type>(
-                static_cast<tm_type&>(terminal_), targets, false);
-        }
-        else if (dynamic_cast<core::publish_subscribe::Terminal<>*>(&terminal_)) {
-            typedef core::publish_subscribe::Terminal<>                  tm_type;
-            typedef core::BindingT<core::publish_subscribe::LeafLogic<>> bd_type;
-
-            *binding = api::PublicObjectRegister::create<bd_type>(
-                static_cast<tm_type&>(terminal_), targets, false);
-        }
-        else if (dynamic_cast<core::scatter_gather::Terminal<>*>(&terminal_)) {
-            typedef core::scatter_gather::Terminal<>                  tm_type;
-            typedef core::BindingT<core::scatter_gather::LeafLogic<>> bd_type;
-
-            *binding = api::PublicObjectRegister::create<bd_type>(
-                static_cast<tm_type&>(terminal_), targets, false);
-        }
-        else if (dynamic_cast<core::cached_publish_subscribe::Terminal<>*>(&terminal_)) {
-            typedef core::cached_publish_subscribe::Terminal<>                  tm_type;
-            typedef core::BindingT<core::cached_publish_subscribe::LeafLogic<>> bd_type;
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
 
-            *binding = api::PublicObjectRegister::create<bd_type>(
-                static_cast<tm_type&>(terminal_), targets, false);
-        }
-        else {
-            throw api::ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
-        }
-    }, __FUNCTION__, binding, terminal, targets);
+        terminal_.set_receive_queue(static_cast<std::size_t>(depth),
+            static_cast<interfaces::IMessageReceiver::overflow_policy>(
+                overflowPolicy));
+    }, __FUNCTION__, terminal, depth, overflowPolicy);
 }
 
-YOGI_API int YOGI_GetBindingState(void* object, int* state)
+YOGI_API int YOGI_GetDroppedMessageCount(void* terminal,
+    unsigned long long* count)
 {
     CHECK_INITIALIZED();
-    CHECK_HANDLE(object);
-    CHECK_PARAM(state);
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(count);
 
     return evaluate([&] {
-        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
-            object);
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
 
-        *state = state_to_int(binding_.state());
-    }, __FUNCTION__, object, state);
+        *count = terminal_.dropped_messages();
+    }, __FUNCTION__, terminal, count);
 }
 
-YOGI_API int YOGI_AsyncGetBindingState(void* binding,
-    void (*handlerFn)(int, int, void*), void* userArg)
+YOGI_API int YOGI_AsyncReceiveMessages(void* terminal, void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, unsigned, unsigned, void*),
+    void* userArg)
 {
     CHECK_INITIALIZED();
-    CHECK_HANDLE(binding);
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
     CHECK_PARAM(handlerFn);
 
     return evaluate([&] {
-        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
-            binding);
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
+        auto buffer_ = boost::asio::buffer(buffer, static_cast<std::size_t>(
+            bufferSize));
 
-        binding_.async_get_state([=](const api::Exception& e,
-            interfaces::IBinding::state_t state) {
-                handlerFn(e.error_code(), state_to_int(state), userArg);
+        terminal_.async_receive_published_messages(buffer_, [=](
+            const api::Exception& e, std::size_t numMessages,
+            std::size_t size) {
+                handlerFn(e.error_code(), static_cast<unsigned>(numMessages),
+                    static_cast<unsigned>(size), userArg);
         });
-    }, __FUNCTION__, binding, handlerFn, userArg);
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
 }
 
-YOGI_API int YOGI_AsyncAwaitBindingStateChange(void* binding,
-    void (*handlerFn)(int, int, void*), void* userArg)
+YOGI_API int YOGI_CancelReceiveMessages(void* terminal)
 {
     CHECK_INITIALIZED();
-    CHECK_HANDLE(binding);
-    CHECK_PARAM(handlerFn);
+    CHECK_HANDLE(terminal);
 
     return evaluate([&] {
-        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
-            binding);
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
 
-        binding_.async_await_state_change([=](const api::Exception& e,
-            interfaces::IBinding::state_t state) {
+        terminal_.cancel_receive_published_messages();
+    }, __FUNCTION__, terminal);
+}
+
+YOGI_API int YOGI_AsyncReceiveMessageLoan(void* terminal,
+    void (*handlerFn)(int, const void*, unsigned, int, void*, void*),
+    void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
+
+        terminal_.async_receive_published_message_loan([=](
+            const api::Exception& e, base::Buffer&& data, bool cached) {
+                if (e.error_code() != YOGI_OK) {
+                    handlerFn(e.error_code(), nullptr, 0, 0, nullptr, userArg);
+                    return;
+                }
+
+                auto loan = std::make_shared<api::MessageLoan>(
+                    std::move(data));
+                auto& data_ = loan->data();
+                void* handle = api::PublicObjectRegister::add(loan);
+                loan.reset();
+
+                handlerFn(YOGI_OK, data_.data(),
+                    static_cast<unsigned>(data_.size()),
+                    cached ? 1 : 0, handle, userArg);
+        });
+    }, __FUNCTION__, terminal, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_CancelReceiveMessageLoan(void* terminal)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            interfaces::IMessageReceiver>(terminal);
+
+        terminal_.cancel_receive_published_message_loan();
+    }, __FUNCTION__, terminal);
+}
+
+YOGI_API int YOGI_ReleaseMessageLoan(void* loan)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(loan);
+
+    return evaluate([&] {
+        api::PublicObjectRegister::get_s<api::MessageLoan>(loan);
+        api::PublicObjectRegister::destroy(loan);
+    }, __FUNCTION__, loan);
+}
+
+YOGI_API int YOGI_CreateBinding(void** binding, void* terminal,
+    const char* targets)
+{
+    return YOGI_CreateBindingEx(binding, terminal, targets, 0);
+}
+
+YOGI_API int YOGI_CreateBindingEx(void** binding, void* terminal,
+    const char* targets, int flags)
+{
+    CHECK_INITIALIZED();
+    CHECK_PARAM(binding);
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(targets);
+    CHECK_PARAM(*targets != '\0');
+
+    return evaluate([&] {
+        CHECK_FLAGS_THROW(flags, YOGI_BF_WILDCARD);
+        bool wildcard = !!(flags & YOGI_BF_WILDCARD);
+
+        auto& terminal_ = api::PublicObjectRegister::get_s<interfaces::ITerminal>(
+            terminal);
+
+        if (dynamic_cast<core::deaf_mute::Terminal<>*>(&terminal_)) {
+            typedef core::deaf_mute::Terminal<>                  tm_type;
+            typedef core::BindingT<core::deaf_mute::LeafLogic<>> bd_type;
+
+            *binding = api::PublicObjectRegister::create<bd_type>(
+                static_cast<tm_type&>(terminal_), targets, false, wildcard);
+        }
+        else if (dynamic_cast<core::publish_subscribe::Terminal<>*>(&terminal_)) {
+            typedef core::publish_subscribe::Terminal<>                  tm_type;
+            typedef core::BindingT<core::publish_subscribe::LeafLogic<>> bd_type;
+
+            *binding = api::PublicObjectRegister::create<bd_type>(
+                static_cast<tm_type&>(terminal_), targets, false, wildcard);
+        }
+        else if (dynamic_cast<core::scatter_gather::Terminal<>*>(&terminal_)) {
+            typedef core::scatter_gather::Terminal<>                  tm_type;
+            typedef core::BindingT<core::scatter_gather::LeafLogic<>> bd_type;
+
+            *binding = api::PublicObjectRegister::create<bd_type>(
+                static_cast<tm_type&>(terminal_), targets, false, wildcard);
+        }
+        else if (dynamic_cast<core::cached_publish_subscribe::Terminal<>*>(&terminal_)) {
+            typedef core::cached_publish_subscribe::Terminal<>                  tm_type;
+            typedef core::BindingT<core::cached_publish_subscribe::LeafLogic<>> bd_type;
+
+            *binding = api::PublicObjectRegister::create<bd_type>(
+                static_cast<tm_type&>(terminal_), targets, false, wildcard);
+        }
+        else {
+            throw api::ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
+        }
+    }, __FUNCTION__, binding, terminal, targets, flags);
+}
+
+YOGI_API int YOGI_GetBindingState(void* object, int* state)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(object);
+    CHECK_PARAM(state);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
+            object);
+
+        *state = state_to_int(binding_.state());
+    }, __FUNCTION__, object, state);
+}
+
+YOGI_API int YOGI_AsyncGetBindingState(void* binding,
+    void (*handlerFn)(int, int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
+            binding);
+
+        binding_.async_get_state([=](const api::Exception& e,
+            interfaces::IBinding::state_t state) {
+                handlerFn(e.error_code(), state_to_int(state), userArg);
+        });
+    }, __FUNCTION__, binding, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_AsyncAwaitBindingStateChange(void* binding,
+    void (*handlerFn)(int, int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
+            binding);
+
+        binding_.async_await_state_change([=](const api::Exception& e,
+            interfaces::IBinding::state_t state) {
                 handlerFn(e.error_code(), state_to_int(state), userArg);
         });
     }, __FUNCTION__, binding, handlerFn, userArg);
@@ -748,6 +1241,43 @@ YOGI_API int YOGI_CancelAwaitBindingStateChange(void* binding)
     }, __FUNCTION__, binding);
 }
 
+YOGI_API int YOGI_RequestReplay(void* binding, unsigned maxMessages,
+    unsigned long long since)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<interfaces::IBinding>(
+            binding);
+
+        base::MessageHistory::clock::time_point since_;
+        if (since) {
+            since_ += std::chrono::duration_cast<
+                base::MessageHistory::clock::duration>(
+                    std::chrono::nanoseconds{since});
+        }
+
+        auto& terminal = binding_.terminal();
+        auto n = static_cast<std::size_t>(maxMessages);
+        if (auto tm = dynamic_cast<core::cached_publish_subscribe
+            ::Terminal<>*>(&terminal)) {
+            tm->request_replay(binding_.group_id(), n, since_);
+        }
+        else if (auto tm = dynamic_cast<core::cached_producer_consumer
+            ::Terminal<>*>(&terminal)) {
+            tm->request_replay(binding_.group_id(), n, since_);
+        }
+        else if (auto tm = dynamic_cast<core::cached_master_slave
+            ::Terminal<>*>(&terminal)) {
+            tm->request_replay(binding_.group_id(), n, since_);
+        }
+        else {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+    }, __FUNCTION__, binding, maxMessages, since);
+}
+
 YOGI_API int YOGI_CreateLocalConnection(void** connection, void* leafNodeA,
     void* leafNodeB)
 {
@@ -802,9 +1332,9 @@ YOGI_API int YOGI_AsyncTcpAccept(void* tcpServer, int hsTimeout,
 
 		server_.async_accept([=](const api::Exception& e,
 			connections::tcp::tcp_connection_ptr conn) {
-            void* connection = conn.get();
+            void* connection = nullptr;
 				if (conn) {
-					api::PublicObjectRegister::add(conn);
+					connection = api::PublicObjectRegister::add(conn);
                conn.reset();
 				}
 				handlerFn(e.error_code(), connection, userArg);
@@ -861,9 +1391,9 @@ YOGI_API int YOGI_AsyncTcpConnect(void* tcpClient, const char* host,
 		client_.async_connect(host, static_cast<unsigned short>(port),
 			[=](const api::Exception& e,
 			connections::tcp::tcp_connection_ptr conn) {
-            void* connection = conn.get();
+            void* connection = nullptr;
 				if (conn) {
-					api::PublicObjectRegister::add(conn);
+					connection = api::PublicObjectRegister::add(conn);
                conn.reset();
 				}
 				handlerFn(e.error_code(), connection, userArg);
@@ -980,6 +1510,39 @@ YOGI_API int YOGI_AssignConnection(void* connection, void* leafNode,
 	}, __FUNCTION__, connection, leafNode, timeout);
 }
 
+YOGI_API int YOGI_AssignMultiplexedConnection(void* connection, int timeout)
+{
+	CHECK_INITIALIZED();
+	CHECK_HANDLE(connection);
+	CHECK_PARAM(timeout == -1 || timeout > 0);
+
+	return evaluate([&] {
+		auto& connection_ = api::PublicObjectRegister::get_s<
+			connections::tcp::TcpConnection>(connection);
+
+		connection_.assign_multiplexed(int_to_timeout(timeout));
+	}, __FUNCTION__, connection, timeout);
+}
+
+YOGI_API int YOGI_CreateTcpChannel(void** channel, void* connection,
+    void* leafNode)
+{
+	CHECK_INITIALIZED();
+	CHECK_PARAM(channel);
+	CHECK_HANDLE(connection);
+	CHECK_HANDLE(leafNode);
+
+	return evaluate([&] {
+		auto& connection_ = api::PublicObjectRegister::get_s<
+			connections::tcp::TcpConnection>(connection);
+		auto& communicator_ = api::PublicObjectRegister::get_s<
+			interfaces::ICommunicator>(leafNode);
+
+		*channel = api::PublicObjectRegister::create<
+			connections::tcp::TcpChannel>(connection_, communicator_);
+	}, __FUNCTION__, channel, connection, leafNode);
+}
+
 YOGI_API int YOGI_AsyncAwaitConnectionDeath(void* connection,
 	void (*handlerFn)(int, void*), void* userArg)
 {
@@ -989,11 +1552,23 @@ YOGI_API int YOGI_AsyncAwaitConnectionDeath(void* connection,
 
 	return evaluate([&] {
 		auto& connection_ = api::PublicObjectRegister::get_s<
-			connections::tcp::TcpConnection>(connection);
+			interfaces::IConnectionLike>(connection);
 
-		connection_.async_await_death([=](const api::Exception& e) {
+		auto fn = [=](const api::Exception& e) {
 			handlerFn(e.error_code(), userArg);
-		});
+		};
+
+		if (auto conn = dynamic_cast<connections::tcp::TcpConnection*>(
+			&connection_)) {
+			conn->async_await_death(fn);
+		}
+		else if (auto ch = dynamic_cast<connections::tcp::TcpChannel*>(
+			&connection_)) {
+			ch->async_await_death(fn);
+		}
+		else {
+			throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+		}
 	}, __FUNCTION__, connection, handlerFn, userArg);
 }
 
@@ -1004,9 +1579,19 @@ YOGI_API int YOGI_CancelAwaitConnectionDeath(void* connection)
 
 	return evaluate([&] {
 		auto& connection_ = api::PublicObjectRegister::get_s<
-			connections::tcp::TcpConnection>(connection);
+			interfaces::IConnectionLike>(connection);
 
-		connection_.cancel_await_death();
+		if (auto conn = dynamic_cast<connections::tcp::TcpConnection*>(
+			&connection_)) {
+			conn->cancel_await_death();
+		}
+		else if (auto ch = dynamic_cast<connections::tcp::TcpChannel*>(
+			&connection_)) {
+			ch->cancel_await_death();
+		}
+		else {
+			throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+		}
 	}, __FUNCTION__, connection);
 }
 
@@ -1028,6 +1613,66 @@ YOGI_API int YOGI_PS_Publish(void* terminal, const void* buffer,
     }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
+YOGI_API int YOGI_PS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
+}
+
+YOGI_API int YOGI_PS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_PS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
 YOGI_API int YOGI_PS_AsyncReceiveMessage(void* terminal, void* buffer,
     unsigned bufferSize, void (*handlerFn)(int, unsigned, void*),
     void* userArg)
@@ -1063,14 +1708,163 @@ YOGI_API int YOGI_PS_CancelReceiveMessage(void* terminal)
     }, __FUNCTION__, terminal);
 }
 
+YOGI_API int YOGI_PS_SetReceiveWindow(void* binding, unsigned window)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<
+            interfaces::IBinding>(binding);
+
+        auto terminal_ = dynamic_cast<core::publish_subscribe::Terminal<>*>(
+            &binding_.terminal());
+        if (!terminal_) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        terminal_->set_receive_window(binding_.group_id(),
+            static_cast<std::size_t>(window));
+    }, __FUNCTION__, binding, window);
+}
+
+YOGI_API int YOGI_PS_GetAvailableCredit(void* terminal, int* credit)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(credit);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        *credit = terminal_.available_credit();
+    }, __FUNCTION__, terminal, credit);
+}
+
+YOGI_API int YOGI_PS_AsyncAwaitCreditChange(void* terminal,
+    void (*handlerFn)(int, int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        terminal_.async_await_credit_change([=](const api::Exception& e,
+            int credit) {
+            handlerFn(e.error_code(), credit, userArg);
+        });
+    }, __FUNCTION__, terminal, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_PS_CancelAwaitCreditChange(void* terminal)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::publish_subscribe::Terminal<>>(terminal);
+
+        terminal_.cancel_await_credit_change();
+    }, __FUNCTION__, terminal);
+}
+
+YOGI_API int YOGI_PS_SetDecimation(void* binding, int mode, unsigned value)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+    CHECK_PARAM(mode == YOGI_DC_NONE || mode == YOGI_DC_CONFLATE
+        || mode == YOGI_DC_EVERYNTH);
+    CHECK_PARAM(mode == YOGI_DC_NONE || value > 0);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<
+            interfaces::IBinding>(binding);
+
+        auto terminal_ = dynamic_cast<core::publish_subscribe::Terminal<>*>(
+            &binding_.terminal());
+        if (!terminal_) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        auto n = static_cast<std::size_t>(value);
+        terminal_->set_decimation(binding_.group_id(),
+            mode == YOGI_DC_CONFLATE ? n : 0,
+            mode == YOGI_DC_EVERYNTH ? n : 0);
+    }, __FUNCTION__, binding, mode, value);
+}
+
+YOGI_API int YOGI_PS_AddFilterMask(void* binding, unsigned offset,
+    const void* value, const void* mask, unsigned size)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+    CHECK_PARAM(value != nullptr);
+    CHECK_PARAM(size > 0);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<
+            interfaces::IBinding>(binding);
+
+        get_ps_terminal_of_binding(binding_).add_filter_condition(
+            binding_.group_id(), core::publish_subscribe::ContentFilter
+                ::make_mask_condition(offset, value, mask, size));
+    }, __FUNCTION__, binding, offset, value, mask, size);
+}
+
+YOGI_API int YOGI_PS_AddFilterRange(void* binding, unsigned offset,
+    unsigned width, unsigned long long min, unsigned long long max)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+    CHECK_PARAM(width > 0 && width <= 8);
+    CHECK_PARAM(min <= max);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<
+            interfaces::IBinding>(binding);
+
+        get_ps_terminal_of_binding(binding_).add_filter_condition(
+            binding_.group_id(), core::publish_subscribe::ContentFilter
+                ::make_range_condition(offset, width, min, max));
+    }, __FUNCTION__, binding, offset, width, min, max);
+}
+
+YOGI_API int YOGI_PS_ClearFilter(void* binding)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(binding);
+
+    return evaluate([&] {
+        auto& binding_ = api::PublicObjectRegister::get_s<
+            interfaces::IBinding>(binding);
+
+        get_ps_terminal_of_binding(binding_).clear_filter(binding_.group_id());
+    }, __FUNCTION__, binding);
+}
+
 YOGI_API int YOGI_SG_AsyncScatterGather(void* terminal, const void* scatBuf,
     unsigned scatSize, void* gathBuf, unsigned gathSize,
     int (*handlerFn)(int, int, int, unsigned, void*), void* userArg)
+{
+    return YOGI_SG_AsyncScatterGatherEx(terminal, scatBuf, scatSize, gathBuf,
+        gathSize, -1, 0, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_SG_AsyncScatterGatherEx(void* terminal, const void* scatBuf,
+    unsigned scatSize, void* gathBuf, unsigned gathSize, int timeout,
+    unsigned quorum, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg)
 {
     CHECK_INITIALIZED();
     CHECK_HANDLE(terminal);
     CHECK_PARAM(scatBuf != nullptr || scatSize == 0);
     CHECK_PARAM(gathBuf != nullptr || gathSize == 0);
+    CHECK_PARAM(timeout == -1 || timeout > 0);
     CHECK_PARAM(handlerFn);
 
     return evaluate([&] {
@@ -1087,11 +1881,52 @@ YOGI_API int YOGI_SG_AsyncScatterGather(void* terminal, const void* scatBuf,
                     static_cast<int>(operationId.number()),
                     static_cast<int>(flags),
                     static_cast<unsigned>(size), userArg);
-        });
+        }, std::chrono::milliseconds{timeout == -1 ? 0 : timeout},
+            static_cast<std::size_t>(quorum));
+
+        return static_cast<int>(id.number());
+    }, __FUNCTION__, terminal, scatBuf, scatSize, gathBuf, gathSize, timeout,
+        quorum, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_SG_AsyncScatterGatherBatched(void* terminal,
+    const void* scatBuf, unsigned scatSize, void* gathBuf, unsigned gathSize,
+    int timeout, unsigned quorum, int aggregation,
+    int (*handlerFn)(int, int, int, unsigned, unsigned, void*),
+    void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(scatBuf != nullptr || scatSize == 0);
+    CHECK_PARAM(gathBuf != nullptr || gathSize == 0);
+    CHECK_PARAM(timeout == -1 || timeout > 0);
+    CHECK_PARAM(aggregation == YOGI_SG_AGGREGATE_UNTIL_FINISHED
+        || aggregation >= 0);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::scatter_gather::Terminal<>>(terminal);
+        auto gathBuf_ = boost::asio::buffer(gathBuf, static_cast<std::size_t>(
+            gathSize));
+
+        base::Id id = terminal_.async_scatter_gather_batched(base::Buffer{
+            scatBuf, static_cast<std::size_t>(scatSize)}, gathBuf_, [=](
+            const api::Exception& e, base::Id operationId,
+            core::scatter_gather::gather_flags flags, std::size_t numResponses,
+            std::size_t size) {
+                return !handlerFn(e.error_code(),
+                    static_cast<int>(operationId.number()),
+                    static_cast<int>(flags),
+                    static_cast<unsigned>(numResponses),
+                    static_cast<unsigned>(size), userArg);
+        }, std::chrono::milliseconds{timeout == -1 ? 0 : timeout},
+            static_cast<std::size_t>(quorum), aggregation != 0,
+            std::chrono::milliseconds{aggregation > 0 ? aggregation : 0});
 
         return static_cast<int>(id.number());
-    }, __FUNCTION__, terminal, scatBuf, scatSize, gathBuf, gathSize, handlerFn,
-        userArg);
+    }, __FUNCTION__, terminal, scatBuf, scatSize, gathBuf, gathSize, timeout,
+        quorum, aggregation, handlerFn, userArg);
 }
 
 YOGI_API int YOGI_SG_CancelScatterGather(void* terminal, int operationId)
@@ -1198,6 +2033,66 @@ YOGI_API int YOGI_CPS_Publish(void* terminal, const void* buffer,
     }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
+YOGI_API int YOGI_CPS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
+}
+
+YOGI_API int YOGI_CPS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_CPS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_publish_subscribe::Terminal<>>(terminal);
+
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
 YOGI_API int YOGI_CPS_GetCachedMessage(void* terminal, void* buffer,
     unsigned bufferSize, unsigned* bytesWritten)
 {
@@ -1232,42 +2127,114 @@ YOGI_API int YOGI_CPS_AsyncReceiveMessage(void* terminal, void* buffer,
 {
     CHECK_INITIALIZED();
     CHECK_HANDLE(terminal);
-    CHECK_BUFFER(buffer, bufferSize);
-    CHECK_PARAM(handlerFn);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_publish_subscribe::Terminal<>>(terminal);
+        auto buffer_ = boost::asio::buffer(buffer, static_cast<std::size_t>(
+            bufferSize));
+
+        terminal_.async_receive_published_message(buffer_, [=](
+            const api::Exception& e, std::size_t size, bool cached) {
+            handlerFn(e.error_code(), static_cast<unsigned>(size),
+                cached ? 1 : 0, userArg);
+        });
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_CPS_CancelReceiveMessage(void* terminal)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_publish_subscribe::Terminal<>>(terminal);
+
+        terminal_.cancel_receive_published_message();
+    }, __FUNCTION__, terminal);
+}
+
+YOGI_API int YOGI_PC_Publish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::producer_consumer::Terminal<>>(terminal);
+
+        // allow only Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_PC_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
 
     return evaluate([&] {
         auto& terminal_ = api::PublicObjectRegister::get_s<
-            core::cached_publish_subscribe::Terminal<>>(terminal);
-        auto buffer_ = boost::asio::buffer(buffer, static_cast<std::size_t>(
-            bufferSize));
+            core::producer_consumer::Terminal<>>(terminal);
 
-        terminal_.async_receive_published_message(buffer_, [=](
-            const api::Exception& e, std::size_t size, bool cached) {
-            handlerFn(e.error_code(), static_cast<unsigned>(size),
-                cached ? 1 : 0, userArg);
-        });
-    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+        // allow only Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
 }
 
-YOGI_API int YOGI_CPS_CancelReceiveMessage(void* terminal)
+YOGI_API int YOGI_PC_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
 {
     CHECK_INITIALIZED();
     CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
 
     return evaluate([&] {
         auto& terminal_ = api::PublicObjectRegister::get_s<
-            core::cached_publish_subscribe::Terminal<>>(terminal);
+            core::producer_consumer::Terminal<>>(terminal);
 
-        terminal_.cancel_receive_published_message();
-    }, __FUNCTION__, terminal);
+        // allow only Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
-YOGI_API int YOGI_PC_Publish(void* terminal, const void* buffer,
-    unsigned bufferSize)
+YOGI_API int YOGI_PC_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
 {
     CHECK_INITIALIZED();
     CHECK_HANDLE(terminal);
     CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
 
     return evaluate([&] {
         auto& terminal_ = api::PublicObjectRegister::get_s<
@@ -1278,11 +2245,14 @@ YOGI_API int YOGI_PC_Publish(void* terminal, const void* buffer,
             return YOGI_ERR_WRONG_OBJECT_TYPE;
         }
 
-        bool ok = terminal_.publish(base::Buffer{buffer,
-            static_cast<std::size_t>(bufferSize)});
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
 
         return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
-    }, __FUNCTION__, terminal, buffer, bufferSize);
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
 }
 
 YOGI_API int YOGI_PC_AsyncReceiveMessage(void* terminal, void* buffer,
@@ -1330,6 +2300,43 @@ YOGI_API int YOGI_PC_CancelReceiveMessage(void* terminal)
     }, __FUNCTION__, terminal);
 }
 
+YOGI_API int YOGI_PC_SetConsumerCapacity(void* terminal, unsigned capacity)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::producer_consumer::Terminal<>>(terminal);
+
+        // allow only Consumer Terminals
+        if (!terminal_.identifier().hidden()) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        terminal_.set_consumer_capacity(static_cast<std::size_t>(capacity));
+    }, __FUNCTION__, terminal, capacity);
+}
+
+YOGI_API int YOGI_PC_AcknowledgeMessages(void* terminal, unsigned numMessages)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(numMessages > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::producer_consumer::Terminal<>>(terminal);
+
+        // allow only Consumer Terminals
+        if (!terminal_.identifier().hidden()) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        terminal_.acknowledge_messages(static_cast<std::size_t>(numMessages));
+    }, __FUNCTION__, terminal, numMessages);
+}
+
 YOGI_API int YOGI_CPC_Publish(void* terminal, const void* buffer,
     unsigned bufferSize)
 {
@@ -1353,6 +2360,81 @@ YOGI_API int YOGI_CPC_Publish(void* terminal, const void* buffer,
     }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
+YOGI_API int YOGI_CPC_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_producer_consumer::Terminal<>>(terminal);
+
+        // allow only Cached Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
+}
+
+YOGI_API int YOGI_CPC_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_producer_consumer::Terminal<>>(terminal);
+
+        // allow only Cached Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_CPC_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_producer_consumer::Terminal<>>(terminal);
+
+        // allow only Cached Producer Terminals
+        if (terminal_.identifier().hidden()) {
+            return YOGI_ERR_WRONG_OBJECT_TYPE;
+        }
+
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
 YOGI_API int YOGI_CPC_GetCachedMessage(void* terminal, void* buffer,
     unsigned bufferSize, unsigned* bytesWritten)
 {
@@ -1450,6 +2532,66 @@ YOGI_API int YOGI_MS_Publish(void* terminal, const void* buffer,
     }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
+YOGI_API int YOGI_MS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
+}
+
+YOGI_API int YOGI_MS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_MS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
 YOGI_API int YOGI_MS_AsyncReceiveMessage(void* terminal, void* buffer,
     unsigned bufferSize, void (*handlerFn)(int, unsigned, void*),
     void* userArg)
@@ -1503,6 +2645,66 @@ YOGI_API int YOGI_CMS_Publish(void* terminal, const void* buffer,
     }, __FUNCTION__, terminal, buffer, bufferSize);
 }
 
+YOGI_API int YOGI_CMS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(buffers);
+    CHECK_PARAM(bufferSizes);
+    CHECK_PARAM(numBuffers > 0);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.publish_batch(make_batch_buffers(buffers,
+            bufferSizes, numBuffers));
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffers, bufferSizes, numBuffers);
+}
+
+YOGI_API int YOGI_CMS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.try_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)});
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize);
+}
+
+YOGI_API int YOGI_CMS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_BUFFER(buffer, bufferSize);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::cached_master_slave::Terminal<>>(terminal);
+
+        bool ok = terminal_.async_publish(base::Buffer{buffer,
+            static_cast<std::size_t>(bufferSize)},
+            [=](const api::Exception& e) {
+                handlerFn(e.error_code(), userArg);
+            });
+
+        return ok ? YOGI_OK : YOGI_ERR_NOT_BOUND;
+    }, __FUNCTION__, terminal, buffer, bufferSize, handlerFn, userArg);
+}
+
 YOGI_API int YOGI_CMS_GetCachedMessage(void* terminal, void* buffer,
     unsigned bufferSize, unsigned* bytesWritten)
 {
@@ -1570,11 +2772,21 @@ YOGI_API int YOGI_CMS_CancelReceiveMessage(void* terminal)
 YOGI_API int YOGI_SC_AsyncRequest(void* terminal, const void* reqBuf,
     unsigned reqSize, void* respBuf, unsigned respSize,
     int (*handlerFn)(int, int, int, unsigned, void*), void* userArg)
+{
+    return YOGI_SC_AsyncRequestEx(terminal, reqBuf, reqSize, respBuf, respSize,
+        -1, 0, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_SC_AsyncRequestEx(void* terminal, const void* reqBuf,
+    unsigned reqSize, void* respBuf, unsigned respSize, int timeout,
+    unsigned quorum, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg)
 {
     CHECK_INITIALIZED();
     CHECK_HANDLE(terminal);
     CHECK_PARAM(reqBuf != nullptr || reqSize == 0);
     CHECK_PARAM(respBuf != nullptr || respSize == 0);
+    CHECK_PARAM(timeout == -1 || timeout > 0);
     CHECK_PARAM(handlerFn);
 
     return evaluate([&] {
@@ -1596,11 +2808,54 @@ YOGI_API int YOGI_SC_AsyncRequest(void* terminal, const void* reqBuf,
                 static_cast<int>(operationId.number()),
                 static_cast<int>(flags),
                 static_cast<unsigned>(size), userArg);
-        });
+        }, std::chrono::milliseconds{timeout == -1 ? 0 : timeout},
+            static_cast<std::size_t>(quorum));
+
+        return static_cast<int>(id.number());
+    }, __FUNCTION__, terminal, reqBuf, reqSize, respBuf, respSize, timeout,
+        quorum, handlerFn, userArg);
+}
+
+YOGI_API int YOGI_SC_AsyncAnycastRequest(void* terminal, const void* reqBuf,
+    unsigned reqSize, void* respBuf, unsigned respSize, int policy,
+    int timeout, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg)
+{
+    CHECK_INITIALIZED();
+    CHECK_HANDLE(terminal);
+    CHECK_PARAM(reqBuf != nullptr || reqSize == 0);
+    CHECK_PARAM(respBuf != nullptr || respSize == 0);
+    CHECK_PARAM(policy == YOGI_LB_ROUNDROBIN
+        || policy == YOGI_LB_LEASTOUTSTANDING
+        || policy == YOGI_LB_LOWESTLATENCY);
+    CHECK_PARAM(timeout == -1 || timeout > 0);
+    CHECK_PARAM(handlerFn);
+
+    return evaluate([&] {
+        auto& terminal_ = api::PublicObjectRegister::get_s<
+            core::service_client::Terminal<>>(terminal);
+        auto respBuf_ = boost::asio::buffer(respBuf, static_cast<std::size_t>(
+            respSize));
+
+        // allow only Client Terminals
+        if (!terminal_.identifier().hidden()) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        base::Id id = terminal_.async_scatter_gather(base::Buffer{reqBuf,
+            static_cast<std::size_t>(reqSize)}, respBuf_, [=](
+                const api::Exception& e, base::Id operationId,
+                core::scatter_gather::gather_flags flags, std::size_t size) {
+            return !handlerFn(e.error_code(),
+                static_cast<int>(operationId.number()),
+                static_cast<int>(flags),
+                static_cast<unsigned>(size), userArg);
+        }, std::chrono::milliseconds{timeout == -1 ? 0 : timeout}, 0,
+            static_cast<core::scatter_gather::anycast_policy>(policy));
 
         return static_cast<int>(id.number());
-    }, __FUNCTION__, terminal, reqBuf, reqSize, respBuf, respSize, handlerFn,
-        userArg);
+    }, __FUNCTION__, terminal, reqBuf, reqSize, respBuf, respSize, policy,
+        timeout, handlerFn, userArg);
 }
 
 YOGI_API int YOGI_SC_CancelRequest(void* terminal, int operationId)
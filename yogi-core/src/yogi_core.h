@@ -125,6 +125,33 @@
 //! Not yet initialized
 #define YOGI_ERR_UNINITIALIZED -38
 
+//! The change cursor refers to changes that are no longer recorded
+#define YOGI_ERR_CURSOR_EXPIRED -39
+
+//! Setting the CPU affinity of a thread failed
+#define YOGI_ERR_SET_AFFINITY_FAILED -40
+
+//! The function cannot be called from the current thread
+#define YOGI_ERR_WRONG_THREAD -41
+
+//! Changing the scheduling policy of a thread failed
+#define YOGI_ERR_SET_PRIORITY_FAILED -42
+
+//! Locking the memory of the process failed
+#define YOGI_ERR_LOCK_MEMORY_FAILED -43
+
+//! The operation would block
+#define YOGI_ERR_WOULD_BLOCK -44
+
+//! Opening or creating a file failed
+#define YOGI_ERR_CANNOT_OPEN_FILE -45
+
+//! The connection has not been assigned as a multiplexed connection
+#define YOGI_ERR_NOT_MULTIPLEXED -46
+
+//! The message is too large to be sent without blocking
+#define YOGI_ERR_MESSAGE_TOO_LARGE -47
+
 //! @}
 //!
 //! @defgroup VERBOSITY Log verbosity
@@ -297,6 +324,56 @@
 //! The connection between the local and the remote Leaf has been lost.
 #define YOGI_SG_CONNECTIONLOST (1<<4)
 
+//! The deadline of the scatter-gather operation has been reached.
+#define YOGI_SG_TIMEOUT (1<<5)
+
+//! The requested number of responses has been received.
+#define YOGI_SG_QUORUM (1<<6)
+
+//! Size of the header preceding each response written by
+//! YOGI_SG_AsyncScatterGatherBatched().
+//!
+//! The header consists of the payload size as a 32 bit unsigned integer in
+//! native byte order followed by a byte holding the response's flags.
+#define YOGI_SG_RESPONSE_HEADER_SIZE 5
+
+//! Nodes hold the responses back until the operation has finished.
+#define YOGI_SG_AGGREGATE_UNTIL_FINISHED -1
+
+//! @}
+//!
+//! @defgroup LBPOLICIES Load balancing policies
+//!
+//! Policies for picking the single service answering an anycast request.
+//!
+//! @{
+
+//! Services take turns in answering requests.
+#define YOGI_LB_ROUNDROBIN 1
+
+//! The service with the fewest unanswered requests gets picked.
+#define YOGI_LB_LEASTOUTSTANDING 2
+
+//! The service that has been answering the fastest recently gets picked.
+#define YOGI_LB_LOWESTLATENCY 3
+
+//! @}
+//!
+//! @defgroup DECIMATIONMODES Decimation modes
+//!
+//! Ways for a Node to reduce the rate of messages sent to a Binding.
+//!
+//! @{
+
+//! Every message gets sent.
+#define YOGI_DC_NONE 0
+
+//! The latest message gets sent at most once per interval.
+#define YOGI_DC_CONFLATE 1
+
+//! Only every Nth message gets sent.
+#define YOGI_DC_EVERYNTH 2
+
 //! @}
 //!
 //! @defgroup CTRLFLOW Control flow commands
@@ -322,6 +399,17 @@
 //! The Binding is established
 #define YOGI_BD_ESTABLISHED 1
 
+//! @}
+//!
+//! @defgroup BINDFLAGS Binding flags
+//!
+//! Flags for creating Bindings via YOGI_CreateBindingEx().
+//!
+//! @{
+
+//! Interpret the targets as a glob pattern instead of a Terminal name
+#define YOGI_BF_WILDCARD (1<<0)
+
 //! @}
 //!
 //! @defgroup SUBSTATES Subscription states
@@ -336,6 +424,126 @@
 //! Subscribed
 #define YOGI_SB_SUBSCRIBED 1
 
+//! @}
+//!
+//! @defgroup KTQUERYMODES Known terminals query modes
+//!
+//! Modes for querying the terminals known to a Node via
+//! YOGI_FindKnownTerminals().
+//!
+//! @{
+
+//! Match terminals whose name starts with the given pattern
+#define YOGI_KT_PREFIX 0
+
+//! Match terminals whose name contains the given pattern
+#define YOGI_KT_SUBSTRING (1<<0)
+
+//! Compare names case-insensitively (can be combined with the above modes)
+#define YOGI_KT_IGNORECASE (1<<1)
+
+//! @}
+//!
+//! @defgroup SCHEDTYPES Scheduler types
+//!
+//! Scheduler implementations that can be chosen via YOGI_CreateSchedulerEx().
+//!
+//! @{
+
+//! All threads of the pool share a single completion queue.
+//!
+//! This is the scheduler created by YOGI_CreateScheduler().
+#define YOGI_ST_SHAREDQUEUE 0
+
+//! Every thread runs its own event loop and idle threads steal work.
+//!
+//! Connections and other objects are assigned to the event loops in a
+//! round-robin fashion and their handlers preferably run on the thread owning
+//! that event loop. Threads without work of their own execute handlers from
+//! other event loops.
+#define YOGI_ST_WORKSTEALING 1
+
+//! Idle threads poll for work for a while before they block.
+//!
+//! Handlers that become ready while a thread is polling get executed without
+//! waking up a blocked thread first, which reduces latency at the cost of CPU
+//! time. The polling duration can be set via YOGI_SetSchedulerSpinDuration().
+#define YOGI_ST_BUSYPOLL 2
+
+//! @}
+//!
+//! @defgroup HANDLERCATEGORIES Handler categories
+//!
+//! Categories of handlers executed by a scheduler that scheduler statistics
+//! are broken down by (see YOGI_GetSchedulerStatistics()).
+//!
+//! @{
+
+//! Processing of data received from a TCP connection
+#define YOGI_HC_TCPRECEIVE 0
+
+//! Deserialization of messages received from a TCP connection
+#define YOGI_HC_DESERIALIZE 1
+
+//! Dispatching received messages within a Leaf or Node
+#define YOGI_HC_DISPATCH 2
+
+//! Completion handlers passed to the library by the user
+#define YOGI_HC_USERCALLBACK 3
+
+//! All other handlers
+#define YOGI_HC_OTHER 4
+
+//! Number of buckets in a scheduler statistics histogram.
+//!
+//! Bucket 0 counts durations below 1 microsecond and bucket i counts durations
+//! of at least 2^(i-1) and less than 2^i microseconds. The last bucket also
+//! counts all durations longer than that.
+#define YOGI_HISTOGRAM_BUCKETS 32
+
+//! @}
+//!
+//! @defgroup OVERFLOWPOLICIES Callback queue overflow policies
+//!
+//! Behaviour of a scheduler's callback executor if its queue is full (see
+//! YOGI_SetSchedulerCallbackExecutor()).
+//!
+//! @{
+
+//! The scheduler thread firing the callback waits until there is space in the
+//! queue.
+//!
+//! This throttles I/O and message routing while the user callbacks cannot keep
+//! up. Callbacks must not wait for operations on the object that fired them
+//! since the waiting scheduler thread may hold a lock on that object.
+#define YOGI_OP_BLOCK 0
+
+//! The scheduler thread firing the callback executes it directly.
+#define YOGI_OP_RUNINLINE 1
+
+//! @}
+//!
+//! @defgroup RECEIVEQUEUEPOLICIES Receive queue overflow policies
+//!
+//! Behaviour of a Terminal's receive queue if a message arrives while the
+//! queue is full (see YOGI_SetReceiveQueue()).
+//!
+//! @{
+
+//! The oldest queued message gets dropped in favour of the new message.
+#define YOGI_RQ_DROPOLDEST 0
+
+//! The new message gets dropped.
+#define YOGI_RQ_DROPNEWEST 1
+
+//! Size of the header preceding each message written by
+//! YOGI_AsyncReceiveMessages().
+//!
+//! The header consists of the payload size as a 32 bit unsigned integer in
+//! native byte order followed by a flags byte which is 1 for cached messages
+//! and 0 otherwise.
+#define YOGI_RQ_MESSAGE_HEADER_SIZE 5
+
 //! @}
 
 #ifndef YOGI_API
@@ -450,6 +658,22 @@ YOGI_API int YOGI_Destroy(void* object);
  ******************************************************************************/
 YOGI_API int YOGI_CreateScheduler(void** scheduler);
 
+/***************************************************************************//**
+ * Creates a new scheduler of a specific type.
+ *
+ * Works like YOGI_CreateScheduler() but allows choosing the scheduler
+ * implementation (see \ref SCHEDTYPES). The work-stealing scheduler scales
+ * better with many threads and connections since there is no single
+ * completion queue that all threads contend on.
+ *
+ * @param[out] scheduler Pointer to the scheduler handle
+ * @param[in]  type      Scheduler type (see \ref SCHEDTYPES)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CreateSchedulerEx(void** scheduler, int type);
+
 /***************************************************************************//**
  * Sets the number of threads in a scheduler's thread pool.
  *
@@ -462,6 +686,182 @@ YOGI_API int YOGI_CreateScheduler(void** scheduler);
 YOGI_API int YOGI_SetSchedulerThreadPoolSize(void* scheduler,
     unsigned numThreads);
 
+/***************************************************************************//**
+ * Enables or disables automatic scaling of a scheduler's thread pool.
+ *
+ * While enabled, the scheduler measures the delay between handlers becoming
+ * ready and their execution. If this queue delay stays above \p queueDelayUs
+ * microseconds, the thread pool grows by one thread. If at least one thread
+ * has been waiting for work during a period of \p idleTimeoutMs milliseconds,
+ * the thread pool shrinks by one thread. The number of threads always stays
+ * between \p minThreads and \p maxThreads.
+ *
+ * Passing zero for \p maxThreads disables automatic scaling and the thread
+ * pool keeps its current size. YOGI_SetSchedulerThreadPoolSize() disables
+ * automatic scaling as well. This function only works with schedulers of type
+ * #YOGI_ST_SHAREDQUEUE.
+ *
+ * @param[in] scheduler     Scheduler handle
+ * @param[in] minThreads    Minimum number of threads
+ * @param[in] maxThreads    Maximum number of threads or zero
+ * @param[in] queueDelayUs  Queue delay threshold in microseconds
+ * @param[in] idleTimeoutMs Idle period in milliseconds
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetSchedulerAutoScaling(void* scheduler, unsigned minThreads,
+    unsigned maxThreads, unsigned queueDelayUs, unsigned idleTimeoutMs);
+
+/***************************************************************************//**
+ * Pins the threads of a scheduler's thread pool to CPUs.
+ *
+ * The i-th thread of the pool gets pinned to the CPU cpus[i % numCpus]. This
+ * also applies to threads that get created later when the thread pool grows.
+ * Passing zero for \p numCpus removes the pinning.
+ *
+ * @param[in] scheduler Scheduler handle
+ * @param[in] cpus      Indices of the CPUs to pin the threads to
+ * @param[in] numCpus   Number of elements in \p cpus
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetSchedulerCpuAffinity(void* scheduler, const int* cpus,
+    unsigned numCpus);
+
+/***************************************************************************//**
+ * Changes the scheduling policy of the threads in a scheduler's thread pool.
+ *
+ * A priority greater than zero makes the threads run under a real-time
+ * scheduling policy (SCHED_FIFO on Linux) with the given priority. This also
+ * applies to threads that get created later when the thread pool grows.
+ * Passing zero reverts the threads to the default policy. Using real-time
+ * policies usually requires special privileges.
+ *
+ * @param[in] scheduler Scheduler handle
+ * @param[in] priority  Real-time priority or zero
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetSchedulerRealtimePriority(void* scheduler, int priority);
+
+/***************************************************************************//**
+ * Sets how long idle threads of a busy-poll scheduler poll for work.
+ *
+ * Threads that run out of work keep polling for \p spinUs microseconds before
+ * they block. With a negative value, threads never block and fully occupy
+ * their CPUs. This function only works with schedulers of type
+ * #YOGI_ST_BUSYPOLL.
+ *
+ * @param[in] scheduler Scheduler handle
+ * @param[in] spinUs    Polling duration in microseconds
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetSchedulerSpinDuration(void* scheduler, int spinUs);
+
+/***************************************************************************//**
+ * Locks the memory of the process into RAM or unlocks it.
+ *
+ * Locking prevents all current and future pages of the process from being
+ * swapped out, so memory accesses never cause slow page faults. This requires
+ * special privileges and is only supported on POSIX systems.
+ *
+ * @param[in] lock Non-zero to lock and zero to unlock the memory
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_LockMemory(int lock);
+
+/***************************************************************************//**
+ * Enables or disables recording statistics in a scheduler.
+ *
+ * When enabled, the scheduler records how long handlers wait in its queue
+ * before they get executed and how long they run. Recording is disabled by
+ * default since it requires reading the clock twice per handler.
+ *
+ * Queue delays are only recorded for handlers that get queued by the library
+ * itself. Runtimes are inclusive, i.e. the runtime of a message dispatch
+ * includes the runtime of the user callbacks invoked during the dispatch.
+ *
+ * @param[in] scheduler Scheduler handle
+ * @param[in] enabled   Non-zero to enable and zero to disable recording
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_EnableSchedulerStatistics(void* scheduler, int enabled);
+
+/***************************************************************************//**
+ * Gets the statistics recorded by a scheduler for a category of handlers.
+ *
+ * Both \p queueDelays and \p runtimes must point to arrays with
+ * #YOGI_HISTOGRAM_BUCKETS elements. Each element receives the number of
+ * handlers whose queue delay or runtime fell into the corresponding bucket
+ * since statistics were last reset.
+ *
+ * @param[in]  scheduler   Scheduler handle
+ * @param[in]  category    Handler category (see \ref HANDLERCATEGORIES)
+ * @param[out] queueDelays Histogram of the queue delays
+ * @param[out] runtimes    Histogram of the runtimes
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_GetSchedulerStatistics(void* scheduler, int category,
+    unsigned long long* queueDelays, unsigned long long* runtimes);
+
+/***************************************************************************//**
+ * Resets the statistics recorded by a scheduler.
+ *
+ * @param[in] scheduler Scheduler handle
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_ResetSchedulerStatistics(void* scheduler);
+
+/***************************************************************************//**
+ * Configures the executor for user callbacks of a scheduler.
+ *
+ * By default, completion handlers passed to the library (e.g. to
+ * YOGI_PS_AsyncReceiveMessage()) get executed on the scheduler's threads, so a
+ * slow handler delays TCP reads and message routing. If \p numThreads is
+ * non-zero, these handlers get queued instead and executed on a separate pool
+ * of \p numThreads threads. The queue holds at most \p queueSize handlers;
+ * \p overflowPolicy defines what happens if the queue is full.
+ *
+ * Handlers of the same asynchronous operation on the same object never run
+ * concurrently and get executed in the order in which they have been fired,
+ * even if \p numThreads is larger than one. If other handlers of its
+ * operation are still pending, a handler waits for space in the queue
+ * regardless of \p overflowPolicy.
+ *
+ * Handlers whose return value is needed by the library, e.g. the handler for
+ * YOGI_SG_AsyncScatterGather(), always run on the scheduler's threads.
+ * Handlers fired from a user's thread, e.g. when canceling an operation, run on
+ * that thread.
+ *
+ * Queued handlers get executed before the executor gets reconfigured. Setting
+ * \p numThreads to zero disables the executor. This function must not be
+ * called from within a handler executed by the executor.
+ *
+ * @param[in] scheduler      Scheduler handle
+ * @param[in] numThreads     Number of threads for executing user callbacks
+ * @param[in] queueSize      Maximum number of queued callbacks
+ * @param[in] overflowPolicy Behaviour if the queue is full (see
+ *                           \ref OVERFLOWPOLICIES)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetSchedulerCallbackExecutor(void* scheduler,
+    unsigned numThreads, unsigned queueSize, int overflowPolicy);
+
 /***************************************************************************//**
  * Creates a Node.
  *
@@ -485,6 +885,8 @@ YOGI_API int YOGI_CreateNode(void** node, void* scheduler);
  *  -# Bytes 1-4: Signature of the terminal
  *  -# Bytes 5-N: Name of the terminal (NULL-terminated)
  *
+ * The terminals are ordered by name, then by type and then by signature.
+ *
  * @param[in]  node         Node handler
  * @param[out] buffer       Buffer to copy the information to
  * @param[in]  bufferSize   Size of the buffer
@@ -535,6 +937,121 @@ YOGI_API int YOGI_AsyncAwaitKnownTerminalsChange(void* node, void* buffer,
  ******************************************************************************/
 YOGI_API int YOGI_CancelAwaitKnownTerminalsChange(void* node);
 
+/***************************************************************************//**
+ * Finds terminals known to a node by name
+ *
+ * The matching terminals are written to \p buffer using the same structure
+ * and ordering as YOGI_GetKnownTerminals(). Matching terminals can be listed
+ * page-wise by using \p maxTerminals and passing the description of the last
+ * terminal of the previous page as \p startAfter. Since the next page starts
+ * after that terminal rather than at a position, terminals appearing or
+ * disappearing between two queries neither cause terminals to be skipped nor
+ * to be listed twice.
+ *
+ * The returned \p cursor reflects the state of the node's known terminals at
+ * the time of the query and can be passed to YOGI_GetKnownTerminalsChanges()
+ * in order to only fetch the changes since this query.
+ *
+ * If \p buffer is too small, as many terminals as possible will be written
+ * and #YOGI_ERR_BUFFER_TOO_SMALL will be returned.
+ *
+ * @param[in]  node         Node handle
+ * @param[in]  mode         Query mode (see \ref KTQUERYMODES)
+ * @param[in]  pattern      Prefix or substring to match terminal names with
+ * @param[in]  startAfter   Description of the terminal to continue after
+ *                          (NULL to start with the first matching terminal)
+ * @param[in]  maxTerminals Maximum number of terminals to write (0 = no limit)
+ * @param[out] buffer       Buffer to copy the information to
+ * @param[in]  bufferSize   Size of the buffer
+ * @param[out] numTerminals Number terminal descriptions written to \p buffer
+ * @param[out] cursor       Change cursor for the result (can be NULL)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_FindKnownTerminals(void* node, int mode,
+    const char* pattern, const void* startAfter, unsigned maxTerminals,
+    void* buffer, unsigned bufferSize, unsigned* numTerminals,
+    unsigned long long* cursor);
+
+/***************************************************************************//**
+ * Gets the changes of the terminals known to a node since a given cursor
+ *
+ * The changes are written to \p buffer in the order they happened, with a
+ * structure of each change as follows:
+ *  -# Byte 0: 0 = terminal removed; 1 = terminal added
+ *  -# Byte 1: Type of the terminal (see \ref TERMTYPES)
+ *  -# Bytes 2-5: Signature of the terminal
+ *  -# Bytes 6-N: Name of the terminal (NULL-terminated)
+ *
+ * On success, \p cursor is set to the cursor of the last change written to
+ * \p buffer. A cursor of 0 refers to the node's initial (empty) state. If
+ * \p buffer is too small, as many changes as possible will be written,
+ * \p cursor will be updated accordingly and #YOGI_ERR_BUFFER_TOO_SMALL will be
+ * returned.
+ *
+ * Only a limited number of changes is recorded. If \p cursor refers to
+ * changes that are no longer recorded, #YOGI_ERR_CURSOR_EXPIRED will be
+ * returned and the known terminals have to be queried again via
+ * YOGI_FindKnownTerminals().
+ *
+ * @param[in]     node       Node handle
+ * @param[in,out] cursor     Cursor of the last change seen by the caller
+ * @param[out]    buffer     Buffer to copy the information to
+ * @param[in]     bufferSize Size of the buffer
+ * @param[out]    numChanges Number of changes written to \p buffer
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_GetKnownTerminalsChanges(void* node,
+    unsigned long long* cursor, void* buffer, unsigned bufferSize,
+    unsigned* numChanges);
+
+/***************************************************************************//**
+ * Sets how many of the most recent messages a Node keeps for each Cached
+ * Publish-Subscribe, Cached Producer-Consumer and Cached Master-Slave Terminal.
+ *
+ * Bindings connected to the Node can request a replay of these messages via
+ * YOGI_RequestReplay(). The history of a Terminal evicts the oldest messages
+ * once either limit is exceeded. By default, Nodes do not keep a history.
+ * New limits take effect with the next message for a Terminal.
+ *
+ * @param[in] node        Node handle
+ * @param[in] maxMessages Maximum number of messages per Terminal (0 disables
+ *                        the history)
+ * @param[in] maxBytes    Maximum total size of the messages per Terminal (0 for
+ *                        no limit)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetHistoryLimits(void* node, unsigned maxMessages,
+    unsigned maxBytes);
+
+/***************************************************************************//**
+ * Makes a Node persist the last received message of its Cached
+ * Publish-Subscribe, Cached Producer-Consumer and Cached Master-Slave Terminals
+ * in a file.
+ *
+ * The file gets created if it does not exist. Messages are written to the file
+ * in the background, so persisting them does not slow down the Node, but the
+ * most recent messages may be lost if the process terminates unexpectedly.
+ * The file gets compacted automatically as it grows.
+ *
+ * Terminals that have not received any message yet use the message stored in
+ * the file when the file has been set. This way, a Node that gets restarted
+ * with the same file can serve cached data to Bindings before the Terminals'
+ * owners publish again. A file must only be used by a single Node at a time.
+ *
+ * @param[in] node Node handle
+ * @param[in] path Path of the file (NULL to stop persisting messages)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SetLastValueStore(void* node, const char* path);
+
 /***************************************************************************//**
  * Creates a Leaf.
  *
@@ -658,57 +1175,244 @@ YOGI_API int YOGI_AsyncAwaitSubscriptionStateChange(void* terminal,
 YOGI_API int YOGI_CancelAwaitSubscriptionStateChange(void* terminal);
 
 /***************************************************************************//**
- * Creates a Binding for a local Terminal to one or more remote Terminals.
+ * Configures the receive queue of a Terminal.
  *
- * @param[out] binding  Pointer to the Binding handle
- * @param[in]  terminal Handle of the associated local Terminal
- * @param[in]  targets  Name of the target Terminal(s)
+ * By default, messages that are received without an asynchronous receive
+ * operation being active are dropped. If \p depth is non-zero, up to \p depth
+ * of these messages get queued instead and are delivered to the next receive
+ * operations in the order they arrived. \p overflowPolicy defines which
+ * message gets dropped if a message arrives while the queue is full.
+ *
+ * Setting \p depth to zero disables the queue. Messages exceeding a smaller
+ * new depth get dropped.
+ *
+ * This function works with all publish-subscribe based Terminals, i.e.
+ * Publish-Subscribe, Cached Publish-Subscribe, Producer-Consumer, Cached
+ * Producer-Consumer, Master-Slave and Cached Master-Slave Terminals.
+ *
+ * @param[in] terminal       Terminal handle
+ * @param[in] depth          Maximum number of queued messages
+ * @param[in] overflowPolicy Behaviour if the queue is full (see
+ *                           \ref RECEIVEQUEUEPOLICIES)
  *
  * @returns [=0] #YOGI_OK if successful
  * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
  ******************************************************************************/
-YOGI_API int YOGI_CreateBinding(void** binding, void* terminal,
-    const char* targets);
+YOGI_API int YOGI_SetReceiveQueue(void* terminal, unsigned depth,
+    int overflowPolicy);
 
 /***************************************************************************//**
- * Queries a Binding's state.
+ * Gets the number of messages a Terminal has dropped.
  *
- * If the operation is successful, the target location of the \p state
- * parameter will be set to the state of the Binding (see \ref BINDSTATES).
+ * This counts messages that arrived without a receive operation being active
+ * and that could not be queued (see YOGI_SetReceiveQueue()).
  *
- * @param[in]  object Binding or Terminal handle
- * @param[out] state  Pointer to where the Binding's state shall be stored
+ * @param[in]  terminal Terminal handle
+ * @param[out] count    Number of dropped messages
  *
  * @returns [=0] #YOGI_OK if successful
  * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
  ******************************************************************************/
-YOGI_API int YOGI_GetBindingState(void* object, int* state);
+YOGI_API int YOGI_GetDroppedMessageCount(void* terminal,
+    unsigned long long* count);
 
 /***************************************************************************//**
- * Asynchronously queries a Binding's state.
+ * Asynchronously receives one or more messages at once.
  *
- * This function invokes the completion handler \p handlerFn with the current
- * state of the Binding. Only one asynchronous operation can be active for a
- * Binding at any time.
- *
- * Propagation of the Binding's state is blocked during the invokation of
- * \p handlerFn to avoid losing state changes within that time. In order to keep
- * track of future state changes, the YOGI_AsyncAwaitBindingStateChange()
- * function should be called from within \p handlerFn.
+ * This function causes the completion handler \p handlerFn to get invoked when
+ * at least one message is available. All queued messages (see
+ * YOGI_SetReceiveQueue()) that fit into \p buffer get written to \p buffer in
+ * a single operation. Each message is preceded by a header of
+ * #YOGI_RQ_MESSAGE_HEADER_SIZE bytes.
+ *
+ * If the oldest message does not fit into \p buffer, \p handlerFn will be
+ * called with an error code of #YOGI_ERR_BUFFER_TOO_SMALL and the number of
+ * bytes that would have been required. The message stays in the receive queue
+ * so that it can be received by calling this function again with a large
+ * enough buffer. If the receive queue is disabled, the message gets dropped
+ * and counted as such (see YOGI_GetDroppedMessageCount()).
+ *
+ * Only one receive operation can be active on a Terminal at a time, i.e. this
+ * function fails if an operation started via e.g.
+ * YOGI_PS_AsyncReceiveMessage() is active.
  *
  * The parameters of the completion handler \p handlerFn are:
  *  -# Error code (see \ref ERRORCODES)
- *  -# Current state of the Binding (see \ref BINDSTATES)
+ *  -# Number of messages written to \p buffer
+ *  -# Number of bytes written to \p buffer
  *  -# Value of the user-defined parameter \p userArg
  *
- * @param[in] binding   Binding handle
- * @param[in] handlerFn Completion handler
- * @param[in] userArg   User-defined parameter passed to \p handlerFn
+ * @param[in]  terminal   Terminal handle
+ * @param[out] buffer     Buffer to write the messages to
+ * @param[in]  bufferSize Size of \p buffer in bytes
+ * @param[in]  handlerFn  Function to call when messages have been received
+ * @param[in]  userArg    User-defined parameter passed to \p handlerFn
  *
  * @returns [=0] #YOGI_OK if successful
  * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
  ******************************************************************************/
-YOGI_API int YOGI_AsyncGetBindingState(void* binding,
+YOGI_API int YOGI_AsyncReceiveMessages(void* terminal, void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, unsigned, unsigned, void*),
+    void* userArg);
+
+/***************************************************************************//**
+ * Cancels an active asynchronous receive operation started via
+ * YOGI_AsyncReceiveMessages().
+ *
+ * This causes the corresponding completion handler to get called with an error
+ * code of #YOGI_ERR_CANCELED.
+ *
+ * @param[in] terminal Terminal handle
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CancelReceiveMessages(void* terminal);
+
+/***************************************************************************//**
+ * Asynchronously receives a message without copying it.
+ *
+ * Instead of writing the received message into a user-supplied buffer, the
+ * completion handler \p handlerFn gets a read-only pointer to the data owned by
+ * the library together with a handle for the loaned message. The data stays
+ * valid until the loan is released via YOGI_ReleaseMessageLoan(). Each
+ * successful receive operation must be followed by such a release call.
+ *
+ * Queued messages (see YOGI_SetReceiveQueue()) get delivered in the same way.
+ *
+ * Only one receive operation can be active on a Terminal at a time, i.e. this
+ * function fails if an operation started via e.g.
+ * YOGI_PS_AsyncReceiveMessage() is active.
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Pointer to the received data (only valid if the error code is #YOGI_OK)
+ *  -# Size of the received data in bytes
+ *  -# 1 if the received message is a cached one; 0 otherwise
+ *  -# Handle of the loan (NULL if the error code is not #YOGI_OK)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal  Terminal handle
+ * @param[in] handlerFn Function to call when a message has been received
+ * @param[in] userArg   User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_AsyncReceiveMessageLoan(void* terminal,
+    void (*handlerFn)(int, const void*, unsigned, int, void*, void*),
+    void* userArg);
+
+/***************************************************************************//**
+ * Cancels an active asynchronous receive operation started via
+ * YOGI_AsyncReceiveMessageLoan().
+ *
+ * This causes the corresponding completion handler to get called with an error
+ * code of #YOGI_ERR_CANCELED.
+ *
+ * @param[in] terminal Terminal handle
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CancelReceiveMessageLoan(void* terminal);
+
+/***************************************************************************//**
+ * Releases a message received via YOGI_AsyncReceiveMessageLoan().
+ *
+ * After this function returns, the data pointer passed to the completion
+ * handler must not be used any more.
+ *
+ * @param[in] loan Handle of the loaned message
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_ReleaseMessageLoan(void* loan);
+
+/***************************************************************************//**
+ * Creates a Binding for a local Terminal to one or more remote Terminals.
+ *
+ * The Binding targets all remote Terminals of the same type and signature
+ * whose name is exactly \p targets. Characters such as '*' and '?' have no
+ * special meaning here; see YOGI_CreateBindingEx() for wildcard Bindings.
+ *
+ * @param[out] binding  Pointer to the Binding handle
+ * @param[in]  terminal Handle of the associated local Terminal
+ * @param[in]  targets  Name of the target Terminal(s)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CreateBinding(void** binding, void* terminal,
+    const char* targets);
+
+/***************************************************************************//**
+ * Creates a Binding for a local Terminal with additional options.
+ *
+ * Works like YOGI_CreateBinding() but accepts flags (see \ref BINDFLAGS).
+ *
+ * With #YOGI_BF_WILDCARD, \p targets is a glob pattern where '*' matches any
+ * sequence of characters and '?' matches a single character, e.g.
+ * "/sensors/temp*" binds to every Terminal of the same type whose name starts
+ * with "/sensors/temp". Such wildcard Bindings are resolved by Nodes: the
+ * Binding stays up-to-date while Terminals appear and disappear and it is
+ * established as long as at least one matching Terminal exists. Received
+ * messages cannot be told apart by their origin. An explicit Binding to a
+ * specific Terminal takes precedence over a wildcard Binding. Since Leafs do
+ * not resolve patterns, a wildcard Binding never gets established over a
+ * direct connection between two Leafs.
+ *
+ * @param[out] binding  Pointer to the Binding handle
+ * @param[in]  terminal Handle of the associated local Terminal
+ * @param[in]  targets  Name of or pattern for the target Terminal(s)
+ * @param[in]  flags    Binding flags (see \ref BINDFLAGS)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CreateBindingEx(void** binding, void* terminal,
+    const char* targets, int flags);
+
+/***************************************************************************//**
+ * Queries a Binding's state.
+ *
+ * If the operation is successful, the target location of the \p state
+ * parameter will be set to the state of the Binding (see \ref BINDSTATES).
+ *
+ * @param[in]  object Binding or Terminal handle
+ * @param[out] state  Pointer to where the Binding's state shall be stored
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_GetBindingState(void* object, int* state);
+
+/***************************************************************************//**
+ * Asynchronously queries a Binding's state.
+ *
+ * This function invokes the completion handler \p handlerFn with the current
+ * state of the Binding. Only one asynchronous operation can be active for a
+ * Binding at any time.
+ *
+ * Propagation of the Binding's state is blocked during the invokation of
+ * \p handlerFn to avoid losing state changes within that time. In order to keep
+ * track of future state changes, the YOGI_AsyncAwaitBindingStateChange()
+ * function should be called from within \p handlerFn.
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Current state of the Binding (see \ref BINDSTATES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] binding   Binding handle
+ * @param[in] handlerFn Completion handler
+ * @param[in] userArg   User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_AsyncGetBindingState(void* binding,
     void (*handlerFn)(int, int, void*), void* userArg);
 
 /***************************************************************************//**
@@ -752,6 +1456,30 @@ YOGI_API int YOGI_AsyncAwaitBindingStateChange(void* binding,
  ******************************************************************************/
 YOGI_API int YOGI_CancelAwaitBindingStateChange(void* binding);
 
+/***************************************************************************//**
+ * Requests a replay of recent messages for a Binding of a Cached
+ * Publish-Subscribe, Cached Producer-Consumer or Cached Master-Slave Terminal.
+ *
+ * The Node that the Leaf is connected to replays the requested part of its
+ * history (see YOGI_SetHistoryLimits()), oldest message first, in batches. The
+ * replayed messages are received like cached messages but they do not replace
+ * the cached message of the Terminal (see YOGI_CPS_GetCachedMessage()). They
+ * may include the message already received as the cached value and live
+ * messages may arrive before the replay has finished. If the Binding is not
+ * established yet, the replay will be requested once it is.
+ *
+ * @param[in] binding     Binding handle
+ * @param[in] maxMessages Maximum number of messages to replay (0 for no limit)
+ * @param[in] since       Only replay messages that the Node received at or
+ *                        after this time, given in nanoseconds since the Unix
+ *                        epoch (0 for no limit)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_RequestReplay(void* binding, unsigned maxMessages,
+    unsigned long long since);
+
 /***************************************************************************//**
  * Creates a connection between local Leafs/Nodes.
  *
@@ -939,10 +1667,57 @@ YOGI_API int YOGI_GetRemoteIdentification(void* connection, void* buffer,
 YOGI_API int YOGI_AssignConnection(void* connection, void* leafNode,
     int timeout);
 
+/***************************************************************************//**
+ * Assigns a TCP connection for multiplexing
+ *
+ * Instead of being assigned to a single leaf or node, the connection carries
+ * any number of channels created via YOGI_CreateTcpChannel(). The remote end
+ * has to be assigned to a leaf or node via YOGI_AssignConnection() as usual;
+ * all channels get connected to it. The heartbeats that detect a broken
+ * connection are shared by all channels.
+ *
+ * A connection can only be assigned once. The remote end has to run at least
+ * version 0.1.0 of the library, since older versions do not understand the
+ * multiplexing and would take the connection for a connection to a node;
+ * otherwise #YOGI_ERR_INCOMPATIBLE_VERSION is returned.
+ *
+ * @param[in] connection Connection handle
+ * @param[in] timeout    Timeout of the connection in milliseconds
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_AssignMultiplexedConnection(void* connection, int timeout);
+
+/***************************************************************************//**
+ * Creates a channel that connects a leaf or node over a multiplexed TCP
+ * connection
+ *
+ * The channel behaves like a connection of its own towards \p leafNode. It can
+ * be used with YOGI_GetConnectionDescription(), YOGI_GetRemoteVersion(),
+ * YOGI_GetRemoteIdentification() and YOGI_AsyncAwaitConnectionDeath(). If the
+ * remote end refuses the channel, it gets disconnected from \p leafNode and
+ * its death is reported with #YOGI_ERR_CONNECTION_REFUSED; it still has to be
+ * destroyed. Destroying the channel closes it on both ends. The connection
+ * cannot be destroyed before all of its channels.
+ *
+ * @param[out] channel    Pointer to the channel handle
+ * @param[in]  connection Handle of a connection assigned via
+ *                        YOGI_AssignMultiplexedConnection()
+ * @param[in]  leafNode   Handle of the leaf or node to connect
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CreateTcpChannel(void** channel, void* connection,
+    void* leafNode);
+
 /***************************************************************************//**
  * Asynchronously waits for a connection to die
  *
- * A connection cannot die before it has been assigned to a leaf or node.
+ * A connection cannot die before it has been assigned to a leaf or node. For
+ * a channel created via YOGI_CreateTcpChannel(), the handler also gets called
+ * if the remote end refuses the channel.
  *
  * The parameters of the completion handler \p handlerFn are:
  *  -# Error code (see \ref ERRORCODES)
@@ -984,15 +1759,85 @@ YOGI_API int YOGI_CancelAwaitConnectionDeath(void* connection);
 YOGI_API int YOGI_PS_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Publish-Subscribe Terminal.
+ *
+ * Works like YOGI_PS_Publish() but sends all messages in a single operation.
+ * Compared to calling YOGI_PS_Publish() for each message, this avoids the
+ * per-call overhead and allows the messages to be coalesced into a single
+ * write on the connection. The messages are received in the given order.
+ *
+ * @param[in] terminal    Handle of the Publish-Subscribe Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Publish-Subscribe Terminal without blocking.
+ *
+ * Works like YOGI_PS_Publish() but never blocks. If the message cannot be
+ * handed over to the connection immediately, e.g. because the send buffer of a
+ * TCP connection is full, the function returns #YOGI_ERR_WOULD_BLOCK and the
+ * message does not get sent. Messages that are larger than the send buffer of
+ * a TCP connection can never be handed over at once; for them, the function
+ * returns #YOGI_ERR_MESSAGE_TOO_LARGE and they have to be sent via
+ * YOGI_PS_Publish() or YOGI_PS_AsyncPublish() instead.
+ *
+ * @param[in] terminal   Handle of the Publish-Subscribe Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Publish-Subscribe Terminal.
+ *
+ * Works like YOGI_PS_Publish() but never blocks. If the message cannot be
+ * handed over to the connection immediately, it gets queued and sent as soon as
+ * the connection is ready. The completion handler \p handlerFn gets called once
+ * the message has been handed over to the connection. It is never called from
+ * within this function and it is not called at all if this function fails,
+ * e.g. with #YOGI_ERR_NOT_BOUND.
+ *
+ * Messages sent via YOGI_PS_Publish() or YOGI_PS_TryPublish() never overtake
+ * queued messages.
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Publish-Subscribe Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Asynchronously receives a message published by a remote Publish-Subscribe
  * Terminal.
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1034,6 +1879,171 @@ YOGI_API int YOGI_PS_AsyncReceiveMessage(void* terminal, void* buffer,
  ******************************************************************************/
 YOGI_API int YOGI_PS_CancelReceiveMessage(void* terminal);
 
+/***************************************************************************//**
+ * Makes a Binding of a Publish-Subscribe Terminal take part in flow control.
+ *
+ * A Binding with a non-zero receive window grants credit for \p window
+ * messages to the Node it is connected to and grants credit again as the
+ * messages arrive. The Node passes the minimum credit left across all flow-
+ * controlled receivers on towards the publishing Terminals, possibly over
+ * several other Nodes. Publishers can query and observe the credit via
+ * YOGI_PS_GetAvailableCredit() and YOGI_PS_AsyncAwaitCreditChange() in order to
+ * throttle at the source; publishing itself is never blocked.
+ *
+ * Flow control only works through Nodes. Receivers that do not take part in
+ * flow control do not limit the publishers.
+ *
+ * @param[in] binding Handle of a Binding created for a Publish-Subscribe
+ *                    Terminal
+ * @param[in] window  Number of messages to grant (0 to stop taking part in flow
+ *                    control)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_SetReceiveWindow(void* binding, unsigned window);
+
+/***************************************************************************//**
+ * Retrieves the number of messages a Publish-Subscribe Terminal may publish
+ * before exceeding the credit granted by its flow-controlled receivers.
+ *
+ * The credit is set to -1 if the Terminal is not limited by flow control.
+ *
+ * @param[in]  terminal Handle of the Publish-Subscribe Terminal
+ * @param[out] credit   Available credit
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_GetAvailableCredit(void* terminal, int* credit);
+
+/***************************************************************************//**
+ * Asynchronously waits for the available credit of a Publish-Subscribe Terminal
+ * to change.
+ *
+ * The credit changes whenever credit is granted or lifted and whenever the
+ * Terminal publishes a message while being limited. This function should be
+ * called again within \p handlerFn in order to keep track of the credit.
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# New available credit (-1 if the Terminal is not limited)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal  Handle of the Publish-Subscribe Terminal
+ * @param[in] handlerFn Completion handler
+ * @param[in] userArg   User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_AsyncAwaitCreditChange(void* terminal,
+    void (*handlerFn)(int, int, void*), void* userArg);
+
+/***************************************************************************//**
+ * Cancels an active asynchronous operation started via
+ * YOGI_PS_AsyncAwaitCreditChange().
+ *
+ * This causes the corresponding completion handler to get called with an error
+ * code of #YOGI_ERR_CANCELED.
+ *
+ * @param[in] terminal Handle of the Publish-Subscribe Terminal
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_CancelAwaitCreditChange(void* terminal);
+
+/***************************************************************************//**
+ * Reduces the rate of messages a Binding of a Publish-Subscribe Terminal
+ * receives.
+ *
+ * If the Leaf is connected to a Node, the Node performs the decimation, so the
+ * full rate of messages only travels over the connections that need it; if it
+ * is connected directly to another Leaf, it decimates the messages it receives
+ * itself. With the #YOGI_DC_CONFLATE mode, \p value is the minimum interval in
+ * milliseconds between two messages (1000 divided by the maximum rate in Hz):
+ * the first message gets sent immediately and any messages received within
+ * the interval are conflated to the latest one which gets sent once the
+ * interval has passed. With the #YOGI_DC_EVERYNTH mode, only the first and
+ * after that every \p value-th message gets sent.
+ *
+ * Bindings with the same targets on the same Leaf share their decimation
+ * setting. Changing the setting drops a message that is being held back.
+ * Bindings of cached Terminals do not support decimation and the function
+ * returns #YOGI_ERR_WRONG_OBJECT_TYPE for them.
+ *
+ * @param[in] binding Handle of a Binding created for a Publish-Subscribe
+ *                    Terminal
+ * @param[in] mode    Decimation mode (see \ref DECIMATIONMODES)
+ * @param[in] value   Interval or N depending on \p mode (ignored for
+ *                    #YOGI_DC_NONE)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_SetDecimation(void* binding, int mode, unsigned value);
+
+/***************************************************************************//**
+ * Restricts the messages a Binding of a Publish-Subscribe Terminal receives to
+ * those whose bytes at \p offset match \p value under \p mask.
+ *
+ * The filter is evaluated by the Nodes between the Binding and the publishing
+ * Terminal. Nodes merge the filters of all their receivers and pass them on to
+ * the Nodes they receive the data from, so messages that no receiver is
+ * interested in are dropped as early as possible. All conditions added to a
+ * Binding have to be met; messages too short for a condition do not meet it.
+ *
+ * A Leaf connected directly to another Leaf evaluates the filter itself.
+ * Bindings with the same targets on the same Leaf share their filter. Bindings
+ * of cached Terminals do not support filters and the function returns
+ * #YOGI_ERR_WRONG_OBJECT_TYPE for them.
+ *
+ * @param[in] binding Handle of a Binding created for a Publish-Subscribe
+ *                    Terminal
+ * @param[in] offset  Offset of the first byte to compare in the message
+ * @param[in] value   Expected bytes
+ * @param[in] mask    Bits to compare for each byte (NULL to compare all bits)
+ * @param[in] size    Number of bytes in \p value and \p mask
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_AddFilterMask(void* binding, unsigned offset,
+    const void* value, const void* mask, unsigned size);
+
+/***************************************************************************//**
+ * Restricts the messages a Binding of a Publish-Subscribe Terminal receives to
+ * those containing a number within a range.
+ *
+ * The number is read as a little-endian unsigned integer of \p width bytes
+ * starting at \p offset. See YOGI_PS_AddFilterMask() for how filters work.
+ *
+ * @param[in] binding Handle of a Binding created for a Publish-Subscribe
+ *                    Terminal
+ * @param[in] offset  Offset of the number in the message
+ * @param[in] width   Size of the number in bytes (1 to 8)
+ * @param[in] min     Smallest accepted number
+ * @param[in] max     Largest accepted number
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_AddFilterRange(void* binding, unsigned offset,
+    unsigned width, unsigned long long min, unsigned long long max);
+
+/***************************************************************************//**
+ * Removes all conditions added to the filter of a Binding of a
+ * Publish-Subscribe Terminal so that it receives every message again.
+ *
+ * @param[in] binding Handle of a Binding created for a Publish-Subscribe
+ *                    Terminal
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PS_ClearFilter(void* binding);
+
 /***************************************************************************//**
  * Initiates a Scatter-Gather operation and asynchronously waits for responses
  * from remote Terminals which have a Binding to the scattering Terminal.
@@ -1081,9 +2091,94 @@ YOGI_API int YOGI_PS_CancelReceiveMessage(void* terminal);
  * @returns [>0] ID of the operation if successful
  * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
  ******************************************************************************/
-YOGI_API int YOGI_SG_AsyncScatterGather(void* terminal, const void* scatBuf,
-    unsigned scatSize, void* gathBuf, unsigned gathSize,
-    int (*handlerFn)(int, int, int, unsigned, void*), void* userArg);
+YOGI_API int YOGI_SG_AsyncScatterGather(void* terminal, const void* scatBuf,
+    unsigned scatSize, void* gathBuf, unsigned gathSize,
+    int (*handlerFn)(int, int, int, unsigned, void*), void* userArg);
+
+/***************************************************************************//**
+ * Initiates a Scatter-Gather operation that finishes early once a deadline or
+ * a number of responses has been reached.
+ *
+ * Works like YOGI_SG_AsyncScatterGather() but the operation finishes as soon
+ * as one of the following conditions is met:
+ *  - All remote Terminals have responded (as usual)
+ *  - \p timeout milliseconds have passed since starting the operation; the
+ *    completion handler will be called with the #YOGI_SG_FINISHED and the
+ *    #YOGI_SG_TIMEOUT flags set and no payload
+ *  - \p quorum remote Terminals have actually responded, i.e. without the
+ *    #YOGI_SG_IGNORED or #YOGI_SG_DEAF flags being set; the last response will
+ *    be delivered with the #YOGI_SG_FINISHED and the #YOGI_SG_QUORUM flags set
+ *
+ * Responses arriving after the operation finished get discarded. Nodes
+ * forwarding the operation enforce the same limits so they can release the
+ * state they keep for the operation early as well.
+ *
+ * @param[in]  terminal   Handle of the Scatter-Gather Terminal
+ * @param[in]  scatBuf    Pointer to the beginning of the data to send
+ * @param[in]  scatSize   Number of bytes to send
+ * @param[out] gathBuf    Buffer to write gathered data to
+ * @param[in]  gathSize   Size of \p gathBuf in bytes
+ * @param[in]  timeout    Timeout in milliseconds (-1 for infinity)
+ * @param[in]  quorum     Number of responses to wait for (0 for all)
+ * @param[in]  handlerFn  Completion handler
+ * @param[in]  userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [>0] ID of the operation if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SG_AsyncScatterGatherEx(void* terminal, const void* scatBuf,
+    unsigned scatSize, void* gathBuf, unsigned gathSize, int timeout,
+    unsigned quorum, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg);
+
+/***************************************************************************//**
+ * Initiates a Scatter-Gather operation that delivers the responses in batches.
+ *
+ * Works like YOGI_SG_AsyncScatterGatherEx() but \p handlerFn can receive
+ * several responses at once. All available responses that fit into \p gathBuf
+ * get written to \p gathBuf, each preceded by a header of
+ * #YOGI_SG_RESPONSE_HEADER_SIZE bytes which contains the response's flags.
+ *
+ * With \p aggregation set to a value other than 0, Nodes forwarding the
+ * operation hold the responses back and send them on in batches. This
+ * reduces the number of messages and handler invocations for operations with
+ * many responders. The responses are held back for at most \p aggregation
+ * milliseconds or, if \p aggregation is #YOGI_SG_AGGREGATE_UNTIL_FINISHED,
+ * until the operation has finished.
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Operation ID returned by YOGI_SG_AsyncScatterGatherBatched()
+ *  -# Combined flags of all responses in the batch (see \ref SCATGATHFLAGS)
+ *  -# Number of responses written to \p gathBuf
+ *  -# Number of bytes written to \p gathBuf
+ *  -# User-defined parameter \p userArg
+ *
+ * If a single response does not fit into \p gathBuf, the handler function
+ * will be called with an error code of #YOGI_ERR_BUFFER_TOO_SMALL for that
+ * response alone. \p gathBuf will then contain the beginning of the response
+ * and the number of bytes parameter will be set to the size that would have
+ * been required.
+ *
+ * @param[in]  terminal    Handle of the Scatter-Gather Terminal
+ * @param[in]  scatBuf     Pointer to the beginning of the data to send
+ * @param[in]  scatSize    Number of bytes to send
+ * @param[out] gathBuf     Buffer to write gathered data to
+ * @param[in]  gathSize    Size of \p gathBuf in bytes
+ * @param[in]  timeout     Timeout in milliseconds (-1 for infinity)
+ * @param[in]  quorum      Number of responses to wait for (0 for all)
+ * @param[in]  aggregation Aggregation window in milliseconds (0 to disable)
+ * @param[in]  handlerFn   Completion handler
+ * @param[in]  userArg     User-defined parameter passed to \p handlerFn
+ *
+ * @returns [>0] ID of the operation if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SG_AsyncScatterGatherBatched(void* terminal,
+    const void* scatBuf, unsigned scatSize, void* gathBuf, unsigned gathSize,
+    int timeout, unsigned quorum, int aggregation,
+    int (*handlerFn)(int, int, int, unsigned, unsigned, void*),
+    void* userArg);
 
 /***************************************************************************//**
  * Cancels an active asynchronous Scatter-Gather operation started via
@@ -1197,6 +2292,59 @@ YOGI_API int YOGI_SG_IgnoreScatteredMessage(void* terminal, int operationId);
 YOGI_API int YOGI_CPS_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Cached Publish-Subscribe Terminal.
+ *
+ * Works like YOGI_CPS_Publish() but sends all messages in a single operation
+ * (see YOGI_PS_PublishBatch()).
+ *
+ * @param[in] terminal    Handle of the Cached Publish-Subscribe Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Cached Publish-Subscribe Terminal without blocking.
+ *
+ * Works like YOGI_CPS_Publish() but never blocks (see YOGI_PS_TryPublish()).
+ *
+ * @param[in] terminal   Handle of the Cached Publish-Subscribe Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Cached Publish-Subscribe Terminal.
+ *
+ * Works like YOGI_CPS_Publish() but never blocks (see YOGI_PS_AsyncPublish()).
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Cached Publish-Subscribe Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Retrieves the last message published by a remote Cached Publish-Subscribe
  * Terminal.
@@ -1218,9 +2366,10 @@ YOGI_API int YOGI_CPS_GetCachedMessage(void* terminal, void* buffer,
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1279,14 +2428,68 @@ YOGI_API int YOGI_CPS_CancelReceiveMessage(void* terminal);
 YOGI_API int YOGI_PC_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Producer Terminal.
+ *
+ * Works like YOGI_PC_Publish() but sends all messages in a single operation
+ * (see YOGI_PS_PublishBatch()).
+ *
+ * @param[in] terminal    Handle of the Producer Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PC_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Producer Terminal without blocking.
+ *
+ * Works like YOGI_PC_Publish() but never blocks (see YOGI_PS_TryPublish()).
+ *
+ * @param[in] terminal   Handle of the Producer Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PC_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Producer Terminal.
+ *
+ * Works like YOGI_PC_Publish() but never blocks (see YOGI_PS_AsyncPublish()).
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Producer Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PC_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Asynchronously receives a message published by a remote Producer Terminal.
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1328,6 +2531,47 @@ YOGI_API int YOGI_PC_AsyncReceiveMessage(void* terminal, void* buffer,
  ******************************************************************************/
 YOGI_API int YOGI_PC_CancelReceiveMessage(void* terminal);
 
+/***************************************************************************//**
+ * Makes a Consumer Terminal compete with other Consumer Terminals for messages.
+ *
+ * By default, every Consumer Terminal receives every message published by the
+ * Producer Terminals. Consumer Terminals with a non-zero capacity instead share
+ * the messages like workers pulling jobs from a queue: the Node sends each
+ * message to only one of them, choosing the one with the most free capacity.
+ * A message occupies one unit of the capacity until it gets acknowledged via
+ * YOGI_PC_AcknowledgeMessages(). If the Consumer Terminal, its Leaf or its
+ * connection goes away, all unacknowledged messages are sent to another
+ * competing Consumer Terminal. Messages are queued on the Node while none of
+ * the competing Consumer Terminals has free capacity.
+ *
+ * Only Consumer Terminals connected to a Node can compete for messages and only
+ * with other Consumer Terminals connected to the same Node. Consumer Terminals
+ * with the same name on the same Leaf share their capacity.
+ *
+ * @param[in] terminal Handle of the Consumer Terminal
+ * @param[in] capacity Maximum number of unacknowledged messages (0 to receive
+ *                     every message)
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PC_SetConsumerCapacity(void* terminal, unsigned capacity);
+
+/***************************************************************************//**
+ * Acknowledges messages received on a competing Consumer Terminal.
+ *
+ * Messages are acknowledged in the order they have been received. Each
+ * acknowledged message frees one unit of the capacity set via
+ * YOGI_PC_SetConsumerCapacity().
+ *
+ * @param[in] terminal    Handle of the Consumer Terminal
+ * @param[in] numMessages Number of messages to acknowledge
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_PC_AcknowledgeMessages(void* terminal, unsigned numMessages);
+
 /***************************************************************************//**
  * Publishes a message on a Cached Producer-Consumer Terminal.
  *
@@ -1343,6 +2587,59 @@ YOGI_API int YOGI_PC_CancelReceiveMessage(void* terminal);
 YOGI_API int YOGI_CPC_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Cached Producer Terminal.
+ *
+ * Works like YOGI_CPC_Publish() but sends all messages in a single operation
+ * (see YOGI_PS_PublishBatch()).
+ *
+ * @param[in] terminal    Handle of the Cached Producer Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPC_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Cached Producer Terminal without blocking.
+ *
+ * Works like YOGI_CPC_Publish() but never blocks (see YOGI_PS_TryPublish()).
+ *
+ * @param[in] terminal   Handle of the Cached Producer Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPC_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Cached Producer Terminal.
+ *
+ * Works like YOGI_CPC_Publish() but never blocks (see YOGI_PS_AsyncPublish()).
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Cached Producer Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CPC_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Retrieves the last message published by a remote Cached Producer Terminal.
  *
@@ -1363,9 +2660,10 @@ YOGI_API int YOGI_CPC_GetCachedMessage(void* terminal, void* buffer,
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1425,15 +2723,69 @@ YOGI_API int YOGI_CPC_CancelReceiveMessage(void* terminal);
 YOGI_API int YOGI_MS_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Master or Slave Terminal.
+ *
+ * Works like YOGI_MS_Publish() but sends all messages in a single operation
+ * (see YOGI_PS_PublishBatch()).
+ *
+ * @param[in] terminal    Handle of the Master or Slave Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_MS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Master or Slave Terminal without blocking.
+ *
+ * Works like YOGI_MS_Publish() but never blocks (see YOGI_PS_TryPublish()).
+ *
+ * @param[in] terminal   Handle of the Master or Slave Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_MS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Master or Slave Terminal.
+ *
+ * Works like YOGI_MS_Publish() but never blocks (see YOGI_PS_AsyncPublish()).
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Master or Slave Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_MS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Asynchronously receives a message published by a remote Master or Slave
  * Terminal.
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1492,6 +2844,59 @@ YOGI_API int YOGI_MS_CancelReceiveMessage(void* terminal);
 YOGI_API int YOGI_CMS_Publish(void* terminal, const void* buffer,
     unsigned bufferSize);
 
+/***************************************************************************//**
+ * Publishes multiple messages at once on a Cached Master or Slave Terminal.
+ *
+ * Works like YOGI_CMS_Publish() but sends all messages in a single operation
+ * (see YOGI_PS_PublishBatch()).
+ *
+ * @param[in] terminal    Handle of the Cached Master or Slave Terminal
+ * @param[in] buffers     Array of pointers to the data of each message
+ * @param[in] bufferSizes Array with the number of bytes of each message
+ * @param[in] numBuffers  Number of messages to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CMS_PublishBatch(void* terminal, const void* const* buffers,
+    const unsigned* bufferSizes, unsigned numBuffers);
+
+/***************************************************************************//**
+ * Publishes a message on a Cached Master or Slave Terminal without blocking.
+ *
+ * Works like YOGI_CMS_Publish() but never blocks (see YOGI_PS_TryPublish()).
+ *
+ * @param[in] terminal   Handle of the Cached Master or Slave Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CMS_TryPublish(void* terminal, const void* buffer,
+    unsigned bufferSize);
+
+/***************************************************************************//**
+ * Asynchronously publishes a message on a Cached Master or Slave Terminal.
+ *
+ * Works like YOGI_CMS_Publish() but never blocks (see YOGI_PS_AsyncPublish()).
+ *
+ * The parameters of the completion handler \p handlerFn are:
+ *  -# Error code (see \ref ERRORCODES)
+ *  -# Value of the user-defined parameter \p userArg
+ *
+ * @param[in] terminal   Handle of the Cached Master or Slave Terminal
+ * @param[in] buffer     Pointer to the beginning of the data to send
+ * @param[in] bufferSize Number of bytes to send
+ * @param[in] handlerFn  Function to call once the message has been sent
+ * @param[in] userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [=0] #YOGI_OK if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_CMS_AsyncPublish(void* terminal, const void* buffer,
+    unsigned bufferSize, void (*handlerFn)(int, void*), void* userArg);
+
 /***************************************************************************//**
  * Retrieves the last message published by a remote Cached Master or Cached
  * Slave Terminal.
@@ -1513,9 +2918,10 @@ YOGI_API int YOGI_CMS_GetCachedMessage(void* terminal, void* buffer,
  *
  * This function causes the completion handler \p handlerFn to get invoked when
  * a message published by a remote Terminal is received. Messages that are
- * received without an asynchronous receive operation being active are dropped.
- * In order to avoid missing messages, this function should be called again
- * within \p handlerFn.
+ * received without an asynchronous receive operation being active are dropped
+ * unless a receive queue has been configured (see YOGI_SetReceiveQueue()). In
+ * order to avoid missing messages, this function should be called again within
+ * \p handlerFn.
  *
  * The target memory location and maximum size for the message's payload is
  * specified by the parameters \p buffer and \p bufferSize. If the payload of
@@ -1607,6 +3013,61 @@ YOGI_API int YOGI_SC_AsyncRequest(void* terminal, const void* reqBuf,
     unsigned reqSize, void* respBuf, unsigned respSize,
     int (*handlerFn)(int, int, int, unsigned, void*), void* userArg);
 
+/***************************************************************************//**
+ * Sends a request to all connected services and finishes early once a deadline
+ * or a number of responses has been reached.
+ *
+ * Works like YOGI_SC_AsyncRequest() but with the limits described for
+ * YOGI_SG_AsyncScatterGatherEx().
+ *
+ * @param[in]  terminal   Handle of the Client Terminal
+ * @param[in]  reqBuf     Pointer to the beginning of the data to send
+ * @param[in]  reqSize    Number of bytes to send
+ * @param[out] respBuf    Buffer to write gathered data to
+ * @param[in]  respSize   Size of \p respBuf in bytes
+ * @param[in]  timeout    Timeout in milliseconds (-1 for infinity)
+ * @param[in]  quorum     Number of responses to wait for (0 for all)
+ * @param[in]  handlerFn  Completion handler
+ * @param[in]  userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [>0] ID of the operation if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SC_AsyncRequestEx(void* terminal, const void* reqBuf,
+    unsigned reqSize, void* respBuf, unsigned respSize, int timeout,
+    unsigned quorum, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg);
+
+/***************************************************************************//**
+ * Sends a request to a single one of the connected services.
+ *
+ * Every Node on the way to the services picks one responder according to the
+ * load balancing \p policy (see \ref LBPOLICIES). If the chosen service does
+ * not answer the request because it has been deaf, ignored the request or
+ * because its Binding or connection has been lost, the request is passed on to
+ * another service that has not been tried yet. Only once no service is left,
+ * the handler function gets called with the corresponding flags set.
+ *
+ * Services answer anycast requests just like any other request.
+ *
+ * @param[in]  terminal   Handle of the Client Terminal
+ * @param[in]  reqBuf     Pointer to the beginning of the data to send
+ * @param[in]  reqSize    Number of bytes to send
+ * @param[out] respBuf    Buffer to write gathered data to
+ * @param[in]  respSize   Size of \p respBuf in bytes
+ * @param[in]  policy     Load balancing policy (see \ref LBPOLICIES)
+ * @param[in]  timeout    Timeout in milliseconds (-1 for infinity)
+ * @param[in]  handlerFn  Completion handler
+ * @param[in]  userArg    User-defined parameter passed to \p handlerFn
+ *
+ * @returns [>0] ID of the operation if successful
+ * @returns [<0] An error code (see \ref ERRORCODES) in case of a failure
+ ******************************************************************************/
+YOGI_API int YOGI_SC_AsyncAnycastRequest(void* terminal, const void* reqBuf,
+    unsigned reqSize, void* respBuf, unsigned respSize, int policy,
+    int timeout, int (*handlerFn)(int, int, int, unsigned, void*),
+    void* userArg);
+
 /***************************************************************************//**
  * Cancels an active asynchronous request operation started via
  * YOGI_SC_AsyncRequest().
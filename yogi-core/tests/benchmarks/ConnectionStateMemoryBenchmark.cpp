@@ -0,0 +1,71 @@
+#include "../../src/base/SmallFlatMap.hpp"
+#include "../../src/core/common/MappedObjectFsm.hpp"
+#include "../../src/interfaces/IConnection.hpp"
+#include "heap_usage.hpp"
+using namespace yogi;
+
+#include <gmock/gmock.h>
+
+#include <iostream>
+#include <iomanip>
+#include <unordered_map>
+#include <vector>
+
+
+struct ConnectionStateMemoryBenchmark : public testing::Test
+{
+    static const std::size_t numTerminals = 20000;
+
+    template <typename TMap>
+    struct terminal_info {
+        TMap owningLeafs;
+        TMap owningNodes;
+        TMap usingNodes;
+    };
+
+    // returns the number of bytes used per terminal
+    template <typename TMap>
+    std::size_t measure(std::size_t connectionsPerMap)
+    {
+        auto before = heap_usage();
+
+        std::vector<terminal_info<TMap>> terminals(numTerminals);
+        for (auto& tm : terminals) {
+            for (auto map : {&tm.owningLeafs, &tm.owningNodes,
+                &tm.usingNodes}) {
+                for (std::size_t i = 0; i < connectionsPerMap; ++i) {
+                    auto conn = reinterpret_cast<interfaces::IConnection*>(
+                        (i + 1) * 64);
+                    (*map)[conn].process_rcvd_description(base::Id{i + 1},
+                        [] {}, [](base::Id) {}, [](bool) {});
+                }
+            }
+        }
+
+        return (heap_usage() - before) / numTerminals;
+    }
+};
+
+TEST_F(ConnectionStateMemoryBenchmark, TerminalInfoFootprint)
+{
+    typedef core::common::MappedObjectFsm fsm_type;
+    typedef std::unordered_map<interfaces::IConnection*, fsm_type> hashed_map;
+    typedef base::SmallFlatMap<interfaces::IConnection*, fsm_type> flat_map;
+
+    std::cout << "Bytes per terminal (" << numTerminals << " terminals, "
+        << "3 connection maps each):" << std::endl;
+    std::cout << std::setw(12) << "connections" << std::setw(16)
+        << "unordered_map" << std::setw(16) << "SmallFlatMap" << std::endl;
+
+    for (std::size_t conns : {0, 1, 2, 4, 8, 32}) {
+        auto hashed = measure<hashed_map>(conns);
+        auto flat   = measure<flat_map>(conns);
+
+        std::cout << std::setw(12) << conns << std::setw(16) << hashed
+            << std::setw(16) << flat << std::endl;
+
+        if (conns > 0) {
+            EXPECT_LT(flat, hashed);
+        }
+    }
+}
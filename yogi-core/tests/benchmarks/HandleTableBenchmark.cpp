@@ -0,0 +1,164 @@
+#include "../../src/api/PublicObjectRegister.hpp"
+using namespace yogi;
+using namespace yogi::interfaces;
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace {
+
+struct ITerminalLike : virtual public IPublicObject
+{
+    virtual int id() const = 0;
+};
+
+struct ISubscribableLike : virtual public IPublicObject
+{
+};
+
+struct TerminalLike : public ITerminalLike, public ISubscribableLike
+{
+    int m_id;
+
+    TerminalLike(int id)
+        : m_id(id)
+    {
+    }
+
+    virtual int id() const override
+    {
+        return m_id;
+    }
+};
+
+// the handle register as it was implemented before the handle table
+class MutexMapRegister
+{
+    std::mutex                                   m_mutex;
+    std::unordered_map<void*, public_object_ptr> m_objects;
+
+public:
+    void* add(public_object_ptr obj)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_objects[obj.get()] = obj;
+        return obj.get();
+    }
+
+    template <typename TO>
+    TO& get_s(void* handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto obj = m_objects.find(handle);
+        if (obj == m_objects.end()) {
+            throw api::ExceptionT<YOGI_ERR_INVALID_HANDLE>{};
+        }
+
+        TO* p = dynamic_cast<TO*>(obj->second.get());
+        if (!p) {
+            throw api::ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>{};
+        }
+
+        return *p;
+    }
+};
+
+} // anonymous namespace
+
+struct HandleTableBenchmark : public testing::Test
+{
+    static const int numObjects     = 1000;
+    static const int callsPerThread = 1000000;
+
+    // returns the average time per lookup in nanoseconds
+    template <typename TFn>
+    double measure(int numThreads, const std::vector<void*>& handles, TFn fn)
+    {
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::atomic<long long> checksum{0};
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) {
+            threads.emplace_back([&, i] {
+                ++ready;
+                while (!go) {
+                }
+
+                long long sum = 0;
+                for (int j = 0; j < callsPerThread; ++j) {
+                    sum += fn(handles[(j + i * 7) % handles.size()]);
+                }
+
+                checksum += sum;
+            });
+        }
+
+        while (ready < numThreads) {
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        go = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+        EXPECT_GT(checksum, 0);
+
+        return std::chrono::duration<double, std::nano>(duration).count()
+            / callsPerThread;
+    }
+};
+
+TEST_F(HandleTableBenchmark, ConcurrentLookups)
+{
+    std::unique_ptr<MutexMapRegister> legacy{new MutexMapRegister};
+    std::vector<void*> legacyHandles;
+    std::vector<void*> handles;
+
+    for (int i = 0; i < numObjects; ++i) {
+        auto obj = std::make_shared<TerminalLike>(i + 1);
+        legacyHandles.push_back(legacy->add(obj));
+        handles.push_back(api::PublicObjectRegister::add(obj));
+    }
+
+    std::cout << "Wall time per lookup in ns (" << numObjects << " objects, "
+        << callsPerThread << " lookups per thread):" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "mutex+map"
+        << std::setw(14) << "handle table" << std::endl;
+
+    int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        auto before = measure(threads, legacyHandles, [&](void* handle) {
+            return legacy->get_s<ITerminalLike>(handle).id();
+        });
+
+        auto after = measure(threads, handles, [&](void* handle) {
+            return api::PublicObjectRegister::get_s<ITerminalLike>(handle)
+                .id();
+        });
+
+        std::cout << std::setw(8) << threads << std::fixed
+            << std::setprecision(1) << std::setw(14) << before
+            << std::setw(14) << after << std::endl;
+
+        if (threads > 1) {
+            EXPECT_LT(after, before);
+        }
+    }
+
+    legacy.reset();
+    for (auto handle : handles) {
+        api::PublicObjectRegister::destroy(handle);
+    }
+}
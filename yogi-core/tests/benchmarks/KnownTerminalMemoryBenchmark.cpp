@@ -0,0 +1,123 @@
+#include "../../src/base/Identifier.hpp"
+#include "../../src/serialization/serialize_one.hpp"
+#include "../../src/serialization/deserialize_one.hpp"
+#include "heap_usage.hpp"
+using namespace yogi;
+
+#include <gmock/gmock.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+struct KnownTerminalMemoryBenchmark : public testing::Test
+{
+    static const std::size_t numTerminals = 20000;
+
+    // identifier layout before names got interned
+    struct string_identifier {
+        base::Identifier::signature_type signature;
+        std::string                      name;
+        bool                             hidden;
+
+        bool operator== (const string_identifier& rhs) const
+        {
+            return signature == rhs.signature && name == rhs.name
+                && hidden == rhs.hidden;
+        }
+    };
+
+    struct string_identifier_hash {
+        std::size_t operator() (const string_identifier& identifier) const
+        {
+            return std::hash<std::string>{}(identifier.name)
+                ^ identifier.signature;
+        }
+    };
+
+    std::vector<std::vector<char>> descriptions;
+
+    virtual void SetUp() override
+    {
+        for (std::size_t i = 0; i < numTerminals; ++i) {
+            std::vector<char> buffer;
+            serialization::serialize_one(buffer, base::Identifier{i,
+                "/Plant/Area " + std::to_string(i % 16) + "/Sensor "
+                + std::to_string(i) + "/Temperature", false});
+            descriptions.push_back(std::move(buffer));
+        }
+    }
+
+    static base::Identifier deserialize(const std::vector<char>& buffer,
+        base::Identifier*)
+    {
+        base::Identifier identifier;
+        auto it = buffer.cbegin();
+        serialization::deserialize_one(buffer, it, identifier);
+        return identifier;
+    }
+
+    static string_identifier deserialize(const std::vector<char>& buffer,
+        string_identifier*)
+    {
+        auto identifier = deserialize(buffer,
+            static_cast<base::Identifier*>(nullptr));
+        return string_identifier{identifier.signature(), identifier.name(),
+            identifier.hidden()};
+    }
+
+    // returns the number of bytes used per known terminal if every terminal
+    // is announced over the given number of connections
+    template <typename TIdentifier, typename THash>
+    std::size_t measure(std::size_t numConnections)
+    {
+        auto before = heap_usage();
+
+        // the node's register holds each terminal once and every connection
+        // keeps its own copy of the received identifier; this includes the
+        // entries in the interning table
+        std::unordered_map<TIdentifier, int, THash> known;
+        std::vector<std::vector<TIdentifier>> connections(numConnections);
+        for (auto& buffer : descriptions) {
+            for (auto& conn : connections) {
+                auto identifier = deserialize(buffer,
+                    static_cast<TIdentifier*>(nullptr));
+                known.emplace(identifier, 0);
+                conn.push_back(std::move(identifier));
+            }
+        }
+
+        return (heap_usage() - before) / numTerminals;
+    }
+};
+
+TEST_F(KnownTerminalMemoryBenchmark, BytesPerKnownTerminal)
+{
+    typedef std::hash<base::Identifier> interned_hash;
+
+    std::cout << "Bytes per known terminal (" << numTerminals
+        << " terminals, names of about "
+        << deserialize(descriptions.back(),
+            static_cast<base::Identifier*>(nullptr)).name().size()
+        << " characters):" << std::endl;
+    std::cout << std::setw(12) << "connections" << std::setw(16)
+        << "std::string" << std::setw(16) << "InternedName" << std::endl;
+
+    for (std::size_t conns : {1, 2, 4, 8}) {
+        auto strings  = measure<string_identifier, string_identifier_hash>(
+            conns);
+        auto interned = measure<base::Identifier, interned_hash>(conns);
+
+        std::cout << std::setw(12) << conns << std::setw(16) << strings
+            << std::setw(16) << interned << std::endl;
+
+        // with a single connection the interning table entry costs about as
+        // much as the second string copy it saves
+        if (conns > 1) {
+            EXPECT_LT(interned, strings);
+        }
+    }
+}
@@ -0,0 +1,142 @@
+#include "../../src/base/LastValueStore.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+
+struct LastValueStoreBenchmark : public testing::Test
+{
+    static const int numKeys       = 16;
+    static const int numMessages   = 100000;
+    static const int numSyncWrites = 2000;
+
+    std::string path;
+    std::vector<std::string> keys;
+
+    virtual void SetUp() override
+    {
+        path = (boost::filesystem::temp_directory_path()
+            / boost::filesystem::unique_path()).string();
+
+        for (int i = 0; i < numKeys; ++i) {
+            keys.push_back("CachedPublishSubscribe::CachedData/0/v/Terminal "
+                + std::to_string(i));
+        }
+    }
+
+    virtual void TearDown() override
+    {
+        boost::filesystem::remove(path);
+    }
+
+    // returns the average time per message in nanoseconds
+    template <typename TFn>
+    double measure(int messages, TFn fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < messages; ++i) {
+            fn(keys[i % keys.size()]);
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(duration).count()
+            / messages;
+    }
+};
+
+TEST_F(LastValueStoreBenchmark, DataPathOverhead)
+{
+    std::cout << "Time per received message in ns (" << numKeys
+        << " terminals):" << std::endl;
+    std::cout << std::setw(8) << "size" << std::setw(14) << "memory only"
+        << std::setw(14) << "store" << std::setw(14) << "sync write"
+        << std::setw(14) << "file size" << std::endl;
+
+    for (std::size_t size : {16, 256, 4096}) {
+        Buffer data{std::vector<char>(size, 'x').data(), size};
+
+        // what a node does without a store: remember the last message
+        std::vector<Buffer> lastMessages(numKeys);
+        std::size_t idx = 0;
+        auto memoryOnly = measure(numMessages, [&](const std::string&) {
+            lastMessages[idx++ % lastMessages.size()] = data;
+        });
+
+        std::size_t fileSize;
+        double store;
+        {
+            LastValueStore uut{path};
+            idx = 0;
+            store = measure(numMessages, [&](const std::string& key) {
+                lastMessages[idx++ % lastMessages.size()] = data;
+                uut.put(key, data);
+            });
+
+            uut.flush();
+            fileSize = uut.file_size();
+        }
+
+        // writing every message to the file before passing it on
+        auto file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        idx = 0;
+        auto sync = measure(numSyncWrites, [&](const std::string& key) {
+            lastMessages[idx++ % lastMessages.size()] = data;
+            std::fwrite(key.data(), 1, key.size(), file);
+            std::fwrite(data.data(), 1, data.size(), file);
+            std::fflush(file);
+        });
+        std::fclose(file);
+        boost::filesystem::remove(path);
+
+        std::cout << std::setw(8) << size << std::fixed
+            << std::setprecision(1) << std::setw(14) << memoryOnly
+            << std::setw(14) << store << std::setw(14) << sync
+            << std::setw(14) << fileSize << std::endl;
+
+        EXPECT_LT(store, sync);
+        // coalescing and compaction keep the file far below the total size of
+        // all messages
+        EXPECT_LT(fileSize, numMessages * size / 10);
+    }
+}
+
+TEST_F(LastValueStoreBenchmark, Reload)
+{
+    std::string value(256, 'x');
+    {
+        LastValueStore uut{path};
+        for (auto& key : keys) {
+            uut.put(key, Buffer{value.data(), value.size()});
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    LastValueStore uut{path};
+    auto opened = std::chrono::steady_clock::now();
+
+    std::size_t found = 0;
+    for (auto& key : keys) {
+        const char* data;
+        std::size_t size;
+        found += uut.find(key, &data, &size) ? 1 : 0;
+    }
+    auto done = std::chrono::steady_clock::now();
+
+    std::cout << "Opening the store took "
+        << std::chrono::duration<double, std::micro>(opened - start).count()
+        << " us, looking up " << numKeys << " values took "
+        << std::chrono::duration<double, std::micro>(done - opened).count()
+        << " us" << std::endl;
+
+    EXPECT_EQ(keys.size(), found);
+}
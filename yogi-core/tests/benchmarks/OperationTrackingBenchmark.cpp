@@ -0,0 +1,289 @@
+#include "../../src/core/Node.hpp"
+#include "../../src/core/Leaf.hpp"
+#include "../../src/core/scatter_gather/Terminal.hpp"
+using namespace yogi;
+using namespace yogi::base;
+using namespace yogi::core;
+using namespace yogi::messaging;
+using namespace yogi::messaging::messages;
+
+#include "../mocks/SchedulerMock.hpp"
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+// connection that remembers the operation ID of the last scatter message sent
+// over it and counts finished gathers; gmock expectations would cost more than
+// the logic being measured
+struct Connection : public interfaces::IConnection
+{
+    const bool        remoteIsNode;
+    std::string       emptyString;
+    std::vector<char> emptyIdentification;
+    Id                lastOperationId;
+    std::size_t       finished = 0;
+
+    explicit Connection(bool remoteIsNode_)
+        : remoteIsNode(remoteIsNode_)
+    {
+    }
+
+    virtual void send(const interfaces::IMessage& msg) override
+    {
+        if (msg.type_id() == ScatterGather::Scatter{}.type_id()) {
+            lastOperationId = static_cast<const ScatterGather::Scatter&>(msg)
+                [fields::operationId];
+        }
+        else if (msg.type_id() == ScatterGather::Gather{}.type_id()) {
+            auto flags = static_cast<const ScatterGather::Gather&>(msg)
+                [fields::gatherFlags];
+            finished += flags & scatter_gather::GATHER_FINISHED ? 1 : 0;
+        }
+    }
+
+    virtual void async_send(const interfaces::IMessage& msg,
+        send_handler_fn) override
+    {
+        send(msg);
+    }
+
+    virtual bool remote_is_node() const override
+    {
+        return remoteIsNode;
+    }
+
+    virtual const std::string& description() const override
+    {
+        return emptyString;
+    }
+
+    virtual const std::string& remote_version() const override
+    {
+        return emptyString;
+    }
+
+    virtual const std::vector<char>& remote_identification() const override
+    {
+        return emptyIdentification;
+    }
+};
+
+struct Terminal : public scatter_gather::Terminal<>
+{
+    std::size_t finished = 0;
+
+    Terminal(Leaf& leaf, Identifier identifier)
+        : scatter_gather::Terminal<>(leaf, identifier)
+    {
+    }
+
+    virtual void on_scattered_message_received(Id, Buffer&&) override
+    {
+    }
+
+    virtual bool on_gathered_message_received(Id,
+        scatter_gather::gather_flags flags, Buffer&&) override
+    {
+        finished += flags & scatter_gather::GATHER_FINISHED ? 1 : 0;
+        return true;
+    }
+
+    virtual bool on_gathered_messages_received(Id,
+        scatter_gather::gathered_responses&&) override
+    {
+        return true;
+    }
+};
+
+} // anonymous namespace
+
+struct OperationTrackingBenchmark : public testing::Test
+{
+    static const int numTerminals  = 8;
+    static const int numOperations = 200000;
+
+    std::shared_ptr<mocks::SchedulerMock> scheduler;
+    Buffer                                data;
+
+    virtual void SetUp() override
+    {
+        scheduler = std::make_shared<mocks::SchedulerMock>();
+
+        std::vector<char> bytes{'a', 'b'};
+        data = Buffer{bytes.data(), bytes.size()};
+    }
+
+    static Identifier ident(int terminal)
+    {
+        return Identifier{0u, std::to_string(terminal), false};
+    }
+
+    static double ops_per_second(std::chrono::steady_clock::duration duration)
+    {
+        return numOperations / std::chrono::duration<double>(duration).count();
+    }
+
+    // keeps a number of operations scattered by leafA in flight on a node with
+    // the terminals bound on each responding leaf; each step lets the oldest
+    // operation get answered by all responders and scatters a new one
+    double measure_node(int inFlight, int responders)
+    {
+        auto uut = std::make_shared<Node>(*scheduler);
+
+        Connection leafA{false};
+        uut->on_new_connection(leafA);
+        uut->on_connection_started(leafA);
+
+        std::vector<std::unique_ptr<Connection>> leafs;
+        for (int i = 0; i < responders; ++i) {
+            leafs.emplace_back(std::make_unique<Connection>(false));
+            uut->on_new_connection(*leafs.back());
+            uut->on_connection_started(*leafs.back());
+        }
+
+        // the node maps the terminals in the order they get described
+        for (int tm = 0; tm < numTerminals; ++tm) {
+            uut->on_message_received(ScatterGather::TerminalDescription::create(
+                ident(tm), Id{static_cast<Id::number_type>(tm + 1)}), leafA);
+
+            for (auto& leaf : leafs) {
+                uut->on_message_received(
+                    ScatterGather::BindingDescription::create(ident(tm),
+                        Id{static_cast<Id::number_type>(tm + 1)}), *leaf);
+            }
+        }
+
+        // operation ID used by leafA and the ones assigned by the node
+        struct operation
+        {
+            Id              leafAId;
+            std::vector<Id> responderIds;
+        };
+
+        std::vector<operation> ops(inFlight);
+        Id::number_type nextLeafAId = 0;
+        auto scatter = [&](operation& op, int tm) {
+            op.leafAId = Id{++nextLeafAId};
+            uut->on_message_received(ScatterGather::Scatter::create(
+                Id{static_cast<Id::number_type>(tm + 1)}, op.leafAId, 0, 0, 0,
+                false, 0, data), leafA);
+
+            op.responderIds.clear();
+            for (auto& leaf : leafs) {
+                op.responderIds.push_back(leaf->lastOperationId);
+            }
+        };
+
+        for (int i = 0; i < inFlight; ++i) {
+            scatter(ops[i], i % numTerminals);
+        }
+
+        leafA.finished = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < numOperations; ++i) {
+            auto& op = ops[i % inFlight];
+            for (int j = 0; j < responders; ++j) {
+                uut->on_message_received(ScatterGather::Gather::create(
+                    op.responderIds[j], scatter_gather::GATHER_FINISHED,
+                    data), *leafs[j]);
+            }
+
+            scatter(op, (i + inFlight) % numTerminals);
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+        EXPECT_EQ(static_cast<std::size_t>(numOperations), leafA.finished);
+
+        uut->on_connection_destroyed(leafA);
+        for (auto& leaf : leafs) {
+            uut->on_connection_destroyed(*leaf);
+        }
+
+        return ops_per_second(duration);
+    }
+
+    // keeps a number of operations in flight on a leaf that is connected to
+    // another leaf; each step finishes the oldest operation and starts a new
+    // one
+    double measure_leaf(int inFlight)
+    {
+        auto uut = std::make_shared<Leaf>(*scheduler);
+
+        Connection connection{false};
+        uut->on_new_connection(connection);
+        uut->on_connection_started(connection);
+
+        std::vector<std::shared_ptr<Terminal>> terminals;
+        for (int tm = 0; tm < numTerminals; ++tm) {
+            terminals.emplace_back(std::make_shared<Terminal>(*uut, ident(tm)));
+            uut->on_message_received(ScatterGather::TerminalMapping::create(
+                terminals.back()->id(),
+                Id{static_cast<Id::number_type>(tm + 1)}), connection);
+        }
+
+        auto scatter = [&](int tm) {
+            uut->scatter_gather::LeafLogic<>::sg_scatter(*terminals[tm],
+                Buffer{data});
+            return connection.lastOperationId;
+        };
+
+        std::vector<Id> ops(inFlight);
+        for (int i = 0; i < inFlight; ++i) {
+            ops[i] = scatter(i % numTerminals);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < numOperations; ++i) {
+            auto& op = ops[i % inFlight];
+            uut->on_message_received(ScatterGather::Gather::create(op,
+                scatter_gather::GATHER_FINISHED, data), connection);
+
+            op = scatter((i + inFlight) % numTerminals);
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        std::size_t finished = 0;
+        for (auto& terminal : terminals) {
+            finished += terminal->finished;
+        }
+
+        EXPECT_EQ(static_cast<std::size_t>(numOperations), finished);
+
+        terminals.clear();
+        uut->on_connection_destroyed(connection);
+
+        return ops_per_second(duration);
+    }
+};
+
+TEST_F(OperationTrackingBenchmark, ScatterGather)
+{
+    std::cout << "Operations per second (" << numTerminals << " terminals):"
+        << std::endl;
+    std::cout << std::setw(10) << "in flight" << std::setw(20)
+        << "node, 1 responder" << std::setw(20) << "node, 3 responders"
+        << std::setw(12) << "leaf" << std::endl;
+
+    for (int inFlight : {1, 64, 1024}) {
+        auto node1 = measure_node(inFlight, 1);
+        auto node3 = measure_node(inFlight, 3);
+        auto leaf  = measure_leaf(inFlight);
+
+        std::cout << std::setw(10) << inFlight << std::fixed
+            << std::setprecision(0) << std::setw(20) << node1 << std::setw(20)
+            << node3 << std::setw(12) << leaf << std::endl;
+    }
+}
@@ -0,0 +1,95 @@
+#include "../../src/scheduling/MultiThreadedScheduler.hpp"
+#include "../../src/scheduling/BusyPollScheduler.hpp"
+using namespace yogi;
+using namespace yogi::scheduling;
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+
+
+struct SchedulerLatencyBenchmark : public testing::Test
+{
+    typedef std::chrono::steady_clock clock;
+
+    static const int numSamples = 2000;
+
+    // returns the sorted delays between posting a handler to an idle
+    // scheduler and the start of its execution in microseconds
+    std::vector<double> measure(interfaces::IScheduler& scheduler)
+    {
+        std::vector<double> delays;
+        delays.reserve(numSamples);
+
+        for (int i = 0; i < numSamples; ++i) {
+            // let the scheduler threads become idle
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+            std::atomic<bool> done{false};
+            auto posted = clock::now();
+            scheduler.post([&] {
+                delays.push_back(std::chrono::duration<double, std::micro>(
+                    clock::now() - posted).count());
+                done = true;
+            });
+
+            while (!done) {
+                std::this_thread::yield();
+            }
+        }
+
+        std::sort(delays.begin(), delays.end());
+        return delays;
+    }
+
+    void print(const char* name, const std::vector<double>& delays)
+    {
+        auto percentile = [&](double p) {
+            return delays[static_cast<std::size_t>(p * (delays.size() - 1))];
+        };
+
+        std::cout << std::setw(24) << name << std::fixed
+            << std::setprecision(1)
+            << std::setw(9) << percentile(0.5)
+            << std::setw(9) << percentile(0.9)
+            << std::setw(9) << percentile(0.99)
+            << std::setw(9) << percentile(0.999)
+            << std::setw(9) << delays.back() << std::endl;
+    }
+};
+
+TEST_F(SchedulerLatencyBenchmark, HandlerStartLatency)
+{
+    std::cout << "Delay between posting a handler to an idle scheduler and "
+        << "its execution in us (" << numSamples << " samples):"
+        << std::endl;
+    std::cout << std::setw(24) << "scheduler" << std::setw(9) << "p50"
+        << std::setw(9) << "p90" << std::setw(9) << "p99"
+        << std::setw(9) << "p99.9" << std::setw(9) << "max" << std::endl;
+
+    MultiThreadedScheduler sharedQueue;
+    auto blocking = measure(sharedQueue);
+    print("shared queue", blocking);
+
+    BusyPollScheduler busyPoll;
+    busyPoll.set_spin_duration(0);
+    print("busy-poll (no spinning)", measure(busyPoll));
+
+    busyPoll.set_spin_duration(1000);
+    print("busy-poll (1 ms spin)", measure(busyPoll));
+
+    busyPoll.set_spin_duration(-1);
+    auto spinning = measure(busyPoll);
+    print("busy-poll (spin forever)", spinning);
+
+    // with a single CPU, the spinning thread competes with the posting thread
+    if (std::thread::hardware_concurrency() > 1) {
+        EXPECT_LT(spinning[numSamples / 2], blocking[numSamples / 2]);
+    }
+}
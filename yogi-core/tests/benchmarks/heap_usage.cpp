@@ -0,0 +1,45 @@
+#include "heap_usage.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+// count the bytes allocated on the heap by the whole process
+namespace {
+
+std::atomic<std::size_t> allocatedBytes{0};
+const std::size_t headerSize = alignof(std::max_align_t);
+
+} // anonymous namespace
+
+void* operator new(std::size_t size)
+{
+    auto p = static_cast<char*>(std::malloc(size + headerSize));
+    if (!p) {
+        throw std::bad_alloc{};
+    }
+
+    *reinterpret_cast<std::size_t*>(p) = size;
+    allocatedBytes += size;
+    return p + headerSize;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr) {
+        auto p = static_cast<char*>(ptr) - headerSize;
+        allocatedBytes -= *reinterpret_cast<std::size_t*>(p);
+        std::free(p);
+    }
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+std::size_t heap_usage()
+{
+    return allocatedBytes.load();
+}
@@ -0,0 +1,11 @@
+#ifndef YOGI_TESTS_BENCHMARKS_HEAP_USAGE_HPP
+#define YOGI_TESTS_BENCHMARKS_HEAP_USAGE_HPP
+
+#include <cstddef>
+
+
+// Returns the number of bytes currently allocated on the heap by the whole
+// process via operator new (see heap_usage.cpp)
+std::size_t heap_usage();
+
+#endif // YOGI_TESTS_BENCHMARKS_HEAP_USAGE_HPP
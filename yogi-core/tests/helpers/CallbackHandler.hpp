@@ -89,6 +89,36 @@ struct SubscriptionStateCallbackHandler : public CallbackHandler
     }
 };
 
+struct CreditCallbackHandler : public CallbackHandler
+{
+    int lastErrorCode = YOGI_OK;
+    int credit        = -1;
+
+    static void fn(int errorCode, int credit, void* userArg)
+    {
+        auto handler = static_cast<CreditCallbackHandler*>(userArg);
+
+        handler->credit        = credit;
+        handler->lastErrorCode = errorCode;
+
+        handler->notify();
+    }
+};
+
+struct AsyncPublishHandler : public CallbackHandler
+{
+    int lastErrorCode = YOGI_OK;
+
+    static void fn(int errorCode, void* userArg)
+    {
+        auto handler = static_cast<AsyncPublishHandler*>(userArg);
+
+        handler->lastErrorCode = errorCode;
+
+        handler->notify();
+    }
+};
+
 struct ReceivePublishedMessageHandler : public CallbackHandler
 {
     int lastErrorCode = YOGI_OK;
@@ -118,6 +148,48 @@ struct ReceivePublishedMessageHandler : public CallbackHandler
     }
 };
 
+struct ReceivePublishedMessagesHandler : public CallbackHandler
+{
+    int lastErrorCode    = YOGI_OK;
+    unsigned numMessages = 0;
+    unsigned size        = 0;
+
+    static void fn(int errorCode, unsigned numMessages, unsigned size,
+        void* userArg)
+    {
+        auto handler = static_cast<ReceivePublishedMessagesHandler*>(userArg);
+
+        handler->lastErrorCode = errorCode;
+        handler->numMessages   = numMessages;
+        handler->size          = size;
+
+        handler->notify();
+    }
+};
+
+struct ReceiveMessageLoanHandler : public CallbackHandler
+{
+    int lastErrorCode = YOGI_OK;
+    const void* data  = nullptr;
+    unsigned size     = 0;
+    bool cached       = false;
+    void* loan        = nullptr;
+
+    static void fn(int errorCode, const void* data, unsigned size, int cached,
+        void* loan, void* userArg)
+    {
+        auto handler = static_cast<ReceiveMessageLoanHandler*>(userArg);
+
+        handler->lastErrorCode = errorCode;
+        handler->data          = data;
+        handler->size          = size;
+        handler->cached        = !!cached;
+        handler->loan          = loan;
+
+        handler->notify();
+    }
+};
+
 struct ReceiveGatheredMessageHandler : public CallbackHandler
 {
     int returnValue   = 0;
@@ -142,6 +214,32 @@ struct ReceiveGatheredMessageHandler : public CallbackHandler
     }
 };
 
+struct ReceiveGatheredMessagesHandler : public CallbackHandler
+{
+    int returnValue       = 0;
+    int lastErrorCode     = YOGI_OK;
+    int operationId       = -1;
+    int flags             = YOGI_SG_NOFLAGS;
+    unsigned numResponses = 0;
+    unsigned size         = 0;
+
+    static int fn(int errorCode, int operationId, int flags,
+        unsigned numResponses, unsigned size, void* userArg)
+    {
+        auto handler = static_cast<ReceiveGatheredMessagesHandler*>(userArg);
+
+        handler->lastErrorCode = errorCode;
+        handler->operationId   = operationId;
+        handler->flags         = flags;
+        handler->numResponses  = numResponses;
+        handler->size          = size;
+
+        handler->notify();
+
+        return handler->returnValue;
+    }
+};
+
 struct ReceiveScatteredMessageHandler : public CallbackHandler
 {
     int lastErrorCode = YOGI_OK;
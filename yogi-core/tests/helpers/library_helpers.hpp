@@ -82,10 +82,10 @@ void* make_terminal(void* leaf, int type, const char* name, int signature = 0)
     return terminal;
 }
 
-void* make_binding(void* terminal, const char* name)
+void* make_binding(void* terminal, const char* name, int flags = 0)
 {
     void* binding = nullptr;
-    int res = YOGI_CreateBinding(&binding, terminal, name);
+    int res = YOGI_CreateBindingEx(&binding, terminal, name, flags);
     EXPECT_EQ(YOGI_OK, res);
 	EXPECT_NE(nullptr, binding);
     return binding;
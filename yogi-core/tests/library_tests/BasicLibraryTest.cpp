@@ -2,6 +2,8 @@
 
 #include <gmock/gmock.h>
 
+#include <numeric>
+
 
 struct BasicLibraryTest : public testing::Test
 {
@@ -35,6 +37,174 @@ TEST_F(BasicLibraryTest, Scheduler)
 
     res = YOGI_SetSchedulerThreadPoolSize(scheduler, 5);
     EXPECT_EQ(YOGI_OK, res);
+
+    // pin the threads to CPUs
+    int cpus[] = {0};
+    res = YOGI_SetSchedulerCpuAffinity(scheduler, cpus, 1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerCpuAffinity(scheduler, nullptr, 0);
+    EXPECT_EQ(YOGI_OK, res);
+
+    cpus[0] = -1;
+    res = YOGI_SetSchedulerCpuAffinity(scheduler, cpus, 1);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+}
+
+TEST_F(BasicLibraryTest, SchedulerTypes)
+{
+    void* scheduler;
+    int res = YOGI_CreateSchedulerEx(&scheduler, 99);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    for (int type : {YOGI_ST_SHAREDQUEUE, YOGI_ST_WORKSTEALING,
+        YOGI_ST_BUSYPOLL}) {
+        res = YOGI_CreateSchedulerEx(&scheduler, type);
+        ASSERT_EQ(YOGI_OK, res);
+
+        res = YOGI_SetSchedulerThreadPoolSize(scheduler, 4);
+        EXPECT_EQ(YOGI_OK, res);
+
+        int cpus[] = {0};
+        res = YOGI_SetSchedulerCpuAffinity(scheduler, cpus, 1);
+        EXPECT_EQ(YOGI_OK, res);
+
+        void* leaf = helpers::make_leaf(scheduler);
+        void* node = helpers::make_node(scheduler);
+        void* connection = helpers::make_connection(leaf, node);
+
+        res = YOGI_SetSchedulerThreadPoolSize(scheduler, 2);
+        EXPECT_EQ(YOGI_OK, res);
+
+        helpers::destroy(connection);
+        helpers::destroy(leaf);
+        helpers::destroy(node);
+        helpers::destroy(scheduler);
+    }
+}
+
+TEST_F(BasicLibraryTest, SchedulerAutoScaling)
+{
+    int res = YOGI_SetSchedulerAutoScaling(scheduler, 3, 2, 1000, 1000);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_SetSchedulerAutoScaling(scheduler, 1, 2, 0, 1000);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_SetSchedulerAutoScaling(scheduler, 1, 8, 1000, 1000);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerAutoScaling(scheduler, 0, 0, 0, 0);
+    EXPECT_EQ(YOGI_OK, res);
+
+    void* workStealingScheduler;
+    res = YOGI_CreateSchedulerEx(&workStealingScheduler, YOGI_ST_WORKSTEALING);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerAutoScaling(workStealingScheduler, 1, 8, 1000,
+        1000);
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, res);
+
+    helpers::destroy(workStealingScheduler);
+}
+
+TEST_F(BasicLibraryTest, RealtimeOptions)
+{
+    int res = YOGI_SetSchedulerRealtimePriority(scheduler, -1);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_SetSchedulerRealtimePriority(scheduler, 0);
+    EXPECT_EQ(YOGI_OK, res);
+
+    // real-time policies usually require special privileges
+    res = YOGI_SetSchedulerRealtimePriority(scheduler, 10);
+    EXPECT_TRUE(res == YOGI_OK || res == YOGI_ERR_SET_PRIORITY_FAILED);
+
+    res = YOGI_SetSchedulerSpinDuration(scheduler, 10);
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, res);
+
+    void* busyPollScheduler;
+    res = YOGI_CreateSchedulerEx(&busyPollScheduler, YOGI_ST_BUSYPOLL);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerSpinDuration(busyPollScheduler, 10);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerSpinDuration(busyPollScheduler, -1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    helpers::destroy(busyPollScheduler);
+
+    res = YOGI_LockMemory(1);
+    EXPECT_TRUE(res == YOGI_OK || res == YOGI_ERR_LOCK_MEMORY_FAILED);
+
+    res = YOGI_LockMemory(0);
+    EXPECT_EQ(YOGI_OK, res);
+}
+
+TEST_F(BasicLibraryTest, SchedulerStatistics)
+{
+    unsigned long long delays[YOGI_HISTOGRAM_BUCKETS];
+    unsigned long long runtimes[YOGI_HISTOGRAM_BUCKETS];
+
+    int res = YOGI_GetSchedulerStatistics(scheduler, 99, delays, runtimes);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_GetSchedulerStatistics(leaf, YOGI_HC_DISPATCH, delays,
+        runtimes);
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, res);
+
+    res = YOGI_EnableSchedulerStatistics(scheduler, 1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    // messages between the leaf and the node get dispatched
+    helpers::make_connection(leaf, node);
+    helpers::make_terminal(leaf, YOGI_TM_DEAFMUTE, "A");
+
+    unsigned long long dispatched = 0;
+    for (int i = 0; i < 1000 && !dispatched; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        res = YOGI_GetSchedulerStatistics(scheduler, YOGI_HC_DISPATCH, delays,
+            runtimes);
+        ASSERT_EQ(YOGI_OK, res);
+        dispatched = std::accumulate(runtimes,
+            runtimes + YOGI_HISTOGRAM_BUCKETS, 0ull);
+    }
+
+    EXPECT_GT(dispatched, 0u);
+
+    res = YOGI_ResetSchedulerStatistics(scheduler);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_GetSchedulerStatistics(scheduler, YOGI_HC_DISPATCH, delays,
+        runtimes);
+    EXPECT_EQ(YOGI_OK, res);
+    EXPECT_EQ(0u, std::accumulate(runtimes, runtimes + YOGI_HISTOGRAM_BUCKETS,
+        0ull));
+}
+
+TEST_F(BasicLibraryTest, SchedulerCallbackExecutor)
+{
+    int res = YOGI_SetSchedulerCallbackExecutor(scheduler, 2, 0,
+        YOGI_OP_BLOCK);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_SetSchedulerCallbackExecutor(scheduler, 2, 10, 99);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_SetSchedulerCallbackExecutor(leaf, 2, 10, YOGI_OP_BLOCK);
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, res);
+
+    res = YOGI_SetSchedulerCallbackExecutor(scheduler, 2, 10, YOGI_OP_BLOCK);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerCallbackExecutor(scheduler, 1, 1,
+        YOGI_OP_RUNINLINE);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_SetSchedulerCallbackExecutor(scheduler, 0, 0, YOGI_OP_BLOCK);
+    EXPECT_EQ(YOGI_OK, res);
 }
 
 TEST_F(BasicLibraryTest, ObjectDependencies)
@@ -3,6 +3,8 @@
 
 #include <gmock/gmock.h>
 
+#include <boost/filesystem.hpp>
+
 
 struct CachedPublishSubscribeLibraryTest : public testing::Test
 {
@@ -59,6 +61,19 @@ struct CachedPublishSubscribeLibraryTest : public testing::Test
 
         rcvMsgFn.wait();
     }
+
+    void receive_cached(const char* expected)
+    {
+        int res = YOGI_CPS_AsyncReceiveMessage(terminalA, buffer,
+            sizeof(buffer), helpers::ReceivePublishedMessageHandler::fn,
+            &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+        EXPECT_STREQ(expected, buffer);
+        EXPECT_TRUE(rcvMsgFn.cached);
+    }
 };
 
 TEST_F(CachedPublishSubscribeLibraryTest, SuccessfulPublishReceive)
@@ -115,3 +130,102 @@ TEST_F(CachedPublishSubscribeLibraryTest, Cache)
     EXPECT_STREQ("Hello", buffer);
     EXPECT_TRUE(rcvMsgFn.cached);
 }
+
+TEST_F(CachedPublishSubscribeLibraryTest, BatchReceive)
+{
+    publish_receive("Hello", sizeof(buffer));
+
+    // the cached message gets delivered again after reconnecting
+    helpers::ReceivePublishedMessagesHandler rcvMsgsFn;
+    int res = YOGI_AsyncReceiveMessages(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_Destroy(connectionB);
+    EXPECT_EQ(YOGI_OK, res);
+    connectionB = helpers::make_connection(leafB, node);
+    rcvMsgsFn.wait();
+
+    EXPECT_EQ(YOGI_OK, rcvMsgsFn.lastErrorCode);
+    EXPECT_EQ(1, rcvMsgsFn.numMessages);
+    EXPECT_EQ(YOGI_RQ_MESSAGE_HEADER_SIZE + 6, rcvMsgsFn.size);
+    EXPECT_EQ(1, buffer[4]);
+    EXPECT_STREQ("Hello", buffer + YOGI_RQ_MESSAGE_HEADER_SIZE);
+}
+
+TEST_F(CachedPublishSubscribeLibraryTest, Replay)
+{
+    ASSERT_EQ(YOGI_OK, YOGI_SetHistoryLimits(node, 3, 0));
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+
+    for (auto msg : {"1", "2", "3", "4", "5"}) {
+        publish_receive(msg, sizeof(buffer));
+        EXPECT_FALSE(rcvMsgFn.cached);
+    }
+
+    ASSERT_EQ(YOGI_OK, YOGI_RequestReplay(binding, 0, 0));
+    for (auto msg : {"3", "4", "5"}) {
+        receive_cached(msg);
+    }
+
+    ASSERT_EQ(YOGI_OK, YOGI_RequestReplay(binding, 2, 0));
+    for (auto msg : {"4", "5"}) {
+        receive_cached(msg);
+    }
+
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    publish_receive("6", sizeof(buffer));
+
+    ASSERT_EQ(YOGI_OK, YOGI_RequestReplay(binding, 0,
+        static_cast<unsigned long long>(now)));
+    receive_cached("6");
+
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, YOGI_RequestReplay(terminalA, 0, 0));
+}
+
+TEST_F(CachedPublishSubscribeLibraryTest, LastValueStore)
+{
+    auto path = (boost::filesystem::temp_directory_path()
+        / boost::filesystem::unique_path()).string();
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetLastValueStore(node, path.c_str()));
+    publish_receive("Hello", sizeof(buffer));
+    ASSERT_EQ(YOGI_OK, YOGI_SetLastValueStore(node, nullptr));
+
+    // a node using the same file serves the message even though it has never
+    // been published to that node
+    using namespace helpers;
+    auto node2     = make_node(make_scheduler());
+    ASSERT_EQ(YOGI_OK, YOGI_SetLastValueStore(node2, path.c_str()));
+    auto leafC     = make_leaf(make_scheduler());
+    auto leafD     = make_leaf(make_scheduler());
+    make_connection(leafC, node2);
+    make_connection(leafD, node2);
+    make_terminal(leafC, YOGI_TM_CACHEDPUBLISHSUBSCRIBE, "B");
+    auto terminalD = make_terminal(leafD, YOGI_TM_CACHEDPUBLISHSUBSCRIBE, "D");
+    auto bindingD  = make_binding(terminalD, "B");
+    await_binding_state(bindingD, YOGI_BD_ESTABLISHED);
+
+    unsigned bytesWritten;
+    int res;
+    for (int i = 0; i < 100; ++i) {
+        res = YOGI_CPS_GetCachedMessage(terminalD, buffer, sizeof(buffer),
+            &bytesWritten);
+        if (res == YOGI_OK) {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(YOGI_OK, res);
+    EXPECT_STREQ("Hello", buffer);
+
+    EXPECT_EQ(YOGI_ERR_CANNOT_OPEN_FILE, YOGI_SetLastValueStore(node,
+        boost::filesystem::temp_directory_path().string().c_str()));
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetLastValueStore(node2, nullptr));
+    boost::filesystem::remove(path);
+}
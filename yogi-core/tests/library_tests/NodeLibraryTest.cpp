@@ -65,6 +65,125 @@ TEST_F(NodeLibraryTest, GetKnownTerminals)
     }}
 }
 
+TEST_F(NodeLibraryTest, FindKnownTerminals)
+{
+    helpers::make_terminal(leaf, YOGI_TM_PUBLISHSUBSCRIBE, "Hello", 123);
+    helpers::make_terminal(leaf, YOGI_TM_SCATTERGATHER,    "Help", 98342);
+    helpers::make_terminal(leaf, YOGI_TM_DEAFMUTE,         "World", 5);
+
+    std::vector<unsigned char> buffer(100);
+    unsigned numTerminals = 0;
+    unsigned long long cursor = 0;
+    while (numTerminals != 3) {
+        int res = YOGI_FindKnownTerminals(node, YOGI_KT_PREFIX, "", nullptr, 0,
+            buffer.data(), static_cast<unsigned>(buffer.size()), &numTerminals,
+            &cursor);
+        EXPECT_EQ(YOGI_OK, res);
+    }
+    EXPECT_EQ(3, cursor);
+
+    // prefix query with paging
+    {{
+        std::vector<unsigned char> expected{YOGI_TM_PUBLISHSUBSCRIBE, 0x7B,
+            0x00, 0x00, 0x00, 'H', 'e', 'l', 'l', 'o', '\0'};
+        std::vector<unsigned char> buffer(expected.size());
+
+        int res = YOGI_FindKnownTerminals(node, YOGI_KT_PREFIX, "Hel",
+            nullptr, 1, buffer.data(), static_cast<unsigned>(buffer.size()),
+            &numTerminals, nullptr);
+        EXPECT_EQ(YOGI_OK, res);
+        EXPECT_EQ(1, numTerminals);
+        EXPECT_EQ(expected, buffer);
+    }}
+
+    {{
+        std::vector<unsigned char> previous{YOGI_TM_PUBLISHSUBSCRIBE, 0x7B,
+            0x00, 0x00, 0x00, 'H', 'e', 'l', 'l', 'o', '\0'};
+        std::vector<unsigned char> expected{YOGI_TM_SCATTERGATHER, 0x26, 0x80,
+            0x01, 0x00, 'H', 'e', 'l', 'p', '\0'};
+        std::vector<unsigned char> buffer(expected.size());
+
+        int res = YOGI_FindKnownTerminals(node, YOGI_KT_PREFIX, "Hel",
+            previous.data(), 1, buffer.data(),
+            static_cast<unsigned>(buffer.size()), &numTerminals, nullptr);
+        EXPECT_EQ(YOGI_OK, res);
+        EXPECT_EQ(1, numTerminals);
+        EXPECT_EQ(expected, buffer);
+    }}
+
+    // case-insensitive substring query
+    {{
+        std::vector<unsigned char> expected{YOGI_TM_DEAFMUTE, 0x05, 0x00, 0x00,
+            0x00, 'W', 'o', 'r', 'l', 'd', '\0'};
+        std::vector<unsigned char> buffer(expected.size());
+
+        int res = YOGI_FindKnownTerminals(node,
+            YOGI_KT_SUBSTRING | YOGI_KT_IGNORECASE, "RL", nullptr, 0,
+            buffer.data(), static_cast<unsigned>(buffer.size()), &numTerminals,
+            nullptr);
+        EXPECT_EQ(YOGI_OK, res);
+        EXPECT_EQ(1, numTerminals);
+        EXPECT_EQ(expected, buffer);
+    }}
+
+    int res = YOGI_FindKnownTerminals(node, 1234, "", nullptr, 0,
+        buffer.data(), static_cast<unsigned>(buffer.size()), &numTerminals,
+        nullptr);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+}
+
+TEST_F(NodeLibraryTest, GetKnownTerminalsChanges)
+{
+    unsigned long long cursor = 0;
+    std::vector<unsigned char> buffer(100);
+    unsigned numChanges = 0;
+
+    int res = YOGI_GetKnownTerminalsChanges(node, &cursor, buffer.data(),
+        static_cast<unsigned>(buffer.size()), &numChanges);
+    EXPECT_EQ(YOGI_OK, res);
+    EXPECT_EQ(0, numChanges);
+    EXPECT_EQ(0, cursor);
+
+    void* terminal = helpers::make_terminal(leaf, YOGI_TM_PUBLISHSUBSCRIBE,
+        "Hello", 123);
+    while (numChanges == 0) {
+        res = YOGI_GetKnownTerminalsChanges(node, &cursor, buffer.data(),
+            static_cast<unsigned>(buffer.size()), &numChanges);
+        EXPECT_EQ(YOGI_OK, res);
+    }
+
+    std::vector<unsigned char> expected{0x01, YOGI_TM_PUBLISHSUBSCRIBE, 0x7B,
+        0x00, 0x00, 0x00, 'H', 'e', 'l', 'l', 'o', '\0'};
+    buffer.resize(expected.size());
+    EXPECT_EQ(expected, buffer);
+    EXPECT_EQ(1, cursor);
+
+    helpers::destroy(terminal);
+    helpers::make_terminal(leaf, YOGI_TM_SCATTERGATHER, "World", 5);
+    std::vector<char> tmp(100);
+    unsigned numTerminals = 0;
+    while (numTerminals == 0) {
+        YOGI_FindKnownTerminals(node, YOGI_KT_PREFIX, "World", nullptr, 0,
+            tmp.data(), static_cast<unsigned>(tmp.size()), &numTerminals,
+            nullptr);
+    }
+
+    // only the first change fits into the buffer
+    res = YOGI_GetKnownTerminalsChanges(node, &cursor, buffer.data(),
+        static_cast<unsigned>(buffer.size()), &numChanges);
+    EXPECT_EQ(YOGI_ERR_BUFFER_TOO_SMALL, res);
+    EXPECT_EQ(1, numChanges);
+    EXPECT_EQ(2, cursor);
+    EXPECT_EQ(0x00, buffer[0]);
+
+    res = YOGI_GetKnownTerminalsChanges(node, &cursor, buffer.data(),
+        static_cast<unsigned>(buffer.size()), &numChanges);
+    EXPECT_EQ(YOGI_OK, res);
+    EXPECT_EQ(1, numChanges);
+    EXPECT_EQ(3, cursor);
+    EXPECT_EQ(0x01, buffer[0]);
+    EXPECT_EQ(YOGI_TM_SCATTERGATHER, buffer[1]);
+}
 
 TEST_F(NodeLibraryTest, AsyncAwaitKnownTerminalsChange)
 {
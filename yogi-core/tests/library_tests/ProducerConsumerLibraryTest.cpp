@@ -1,8 +1,11 @@
 #include "../helpers/library_helpers.hpp"
 #include "../helpers/CallbackHandler.hpp"
+#include "../../src/config.h"
 
 #include <gmock/gmock.h>
 
+#include <string>
+
 
 struct ProducerConsumerLibraryTest : public testing::Test
 {
@@ -76,3 +79,136 @@ TEST_F(ProducerConsumerLibraryTest, BufferTooSmall)
     EXPECT_EQ(6, rcvMsgFn.size);
     EXPECT_EQ('H', buffer[0]);
 }
+
+struct CompetingConsumersLibraryTest : public testing::Test
+{
+    void* node;
+    void* leafA;
+    void* leafB;
+    void* leafC;
+    void* connectionA;
+    void* connectionB;
+    void* connectionC;
+    void* producer;
+    void* consumerB;
+    void* consumerC;
+
+    char bufferB[10] = {0};
+    char bufferC[10] = {0};
+    helpers::ReceivePublishedMessageHandler rcvMsgFnB;
+    helpers::ReceivePublishedMessageHandler rcvMsgFnC;
+
+    virtual void SetUp() override
+    {
+        ASSERT_EQ(YOGI_OK, YOGI_Initialise());
+
+        using namespace helpers;
+        node        = make_node(make_scheduler());
+        leafA       = make_leaf(make_scheduler());
+        leafB       = make_leaf(make_scheduler());
+        leafC       = make_leaf(make_scheduler());
+        connectionA = make_connection(leafA, node);
+        connectionB = make_connection(leafB, node);
+        connectionC = make_connection(leafC, node);
+        producer    = make_terminal(leafA, YOGI_TM_PRODUCER, "T");
+        consumerB   = make_terminal(leafB, YOGI_TM_CONSUMER, "T");
+        consumerC   = make_terminal(leafC, YOGI_TM_CONSUMER, "T");
+
+        await_binding_state(consumerB, YOGI_BD_ESTABLISHED);
+        await_binding_state(consumerC, YOGI_BD_ESTABLISHED);
+        await_subscription_state(producer, YOGI_SB_SUBSCRIBED);
+
+        ASSERT_EQ(YOGI_OK, YOGI_PC_SetConsumerCapacity(consumerB, 1));
+        ASSERT_EQ(YOGI_OK, YOGI_PC_SetConsumerCapacity(consumerC, 1));
+
+        // give the node time to process the subscription and the capacities
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        receive();
+    }
+
+    virtual void TearDown() override
+    {
+        ASSERT_EQ(YOGI_OK, YOGI_Shutdown());
+    }
+
+    void receive()
+    {
+        int res = YOGI_PC_AsyncReceiveMessage(consumerB, bufferB,
+            sizeof(bufferB), helpers::ReceivePublishedMessageHandler::fn,
+            &rcvMsgFnB);
+        ASSERT_EQ(YOGI_OK, res);
+
+        res = YOGI_PC_AsyncReceiveMessage(consumerC, bufferC,
+            sizeof(bufferC), helpers::ReceivePublishedMessageHandler::fn,
+            &rcvMsgFnC);
+        ASSERT_EQ(YOGI_OK, res);
+    }
+
+    void publish(const char* data)
+    {
+        int res = YOGI_PC_Publish(producer, data, strlen(data) + 1);
+        ASSERT_EQ(YOGI_OK, res);
+    }
+};
+
+TEST_F(CompetingConsumersLibraryTest, EachMessageGoesToOneConsumer)
+{
+    publish("1");
+    publish("2");
+
+    rcvMsgFnB.wait();
+    rcvMsgFnC.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgFnB.lastErrorCode);
+    EXPECT_EQ(YOGI_OK, rcvMsgFnC.lastErrorCode);
+    EXPECT_NE(std::string(bufferB), std::string(bufferC));
+
+    // both consumers are out of credit
+    receive();
+    publish("3");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(1, rcvMsgFnB.calls());
+    EXPECT_EQ(1, rcvMsgFnC.calls());
+
+    EXPECT_EQ(YOGI_OK, YOGI_PC_AcknowledgeMessages(consumerC, 1));
+    rcvMsgFnC.wait();
+    EXPECT_STREQ("3", bufferC);
+    EXPECT_EQ(1, rcvMsgFnB.calls());
+}
+
+TEST_F(CompetingConsumersLibraryTest, RedispatchUnacknowledgedMessages)
+{
+    publish("1");
+    publish("2");
+
+    rcvMsgFnB.wait();
+    rcvMsgFnC.wait();
+    std::string lostMessage = bufferB;
+
+    receive();
+    ASSERT_EQ(YOGI_OK, YOGI_Destroy(connectionB));
+
+    EXPECT_EQ(YOGI_OK, YOGI_PC_AcknowledgeMessages(consumerC, 1));
+    rcvMsgFnC.wait();
+    EXPECT_EQ(lostMessage, std::string(bufferC));
+}
+
+TEST_F(CompetingConsumersLibraryTest, OldestQueuedMessagesGetDropped)
+{
+    publish("1");
+    publish("2");
+
+    rcvMsgFnB.wait();
+    rcvMsgFnC.wait();
+
+    // both consumers are out of credit, so the messages get queued
+    receive();
+    for (int i = 0; i < YOGI_MAX_PRODUCER_CONSUMER_BACKLOG + 2; ++i) {
+        publish(std::to_string(i).c_str());
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(YOGI_OK, YOGI_PC_AcknowledgeMessages(consumerC, 1));
+    rcvMsgFnC.wait();
+    EXPECT_STREQ("2", bufferC);
+}
@@ -3,9 +3,13 @@
 
 #include <gmock/gmock.h>
 
+#include <thread>
+#include <cstdint>
+
 
 struct PublishSubscribeLibraryTest : public testing::Test
 {
+    void* schedulerA;
     void* node;
     void* leafA;
     void* leafB;
@@ -23,8 +27,9 @@ struct PublishSubscribeLibraryTest : public testing::Test
         ASSERT_EQ(YOGI_OK, YOGI_Initialise());
 
         using namespace helpers;
+        schedulerA  = make_scheduler();
         node        = make_node(make_scheduler());
-        leafA       = make_leaf(make_scheduler());
+        leafA       = make_leaf(schedulerA);
         leafB       = make_leaf(make_scheduler());
         connectionA = make_connection(leafA, node);
         connectionB = make_connection(leafB, node);
@@ -40,6 +45,15 @@ struct PublishSubscribeLibraryTest : public testing::Test
         ASSERT_EQ(YOGI_OK, YOGI_Shutdown());
     }
 
+    void publish(const char* data)
+    {
+        int res;
+        do {
+            res = YOGI_PS_Publish(terminalB, data, strlen(data) + 1);
+        } while (res == YOGI_ERR_NOT_BOUND);
+        EXPECT_EQ(YOGI_OK, res);
+    }
+
     void publish_receive(const char* data, unsigned bufferSize)
     {
         memset(buffer, 0, sizeof(buffer));
@@ -47,12 +61,52 @@ struct PublishSubscribeLibraryTest : public testing::Test
             bufferSize, helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
         EXPECT_EQ(YOGI_OK, res);
 
+        publish(data);
+
+        rcvMsgFn.wait();
+    }
+
+    void await_dropped_messages(unsigned long long n)
+    {
+        unsigned long long count;
         do {
-            res = YOGI_PS_Publish(terminalB, data, strlen(data) + 1);
-        } while (res == YOGI_ERR_NOT_BOUND);
-        EXPECT_EQ(YOGI_OK, res);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ASSERT_EQ(YOGI_OK, YOGI_GetDroppedMessageCount(terminalA, &count));
+        } while (count < n);
+
+        EXPECT_EQ(n, count);
+    }
+
+    void receive(const char* expected)
+    {
+        int res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+            helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
 
         rcvMsgFn.wait();
+        EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+        EXPECT_STREQ(expected, buffer);
+    }
+
+    void await_credit(int credit)
+    {
+        int current;
+        do {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ASSERT_EQ(YOGI_OK, YOGI_PS_GetAvailableCredit(terminalB, &current));
+        } while (current != credit);
+    }
+
+    // publishes only once the receivers have granted credit
+    void publish_with_credit(const char* data)
+    {
+        int credit;
+        do {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ASSERT_EQ(YOGI_OK, YOGI_PS_GetAvailableCredit(terminalB, &credit));
+        } while (credit == 0);
+
+        publish(data);
     }
 };
 
@@ -73,3 +127,608 @@ TEST_F(PublishSubscribeLibraryTest, BufferTooSmall)
     EXPECT_EQ(6, rcvMsgFn.size);
     EXPECT_EQ('H', buffer[0]);
 }
+
+TEST_F(PublishSubscribeLibraryTest, CallbackExecutor)
+{
+    int res = YOGI_SetSchedulerCallbackExecutor(schedulerA, 1, 1,
+        YOGI_OP_BLOCK);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish_receive("Hello", sizeof(buffer));
+
+    EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+    EXPECT_EQ(6, rcvMsgFn.size);
+    EXPECT_STREQ("Hello", buffer);
+
+    res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_PS_CancelReceiveMessage(terminalA);
+    EXPECT_EQ(YOGI_OK, res);
+
+    rcvMsgFn.wait();
+    EXPECT_EQ(YOGI_ERR_CANCELED, rcvMsgFn.lastErrorCode);
+}
+
+TEST_F(PublishSubscribeLibraryTest, WildcardBinding)
+{
+    using namespace helpers;
+    auto terminal = make_terminal(leafA, YOGI_TM_PUBLISHSUBSCRIBE, "Sensors");
+    auto wildcard = make_binding(terminal, "/sensors/*", YOGI_BF_WILDCARD);
+
+    auto sensor1 = make_terminal(leafB, YOGI_TM_PUBLISHSUBSCRIBE, "/sensors/1");
+    make_terminal(leafB, YOGI_TM_PUBLISHSUBSCRIBE, "/actors/1");
+    await_binding_state(wildcard, YOGI_BD_ESTABLISHED);
+
+    auto sensor2 = make_terminal(leafB, YOGI_TM_PUBLISHSUBSCRIBE, "/sensors/2");
+    for (auto sensor : {sensor1, sensor2}) {
+        memset(buffer, 0, sizeof(buffer));
+        int res = YOGI_PS_AsyncReceiveMessage(terminal, buffer, sizeof(buffer),
+            helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+        EXPECT_EQ(YOGI_OK, res);
+
+        do {
+            res = YOGI_PS_Publish(sensor, "Hi", 3);
+        } while (res == YOGI_ERR_NOT_BOUND);
+        EXPECT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+        EXPECT_STREQ("Hi", buffer);
+    }
+
+    EXPECT_EQ(YOGI_OK, YOGI_Destroy(sensor1));
+    EXPECT_EQ(YOGI_OK, YOGI_Destroy(sensor2));
+    await_binding_state(wildcard, YOGI_BD_RELEASED);
+}
+
+TEST_F(PublishSubscribeLibraryTest, TryPublish)
+{
+    int res = YOGI_PS_TryPublish(terminalA, "Hello", 6);
+    EXPECT_EQ(YOGI_ERR_NOT_BOUND, res);
+
+    res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    do {
+        res = YOGI_PS_TryPublish(terminalB, "Hello", 6);
+    } while (res == YOGI_ERR_NOT_BOUND);
+    EXPECT_EQ(YOGI_OK, res);
+
+    rcvMsgFn.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+    EXPECT_STREQ("Hello", buffer);
+}
+
+TEST_F(PublishSubscribeLibraryTest, AsyncPublish)
+{
+    helpers::AsyncPublishHandler publishFn;
+    int res = YOGI_PS_AsyncPublish(terminalA, "Hello", 6,
+        helpers::AsyncPublishHandler::fn, &publishFn);
+    EXPECT_EQ(YOGI_ERR_NOT_BOUND, res);
+
+    res = YOGI_PS_AsyncPublish(terminalA, "Hello", 6, nullptr, nullptr);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+
+    res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    do {
+        res = YOGI_PS_AsyncPublish(terminalB, "Hello", 6,
+            helpers::AsyncPublishHandler::fn, &publishFn);
+    } while (res == YOGI_ERR_NOT_BOUND);
+    EXPECT_EQ(YOGI_OK, res);
+
+    publishFn.wait();
+    EXPECT_EQ(YOGI_OK, publishFn.lastErrorCode);
+    EXPECT_EQ(1, publishFn.calls());
+
+    rcvMsgFn.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+    EXPECT_STREQ("Hello", buffer);
+}
+
+TEST_F(PublishSubscribeLibraryTest, ReceiveQueue)
+{
+    int res = YOGI_SetReceiveQueue(terminalA, 2, YOGI_RQ_DROPOLDEST);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish("1");
+    publish("2");
+    publish("3");
+    await_dropped_messages(1);
+
+    for (auto msg : {"2", "3"}) {
+        res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+            helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+        EXPECT_STREQ(msg, buffer);
+    }
+
+    // messages received while the queue is disabled get dropped
+    res = YOGI_SetReceiveQueue(terminalA, 0, YOGI_RQ_DROPOLDEST);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish("4");
+    await_dropped_messages(2);
+
+    void* sgTerminal = helpers::make_terminal(leafA, YOGI_TM_SCATTERGATHER,
+        "C");
+    res = YOGI_SetReceiveQueue(sgTerminal, 2, YOGI_RQ_DROPOLDEST);
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, res);
+    res = YOGI_SetReceiveQueue(terminalA, 2, 2);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+}
+
+TEST_F(PublishSubscribeLibraryTest, BatchReceive)
+{
+    int res = YOGI_SetReceiveQueue(terminalA, 2, YOGI_RQ_DROPNEWEST);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish("Hello");
+    publish("World");
+    publish("!");
+    await_dropped_messages(1);
+
+    helpers::ReceivePublishedMessagesHandler rcvMsgsFn;
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgsFn.lastErrorCode);
+    EXPECT_EQ(2, rcvMsgsFn.numMessages);
+    EXPECT_EQ(2 * YOGI_RQ_MESSAGE_HEADER_SIZE + 12, rcvMsgsFn.size);
+
+    std::uint32_t size;
+    memcpy(&size, buffer, 4);
+    EXPECT_EQ(6, size);
+    EXPECT_EQ(0, buffer[4]);
+    EXPECT_STREQ("Hello", buffer + YOGI_RQ_MESSAGE_HEADER_SIZE);
+    EXPECT_STREQ("World", buffer + 2 * YOGI_RQ_MESSAGE_HEADER_SIZE + 6);
+
+    // a message arriving while the operation is active gets delivered directly
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    EXPECT_EQ(YOGI_ERR_ASYNC_OPERATION_RUNNING, res);
+
+    publish("Hi");
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgsFn.lastErrorCode);
+    EXPECT_EQ(1, rcvMsgsFn.numMessages);
+    EXPECT_STREQ("Hi", buffer + YOGI_RQ_MESSAGE_HEADER_SIZE);
+
+    // messages that do not fit into the buffer stay queued
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, 6,
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish("Hello");
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_ERR_BUFFER_TOO_SMALL, rcvMsgsFn.lastErrorCode);
+    EXPECT_EQ(0, rcvMsgsFn.numMessages);
+    EXPECT_EQ(YOGI_RQ_MESSAGE_HEADER_SIZE + 6, rcvMsgsFn.size);
+
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_OK, rcvMsgsFn.lastErrorCode);
+    EXPECT_EQ(1, rcvMsgsFn.numMessages);
+    EXPECT_STREQ("Hello", buffer + YOGI_RQ_MESSAGE_HEADER_SIZE);
+
+    // ...unless the receive queue is disabled
+    res = YOGI_SetReceiveQueue(terminalA, 0, YOGI_RQ_DROPNEWEST);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, 6,
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    publish("Hello");
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_ERR_BUFFER_TOO_SMALL, rcvMsgsFn.lastErrorCode);
+    await_dropped_messages(2);
+
+    res = YOGI_AsyncReceiveMessages(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessagesHandler::fn, &rcvMsgsFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_CancelReceiveMessages(terminalA);
+    EXPECT_EQ(YOGI_OK, res);
+
+    rcvMsgsFn.wait();
+    EXPECT_EQ(YOGI_ERR_CANCELED, rcvMsgsFn.lastErrorCode);
+}
+
+TEST_F(PublishSubscribeLibraryTest, ReceiveMessageLoan)
+{
+    helpers::ReceiveMessageLoanHandler loanFn;
+    int res = YOGI_AsyncReceiveMessageLoan(terminalA,
+        helpers::ReceiveMessageLoanHandler::fn, &loanFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    EXPECT_EQ(YOGI_ERR_ASYNC_OPERATION_RUNNING, res);
+
+    publish("Hello");
+    loanFn.wait();
+    EXPECT_EQ(YOGI_OK, loanFn.lastErrorCode);
+    EXPECT_EQ(6, loanFn.size);
+    EXPECT_FALSE(loanFn.cached);
+    EXPECT_STREQ("Hello", static_cast<const char*>(loanFn.data));
+    ASSERT_NE(nullptr, loanFn.loan);
+
+    // the loaned data stays valid while more messages get received
+    auto firstData = loanFn.data;
+    auto firstLoan = loanFn.loan;
+
+    res = YOGI_SetReceiveQueue(terminalA, 1, YOGI_RQ_DROPOLDEST);
+    ASSERT_EQ(YOGI_OK, res);
+    publish("World");
+
+    res = YOGI_AsyncReceiveMessageLoan(terminalA,
+        helpers::ReceiveMessageLoanHandler::fn, &loanFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    loanFn.wait();
+    EXPECT_EQ(YOGI_OK, loanFn.lastErrorCode);
+    EXPECT_STREQ("World", static_cast<const char*>(loanFn.data));
+    EXPECT_STREQ("Hello", static_cast<const char*>(firstData));
+
+    EXPECT_EQ(YOGI_OK, YOGI_ReleaseMessageLoan(firstLoan));
+    EXPECT_EQ(YOGI_ERR_INVALID_HANDLE, YOGI_ReleaseMessageLoan(firstLoan));
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, YOGI_ReleaseMessageLoan(terminalA));
+    EXPECT_EQ(YOGI_OK, YOGI_ReleaseMessageLoan(loanFn.loan));
+
+    res = YOGI_AsyncReceiveMessageLoan(terminalA,
+        helpers::ReceiveMessageLoanHandler::fn, &loanFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_CancelReceiveMessageLoan(terminalA);
+    EXPECT_EQ(YOGI_OK, res);
+
+    loanFn.wait();
+    EXPECT_EQ(YOGI_ERR_CANCELED, loanFn.lastErrorCode);
+    EXPECT_EQ(nullptr, loanFn.loan);
+}
+
+TEST_F(PublishSubscribeLibraryTest, PublishBatch)
+{
+    int res = YOGI_SetReceiveQueue(terminalA, 3, YOGI_RQ_DROPOLDEST);
+    ASSERT_EQ(YOGI_OK, res);
+
+    const void* buffers[]  = {"Hello", "World", "!"};
+    unsigned bufferSizes[] = {6, 6, 2};
+
+    do {
+        res = YOGI_PS_PublishBatch(terminalB, buffers, bufferSizes, 3);
+    } while (res == YOGI_ERR_NOT_BOUND);
+    EXPECT_EQ(YOGI_OK, res);
+
+    for (auto msg : {"Hello", "World", "!"}) {
+        res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+            helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_EQ(YOGI_OK, rcvMsgFn.lastErrorCode);
+        EXPECT_STREQ(msg, buffer);
+    }
+
+    res = YOGI_PS_PublishBatch(terminalB, buffers, bufferSizes, 0);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+    buffers[1] = nullptr;
+    res = YOGI_PS_PublishBatch(terminalB, buffers, bufferSizes, 3);
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, res);
+}
+
+TEST_F(PublishSubscribeLibraryTest, FlowControl)
+{
+    int credit;
+    ASSERT_EQ(YOGI_OK, YOGI_PS_GetAvailableCredit(terminalB, &credit));
+    EXPECT_EQ(-1, credit);
+
+    helpers::CreditCallbackHandler creditFn;
+    int res = YOGI_PS_AsyncAwaitCreditChange(terminalB,
+        helpers::CreditCallbackHandler::fn, &creditFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetReceiveWindow(binding, 4));
+
+    creditFn.wait();
+    EXPECT_EQ(YOGI_OK, creditFn.lastErrorCode);
+    EXPECT_EQ(4, creditFn.credit);
+
+    // publishing uses up credit; the receiver grants two messages again once
+    // it received half of its window
+    publish("1");
+    publish("2");
+    publish("3");
+    await_credit(3);
+
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetReceiveWindow(binding, 0));
+    await_credit(-1);
+
+    res = YOGI_PS_AsyncAwaitCreditChange(terminalB,
+        helpers::CreditCallbackHandler::fn, &creditFn);
+    ASSERT_EQ(YOGI_OK, res);
+    ASSERT_EQ(YOGI_OK, YOGI_PS_CancelAwaitCreditChange(terminalB));
+    creditFn.wait();
+    EXPECT_EQ(YOGI_ERR_CANCELED, creditFn.lastErrorCode);
+
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE,
+        YOGI_PS_SetReceiveWindow(terminalA, 4));
+}
+
+TEST_F(PublishSubscribeLibraryTest, Decimation)
+{
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+
+    // give the node some time to apply the setting
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetDecimation(binding, YOGI_DC_EVERYNTH, 3));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (auto msg : {"1", "2", "3", "4", "5", "6", "7"}) {
+        publish(msg);
+    }
+
+    for (auto msg : {"1", "4", "7"}) {
+        receive(msg);
+    }
+
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetDecimation(binding, YOGI_DC_CONFLATE, 100));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (auto msg : {"a", "b", "c"}) {
+        publish(msg);
+    }
+
+    receive("a");
+    receive("c");
+
+    // nothing else has been held back
+    int res = YOGI_PS_AsyncReceiveMessage(terminalA, buffer, sizeof(buffer),
+        helpers::ReceivePublishedMessageHandler::fn, &rcvMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_CancelReceiveMessage(terminalA));
+    rcvMsgFn.wait();
+    EXPECT_EQ(YOGI_ERR_CANCELED, rcvMsgFn.lastErrorCode);
+
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM,
+        YOGI_PS_SetDecimation(binding, YOGI_DC_EVERYNTH, 0));
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, YOGI_PS_SetDecimation(binding, 3, 1));
+}
+
+TEST_F(PublishSubscribeLibraryTest, DecimationWithFlowControl)
+{
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetDecimation(binding, YOGI_DC_EVERYNTH, 3));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetReceiveWindow(binding, 4));
+    await_credit(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // dropped messages do not use up the receiver's credit
+    for (auto msg : {"1", "2", "3", "4", "5", "6", "7", "8", "9", "10"}) {
+        publish_with_credit(msg);
+    }
+
+    for (auto msg : {"1", "4", "7", "10"}) {
+        receive(msg);
+    }
+}
+
+TEST_F(PublishSubscribeLibraryTest, DecimationBetweenLeafs)
+{
+    using namespace helpers;
+    auto leafC     = make_leaf(make_scheduler());
+    auto leafD     = make_leaf(make_scheduler());
+    auto terminalC = make_terminal(leafC, YOGI_TM_PUBLISHSUBSCRIBE, "C");
+    auto terminalD = make_terminal(leafD, YOGI_TM_PUBLISHSUBSCRIBE, "D");
+    auto bindingD  = make_binding(terminalD, "C");
+    make_connection(leafC, leafD);
+    await_binding_state(bindingD, YOGI_BD_ESTABLISHED);
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalD, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetDecimation(bindingD, YOGI_DC_EVERYNTH, 2));
+
+    auto publishC = [&](const char* msg) {
+        int res;
+        do {
+            res = YOGI_PS_Publish(terminalC, msg, 2);
+        } while (res == YOGI_ERR_NOT_BOUND);
+        ASSERT_EQ(YOGI_OK, res);
+    };
+
+    auto receiveD = [&](const char* expected) {
+        int res = YOGI_PS_AsyncReceiveMessage(terminalD, buffer,
+            sizeof(buffer), helpers::ReceivePublishedMessageHandler::fn,
+            &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_STREQ(expected, buffer);
+    };
+
+    for (auto msg : {"1", "2", "3", "4", "5"}) {
+        publishC(msg);
+    }
+
+    for (auto msg : {"1", "3", "5"}) {
+        receiveD(msg);
+    }
+
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetDecimation(bindingD, YOGI_DC_CONFLATE, 100));
+    for (auto msg : {"a", "b", "c"}) {
+        publishC(msg);
+    }
+
+    receiveD("a");
+    receiveD("c");
+
+    // cached terminals cannot be decimated
+    auto cached  = make_terminal(leafD, YOGI_TM_CACHEDPUBLISHSUBSCRIBE, "E");
+    auto cachedB = make_binding(cached, "F");
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE,
+        YOGI_PS_SetDecimation(cachedB, YOGI_DC_EVERYNTH, 2));
+}
+
+TEST_F(PublishSubscribeLibraryTest, Filter)
+{
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+
+    // give the node some time to apply the filter
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterMask(binding, 0, "x", nullptr, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (auto msg : {"a1", "x1", "b1", "x5"}) {
+        publish(msg);
+    }
+
+    receive("x1");
+    receive("x5");
+
+    // all conditions have to be met; 'x' and 'y' only differ in the lowest bit
+    const char mask = '\xFE';
+    ASSERT_EQ(YOGI_OK, YOGI_PS_ClearFilter(binding));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterMask(binding, 0, "x", &mask, 1));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterRange(binding, 1, 1, '2', '4'));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (auto msg : {"x1", "y3", "x5", "a3", "x", "x4"}) {
+        publish(msg);
+    }
+
+    receive("y3");
+    receive("x4");
+
+    ASSERT_EQ(YOGI_OK, YOGI_PS_ClearFilter(binding));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    publish_receive("a1", sizeof(buffer));
+    EXPECT_STREQ("a1", buffer);
+
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM,
+        YOGI_PS_AddFilterMask(binding, 0, nullptr, nullptr, 1));
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM,
+        YOGI_PS_AddFilterRange(binding, 0, 9, 0, 1));
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM,
+        YOGI_PS_AddFilterRange(binding, 0, 1, 2, 1));
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE, YOGI_PS_ClearFilter(terminalA));
+}
+
+TEST_F(PublishSubscribeLibraryTest, FilterWithFlowControl)
+{
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterMask(binding, 0, "x", nullptr, 1));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_SetReceiveWindow(binding, 4));
+    await_credit(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // filtered data does not use up the receiver's credit, so the publisher
+    // gets granted credit again once it has used up its own
+    for (auto msg : {"a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "x1"}) {
+        publish_with_credit(msg);
+    }
+
+    receive("x1");
+    await_credit(3);
+}
+
+TEST_F(PublishSubscribeLibraryTest, FilterBetweenLeafs)
+{
+    using namespace helpers;
+    auto leafC     = make_leaf(make_scheduler());
+    auto leafD     = make_leaf(make_scheduler());
+    auto terminalC = make_terminal(leafC, YOGI_TM_PUBLISHSUBSCRIBE, "C");
+    auto terminalD = make_terminal(leafD, YOGI_TM_PUBLISHSUBSCRIBE, "D");
+    auto bindingD  = make_binding(terminalD, "C");
+    make_connection(leafC, leafD);
+    await_binding_state(bindingD, YOGI_BD_ESTABLISHED);
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalD, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterRange(bindingD, 0, 1, '3', '5'));
+
+    for (auto msg : {"1", "3", "7", "5"}) {
+        int res;
+        do {
+            res = YOGI_PS_Publish(terminalC, msg, 2);
+        } while (res == YOGI_ERR_NOT_BOUND);
+        ASSERT_EQ(YOGI_OK, res);
+    }
+
+    for (auto msg : {"3", "5"}) {
+        int res = YOGI_PS_AsyncReceiveMessage(terminalD, buffer,
+            sizeof(buffer), helpers::ReceivePublishedMessageHandler::fn,
+            &rcvMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+
+        rcvMsgFn.wait();
+        EXPECT_STREQ(msg, buffer);
+    }
+
+    // cached terminals cannot be filtered
+    auto cached  = make_terminal(leafD, YOGI_TM_CACHEDPUBLISHSUBSCRIBE, "E");
+    auto cachedB = make_binding(cached, "F");
+    EXPECT_EQ(YOGI_ERR_WRONG_OBJECT_TYPE,
+        YOGI_PS_AddFilterMask(cachedB, 0, "x", nullptr, 1));
+}
+
+TEST_F(PublishSubscribeLibraryTest, FilterAcrossNodes)
+{
+    using namespace helpers;
+    auto node2     = make_node(make_scheduler());
+    auto leafC     = make_leaf(make_scheduler());
+    auto terminalC = make_terminal(leafC, YOGI_TM_PUBLISHSUBSCRIBE, "C");
+    make_connection(leafC, node2);
+    make_connection(node2, node);
+
+    auto bindingC = make_binding(terminalA, "C");
+    await_binding_state(bindingC, YOGI_BD_ESTABLISHED);
+
+    ASSERT_EQ(YOGI_OK, YOGI_SetReceiveQueue(terminalA, 10, YOGI_RQ_DROPOLDEST));
+    ASSERT_EQ(YOGI_OK, YOGI_PS_AddFilterRange(bindingC, 0, 1, '3', '5'));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    for (auto msg : {"1", "3", "7", "5"}) {
+        int res;
+        do {
+            res = YOGI_PS_Publish(terminalC, msg, 2);
+        } while (res == YOGI_ERR_NOT_BOUND);
+        ASSERT_EQ(YOGI_OK, res);
+    }
+
+    receive("3");
+    receive("5");
+}
+
+TEST_F(PublishSubscribeLibraryTest, LiteralBindingWithWildcardCharacters)
+{
+    using namespace helpers;
+    auto terminal = make_terminal(leafA, YOGI_TM_PUBLISHSUBSCRIBE, "Sensors");
+    auto literalBinding = make_binding(terminal, "/sensors/*");
+
+    make_terminal(leafB, YOGI_TM_PUBLISHSUBSCRIBE, "/sensors/1");
+    auto literal = make_terminal(leafB, YOGI_TM_PUBLISHSUBSCRIBE, "/sensors/*");
+    await_binding_state(literalBinding, YOGI_BD_ESTABLISHED);
+
+    EXPECT_EQ(YOGI_OK, YOGI_Destroy(literal));
+    await_binding_state(literalBinding, YOGI_BD_RELEASED);
+
+    void* dummy;
+    EXPECT_EQ(YOGI_ERR_INVALID_PARAM, YOGI_CreateBindingEx(&dummy, terminal,
+        "/sensors/*", 1234));
+}
@@ -5,6 +5,9 @@
 
 #include <thread>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
 
 
 struct ScatterGatherLibraryTest : public testing::Test
@@ -204,6 +207,138 @@ TEST_F(ScatterGatherLibraryTest, CancelScatterGatherOperation)
     EXPECT_EQ(0, rcvGatheredMsgFn.size);
 }
 
+TEST_F(ScatterGatherLibraryTest, FinishScatterGatherOperationOnTimeout)
+{
+    helpers::ReceiveScatteredMessageHandler rcvScatteredMsgFnB;
+    int res = YOGI_SG_AsyncReceiveScatteredMessage(terminalB, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFnB);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SG_AsyncReceiveScatteredMessage(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    int id = YOGI_SG_AsyncScatterGatherEx(terminalA, "Hi", 3, nullptr, 0, 50,
+        0, helpers::ReceiveGatheredMessageHandler::fn, &rcvGatheredMsgFn);
+    ASSERT_GT(id, 0);
+
+    rcvScatteredMsgFnB.wait();
+    rcvScatteredMsgFn.wait();
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+    EXPECT_EQ(YOGI_SG_TIMEOUT | YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+    EXPECT_EQ(YOGI_OK, rcvGatheredMsgFn.lastErrorCode);
+    EXPECT_EQ(0, rcvGatheredMsgFn.size);
+
+    // late responses get discarded
+    res = YOGI_SG_RespondToScatteredMessage(terminalC,
+        rcvScatteredMsgFn.operationId, "X", 2);
+    EXPECT_EQ(YOGI_OK, res);
+    res = YOGI_SG_IgnoreScatteredMessage(terminalB,
+        rcvScatteredMsgFnB.operationId);
+    EXPECT_EQ(YOGI_OK, res);
+
+    helpers::ReceiveGatheredMessageHandler rcvGatheredMsgFn2;
+    id = YOGI_SG_AsyncScatterGather(terminalA, "Hi", 3, nullptr, 0,
+        helpers::ReceiveGatheredMessageHandler::fn, &rcvGatheredMsgFn2);
+    ASSERT_GT(id, 0);
+
+    rcvGatheredMsgFn2.wait(2);
+    EXPECT_EQ(YOGI_SG_DEAF | YOGI_SG_FINISHED, rcvGatheredMsgFn2.flags);
+    EXPECT_EQ(1, rcvGatheredMsgFn.calls());
+}
+
+TEST_F(ScatterGatherLibraryTest, FinishScatterGatherOperationOnQuorum)
+{
+    helpers::ReceiveScatteredMessageHandler rcvScatteredMsgFnB;
+    int res = YOGI_SG_AsyncReceiveScatteredMessage(terminalB, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFnB);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SG_AsyncReceiveScatteredMessage(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    char scatBuffer[10] = {0};
+    int id = YOGI_SG_AsyncScatterGatherEx(terminalA, "Hi", 3, scatBuffer,
+        sizeof(scatBuffer), -1, 1, helpers::ReceiveGatheredMessageHandler::fn,
+        &rcvGatheredMsgFn);
+    ASSERT_GT(id, 0);
+
+    rcvScatteredMsgFnB.wait();
+    rcvScatteredMsgFn.wait();
+
+    res = YOGI_SG_RespondToScatteredMessage(terminalC,
+        rcvScatteredMsgFn.operationId, "X", 2);
+    EXPECT_EQ(YOGI_OK, res);
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+    EXPECT_EQ(YOGI_SG_QUORUM | YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+    EXPECT_EQ(YOGI_OK, rcvGatheredMsgFn.lastErrorCode);
+    EXPECT_EQ(2, rcvGatheredMsgFn.size);
+    EXPECT_STREQ("X", scatBuffer);
+
+    // responses after reaching the quorum get discarded
+    res = YOGI_SG_RespondToScatteredMessage(terminalB,
+        rcvScatteredMsgFnB.operationId, "Y", 2);
+    EXPECT_EQ(YOGI_OK, res);
+
+    wait_until_system_stable();
+    EXPECT_EQ(1, rcvGatheredMsgFn.calls());
+}
+
+TEST_F(ScatterGatherLibraryTest, AggregatedScatterGatherOperation)
+{
+    helpers::ReceiveScatteredMessageHandler rcvScatteredMsgFnB;
+    int res = YOGI_SG_AsyncReceiveScatteredMessage(terminalB, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFnB);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SG_AsyncReceiveScatteredMessage(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    helpers::ReceiveGatheredMessagesHandler rcvGatheredMsgsFn;
+    char scatBuffer[2 * YOGI_SG_RESPONSE_HEADER_SIZE + 10] = {0};
+    int id = YOGI_SG_AsyncScatterGatherBatched(terminalA, "Hi", 3, scatBuffer,
+        sizeof(scatBuffer), -1, 0, YOGI_SG_AGGREGATE_UNTIL_FINISHED,
+        helpers::ReceiveGatheredMessagesHandler::fn, &rcvGatheredMsgsFn);
+    ASSERT_GT(id, 0);
+
+    rcvScatteredMsgFnB.wait();
+    rcvScatteredMsgFn.wait();
+
+    res = YOGI_SG_RespondToScatteredMessage(terminalB,
+        rcvScatteredMsgFnB.operationId, "Y", 2);
+    EXPECT_EQ(YOGI_OK, res);
+    res = YOGI_SG_RespondToScatteredMessage(terminalC,
+        rcvScatteredMsgFn.operationId, "X", 2);
+    EXPECT_EQ(YOGI_OK, res);
+
+    // the node delivers both responses at once
+    rcvGatheredMsgsFn.wait();
+    EXPECT_EQ(1, rcvGatheredMsgsFn.calls());
+    EXPECT_EQ(id, rcvGatheredMsgsFn.operationId);
+    EXPECT_EQ(YOGI_OK, rcvGatheredMsgsFn.lastErrorCode);
+    EXPECT_EQ(YOGI_SG_FINISHED, rcvGatheredMsgsFn.flags);
+    EXPECT_EQ(2u, rcvGatheredMsgsFn.numResponses);
+    EXPECT_EQ(2u * (YOGI_SG_RESPONSE_HEADER_SIZE + 2),
+        rcvGatheredMsgsFn.size);
+
+    std::string responses;
+    for (unsigned pos = 0; pos < rcvGatheredMsgsFn.size;
+        pos += YOGI_SG_RESPONSE_HEADER_SIZE + 2) {
+        std::uint32_t size;
+        std::memcpy(&size, scatBuffer + pos, sizeof(size));
+        EXPECT_EQ(2u, size);
+        responses += scatBuffer + pos + YOGI_SG_RESPONSE_HEADER_SIZE;
+    }
+
+    EXPECT_TRUE(responses == "XY" || responses == "YX");
+}
+
 TEST_F(ScatterGatherLibraryTest, CancelReceiveScatteredMessageOperation)
 {
     char gathBuffer[10] = {0};
@@ -107,6 +107,127 @@ TEST_F(ServiceClientLibraryTest, SuccessfulScatterGatherOperation)
     EXPECT_STREQ("X", scatBuffer);
 }
 
+TEST_F(ServiceClientLibraryTest, RequestWithTimeout)
+{
+    int res = YOGI_SC_AsyncReceiveRequest(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    int id = YOGI_SC_AsyncRequestEx(terminalA, "Hi", 3, nullptr, 0, 50, 0,
+        helpers::ReceiveGatheredMessageHandler::fn, &rcvGatheredMsgFn);
+    ASSERT_GT(id, 0);
+
+    rcvScatteredMsgFn.wait();
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+    EXPECT_EQ(YOGI_SG_DEAF, rcvGatheredMsgFn.flags);
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+    EXPECT_EQ(YOGI_SG_TIMEOUT | YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+    EXPECT_EQ(YOGI_OK, rcvGatheredMsgFn.lastErrorCode);
+    EXPECT_EQ(0, rcvGatheredMsgFn.size);
+
+    // the late response gets discarded
+    res = YOGI_SC_RespondToRequest(terminalC, rcvScatteredMsgFn.operationId,
+        "X", 2);
+    EXPECT_EQ(YOGI_OK, res);
+
+    helpers::ReceiveGatheredMessageHandler rcvGatheredMsgFn2;
+    id = YOGI_SC_AsyncRequest(terminalA, "Hi", 3, nullptr, 0,
+        helpers::ReceiveGatheredMessageHandler::fn, &rcvGatheredMsgFn2);
+    ASSERT_GT(id, 0);
+
+    rcvGatheredMsgFn2.wait(2);
+    EXPECT_EQ(YOGI_SG_DEAF | YOGI_SG_FINISHED, rcvGatheredMsgFn2.flags);
+    EXPECT_EQ(2, rcvGatheredMsgFn.calls());
+}
+
+TEST_F(ServiceClientLibraryTest, AnycastRequest)
+{
+    helpers::ReceiveScatteredMessageHandler rcvScatteredMsgFnB;
+    int res = YOGI_SC_AsyncReceiveRequest(terminalB, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFnB);
+    ASSERT_EQ(YOGI_OK, res);
+
+    res = YOGI_SC_AsyncReceiveRequest(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    char scatBuffer[10] = {0};
+    int id = YOGI_SC_AsyncAnycastRequest(terminalA, "Hi", 3, scatBuffer,
+        sizeof(scatBuffer), YOGI_LB_ROUNDROBIN, -1,
+        helpers::ReceiveGatheredMessageHandler::fn, &rcvGatheredMsgFn);
+    ASSERT_GT(id, 0);
+
+    while (!rcvScatteredMsgFnB.calls() && !rcvScatteredMsgFn.calls()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    bool bChosen = !!rcvScatteredMsgFnB.calls();
+    auto& chosenFn = bChosen ? rcvScatteredMsgFnB : rcvScatteredMsgFn;
+    res = YOGI_SC_RespondToRequest(bChosen ? terminalB : terminalC,
+        chosenFn.operationId, "X", 2);
+    EXPECT_EQ(YOGI_OK, res);
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+    EXPECT_EQ(YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+    EXPECT_EQ(2, rcvGatheredMsgFn.size);
+    EXPECT_STREQ("X", scatBuffer);
+    EXPECT_EQ(1, rcvScatteredMsgFnB.calls() + rcvScatteredMsgFn.calls());
+
+    res = YOGI_SC_CancelReceiveRequest(bChosen ? terminalC : terminalB);
+    EXPECT_EQ(YOGI_OK, res);
+    (bChosen ? rcvScatteredMsgFn : rcvScatteredMsgFnB).wait();
+}
+
+TEST_F(ServiceClientLibraryTest, AnycastRequestFailover)
+{
+    int res = YOGI_SC_AsyncReceiveRequest(terminalC, nullptr, 0,
+        helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+    ASSERT_EQ(YOGI_OK, res);
+
+    // B is deaf, so the request ends up at C no matter who gets picked first
+    for (auto policy : {YOGI_LB_ROUNDROBIN, YOGI_LB_LEASTOUTSTANDING,
+        YOGI_LB_LOWESTLATENCY}) {
+        helpers::ReceiveGatheredMessageHandler rcvGatheredMsgFn;
+        int id = YOGI_SC_AsyncAnycastRequest(terminalA, "Hi", 3, nullptr, 0,
+            policy, -1, helpers::ReceiveGatheredMessageHandler::fn,
+            &rcvGatheredMsgFn);
+        ASSERT_GT(id, 0);
+
+        rcvScatteredMsgFn.wait();
+        res = YOGI_SC_RespondToRequest(terminalC,
+            rcvScatteredMsgFn.operationId, nullptr, 0);
+        EXPECT_EQ(YOGI_OK, res);
+
+        rcvGatheredMsgFn.wait();
+        EXPECT_EQ(id, rcvGatheredMsgFn.operationId);
+        EXPECT_EQ(YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+        EXPECT_EQ(1, rcvGatheredMsgFn.calls());
+
+        res = YOGI_SC_AsyncReceiveRequest(terminalC, nullptr, 0,
+            helpers::ReceiveScatteredMessageHandler::fn, &rcvScatteredMsgFn);
+        ASSERT_EQ(YOGI_OK, res);
+    }
+
+    // no service left to fail over to
+    res = YOGI_SC_CancelReceiveRequest(terminalC);
+    ASSERT_EQ(YOGI_OK, res);
+    rcvScatteredMsgFn.wait();
+
+    int id = YOGI_SC_AsyncAnycastRequest(terminalA, "Hi", 3, nullptr, 0,
+        YOGI_LB_ROUNDROBIN, -1, helpers::ReceiveGatheredMessageHandler::fn,
+        &rcvGatheredMsgFn);
+    ASSERT_GT(id, 0);
+
+    rcvGatheredMsgFn.wait();
+    EXPECT_EQ(YOGI_SG_DEAF | YOGI_SG_FINISHED, rcvGatheredMsgFn.flags);
+    EXPECT_EQ(1, rcvGatheredMsgFn.calls());
+}
+
 TEST_F(ServiceClientLibraryTest, IgnoreScatteredMessage)
 {
     char gathBuffer[10] = {0};
@@ -71,6 +71,27 @@ TEST_F(TcpLibraryTest, ClientServerConnection)
 	EXPECT_EQ(YOGI_OK, res);
 }
 
+TEST_F(TcpLibraryTest, WorkStealingScheduler)
+{
+    helpers::destroy(leafConn);
+    helpers::destroy(nodeConn);
+
+    int res = YOGI_CreateSchedulerEx(&scheduler, YOGI_ST_WORKSTEALING);
+    ASSERT_EQ(YOGI_OK, res);
+    res = YOGI_SetSchedulerThreadPoolSize(scheduler, 3);
+    ASSERT_EQ(YOGI_OK, res);
+
+    leaf = helpers::make_leaf(scheduler);
+    node = helpers::make_node(scheduler);
+    make_connections();
+
+    res = YOGI_AssignConnection(leafConn, leaf, -1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_AssignConnection(nodeConn, node, -1);
+    EXPECT_EQ(YOGI_OK, res);
+}
+
 TEST_F(TcpLibraryTest, CancelAccept)
 {
 	void* server = helpers::make_tcp_server(scheduler, "Hello");
@@ -168,3 +189,47 @@ TEST_F(TcpLibraryTest, ConnectionInformation)
     EXPECT_STREQ("Hello", buffer);
     EXPECT_EQ(6, n);
 }
+
+TEST_F(TcpLibraryTest, MultiplexedConnection)
+{
+    void* leafB = helpers::make_leaf(scheduler);
+
+    void* channelA;
+    int res = YOGI_CreateTcpChannel(&channelA, nodeConn, leaf);
+    EXPECT_EQ(YOGI_ERR_NOT_MULTIPLEXED, res);
+
+    res = YOGI_AssignMultiplexedConnection(nodeConn, -1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_AssignConnection(leafConn, node, -1);
+    EXPECT_EQ(YOGI_OK, res);
+
+    res = YOGI_CreateTcpChannel(&channelA, nodeConn, leaf);
+    EXPECT_EQ(YOGI_OK, res);
+
+    void* channelB;
+    res = YOGI_CreateTcpChannel(&channelB, nodeConn, leafB);
+    EXPECT_EQ(YOGI_OK, res);
+
+    // both leafs reach each other via the node on the remote end
+    void* terminalA = helpers::make_terminal(leaf, YOGI_TM_DEAFMUTE, "A");
+    void* terminalB = helpers::make_terminal(leafB, YOGI_TM_DEAFMUTE, "B");
+    void* binding   = helpers::make_binding(terminalB, "A");
+    helpers::await_binding_state(binding, YOGI_BD_ESTABLISHED);
+
+    char buffer[100];
+    res = YOGI_GetConnectionDescription(channelA, buffer, sizeof(buffer));
+    EXPECT_EQ(YOGI_OK, res);
+
+    // the channels keep the connection alive
+    EXPECT_EQ(YOGI_ERR_OBJECT_STILL_USED, YOGI_Destroy(nodeConn));
+
+    helpers::destroy(channelA);
+    helpers::await_binding_state(binding, YOGI_BD_RELEASED);
+
+    helpers::destroy(binding);
+    helpers::destroy(terminalA);
+    helpers::destroy(terminalB);
+    helpers::destroy(channelB);
+    helpers::destroy(nodeConn);
+}
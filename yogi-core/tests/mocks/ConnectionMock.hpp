@@ -13,6 +13,8 @@ namespace mocks {
 struct ConnectionMock : public interfaces::IConnection
 {
     MOCK_METHOD1(send, void (const interfaces::IMessage&) noexcept);
+    MOCK_METHOD2(async_send, void (const interfaces::IMessage&,
+        send_handler_fn) noexcept);
     MOCK_CONST_METHOD0(remote_is_node, bool () noexcept);
     MOCK_CONST_METHOD0(description, const std::string& () noexcept);
 	MOCK_CONST_METHOD0(remote_version, const std::string& () noexcept);
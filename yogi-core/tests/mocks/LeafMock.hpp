@@ -20,7 +20,9 @@ struct LeafMock : public core::Leaf
 
     virtual std::pair<base::Id, std::unique_lock<std::recursive_mutex>>
         sg_scatter(core::scatter_gather::Terminal<>& terminal,
-            base::Buffer&& data) override
+            base::Buffer&& data, std::chrono::milliseconds, std::size_t,
+            core::scatter_gather::anycast_policy, bool,
+            std::chrono::milliseconds) override
     {
         static std::recursive_mutex m;
         return std::make_pair(scatter_(terminal, data),
@@ -33,6 +33,15 @@ struct ScatterGatherTerminalMock
         return on_gathered_message_received_(operationId, flags, data);
     }
 
+    MOCK_METHOD2(on_gathered_messages_received_, bool (base::Id,
+        core::scatter_gather::gathered_responses& responses));
+
+    virtual bool on_gathered_messages_received(base::Id operationId,
+        core::scatter_gather::gathered_responses&& responses) override
+    {
+        return on_gathered_messages_received_(operationId, responses);
+    }
+
     ScatterGatherTerminalMock(core::Leaf& leaf,
         base::Identifier identifier)
         : core::scatter_gather::Terminal<>(leaf, identifier)
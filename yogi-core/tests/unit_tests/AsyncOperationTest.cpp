@@ -65,3 +65,37 @@ TEST_F(AsyncOperationTest, NonVoidReturnType)
     EXPECT_EQ(12345, op.fire<YOGI_OK>());
 }
 
+
+TEST_F(AsyncOperationTest, CallbackExecutor)
+{
+    scheduling::CallbackExecutor executor;
+    executor.configure(1, 1, scheduling::CallbackExecutor::BLOCK);
+    scheduling::CallbackExecutor::set_thread_executor(&executor);
+
+    std::thread::id handlerThread;
+    op.arm([&](const api::Exception& e, int x) {
+        handlerThread = std::this_thread::get_id();
+        fn(e, x);
+    });
+
+    {{
+        // the handler must not be executed on the firing thread
+        std::lock_guard<std::mutex> lock{mutex};
+        op.fire<YOGI_ERR_CANCELED>(55);
+        EXPECT_EQ(0, calls);
+    }}
+
+    op.await_idle();
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(YOGI_ERR_CANCELED, errorCode);
+    EXPECT_EQ(55, arg);
+    EXPECT_NE(std::this_thread::get_id(), handlerThread);
+
+    // handlers with a return value are always executed on the firing thread
+    typedef std::function<int (const api::Exception&)> int_handler_fn;
+    base::AsyncOperation<int_handler_fn> intOp;
+    intOp.arm([](const api::Exception&){ return 12345; });
+    EXPECT_EQ(12345, intOp.fire<YOGI_OK>());
+
+    scheduling::CallbackExecutor::set_thread_executor(nullptr);
+}
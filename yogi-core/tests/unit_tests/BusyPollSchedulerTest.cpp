@@ -0,0 +1,97 @@
+#include "../../src/scheduling/BusyPollScheduler.hpp"
+#include "../../src/api/ExceptionT.hpp"
+using namespace yogi::scheduling;
+
+#include <gmock/gmock.h>
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+
+struct BusyPollSchedulerTest : public testing::Test
+{
+    std::shared_ptr<BusyPollScheduler> uut;
+    std::mutex                         mutex;
+
+    virtual void SetUp() override
+    {
+        uut = std::make_shared<BusyPollScheduler>();
+    }
+
+    void check_parallel_tasks(size_t parallelTasks)
+    {
+        std::atomic<size_t> n{0};
+        std::atomic<size_t> m{0};
+
+        auto fn = [&] {
+            ++n;
+            {{ std::lock_guard<std::mutex> lock(mutex); }}
+            ++m;
+        };
+
+        {{
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < parallelTasks + 1; ++i)
+                uut->post(fn);
+
+            while (n < parallelTasks)
+                std::this_thread::yield();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+            EXPECT_EQ(parallelTasks, n);
+        }}
+
+        while (m != parallelTasks + 1)
+            std::this_thread::yield();
+    }
+};
+
+TEST_F(BusyPollSchedulerTest, DefaultThreadPoolSize)
+{
+    check_parallel_tasks(YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE);
+}
+
+TEST_F(BusyPollSchedulerTest, ResizeThreadPool)
+{
+    uut->resize_thread_pool(3);
+    check_parallel_tasks(3);
+
+    uut->resize_thread_pool(1);
+    check_parallel_tasks(1);
+
+    uut->resize_thread_pool(4);
+    check_parallel_tasks(4);
+}
+
+TEST_F(BusyPollSchedulerTest, SpinForever)
+{
+    uut->set_spin_duration(-1);
+    check_parallel_tasks(1);
+
+    // give the thread time to start spinning
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    check_parallel_tasks(1);
+}
+
+TEST_F(BusyPollSchedulerTest, Park)
+{
+    uut->set_spin_duration(0);
+    uut->resize_thread_pool(2);
+
+    // give the threads time to park
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    check_parallel_tasks(2);
+
+    uut->resize_thread_pool(1);
+    check_parallel_tasks(1);
+}
+
+TEST_F(BusyPollSchedulerTest, RealtimePriority)
+{
+    EXPECT_NO_THROW(uut->set_realtime_priority(0));
+    EXPECT_THROW(uut->set_realtime_priority(-1),
+        yogi::api::ExceptionT<YOGI_ERR_INVALID_PARAM>);
+}
@@ -0,0 +1,235 @@
+#include "../../src/scheduling/CallbackExecutor.hpp"
+#include "../../src/api/ExceptionT.hpp"
+using namespace yogi;
+using namespace yogi::scheduling;
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+
+
+struct CallbackExecutorTest : public testing::Test
+{
+    CallbackExecutor uut;
+
+    std::mutex        mutex;
+    std::atomic<int>  calls{0};
+    std::thread::id   callerThread;
+
+    CallbackExecutor::callback_fn make_callback()
+    {
+        return [&] {
+            {{ std::lock_guard<std::mutex> lock(mutex); }}
+            callerThread = std::this_thread::get_id();
+            ++calls;
+        };
+    }
+
+    void await_calls(int n)
+    {
+        while (calls != n) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+TEST_F(CallbackExecutorTest, Disabled)
+{
+    EXPECT_FALSE(uut.enabled());
+
+    uut.execute(make_callback());
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(std::this_thread::get_id(), callerThread);
+}
+
+TEST_F(CallbackExecutorTest, ThreadExecutor)
+{
+    CallbackExecutor::set_thread_executor(&uut);
+    EXPECT_EQ(nullptr, CallbackExecutor::thread_executor());
+
+    uut.configure(1, 1, CallbackExecutor::BLOCK);
+    EXPECT_EQ(&uut, CallbackExecutor::thread_executor());
+
+    CallbackExecutor::set_thread_executor(nullptr);
+    EXPECT_EQ(nullptr, CallbackExecutor::thread_executor());
+}
+
+TEST_F(CallbackExecutorTest, ExecuteOnOwnThreads)
+{
+    uut.configure(2, 10, CallbackExecutor::BLOCK);
+    EXPECT_TRUE(uut.enabled());
+
+    uut.execute(make_callback());
+    await_calls(1);
+    EXPECT_NE(std::this_thread::get_id(), callerThread);
+}
+
+TEST_F(CallbackExecutorTest, BlockIfQueueFull)
+{
+    uut.configure(1, 1, CallbackExecutor::BLOCK);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    uut.execute(make_callback()); // blocked by the mutex
+    uut.execute(make_callback()); // queued
+
+    std::atomic<bool> executed{false};
+    std::thread th([&] {
+        uut.execute(make_callback());
+        executed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(executed);
+
+    lock.unlock();
+    th.join();
+    await_calls(3);
+    EXPECT_NE(std::this_thread::get_id(), callerThread);
+}
+
+TEST_F(CallbackExecutorTest, RunInlineIfQueueFull)
+{
+    uut.configure(1, 1, CallbackExecutor::RUN_INLINE);
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    uut.execute([&] {
+        started = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    uut.execute(make_callback()); // queued
+    uut.execute(make_callback()); // no space left
+    EXPECT_EQ(1, calls);
+    EXPECT_EQ(std::this_thread::get_id(), callerThread);
+
+    release = true;
+    await_calls(2);
+}
+
+TEST_F(CallbackExecutorTest, Reconfigure)
+{
+    uut.configure(1, 10, CallbackExecutor::BLOCK);
+
+    // queued callbacks must be executed before the threads terminate
+    std::unique_lock<std::mutex> lock(mutex);
+    for (int i = 0; i < 5; ++i) {
+        uut.execute(make_callback());
+    }
+
+    std::thread th([&] {
+        uut.configure(0, 0, CallbackExecutor::BLOCK);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    lock.unlock();
+    th.join();
+
+    EXPECT_EQ(5, calls);
+    EXPECT_FALSE(uut.enabled());
+
+    EXPECT_THROW(uut.configure(1, 0, CallbackExecutor::BLOCK),
+        api::ExceptionT<YOGI_ERR_INVALID_PARAM>);
+}
+
+TEST_F(CallbackExecutorTest, ConfigureFromCallback)
+{
+    uut.configure(1, 1, CallbackExecutor::BLOCK);
+
+    std::atomic<int> errorCode{YOGI_OK};
+    uut.execute([&] {
+        try {
+            uut.configure(2, 1, CallbackExecutor::BLOCK);
+        }
+        catch (const api::Exception& e) {
+            errorCode = e.error_code();
+        }
+
+        ++calls;
+    });
+
+    await_calls(1);
+    EXPECT_EQ(YOGI_ERR_WRONG_THREAD, errorCode);
+}
+
+TEST_F(CallbackExecutorTest, Sequences)
+{
+    uut.configure(4, 100, CallbackExecutor::BLOCK);
+
+    // callbacks of the same sequence must neither overlap nor get reordered
+    int sequenceA = 0;
+    int sequenceB = 0;
+    std::atomic<int> runningA{0};
+    std::atomic<bool> overlapped{false};
+    std::vector<int> orderA;
+
+    for (int i = 0; i < 50; ++i) {
+        uut.execute([&, i] {
+            if (++runningA > 1) {
+                overlapped = true;
+            }
+
+            orderA.push_back(i);
+            std::this_thread::yield();
+            --runningA;
+            ++calls;
+        }, &sequenceA);
+
+        uut.execute([&] { ++calls; }, &sequenceB);
+        uut.execute([&] { ++calls; });
+    }
+
+    await_calls(150);
+    EXPECT_FALSE(overlapped);
+    ASSERT_EQ(50u, orderA.size());
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(i, orderA[i]);
+    }
+}
+
+TEST_F(CallbackExecutorTest, NoInlineExecutionOfPendingSequence)
+{
+    uut.configure(1, 1, CallbackExecutor::RUN_INLINE);
+
+    int sequence = 0;
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    uut.execute([&] {
+        started = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+
+        ++calls;
+    }, &sequence);
+
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    uut.execute(make_callback(), &sequence); // queued
+
+    // no space left but the callback must not overtake the queued one
+    std::atomic<bool> executed{false};
+    std::thread th([&] {
+        uut.execute(make_callback(), &sequence);
+        executed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_FALSE(executed);
+
+    release = true;
+    th.join();
+    await_calls(3);
+    EXPECT_NE(std::this_thread::get_id(), callerThread);
+}
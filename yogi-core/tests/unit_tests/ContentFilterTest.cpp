@@ -0,0 +1,120 @@
+#include "../../src/core/publish_subscribe/ContentFilter.hpp"
+using namespace yogi::core::publish_subscribe;
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <string>
+
+
+struct ContentFilterTest : public testing::Test
+{
+    static Buffer make_buffer(const std::string& str)
+    {
+        return Buffer{str.data(), str.size()};
+    }
+
+    static ContentFilter make_filter(ContentFilter::condition cond)
+    {
+        ContentFilter filter;
+        filter.add_condition(std::move(cond));
+        return filter;
+    }
+};
+
+TEST_F(ContentFilterTest, LetsEverythingPassByDefault)
+{
+    ContentFilter uut;
+    EXPECT_TRUE(uut.lets_everything_pass());
+    EXPECT_TRUE(uut.matches(make_buffer("")));
+    EXPECT_TRUE(uut.matches(make_buffer("abc")));
+    EXPECT_EQ(0u, uut.to_buffer().size());
+}
+
+TEST_F(ContentFilterTest, MaskCondition)
+{
+    unsigned char mask[] = {0xFF, 0xF0};
+    auto uut = make_filter(ContentFilter::make_mask_condition(1, "ab", mask,
+        2));
+
+    EXPECT_TRUE(uut.matches(make_buffer("xab")));
+    EXPECT_TRUE(uut.matches(make_buffer("xacz")));
+    EXPECT_FALSE(uut.matches(make_buffer("xbb")));
+    EXPECT_FALSE(uut.matches(make_buffer("xa")));
+    EXPECT_FALSE(uut.matches(make_buffer("")));
+}
+
+TEST_F(ContentFilterTest, RangeCondition)
+{
+    auto uut = make_filter(ContentFilter::make_range_condition(1, 2, 0x0100,
+        0x0200));
+
+    EXPECT_TRUE(uut.matches(make_buffer(std::string("x\x00\x01", 3))));
+    EXPECT_TRUE(uut.matches(make_buffer(std::string("x\xFF\x01", 3))));
+    EXPECT_TRUE(uut.matches(make_buffer(std::string("x\x00\x02z", 4))));
+    EXPECT_FALSE(uut.matches(make_buffer(std::string("x\x01\x02", 3))));
+    EXPECT_FALSE(uut.matches(make_buffer(std::string("x\x01\x00", 3))));
+    EXPECT_FALSE(uut.matches(make_buffer(std::string("x\x00", 2))));
+}
+
+TEST_F(ContentFilterTest, AllConditionsOfAnAlternativeMustBeMet)
+{
+    auto uut = make_filter(ContentFilter::make_mask_condition(0, "a", nullptr,
+        1));
+    uut.add_condition(ContentFilter::make_range_condition(1, 1, '1', '3'));
+
+    EXPECT_TRUE(uut.matches(make_buffer("a2")));
+    EXPECT_FALSE(uut.matches(make_buffer("a4")));
+    EXPECT_FALSE(uut.matches(make_buffer("b2")));
+}
+
+TEST_F(ContentFilterTest, Merge)
+{
+    auto uut = make_filter(ContentFilter::make_mask_condition(0, "a", nullptr,
+        1));
+    auto other = make_filter(ContentFilter::make_mask_condition(0, "b",
+        nullptr, 1));
+
+    uut.merge(other);
+    uut.merge(other);
+    EXPECT_EQ(2u, uut.alternatives().size());
+    EXPECT_TRUE(uut.matches(make_buffer("a")));
+    EXPECT_TRUE(uut.matches(make_buffer("b")));
+    EXPECT_FALSE(uut.matches(make_buffer("c")));
+
+    uut.merge(ContentFilter{});
+    EXPECT_TRUE(uut.lets_everything_pass());
+
+    uut.merge(other);
+    EXPECT_TRUE(uut.lets_everything_pass());
+}
+
+TEST_F(ContentFilterTest, MergeTooManyAlternatives)
+{
+    ContentFilter uut;
+    for (std::size_t i = 0; i <= ContentFilter::MAX_ALTERNATIVES; ++i) {
+        auto filter = make_filter(ContentFilter::make_range_condition(0, 1, i,
+            i));
+        if (i == 0) {
+            uut = filter;
+        }
+        else {
+            uut.merge(filter);
+        }
+    }
+
+    EXPECT_TRUE(uut.lets_everything_pass());
+}
+
+TEST_F(ContentFilterTest, Serialization)
+{
+    auto uut = make_filter(ContentFilter::make_mask_condition(3, "xyz",
+        nullptr, 3));
+    uut.add_condition(ContentFilter::make_range_condition(1000, 8, 5,
+        0xFFFFFFFFFFFFFFFFull));
+    uut.merge(make_filter(ContentFilter::make_range_condition(0, 4, 1, 2)));
+
+    EXPECT_EQ(uut, ContentFilter{uut.to_buffer()});
+    EXPECT_TRUE(ContentFilter{make_buffer("\x01\x01\x07")}
+        .lets_everything_pass());
+}
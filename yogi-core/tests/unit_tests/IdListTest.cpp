@@ -0,0 +1,109 @@
+#include "../../src/base/IdList.hpp"
+#include "../../src/base/ObjectRegister.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+
+struct IdListTest : public testing::Test
+{
+    struct element
+    {
+        int        value = 0;
+        IdListHook hook1;
+        IdListHook hook2;
+    };
+
+    ObjectRegister<element> reg;
+
+    Id add(int value)
+    {
+        auto id = reg.insert();
+        reg[id].value = value;
+        return id;
+    }
+
+    std::vector<int> values(const IdList& list, IdListHook element::* hook)
+    {
+        std::vector<int> v;
+        list.foreach(reg, hook, [&](Id id) {
+            v.push_back(reg[id].value);
+        });
+
+        return v;
+    }
+};
+
+TEST_F(IdListTest, BasicBehavior)
+{
+    IdList uut;
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_FALSE(uut.front().valid());
+
+    auto id1 = add(1);
+    auto id2 = add(2);
+    auto id3 = add(3);
+    uut.push_front(reg, &element::hook1, id1);
+    uut.push_front(reg, &element::hook1, id2);
+    uut.push_front(reg, &element::hook1, id3);
+
+    EXPECT_FALSE(uut.empty());
+    EXPECT_EQ(3u, uut.size());
+    EXPECT_EQ(id3, uut.front());
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), values(uut, &element::hook1));
+
+    uut.erase(reg, &element::hook1, id2);
+    EXPECT_EQ((std::vector<int>{3, 1}), values(uut, &element::hook1));
+
+    uut.erase(reg, &element::hook1, id3);
+    EXPECT_EQ(id1, uut.front());
+    EXPECT_EQ((std::vector<int>{1}), values(uut, &element::hook1));
+
+    uut.erase(reg, &element::hook1, id1);
+    EXPECT_TRUE(uut.empty());
+
+    // erased elements can be added again
+    uut.push_front(reg, &element::hook1, id2);
+    EXPECT_EQ((std::vector<int>{2}), values(uut, &element::hook1));
+}
+
+TEST_F(IdListTest, MultipleHooks)
+{
+    IdList odd, all;
+    for (int i = 1; i <= 4; ++i) {
+        auto id = add(i);
+        all.push_front(reg, &element::hook1, id);
+        if (i % 2) {
+            odd.push_front(reg, &element::hook2, id);
+        }
+    }
+
+    EXPECT_EQ((std::vector<int>{4, 3, 2, 1}), values(all, &element::hook1));
+    EXPECT_EQ((std::vector<int>{3, 1}), values(odd, &element::hook2));
+
+    auto id3 = odd.front();
+    odd.erase(reg, &element::hook2, id3);
+    EXPECT_EQ((std::vector<int>{4, 3, 2, 1}), values(all, &element::hook1));
+    EXPECT_EQ((std::vector<int>{1}), values(odd, &element::hook2));
+}
+
+TEST_F(IdListTest, EraseWhileIterating)
+{
+    IdList uut;
+    for (int i = 1; i <= 5; ++i) {
+        uut.push_front(reg, &element::hook1, add(i));
+    }
+
+    uut.foreach(reg, &element::hook1, [&](Id id) {
+        if (reg[id].value % 2) {
+            uut.erase(reg, &element::hook1, id);
+            reg.erase(id);
+        }
+    });
+
+    EXPECT_EQ(2u, uut.size());
+    EXPECT_EQ((std::vector<int>{4, 2}), values(uut, &element::hook1));
+}
@@ -0,0 +1,97 @@
+#include "../../src/base/InternedName.hpp"
+#include "../../src/base/Identifier.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <thread>
+#include <vector>
+#include <string>
+
+
+struct InternedNameTest : public testing::Test
+{
+};
+
+TEST_F(InternedNameTest, EqualNamesShareEntry)
+{
+    auto tableSize = InternedName::table_size();
+
+    InternedName a{std::string("/some/long/terminal/name")};
+    InternedName b{std::string("/some/long/terminal/name")};
+    InternedName c{std::string("/another/terminal/name")};
+
+    EXPECT_EQ(tableSize + 2, InternedName::table_size());
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(&a.str(), &b.str());
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_NE(a.hash(), c.hash());
+    EXPECT_EQ("/some/long/terminal/name", a.str());
+}
+
+TEST_F(InternedNameTest, EntriesGetReleased)
+{
+    auto tableSize = InternedName::table_size();
+
+    {
+        InternedName a{std::string("Released")};
+        InternedName b{a};
+        InternedName c{std::move(a)};
+        b = InternedName{std::string("Other")};
+        EXPECT_EQ(tableSize + 2, InternedName::table_size());
+    }
+
+    EXPECT_EQ(tableSize, InternedName::table_size());
+}
+
+TEST_F(InternedNameTest, EmptyName)
+{
+    auto tableSize = InternedName::table_size();
+
+    InternedName a;
+    InternedName b{std::string()};
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ("", b.str());
+    EXPECT_EQ(tableSize, InternedName::table_size());
+}
+
+TEST_F(InternedNameTest, ConcurrentUse)
+{
+    auto tableSize = InternedName::table_size();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            for (int j = 0; j < 10000; ++j) {
+                InternedName a{std::to_string(j % 7)};
+                InternedName b{a};
+                EXPECT_EQ(std::to_string(j % 7), b.str());
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(tableSize, InternedName::table_size());
+}
+
+TEST_F(InternedNameTest, Identifier)
+{
+    Identifier a{1u, "/sensors/temperature", false};
+    Identifier b{1u, std::string("/sensors/temperature"), false};
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(std::hash<Identifier>{}(a), std::hash<Identifier>{}(b));
+    EXPECT_NE(a, (Identifier{2u, "/sensors/temperature", false}));
+    EXPECT_NE(a, (Identifier{1u, "/sensors/temperature", true}));
+    EXPECT_NE(a, (Identifier{1u, "/sensors/pressure", false}));
+    EXPECT_EQ(&a.name(), &b.name());
+
+    // the name is shared instead of being stored in every identifier
+    EXPECT_LT(sizeof(Identifier), sizeof(Identifier::signature_type)
+        + sizeof(std::string) + sizeof(bool));
+}
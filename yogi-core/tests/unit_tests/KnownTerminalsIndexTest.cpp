@@ -0,0 +1,157 @@
+#include "../../src/core/KnownTerminalsIndex.hpp"
+#include "../../src/yogi_core.h"
+using namespace yogi;
+using namespace yogi::core;
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct KnownTerminalsIndexTest : public testing::Test
+{
+    KnownTerminalsIndex uut;
+
+    virtual void SetUp() override
+    {
+        uut.insert(YOGI_TM_PUBLISHSUBSCRIBE, base::Identifier{1u, "/Ann", false});
+        uut.insert(YOGI_TM_SCATTERGATHER,    base::Identifier{2u, "/Bob", false});
+        uut.insert(YOGI_TM_DEAFMUTE,         base::Identifier{3u, "/Anna", false});
+        uut.insert(YOGI_TM_PUBLISHSUBSCRIBE, base::Identifier{4u, "Tom", false});
+    }
+
+    std::vector<std::string> find(KnownTerminalsIndex::query_mode mode,
+        const std::string& pattern, bool caseSensitive = true,
+        std::size_t max = 0,
+        std::unique_ptr<KnownTerminalsIndex::entry>* after = nullptr)
+    {
+        std::vector<std::string> names;
+        uut.find(mode, pattern, caseSensitive, after ? after->get() : nullptr,
+            [&](const KnownTerminalsIndex::entry& terminal) {
+                if (max && names.size() == max) {
+                    return false;
+                }
+
+                names.push_back(terminal.identifier.name());
+                if (after) {
+                    after->reset(new KnownTerminalsIndex::entry(terminal));
+                }
+
+                return true;
+            });
+
+        return names;
+    }
+};
+
+TEST_F(KnownTerminalsIndexTest, PrefixQuery)
+{
+    using names = std::vector<std::string>;
+    EXPECT_EQ((names{"/Ann", "/Anna", "/Bob", "Tom"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, ""));
+    EXPECT_EQ((names{"/Ann", "/Anna"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "/An"));
+    EXPECT_EQ((names{}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "/an"));
+    EXPECT_EQ((names{"/Ann", "/Anna"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "/an", false));
+}
+
+TEST_F(KnownTerminalsIndexTest, SubstringQuery)
+{
+    using names = std::vector<std::string>;
+    EXPECT_EQ((names{"/Bob", "Tom"}),
+        find(KnownTerminalsIndex::QUERY_SUBSTRING, "o"));
+    EXPECT_EQ((names{}),
+        find(KnownTerminalsIndex::QUERY_SUBSTRING, "NN"));
+    EXPECT_EQ((names{"/Ann", "/Anna"}),
+        find(KnownTerminalsIndex::QUERY_SUBSTRING, "NN", false));
+}
+
+TEST_F(KnownTerminalsIndexTest, PagedQuery)
+{
+    using names = std::vector<std::string>;
+    std::unique_ptr<KnownTerminalsIndex::entry> last;
+    EXPECT_EQ((names{"/Ann", "/Anna"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+    EXPECT_EQ((names{"/Bob", "Tom"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+    EXPECT_EQ((names{}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+
+    last.reset();
+    EXPECT_EQ((names{"/Ann"}),
+        find(KnownTerminalsIndex::QUERY_SUBSTRING, "n", true, 1, &last));
+    EXPECT_EQ((names{"/Anna"}),
+        find(KnownTerminalsIndex::QUERY_SUBSTRING, "n", true, 1, &last));
+}
+
+TEST_F(KnownTerminalsIndexTest, PagedQueryWithChanges)
+{
+    using names = std::vector<std::string>;
+    std::unique_ptr<KnownTerminalsIndex::entry> last;
+    EXPECT_EQ((names{"/Ann", "/Anna"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+
+    // neither removing an already listed entry nor adding one in front of the
+    // current position must shift the next page
+    uut.erase(YOGI_TM_PUBLISHSUBSCRIBE, base::Identifier{1u, "/Ann", false});
+    uut.insert(YOGI_TM_DEAFMUTE, base::Identifier{6u, "/Al", false});
+    uut.insert(YOGI_TM_MASTER, base::Identifier{7u, "/Anna", false});
+
+    EXPECT_EQ((names{"/Anna", "/Bob"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+    EXPECT_EQ((names{"Tom"}),
+        find(KnownTerminalsIndex::QUERY_PREFIX, "", true, 2, &last));
+}
+
+TEST_F(KnownTerminalsIndexTest, Changes)
+{
+    auto cursor = uut.cursor();
+    EXPECT_EQ(4u, cursor);
+    EXPECT_EQ(4u, uut.size());
+
+    uut.erase(YOGI_TM_SCATTERGATHER, base::Identifier{2u, "/Bob", false});
+    uut.insert(YOGI_TM_MASTER, base::Identifier{5u, "/Bob", false});
+
+    std::vector<KnownTerminalsIndex::change> changes;
+    auto newCursor = uut.get_changes(cursor,
+        [&](const KnownTerminalsIndex::change& change) {
+            changes.push_back(change);
+            return true;
+        });
+
+    EXPECT_EQ(6u, newCursor);
+    ASSERT_EQ(2u, changes.size());
+    EXPECT_FALSE(changes[0].added);
+    EXPECT_EQ(YOGI_TM_SCATTERGATHER, changes[0].terminal.type);
+    EXPECT_TRUE(changes[1].added);
+    EXPECT_EQ(YOGI_TM_MASTER, changes[1].terminal.type);
+
+    // stop after the first change
+    newCursor = uut.get_changes(cursor,
+        [&](const KnownTerminalsIndex::change& change) {
+            return change.cursor == cursor + 1;
+        });
+    EXPECT_EQ(cursor + 1, newCursor);
+
+    // cursor from the future
+    EXPECT_THROW(uut.get_changes(newCursor + 100,
+        [](const KnownTerminalsIndex::change&) { return true; }),
+        api::ExceptionT<YOGI_ERR_INVALID_PARAM>);
+}
+
+TEST_F(KnownTerminalsIndexTest, ExpiredCursor)
+{
+    for (int i = 0; i < YOGI_KNOWN_TERMINALS_HISTORY_SIZE; ++i) {
+        uut.insert(YOGI_TM_DEAFMUTE, base::Identifier{0u,
+            std::to_string(i), false});
+    }
+
+    auto fn = [](const KnownTerminalsIndex::change&) { return true; };
+    EXPECT_THROW(uut.get_changes(0, fn),
+        api::ExceptionT<YOGI_ERR_CURSOR_EXPIRED>);
+    EXPECT_NO_THROW(uut.get_changes(4, fn));
+}
@@ -0,0 +1,148 @@
+#include "../../src/base/LastValueStore.hpp"
+#include "../../src/api/ExceptionT.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <boost/filesystem.hpp>
+
+#include <string>
+#include <thread>
+
+
+struct LastValueStoreTest : public testing::Test
+{
+    std::string path;
+
+    virtual void SetUp() override
+    {
+        path = (boost::filesystem::temp_directory_path()
+            / boost::filesystem::unique_path()).string();
+    }
+
+    virtual void TearDown() override
+    {
+        boost::filesystem::remove(path);
+    }
+
+    static Buffer make_buffer(const std::string& str)
+    {
+        return Buffer{str.data(), str.size()};
+    }
+
+    static std::string find(LastValueStore& store, const std::string& key)
+    {
+        const char* data;
+        std::size_t size;
+        if (!store.find(key, &data, &size)) {
+            return "<none>";
+        }
+
+        return std::string(data, size);
+    }
+};
+
+TEST_F(LastValueStoreTest, EmptyFile)
+{
+    LastValueStore uut{path};
+    EXPECT_EQ("<none>", find(uut, "a"));
+    EXPECT_TRUE(boost::filesystem::exists(path));
+}
+
+TEST_F(LastValueStoreTest, Reload)
+{
+    {
+        LastValueStore uut{path};
+        uut.put("a", make_buffer("1"));
+        uut.put("b", make_buffer("Hello"));
+        uut.put("a", make_buffer("2"));
+
+        // values put into the store are only visible after re-opening it
+        EXPECT_EQ("<none>", find(uut, "a"));
+    }
+
+    LastValueStore uut{path};
+    EXPECT_EQ("2", find(uut, "a"));
+    EXPECT_EQ("Hello", find(uut, "b"));
+    EXPECT_EQ("<none>", find(uut, "c"));
+
+    uut.put("b", make_buffer("World"));
+    uut.flush();
+    EXPECT_EQ("Hello", find(uut, "b"));
+}
+
+TEST_F(LastValueStoreTest, BackgroundWrites)
+{
+    LastValueStore uut{path, std::chrono::milliseconds{1}};
+    uut.flush();
+    auto emptySize = uut.file_size();
+
+    uut.put("a", make_buffer("Hello"));
+    for (int i = 0; i < 1000 && uut.file_size() == emptySize; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    EXPECT_GT(uut.file_size(), emptySize);
+    EXPECT_EQ(boost::filesystem::file_size(path), uut.file_size());
+}
+
+TEST_F(LastValueStoreTest, BrokenRecord)
+{
+    {
+        LastValueStore uut{path};
+        uut.put("a", make_buffer("1"));
+        uut.flush();
+        uut.put("b", make_buffer("2"));
+    }
+
+    // cut the last record short as if the process died while writing it
+    boost::filesystem::resize_file(path,
+        boost::filesystem::file_size(path) - 1);
+
+    {
+        LastValueStore uut{path};
+        EXPECT_EQ("1", find(uut, "a"));
+        EXPECT_EQ("<none>", find(uut, "b"));
+
+        uut.put("c", make_buffer("3"));
+    }
+
+    LastValueStore uut{path};
+    EXPECT_EQ("1", find(uut, "a"));
+    EXPECT_EQ("3", find(uut, "c"));
+}
+
+TEST_F(LastValueStoreTest, Compaction)
+{
+    std::string value(1000, 'x');
+
+    {
+        LastValueStore uut{path};
+        uut.put("c", make_buffer("Hello"));
+    }
+
+    {
+        LastValueStore uut{path};
+        for (int i = 0; i < 1000; ++i) {
+            value[0] = static_cast<char>('a' + i % 26);
+            uut.put("a", make_buffer(value));
+            uut.put("b", make_buffer(std::to_string(i)));
+            uut.flush();
+        }
+
+        EXPECT_LT(uut.file_size(),
+            static_cast<std::size_t>(LastValueStore::MIN_COMPACTION_SIZE));
+        EXPECT_EQ(boost::filesystem::file_size(path), uut.file_size());
+    }
+
+    LastValueStore uut{path};
+    EXPECT_EQ(value, find(uut, "a"));
+    EXPECT_EQ("999", find(uut, "b"));
+    EXPECT_EQ("Hello", find(uut, "c"));
+}
+
+TEST_F(LastValueStoreTest, CannotOpenFile)
+{
+    auto dir = boost::filesystem::temp_directory_path().string();
+    EXPECT_THROW(LastValueStore{dir}, yogi::api::Exception);
+}
@@ -341,7 +341,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{10});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{10}, Id{1}, buf))));
+            Id{10}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
 
@@ -367,7 +367,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{10});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{10}, Id{1}, buf))));
+            Id{10}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
 
@@ -384,6 +384,46 @@ TEST_F(LeafTest, ScatterLeafLogic)
             Id{1}, GATHER_FINISHED, buf), *connection);
     }}
 
+    uut->on_message_received(ScatterGather::TerminalRemovedAck::create(
+        Id{1}), *connection);
+
+    // run an aggregated scatter operation with a quorum of two
+    {{
+        auto terminal = make_scatter_gather_terminal(Id{1}, Id{10});
+
+        EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
+            Id{10}, Id{1}, 0, 2, 0, true, 50, buf))));
+        EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
+            *terminal, Buffer{buf}, std::chrono::milliseconds{}, 2,
+            ANYCAST_NONE, true, std::chrono::milliseconds{50}).first);
+
+        gathered_responses responses(4);
+        responses[0].data  = buf;
+        responses[1].flags = GATHER_IGNORED;
+        responses[2].data  = buf;
+        responses[3].data  = buf;
+
+        // responses after reaching the quorum get dropped
+        gathered_responses expected(3);
+        expected[0].data  = buf;
+        expected[1].flags = GATHER_IGNORED;
+        expected[2].flags = GATHER_FINISHED | GATHER_QUORUM;
+        expected[2].data  = buf;
+
+        EXPECT_CALL(*terminal, on_gathered_messages_received_(Id{1},
+            expected))
+            .WillOnce(Return(true));
+        uut->on_message_received(ScatterGather::GatherBatch::create(
+            Id{1}, responses), *connection);
+
+        responses.resize(1);
+        responses[0].flags = GATHER_FINISHED;
+        EXPECT_CALL(*terminal, on_gathered_messages_received_(_, _))
+            .Times(0);
+        uut->on_message_received(ScatterGather::GatherBatch::create(
+            Id{1}, responses), *connection);
+    }}
+
     uut->on_message_received(ScatterGather::TerminalRemovedAck::create(
         Id{1}), *connection);
 
@@ -392,7 +432,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{11});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{11}, Id{1}, buf))));
+            Id{11}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
         uut->scatter_gather::LeafLogic<>::sg_cancel_scatter(*terminal, Id{1});
@@ -409,7 +449,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{12});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{12}, Id{1}, buf))));
+            Id{12}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
 
@@ -426,7 +466,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{13});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{13}, Id{1}, buf))));
+            Id{13}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
 
@@ -446,7 +486,7 @@ TEST_F(LeafTest, ScatterLeafLogic)
         auto terminal = make_scatter_gather_terminal(Id{1}, Id{13});
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Scatter::create(
-            Id{13}, Id{1}, buf))));
+            Id{13}, Id{1}, 0, 0, 0, false, 0, buf))));
         EXPECT_EQ(Id{1}, uut->scatter_gather::LeafLogic<>::sg_scatter(
             *terminal, Buffer{buf}).first);
 
@@ -495,7 +535,7 @@ TEST_F(LeafTest, GatherLeafLogic)
         EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
         EXPECT_CALL(*t2, on_scattered_message_received_(Id{88}, buf));
         uut->on_message_received(ScatterGather::Scatter::create(
-            Id{1}, Id{88}, buf), *connection);
+            Id{1}, Id{88}, 0, 0, 0, false, 0, buf), *connection);
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Gather::create(
             Id{88}, GATHER_NO_FLAGS, buf))));
@@ -508,6 +548,52 @@ TEST_F(LeafTest, GatherLeafLogic)
             *t2, Id{88}, GATHER_IGNORED, true, Buffer{});
     }}
 
+    uut->on_message_received(ScatterGather::BindingRemovedAck::create(
+        Id{1}), *connection);
+    uut->on_message_received(ScatterGather::TerminalRemovedAck::create(
+        Id{2}), *connection);
+    uut->on_message_received(ScatterGather::TerminalRemovedAck::create(
+        Id{1}), *connection);
+
+    // run anycast gather operations that fail over to the other binding
+    {{
+        auto t1 = make_scatter_gather_terminal(Id{1}, Id{101});
+        auto t2 = make_scatter_gather_terminal(Id{2}, Id{102});
+        auto b1 = std::make_shared<BindingMock<scatter_gather::LeafLogic<>>>(
+            *t1, "A");
+        auto b2 = std::make_shared<BindingMock<scatter_gather::LeafLogic<>>>(
+            *t2, "A");
+        uut->on_message_received(ScatterGather::BindingMapping::create(
+            Id{1}, Id{201}), *connection);
+
+        EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
+        uut->on_message_received(ScatterGather::Scatter::create(
+            Id{1}, Id{88}, 0, 0, ANYCAST_ROUND_ROBIN, false, 0, buf),
+            *connection);
+
+        EXPECT_CALL(*t2, on_scattered_message_received_(Id{88}, buf));
+        uut->scatter_gather::LeafLogic<>::sg_respond_to_scattered_message(
+            *t1, Id{88}, GATHER_IGNORED, true, Buffer{});
+
+        EXPECT_CALL(*connection, send(Msg(ScatterGather::Gather::create(
+            Id{88}, GATHER_FINISHED, buf))));
+        uut->scatter_gather::LeafLogic<>::sg_respond_to_scattered_message(
+            *t2, Id{88}, GATHER_NO_FLAGS, true, Buffer{buf});
+
+        EXPECT_CALL(*t1, on_scattered_message_received_(Id{89}, buf));
+        uut->on_message_received(ScatterGather::Scatter::create(
+            Id{1}, Id{89}, 0, 0, ANYCAST_ROUND_ROBIN, false, 0, buf),
+            *connection);
+
+        EXPECT_CALL(*t2, on_scattered_message_received_(Id{89}, buf));
+        b1.reset();
+
+        EXPECT_CALL(*connection, send(Msg(ScatterGather::Gather::create(
+            Id{89}, GATHER_IGNORED | GATHER_FINISHED, Buffer{}))));
+        uut->scatter_gather::LeafLogic<>::sg_respond_to_scattered_message(
+            *t2, Id{89}, GATHER_IGNORED, true, Buffer{});
+    }}
+
     uut->on_message_received(ScatterGather::BindingRemovedAck::create(
         Id{1}), *connection);
     uut->on_message_received(ScatterGather::TerminalRemovedAck::create(
@@ -529,7 +615,7 @@ TEST_F(LeafTest, GatherLeafLogic)
         EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
         EXPECT_CALL(*t2, on_scattered_message_received_(Id{88}, buf));
         uut->on_message_received(ScatterGather::Scatter::create(
-            Id{1}, Id{88}, buf), *connection);
+            Id{1}, Id{88}, 0, 0, 0, false, 0, buf), *connection);
 
         b1.reset();
 
@@ -560,7 +646,7 @@ TEST_F(LeafTest, GatherLeafLogic)
 
         EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
         uut->on_message_received(ScatterGather::Scatter::create(
-            Id{1}, Id{88}, buf), *connection);
+            Id{1}, Id{88}, 0, 0, 0, false, 0, buf), *connection);
 
         EXPECT_CALL(*connection, send(Msg(ScatterGather::Gather::create(
             Id{88}, GATHER_BINDINGDESTROYED | GATHER_FINISHED, Buffer{}))));
@@ -586,7 +672,7 @@ TEST_F(LeafTest, GatherLeafLogic)
 
         EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
         uut->on_message_received(ScatterGather::Scatter::create(
-            Id{1}, Id{88}, buf), *connection);
+            Id{1}, Id{88}, 0, 0, 0, false, 0, buf), *connection);
 
         uut->on_message_received(ScatterGather::TerminalRemoved::create(
             Id{1}), *connection);
@@ -609,7 +695,7 @@ TEST_F(LeafTest, GatherLeafLogic)
 
         EXPECT_CALL(*t1, on_scattered_message_received_(Id{88}, buf));
         uut->on_message_received(ScatterGather::Scatter::create(
-            Id{1}, Id{88}, buf), *connection);
+            Id{1}, Id{88}, 0, 0, 0, false, 0, buf), *connection);
 
         uut->on_connection_destroyed(*connection);
 
@@ -1035,6 +1121,16 @@ TEST_F(LeafTest, CachedPublishSubscribeCacheLeafConnection)
     EXPECT_EQ(data1[0], cache[0]);
     EXPECT_EQ(data1[1], cache[1]);
 
+    // receive a replayed data message which must not replace the cache
+    uut->on_message_received(CachedPublishSubscribe::ReplayedData::create(
+        Id{1}, buffer2), *connection);
+
+    cacheRes = t1->get_cache(boost::asio::buffer(cache, sizeof(cache)));
+    EXPECT_TRUE(cacheRes.first);
+    EXPECT_EQ(2, cacheRes.second);
+    EXPECT_EQ(data1[0], cache[0]);
+    EXPECT_EQ(data1[1], cache[1]);
+
     EXPECT_THROW(t1->get_cache(boost::asio::buffer(cache, 1)),
         api::ExceptionT<YOGI_ERR_BUFFER_TOO_SMALL>);
 
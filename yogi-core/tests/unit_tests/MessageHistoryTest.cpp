@@ -0,0 +1,107 @@
+#include "../../src/base/MessageHistory.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+
+struct MessageHistoryTest : public testing::Test
+{
+    MessageHistory uut;
+    MessageHistory::clock::time_point t0 = MessageHistory::clock::now();
+
+    static Buffer make_buffer(const std::string& str)
+    {
+        return Buffer{str.data(), str.size()};
+    }
+
+    MessageHistory::clock::time_point at(int seconds)
+    {
+        return t0 + std::chrono::seconds(seconds);
+    }
+
+    std::vector<std::string> recent(std::size_t maxMessages = 0,
+        MessageHistory::clock::time_point since
+            = MessageHistory::clock::time_point::min())
+    {
+        std::vector<std::string> msgs;
+        uut.foreach_recent(maxMessages, since,
+            [&](const Buffer& data, MessageHistory::clock::time_point) {
+                msgs.emplace_back(data.data(), data.size());
+            });
+
+        return msgs;
+    }
+};
+
+TEST_F(MessageHistoryTest, DisabledByDefault)
+{
+    EXPECT_FALSE(uut.enabled());
+    uut.push(make_buffer("a"));
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_TRUE(recent().empty());
+}
+
+TEST_F(MessageHistoryTest, MessageLimit)
+{
+    uut.set_limits(3, 0);
+    for (auto msg : {"a", "b", "c", "d", "e"}) {
+        uut.push(make_buffer(msg));
+    }
+
+    EXPECT_EQ(3u, uut.size());
+    EXPECT_EQ((std::vector<std::string>{"c", "d", "e"}), recent());
+    EXPECT_EQ((std::vector<std::string>{"d", "e"}), recent(2));
+}
+
+TEST_F(MessageHistoryTest, ByteLimit)
+{
+    uut.set_limits(10, 5);
+    for (auto msg : {"ab", "cd", "e", "fgh"}) {
+        uut.push(make_buffer(msg));
+    }
+
+    EXPECT_EQ(4u, uut.bytes());
+    EXPECT_EQ((std::vector<std::string>{"e", "fgh"}), recent());
+
+    // messages exceeding the limit on their own empty the history
+    uut.push(make_buffer("123456"));
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_EQ(0u, uut.bytes());
+}
+
+TEST_F(MessageHistoryTest, Since)
+{
+    uut.set_limits(10, 0);
+    uut.push(make_buffer("a"), at(1));
+    uut.push(make_buffer("b"), at(2));
+    uut.push(make_buffer("c"), at(3));
+
+    EXPECT_EQ((std::vector<std::string>{"b", "c"}), recent(0, at(2)));
+    EXPECT_EQ((std::vector<std::string>{"c"}), recent(1, at(2)));
+    EXPECT_TRUE(recent(0, at(4)).empty());
+}
+
+TEST_F(MessageHistoryTest, ChangeLimits)
+{
+    uut.set_limits(4, 0);
+    for (auto msg : {"a", "b", "c", "d", "e", "f"}) {
+        uut.push(make_buffer(msg));
+    }
+
+    uut.set_limits(2, 0);
+    EXPECT_EQ((std::vector<std::string>{"e", "f"}), recent());
+
+    uut.set_limits(5, 0);
+    uut.push(make_buffer("g"));
+    EXPECT_EQ((std::vector<std::string>{"e", "f", "g"}), recent());
+
+    uut.set_limits(5, 1);
+    EXPECT_EQ((std::vector<std::string>{"g"}), recent());
+
+    uut.set_limits(0, 0);
+    EXPECT_FALSE(uut.enabled());
+    EXPECT_TRUE(recent().empty());
+}
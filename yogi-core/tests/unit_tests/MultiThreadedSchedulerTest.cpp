@@ -1,4 +1,5 @@
 #include "../../src/scheduling/MultiThreadedScheduler.hpp"
+#include "../../src/api/ExceptionT.hpp"
 using namespace yogi::scheduling;
 
 #include <gmock/gmock.h>
@@ -6,6 +7,7 @@ using namespace yogi::scheduling;
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <chrono>
 
 
 struct MultiThreadedSchedulerTest : public testing::Test
@@ -60,3 +62,115 @@ TEST_F(MultiThreadedSchedulerTest, ResizeThreadPool)
     uut->resize_thread_pool(1);
     check_parallel_tasks(1);
 }
+
+TEST_F(MultiThreadedSchedulerTest, AutoScalingLimits)
+{
+    using namespace std::chrono;
+
+    EXPECT_THROW(uut->enable_auto_scaling(3, 2, milliseconds(1), seconds(1)),
+        yogi::api::ExceptionT<YOGI_ERR_INVALID_PARAM>);
+    EXPECT_THROW(uut->enable_auto_scaling(0, 2, milliseconds(1), seconds(1)),
+        yogi::api::ExceptionT<YOGI_ERR_INVALID_PARAM>);
+
+    uut->enable_auto_scaling(2, 4, seconds(10), seconds(10));
+    EXPECT_EQ(2u, uut->thread_pool_size());
+
+    uut->resize_thread_pool(5);
+    EXPECT_EQ(5u, uut->thread_pool_size());
+
+    uut->enable_auto_scaling(1, 3, seconds(10), seconds(10));
+    EXPECT_EQ(3u, uut->thread_pool_size());
+    check_parallel_tasks(3);
+}
+
+TEST_F(MultiThreadedSchedulerTest, AutoScalingGrow)
+{
+    using namespace std::chrono;
+    uut->enable_auto_scaling(1, 3, milliseconds(1), seconds(10));
+
+    // block all threads so the queue delay grows
+    std::atomic<bool> release{false};
+    std::atomic<int>  finished{0};
+    for (int i = 0; i < 4; ++i) {
+        uut->post([&] {
+            while (!release) {
+                std::this_thread::sleep_for(microseconds(100));
+            }
+
+            ++finished;
+        });
+    }
+
+    auto start = steady_clock::now();
+    while (uut->thread_pool_size() < 3
+        && steady_clock::now() - start < seconds(5)) {
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+
+    EXPECT_EQ(3u, uut->thread_pool_size());
+
+    release = true;
+    while (finished != 4) {
+        std::this_thread::yield();
+    }
+}
+
+TEST_F(MultiThreadedSchedulerTest, AutoScalingShrink)
+{
+    using namespace std::chrono;
+    uut->resize_thread_pool(4);
+    uut->enable_auto_scaling(2, 4, milliseconds(1), milliseconds(10));
+
+    auto start = steady_clock::now();
+    while (uut->thread_pool_size() > 2
+        && steady_clock::now() - start < seconds(5)) {
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+
+    EXPECT_EQ(2u, uut->thread_pool_size());
+
+    // blocking the threads would make the pool grow again
+    uut->disable_auto_scaling();
+    EXPECT_EQ(2u, uut->thread_pool_size());
+    check_parallel_tasks(2);
+}
+
+TEST_F(MultiThreadedSchedulerTest, AutoScalingKeepsBusyThreads)
+{
+    using namespace std::chrono;
+    uut->resize_thread_pool(3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // occupy all threads with long-running handlers while they are waiting
+    std::atomic<bool> release{false};
+    std::atomic<int>  started{0};
+    std::atomic<int>  finished{0};
+    for (int i = 0; i < 3; ++i) {
+        uut->post([&] {
+            ++started;
+            while (!release) {
+                std::this_thread::sleep_for(microseconds(100));
+            }
+
+            ++finished;
+        });
+    }
+
+    while (started != 3) {
+        std::this_thread::yield();
+    }
+
+    // the threads are busy for several idle periods
+    uut->enable_auto_scaling(1, 3, milliseconds(50), milliseconds(20));
+    std::this_thread::sleep_for(milliseconds(200));
+
+    release = true;
+    while (finished != 3) {
+        std::this_thread::yield();
+    }
+
+    // a thread only counts as idle once it has been waiting for a whole idle
+    // period after the handlers finished
+    std::this_thread::sleep_for(milliseconds(10));
+    EXPECT_EQ(3u, uut->thread_pool_size());
+}
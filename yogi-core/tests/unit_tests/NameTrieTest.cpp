@@ -0,0 +1,89 @@
+#include "../../src/base/NameTrie.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+
+struct NameTrieTest : public testing::Test
+{
+    NameTrie<int> uut;
+
+    virtual void SetUp() override
+    {
+        uut.insert("/sensors/temp", 1);
+        uut.insert("/sensors/temp2", 2);
+        uut.insert("/sensors/pressure", 3);
+        uut.insert("/actors/motor", 4);
+        uut.insert("/sensors/temp", 5);
+    }
+
+    std::vector<int> find(const std::string& pattern)
+    {
+        std::vector<int> values;
+        uut.find_matches(pattern, [&](int value) { values.push_back(value); });
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+};
+
+TEST_F(NameTrieTest, IsPattern)
+{
+    EXPECT_TRUE(NameTrie<int>::is_pattern("/sensors/*"));
+    EXPECT_TRUE(NameTrie<int>::is_pattern("/sensor?"));
+    EXPECT_FALSE(NameTrie<int>::is_pattern("/sensors"));
+}
+
+TEST_F(NameTrieTest, Matches)
+{
+    EXPECT_TRUE(NameTrie<int>::matches("/sensors/*", "/sensors/temp"));
+    EXPECT_TRUE(NameTrie<int>::matches("/sensors/*", "/sensors/"));
+    EXPECT_TRUE(NameTrie<int>::matches("*/temp?", "/sensors/temp2"));
+    EXPECT_TRUE(NameTrie<int>::matches("/*s*s*", "/sensors/pressure"));
+    EXPECT_FALSE(NameTrie<int>::matches("/sensors/*", "/sensors"));
+    EXPECT_FALSE(NameTrie<int>::matches("/sensors/?", "/sensors/temp"));
+    EXPECT_FALSE(NameTrie<int>::matches("*/temp", "/sensors/temp2"));
+}
+
+TEST_F(NameTrieTest, FindMatches)
+{
+    using values = std::vector<int>;
+    EXPECT_EQ((values{1, 5}), find("/sensors/temp"));
+    EXPECT_EQ((values{1, 2, 3, 5}), find("/sensors/*"));
+    EXPECT_EQ((values{2}), find("/sensors/temp?"));
+    EXPECT_EQ((values{1, 2, 5}), find("*temp*"));
+    EXPECT_EQ((values{1, 2, 3, 4, 5}), find("*"));
+    EXPECT_EQ((values{3}), find("/*s*s*e"));
+    EXPECT_EQ((values{}), find("/sensors/?"));
+    EXPECT_EQ((values{}), find("/sensor"));
+}
+
+TEST_F(NameTrieTest, Erase)
+{
+    EXPECT_EQ(5u, uut.size());
+    EXPECT_TRUE(uut.erase("/sensors/temp", 1));
+    EXPECT_FALSE(uut.erase("/sensors/temp", 1));
+    EXPECT_FALSE(uut.erase("/sensors/tem", 2));
+    EXPECT_EQ(4u, uut.size());
+
+    using values = std::vector<int>;
+    EXPECT_EQ((values{5}), find("/sensors/temp"));
+    EXPECT_EQ((values{2, 3, 5}), find("/sensors/*"));
+
+    EXPECT_TRUE(uut.erase("/sensors/temp2", 2));
+    EXPECT_EQ((values{5}), find("/sensors/temp*"));
+    EXPECT_EQ((values{}), find("/sensors/temp?*"));
+}
+
+TEST_F(NameTrieTest, Clear)
+{
+    uut.clear();
+    EXPECT_EQ(0u, uut.size());
+    EXPECT_EQ((std::vector<int>{}), find("*"));
+
+    uut.insert("/sensors/temp", 6);
+    EXPECT_EQ((std::vector<int>{6}), find("/sensors/*"));
+}
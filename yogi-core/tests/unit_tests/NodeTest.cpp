@@ -631,11 +631,11 @@ TEST_F(NodeTest, SuccessfulScatterGatherOverNode)
 
     // run successful scatter-gather operation over node1
     EXPECT_CALL(*leafA, send(Msg(ScatterGather::Scatter::create(
-        Id{51}, Id{1}, buffer))));
+        Id{51}, Id{1}, 0, 0, 0, false, 0, buffer))));
     EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-        Id{61}, Id{1}, buffer))));
+        Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
     uut->on_message_received(ScatterGather::Scatter::create(
-        Id{1}, Id{555}, buffer), *node1);
+        Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *node1);
 
     EXPECT_CALL(*node1, send(Msg(ScatterGather::Gather::create(
         Id{555}, GATHER_IGNORED, buffer))));
@@ -660,11 +660,11 @@ TEST_F(NodeTest, SuccessfulScatterGatherOverLeaf)
 
 	// run successful scatter-gather operation over leafA
 	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
-		Id{104}, Id{1}, buffer))));
+		Id{104}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-		Id{61}, Id{1}, buffer))));
+		Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	uut->on_message_received(ScatterGather::Scatter::create(
-		Id{1}, Id{555}, buffer), *leafA);
+		Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *leafA);
 
 	EXPECT_CALL(*leafA, send(Msg(ScatterGather::Gather::create(
 		Id{555}, GATHER_NO_FLAGS, buffer))));
@@ -677,6 +677,106 @@ TEST_F(NodeTest, SuccessfulScatterGatherOverLeaf)
 		Id{1}, GATHER_FINISHED, buffer), *leafB);
 }
 
+TEST_F(NodeTest, LateGatherAfterScatterGatherFinished)
+{
+    using namespace scatter_gather;
+	Buffer buffer = prepare_scatter_gather_test();
+
+    // the operation finishes as soon as the quorum has been reached
+    EXPECT_CALL(*leafA, send(Msg(ScatterGather::Scatter::create(
+        Id{51}, Id{1}, 0, 1, 0, false, 0, buffer))));
+    EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
+        Id{61}, Id{1}, 0, 1, 0, false, 0, buffer))));
+    uut->on_message_received(ScatterGather::Scatter::create(
+        Id{1}, Id{555}, 0, 1, 0, false, 0, buffer), *node1);
+
+    EXPECT_CALL(*node1, send(Msg(ScatterGather::Gather::create(
+        Id{555}, GATHER_FINISHED | GATHER_QUORUM, buffer))));
+    uut->on_message_received(ScatterGather::Gather::create(
+        Id{1}, GATHER_FINISHED, buffer), *leafA);
+
+    // the next operation re-uses the slot with a new generation
+    auto operationId = make_operation_id(Id{1}, 1);
+    EXPECT_CALL(*leafA, send(Msg(ScatterGather::Scatter::create(
+        Id{51}, operationId, 0, 0, 0, false, 0, buffer))));
+    EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
+        Id{61}, operationId, 0, 0, 0, false, 0, buffer))));
+    uut->on_message_received(ScatterGather::Scatter::create(
+        Id{1}, Id{556}, 0, 0, 0, false, 0, buffer), *node1);
+
+    // the late response to the first operation must get dropped
+    uut->on_message_received(ScatterGather::Gather::create(
+        Id{1}, GATHER_FINISHED, buffer), *leafB);
+
+    EXPECT_CALL(*node1, send(Msg(ScatterGather::Gather::create(
+        Id{556}, GATHER_NO_FLAGS, buffer))));
+    uut->on_message_received(ScatterGather::Gather::create(
+        operationId, GATHER_FINISHED, buffer), *leafA);
+
+    EXPECT_CALL(*node1, send(Msg(ScatterGather::Gather::create(
+        Id{556}, GATHER_FINISHED, buffer))));
+    uut->on_message_received(ScatterGather::Gather::create(
+        operationId, GATHER_FINISHED, buffer), *leafB);
+}
+
+TEST_F(NodeTest, AggregatedScatterGatherOverNode)
+{
+    using namespace scatter_gather;
+	Buffer buffer = prepare_scatter_gather_test();
+
+    // the responses get held back until the operation finishes
+    EXPECT_CALL(*leafA, send(Msg(ScatterGather::Scatter::create(
+        Id{51}, Id{1}, 0, 0, 0, true, 0, buffer))));
+    EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
+        Id{61}, Id{1}, 0, 0, 0, true, 0, buffer))));
+    uut->on_message_received(ScatterGather::Scatter::create(
+        Id{1}, Id{555}, 0, 0, 0, true, 0, buffer), *node1);
+
+    uut->on_message_received(ScatterGather::Gather::create(
+        Id{1}, GATHER_IGNORED | GATHER_FINISHED, Buffer{}), *leafA);
+
+    gathered_responses responses(2);
+    responses[0].flags = GATHER_IGNORED;
+    responses[1].flags = GATHER_FINISHED;
+    responses[1].data  = buffer;
+
+    EXPECT_CALL(*node1, send(Msg(ScatterGather::GatherBatch::create(
+        Id{555}, responses))));
+    uut->on_message_received(ScatterGather::Gather::create(
+        Id{1}, GATHER_FINISHED, buffer), *leafB);
+}
+
+TEST_F(NodeTest, AggregatedScatterGatherOverLeaf)
+{
+	using namespace scatter_gather;
+	Buffer buffer = prepare_scatter_gather_test();
+
+	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
+		Id{104}, Id{1}, 0, 0, 0, true, 0, buffer))));
+	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
+		Id{61}, Id{1}, 0, 0, 0, true, 0, buffer))));
+	uut->on_message_received(ScatterGather::Scatter::create(
+		Id{1}, Id{555}, 0, 0, 0, true, 0, buffer), *leafA);
+
+	// batches from other nodes get merged into the node's own batch
+	gathered_responses fromNode(2);
+	fromNode[0].data  = buffer;
+	fromNode[1].flags = GATHER_DEAF | GATHER_FINISHED;
+	uut->on_message_received(ScatterGather::GatherBatch::create(
+		Id{1}, fromNode), *node1);
+
+	gathered_responses responses(3);
+	responses[0].data  = buffer;
+	responses[1].flags = GATHER_DEAF;
+	responses[2].flags = GATHER_FINISHED;
+	responses[2].data  = buffer;
+
+	EXPECT_CALL(*leafA, send(Msg(ScatterGather::GatherBatch::create(
+		Id{555}, responses))));
+	uut->on_message_received(ScatterGather::Gather::create(
+		Id{1}, GATHER_FINISHED, buffer), *leafB);
+}
+
 TEST_F(NodeTest, RemoveBindingsAndSubscriptionsWhileScatterGatherOverLeaf)
 {
 	using namespace scatter_gather;
@@ -684,11 +784,11 @@ TEST_F(NodeTest, RemoveBindingsAndSubscriptionsWhileScatterGatherOverLeaf)
 
 	// run scatter-gather operation over leafA and remove bindings/subscriptions
 	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
-		Id{104}, Id{1}, buffer))));
+		Id{104}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-		Id{61}, Id{1}, buffer))));
+		Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	uut->on_message_received(ScatterGather::Scatter::create(
-		Id{1}, Id{555}, buffer), *leafA);
+		Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *leafA);
 
 	EXPECT_CALL(*leafA, send(Msg(ScatterGather::Gather::create(
 		Id{555}, GATHER_BINDINGDESTROYED, Buffer{}))));
@@ -709,11 +809,11 @@ TEST_F(NodeTest, CloseGatheringConnectionsWhileScatterGatherOverLeaf)
 
 	// run scatter-gather operation over leafA and close connections
 	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
-		Id{104}, Id{1}, buffer))));
+		Id{104}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-		Id{61}, Id{1}, buffer))));
+		Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	uut->on_message_received(ScatterGather::Scatter::create(
-		Id{1}, Id{555}, buffer), *leafA);
+		Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *leafA);
 
 	EXPECT_CALL(*leafA, send(Msg(ScatterGather::Gather::create(
 		Id{555}, GATHER_CONNECTIONLOST, Buffer{}))));
@@ -732,11 +832,11 @@ TEST_F(NodeTest, RemoveScatteringTerminalWhileScatterGatherOverLeaf)
 	// run scatter-gather operation over leafA and remove the terminal which
 	// initiated the scatter-gather operation
 	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
-		Id{104}, Id{1}, buffer))));
+		Id{104}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-		Id{61}, Id{1}, buffer))));
+		Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	uut->on_message_received(ScatterGather::Scatter::create(
-		Id{1}, Id{555}, buffer), *leafA);
+		Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *leafA);
 
 	uut->on_message_received(ScatterGather::TerminalRemoved::create(
 		Id{1}), *leafA);
@@ -757,11 +857,11 @@ TEST_F(NodeTest, CloseScatteringConnectionWhileScatterGatherOverLeaf)
 	// run scatter-gather operation over leafA and close the connection to
 	// leafA
 	EXPECT_CALL(*node1, send(Msg(ScatterGather::Scatter::create(
-		Id{104}, Id{1}, buffer))));
+		Id{104}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	EXPECT_CALL(*leafB, send(Msg(ScatterGather::Scatter::create(
-		Id{61}, Id{1}, buffer))));
+		Id{61}, Id{1}, 0, 0, 0, false, 0, buffer))));
 	uut->on_message_received(ScatterGather::Scatter::create(
-		Id{1}, Id{555}, buffer), *leafA);
+		Id{1}, Id{555}, 0, 0, 0, false, 0, buffer), *leafA);
 
 	uut->on_connection_destroyed(*leafA);
 
@@ -29,3 +29,19 @@ TEST_F(ObjectRegisterTest, BasicBehavior)
     EXPECT_EQ(30, uut[id3]);
     EXPECT_EQ(40, uut[id4]);
 }
+
+TEST_F(ObjectRegisterTest, FindSlot)
+{
+    auto id1 = uut.insert(10);
+    auto id2 = uut.insert(20);
+
+    ASSERT_NE(nullptr, uut.find_slot(id1));
+    EXPECT_EQ(10, *uut.find_slot(id1));
+    EXPECT_EQ(nullptr, uut.find_slot(Id{}));
+    EXPECT_EQ(nullptr, uut.find_slot(Id{3}));
+
+    // the slot of an erased ID stays accessible until it gets re-used
+    uut.erase(id2);
+    ASSERT_NE(nullptr, uut.find_slot(id2));
+    EXPECT_EQ(0, *uut.find_slot(id2));
+}
@@ -4,6 +4,10 @@ using namespace yogi::interfaces;
 
 #include <gmock/gmock.h>
 
+#include <thread>
+#include <atomic>
+#include <vector>
+
 
 struct Cat : public IPublicObject
 {
@@ -19,6 +23,24 @@ struct Dog : public IPublicObject
 {
 };
 
+struct IPet : virtual public IPublicObject
+{
+    virtual const char* sound() const = 0;
+};
+
+struct IGuard : virtual public IPublicObject
+{
+    int strength = 3;
+};
+
+struct GuardDog : public IPet, public IGuard
+{
+    virtual const char* sound() const override
+    {
+        return "woof";
+    }
+};
+
 
 struct PublicObjectRegisterTest : public testing::Test
 {
@@ -76,3 +98,75 @@ TEST_F(PublicObjectRegisterTest, Clear)
     EXPECT_THROW(PublicObjectRegister::get_s<Cat>(handle),
         ExceptionT<YOGI_ERR_INVALID_HANDLE>);
 }
+
+TEST_F(PublicObjectRegisterTest, StaleHandle)
+{
+    EXPECT_NO_THROW(PublicObjectRegister::destroy(handle));
+    EXPECT_THROW(PublicObjectRegister::get_s<Cat>(handle),
+        ExceptionT<YOGI_ERR_INVALID_HANDLE>);
+    EXPECT_THROW(PublicObjectRegister::destroy(handle),
+        ExceptionT<YOGI_ERR_INVALID_HANDLE>);
+
+    // the slot of the destroyed object gets reused with a new generation
+    void* newHandle = PublicObjectRegister::create<Cat>(9);
+    EXPECT_NE(handle, newHandle);
+    EXPECT_EQ(9, PublicObjectRegister::get_s<Cat>(newHandle).age);
+    EXPECT_THROW(PublicObjectRegister::get_s<Cat>(handle),
+        ExceptionT<YOGI_ERR_INVALID_HANDLE>);
+}
+
+TEST_F(PublicObjectRegisterTest, BaseClasses)
+{
+    void* handle = PublicObjectRegister::create<GuardDog>();
+
+    // repeat to use the cached type information
+    for (int i = 0; i < 2; ++i) {
+        auto& dog = PublicObjectRegister::get_s<GuardDog>(handle);
+        EXPECT_STREQ("woof",
+            PublicObjectRegister::get_s<IPet>(handle).sound());
+        EXPECT_EQ(3, PublicObjectRegister::get_s<IGuard>(handle).strength);
+        EXPECT_EQ(static_cast<IGuard*>(&dog),
+            &PublicObjectRegister::get_s<IGuard>(handle));
+        EXPECT_EQ(static_cast<IPublicObject*>(&dog),
+            &PublicObjectRegister::get_s(handle));
+        EXPECT_THROW(PublicObjectRegister::get_s<Cat>(handle),
+            ExceptionT<YOGI_ERR_WRONG_OBJECT_TYPE>);
+    }
+
+    EXPECT_NO_THROW(PublicObjectRegister::destroy(handle));
+}
+
+TEST_F(PublicObjectRegisterTest, ConcurrentUse)
+{
+    std::atomic<bool> stop{false};
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                EXPECT_EQ(7, PublicObjectRegister::get_s<Cat>(handle).age);
+            }
+        });
+    }
+
+    std::vector<void*> handles;
+    for (int i = 0; i < 5000; ++i) {
+        handles.push_back(PublicObjectRegister::create<Cat>(i));
+        if (i % 3 == 0) {
+            auto old = handles[handles.size() / 2];
+            handles.erase(handles.begin() + handles.size() / 2);
+            PublicObjectRegister::destroy(old);
+            EXPECT_THROW(PublicObjectRegister::get_s<Cat>(old),
+                ExceptionT<YOGI_ERR_INVALID_HANDLE>);
+        }
+    }
+
+    stop = true;
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    for (auto handle : handles) {
+        PublicObjectRegister::destroy(handle);
+    }
+}
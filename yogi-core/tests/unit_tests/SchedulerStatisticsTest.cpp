@@ -0,0 +1,113 @@
+#include "../../src/scheduling/SchedulerStatistics.hpp"
+#include "../../src/scheduling/MultiThreadedScheduler.hpp"
+using namespace yogi::scheduling;
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <thread>
+#include <numeric>
+
+
+struct SchedulerStatisticsTest : public testing::Test
+{
+    typedef SchedulerStatistics::clock clock;
+
+    SchedulerStatistics uut;
+
+    std::uint64_t sum(const SchedulerStatistics::histogram& hist)
+    {
+        return std::accumulate(std::begin(hist), std::end(hist),
+            std::uint64_t{0});
+    }
+};
+
+TEST_F(SchedulerStatisticsTest, Buckets)
+{
+    uut.record_runtime(SchedulerStatistics::OTHER,
+        std::chrono::nanoseconds(500));
+    uut.record_runtime(SchedulerStatistics::OTHER,
+        std::chrono::microseconds(1));
+    uut.record_runtime(SchedulerStatistics::OTHER,
+        std::chrono::microseconds(3));
+    uut.record_runtime(SchedulerStatistics::OTHER,
+        std::chrono::microseconds(1000));
+    uut.record_runtime(SchedulerStatistics::OTHER, std::chrono::hours(1000));
+    uut.record_queue_delay(SchedulerStatistics::OTHER,
+        std::chrono::microseconds(4));
+
+    SchedulerStatistics::histogram delays, runtimes;
+    uut.get_histograms(SchedulerStatistics::OTHER, &delays, &runtimes);
+
+    EXPECT_EQ(1u, runtimes[0]);
+    EXPECT_EQ(1u, runtimes[1]);
+    EXPECT_EQ(1u, runtimes[2]);
+    EXPECT_EQ(1u, runtimes[10]);
+    EXPECT_EQ(1u, runtimes[SchedulerStatistics::NUM_BUCKETS - 1]);
+    EXPECT_EQ(5u, sum(runtimes));
+    EXPECT_EQ(1u, delays[3]);
+    EXPECT_EQ(1u, sum(delays));
+
+    uut.get_histograms(SchedulerStatistics::DISPATCH, &delays, &runtimes);
+    EXPECT_EQ(0u, sum(delays) + sum(runtimes));
+
+    uut.reset();
+    uut.get_histograms(SchedulerStatistics::OTHER, &delays, &runtimes);
+    EXPECT_EQ(0u, sum(delays) + sum(runtimes));
+}
+
+TEST_F(SchedulerStatisticsTest, ScopedMeasurement)
+{
+    SchedulerStatistics::set_thread_statistics(&uut);
+
+    {{
+        SchedulerStatistics::scoped_measurement m{
+            SchedulerStatistics::USER_CALLBACK};
+    }}
+
+    uut.set_enabled(true);
+
+    {{
+        SchedulerStatistics::scoped_measurement m{
+            SchedulerStatistics::USER_CALLBACK};
+    }}
+
+    SchedulerStatistics::set_thread_statistics(nullptr);
+
+    SchedulerStatistics::histogram delays, runtimes;
+    uut.get_histograms(SchedulerStatistics::USER_CALLBACK, &delays,
+        &runtimes);
+    EXPECT_EQ(0u, sum(delays));
+    EXPECT_EQ(1u, sum(runtimes));
+}
+
+TEST_F(SchedulerStatisticsTest, PostedHandlers)
+{
+    auto scheduler = std::make_shared<MultiThreadedScheduler>();
+    auto& stats = *scheduler->statistics();
+
+    std::atomic<int> n{0};
+    scheduler->post(SchedulerStatistics::DESERIALIZE, [&] { ++n; });
+    stats.set_enabled(true);
+    scheduler->post(SchedulerStatistics::DESERIALIZE, [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        ++n;
+    });
+    scheduler->post([&] { ++n; });
+
+    // runtimes get recorded after the handlers return
+    SchedulerStatistics::histogram delays, runtimes;
+    do {
+        std::this_thread::yield();
+        stats.get_histograms(SchedulerStatistics::OTHER, &delays, &runtimes);
+    } while (n != 3 || sum(runtimes) != 1);
+
+    stats.get_histograms(SchedulerStatistics::DESERIALIZE, &delays,
+        &runtimes);
+    EXPECT_EQ(1u, sum(delays));
+    EXPECT_EQ(1u, sum(runtimes));
+    EXPECT_EQ(0u, std::accumulate(runtimes, runtimes + 11, 0u));
+
+    stats.get_histograms(SchedulerStatistics::OTHER, &delays, &runtimes);
+    EXPECT_EQ(1u, sum(delays));
+}
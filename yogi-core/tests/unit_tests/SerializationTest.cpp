@@ -107,6 +107,17 @@ TEST_F(SerializationTest, Identifier)
     EXPECT_EQ(12345ul, identifier.signature());
     EXPECT_EQ("Hello", identifier.name());
     EXPECT_TRUE(identifier.hidden());
+    EXPECT_FALSE(identifier.wildcard());
+
+    buffer.clear();
+    serialization::serialize_one(buffer,
+        base::Identifier{5ul, "/a/*", false, true});
+    it = buffer.cbegin();
+    serialization::deserialize_one(buffer, it, identifier);
+    EXPECT_EQ(it, buffer.end());
+    EXPECT_EQ("/a/*", identifier.name());
+    EXPECT_FALSE(identifier.hidden());
+    EXPECT_TRUE(identifier.wildcard());
 }
 
 TEST_F(SerializationTest, Buffer)
@@ -0,0 +1,133 @@
+#include "../../src/base/SmallFlatMap.hpp"
+using namespace yogi::base;
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+#include <map>
+
+
+struct SmallFlatMapTest : public testing::Test
+{
+    typedef SmallFlatMap<int, std::string, 2> map_type;
+
+    map_type uut;
+
+    std::vector<int> keys(const map_type& map)
+    {
+        std::vector<int> keys;
+        for (auto& val : map) {
+            keys.push_back(val.first);
+        }
+
+        return keys;
+    }
+};
+
+TEST_F(SmallFlatMapTest, Insert)
+{
+    EXPECT_TRUE(uut.empty());
+    EXPECT_TRUE(uut.insert(std::make_pair(3, std::string("c"))).second);
+    EXPECT_TRUE(uut.insert(std::make_pair(1, std::string("a"))).second);
+
+    auto res = uut.insert(std::make_pair(3, std::string("x")));
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ("c", res.first->second);
+
+    uut[2] = "b";
+    uut[4];
+    EXPECT_EQ(4u, uut.size());
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4}), keys(uut));
+    EXPECT_EQ("b", uut[2]);
+    EXPECT_EQ("", uut[4]);
+}
+
+TEST_F(SmallFlatMapTest, Find)
+{
+    uut[5] = "e";
+    uut[1] = "a";
+    uut[3] = "c";
+
+    EXPECT_EQ("c", uut.find(3)->second);
+    EXPECT_EQ(uut.end(), uut.find(2));
+    EXPECT_EQ(1u, uut.count(5));
+    EXPECT_EQ(0u, uut.count(4));
+}
+
+TEST_F(SmallFlatMapTest, Erase)
+{
+    for (int i = 0; i < 10; ++i) {
+        uut[i] = std::to_string(i);
+    }
+
+    EXPECT_EQ(1u, uut.erase(0));
+    EXPECT_EQ(0u, uut.erase(0));
+
+    auto it = uut.begin();
+    while (it != uut.end()) {
+        if (it->first % 2) {
+            it = uut.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ((std::vector<int>{2, 4, 6, 8}), keys(uut));
+    uut.erase(2);
+    uut.erase(4);
+    EXPECT_EQ((std::vector<int>{6, 8}), keys(uut));
+    EXPECT_EQ("8", uut[8]);
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+}
+
+TEST_F(SmallFlatMapTest, CopyAndMove)
+{
+    for (int i = 0; i < 2; ++i) {
+        uut[i] = std::to_string(i);
+    }
+
+    map_type copy{uut};
+    map_type moved{std::move(copy)};
+    EXPECT_EQ(keys(uut), keys(moved));
+    EXPECT_TRUE(copy.empty());
+
+    for (int i = 2; i < 5; ++i) {
+        uut[i] = std::to_string(i);
+    }
+
+    copy = uut;
+    moved = std::move(copy);
+    EXPECT_EQ(keys(uut), keys(moved));
+    EXPECT_EQ("4", moved[4]);
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST_F(SmallFlatMapTest, MatchesStdMap)
+{
+    std::map<int, std::string> ref;
+    unsigned seed = 1;
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        int key = static_cast<int>((seed >> 16) % 20);
+        if (seed & 0x100) {
+            ref[key] = std::to_string(i);
+            uut[key] = std::to_string(i);
+        }
+        else {
+            EXPECT_EQ(ref.erase(key), uut.erase(key));
+        }
+
+        ASSERT_EQ(ref.size(), uut.size());
+    }
+
+    auto it = uut.begin();
+    for (auto& val : ref) {
+        EXPECT_EQ(val.first, it->first);
+        EXPECT_EQ(val.second, it->second);
+        ++it;
+    }
+}
@@ -1,4 +1,5 @@
 #include "../../src/connections/tcp/TcpConnection.hpp"
+#include "../../src/connections/tcp/TcpChannel.hpp"
 #include "../../src/messaging/messages/ScatterGather.hpp"
 #include "../../src/messaging/messages/ServiceClient.hpp"
 using namespace yogi::base;
@@ -27,6 +28,11 @@ struct TcpConnectionTest : public testing::Test
     tcp_connection_ptr nodeConn;
 
     virtual void SetUp() override
+    {
+        connect("1.2.3", "4.5.6");
+    }
+
+    void connect(std::string leafRemoteVersion, std::string nodeRemoteVersion)
     {
         // connect leafConn and nodeConn via IPv6
         boost::asio::ip::tcp::acceptor acceptor{scheduler->io_service(),
@@ -42,9 +48,9 @@ struct TcpConnectionTest : public testing::Test
         acceptor.accept(socketB);
 
         leafConn = std::make_shared<TcpConnection>(*scheduler,
-            std::move(socketA), "1.2.3", std::vector<char>{11});
+            std::move(socketA), leafRemoteVersion, std::vector<char>{11});
         nodeConn = std::make_shared<TcpConnection>(*scheduler,
-            std::move(socketB), "4.5.6", std::vector<char>{22});
+            std::move(socketB), nodeRemoteVersion, std::vector<char>{22});
     }
 
     virtual void TearDown()
@@ -124,8 +130,8 @@ TEST_F(TcpConnectionTest, ExchangeMessages)
     prepare_and_await_connection_ready();
 
     std::vector<char> data{'a', 'b', 'c', 'd'};
-    auto msg1 = messages::ServiceClient::Scatter::create(Id{3}, Id{5555},
-        Buffer{data.data(), data.size()});
+    auto msg1 = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{data.data(), data.size()});
     auto msg2 = messages::ScatterGather::Subscribe::create(Id{879});
 
     std::atomic<int> msgsRemaining{4};
@@ -149,6 +155,373 @@ TEST_F(TcpConnectionTest, ExchangeMessages)
     }
 }
 
+TEST_F(TcpConnectionTest, SendBatch)
+{
+    prepare_and_await_connection_ready();
+
+    // more data than fits into the connection's out buffer
+    std::vector<char> data(LockFreeRingBuffer::capacity() / 4, 'x');
+    auto msg1 = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{data.data(), data.size()});
+    auto msg2 = messages::ScatterGather::Subscribe::create(Id{879});
+
+    std::atomic<int> msgsRemaining{8};
+
+    {
+        InSequence seq;
+        EXPECT_CALL(*node, on_message_received_(Msg(msg1), Ref(*nodeConn)))
+            .Times(7)
+            .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+        EXPECT_CALL(*node, on_message_received_(Msg(msg2), Ref(*nodeConn)))
+            .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    }
+
+    std::vector<const IMessage*> msgs(7, &msg1);
+    msgs.push_back(&msg2);
+    leafConn->send_batch(msgs);
+
+    while (msgsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+TEST_F(TcpConnectionTest, TrySend)
+{
+    prepare_and_await_connection_ready();
+
+    // messages larger than the out buffer can never be sent without blocking
+    std::vector<char> data(LockFreeRingBuffer::capacity() + 1, 'x');
+    auto msg1 = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{data.data(), data.size()});
+    EXPECT_THROW(leafConn->try_send(msg1),
+        api::ExceptionT<YOGI_ERR_MESSAGE_TOO_LARGE>);
+
+    auto msg2 = messages::ScatterGather::Subscribe::create(Id{879});
+
+    std::atomic<bool> received{false};
+    EXPECT_CALL(*node, on_message_received_(Msg(msg2), Ref(*nodeConn)))
+        .WillOnce(InvokeWithoutArgs([&]{ received = true; }));
+
+    EXPECT_TRUE(leafConn->try_send(msg2));
+
+    while (!received) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+TEST_F(TcpConnectionTest, AsyncSend)
+{
+    prepare_and_await_connection_ready();
+
+    // more data than fits into the connection's out buffer
+    std::vector<char> data(LockFreeRingBuffer::capacity() / 4, 'x');
+    auto msg1 = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{data.data(), data.size()});
+    auto msg2 = messages::ScatterGather::Subscribe::create(Id{879});
+
+    std::atomic<int> msgsRemaining{8};
+    std::atomic<int> handlersRemaining{7};
+
+    {
+        InSequence seq;
+        EXPECT_CALL(*node, on_message_received_(Msg(msg1), Ref(*nodeConn)))
+            .Times(7)
+            .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+        EXPECT_CALL(*node, on_message_received_(Msg(msg2), Ref(*nodeConn)))
+            .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    }
+
+    for (int i = 0; i < 7; ++i) {
+        leafConn->async_send(msg1, [&](const api::Exception& e) {
+            EXPECT_EQ(YOGI_OK, e.error_code());
+            --handlersRemaining;
+        });
+    }
+
+    // must not overtake the queued messages
+    leafConn->send(msg2);
+
+    while (msgsRemaining || handlersRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+TEST_F(TcpConnectionTest, ConcurrentSends)
+{
+    prepare_and_await_connection_ready();
+
+    // frames larger than the free space in the out buffer get written in
+    // pieces; none of the other sends may end up in between
+    std::vector<char> dataA(LockFreeRingBuffer::capacity() / 2, 'a');
+    auto msgA = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{dataA.data(), dataA.size()});
+    std::vector<char> dataB(LockFreeRingBuffer::capacity() / 3, 'b');
+    auto msgB = messages::ServiceClient::Scatter::create(Id{4}, Id{6666}, 0, 0,
+        0, false, 0, Buffer{dataB.data(), dataB.size()});
+    auto msgC = messages::ScatterGather::Subscribe::create(Id{879});
+    auto msgD = messages::ScatterGather::Subscribe::create(Id{880});
+
+    const int n = 20;
+    std::atomic<int> msgsRemaining{n * 5};
+
+    EXPECT_CALL(*node, on_message_received_(Msg(msgA), Ref(*nodeConn)))
+        .Times(n)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*node, on_message_received_(Msg(msgB), Ref(*nodeConn)))
+        .Times(n * 2)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*node, on_message_received_(Msg(msgC), Ref(*nodeConn)))
+        .Times(n)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*node, on_message_received_(Msg(msgD), Ref(*nodeConn)))
+        .Times(n)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+
+    std::thread threadA([&] {
+        for (int i = 0; i < n; ++i) {
+            leafConn->send(msgA);
+        }
+    });
+
+    std::thread threadB([&] {
+        std::vector<const IMessage*> msgs(2, &msgB);
+        for (int i = 0; i < n; ++i) {
+            leafConn->send_batch(msgs);
+        }
+    });
+
+    for (int i = 0; i < n; ++i) {
+        leafConn->async_send(msgD, [](const api::Exception& e) {
+            EXPECT_EQ(YOGI_OK, e.error_code());
+        });
+
+        while (!leafConn->try_send(msgC)) {
+            std::this_thread::yield();
+        }
+    }
+
+    threadA.join();
+    threadB.join();
+
+    while (msgsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+TEST_F(TcpConnectionTest, MultiplexedChannels)
+{
+    auto leafB = std::make_shared<mocks::LeafCommunicatorMock>(*scheduler);
+
+    EXPECT_THROW(TcpChannel(*leafConn, *leaf),
+        api::ExceptionT<YOGI_ERR_NOT_MULTIPLEXED>);
+
+    leafConn->assign_multiplexed(std::chrono::milliseconds::max());
+    EXPECT_THROW(leafConn->assign(*leaf, std::chrono::milliseconds::max()),
+        api::ExceptionT<YOGI_ERR_ALREADY_ASSIGNED>);
+
+    // channels opened by the remote end get connected to the node
+    std::vector<IConnection*> nodeChannels;
+    std::atomic<int> channelsRemaining{4};
+    EXPECT_CALL(*node, on_new_connection(_))
+        .Times(2);
+    EXPECT_CALL(*node, on_connection_started(_))
+        .Times(2)
+        .WillRepeatedly(Invoke([&](IConnection& conn) {
+            nodeChannels.push_back(&conn);
+            --channelsRemaining;
+        }));
+    EXPECT_CALL(*node, on_new_connection(Ref(*nodeConn)));
+
+    // the first channel gets opened before the connection is ready
+    std::unique_ptr<TcpChannel> channelA;
+    EXPECT_CALL(*leaf, on_new_connection(_));
+    EXPECT_CALL(*leaf, on_connection_started(_))
+        .WillOnce(InvokeWithoutArgs([&] { --channelsRemaining; }));
+    channelA.reset(new TcpChannel(*leafConn, *leaf));
+
+    nodeConn->assign(*node, std::chrono::milliseconds::max());
+    EXPECT_THROW(TcpChannel(*nodeConn, *leaf),
+        api::ExceptionT<YOGI_ERR_ALREADY_ASSIGNED>);
+
+    while (channelsRemaining > 2) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    std::unique_ptr<TcpChannel> channelB;
+    EXPECT_CALL(*leafB, on_new_connection(_));
+    EXPECT_CALL(*leafB, on_connection_started(_))
+        .WillOnce(InvokeWithoutArgs([&] { --channelsRemaining; }));
+    channelB.reset(new TcpChannel(*leafConn, *leafB));
+
+    while (channelsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    EXPECT_NE(channelA->id(), channelB->id());
+    EXPECT_EQ(true, channelA->remote_is_node());
+    EXPECT_EQ(false, nodeChannels[0]->remote_is_node());
+    EXPECT_NE(channelA->description(), channelB->description());
+    EXPECT_EQ("1.2.3", channelA->remote_version());
+
+    // messages arrive on the right channel in both directions
+    auto msg1 = messages::ScatterGather::Subscribe::create(Id{1});
+    auto msg2 = messages::ScatterGather::Subscribe::create(Id{2});
+
+    std::atomic<int> msgsRemaining{4};
+    EXPECT_CALL(*node, on_message_received_(Msg(msg1), Ref(*nodeChannels[0])))
+        .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*node, on_message_received_(Msg(msg2), Ref(*nodeChannels[1])))
+        .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*leaf, on_message_received_(Msg(msg2), Ref(*channelA)))
+        .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*leafB, on_message_received_(Msg(msg1), Ref(*channelB)))
+        .WillOnce(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+
+    channelA->send(msg1);
+    channelB->send(msg2);
+    nodeChannels[0]->send(msg2);
+    nodeChannels[1]->send(msg1);
+
+    while (msgsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    // closing a channel destroys it on both ends
+    std::atomic<bool> closed{false};
+    EXPECT_CALL(*node, on_connection_destroyed(Ref(*nodeChannels[0])))
+        .WillOnce(InvokeWithoutArgs([&]{ closed = true; }));
+    EXPECT_CALL(*leaf, on_connection_destroyed(Ref(*channelA)));
+    channelA.reset();
+
+    while (!closed) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    EXPECT_CALL(*node, on_connection_destroyed(_))
+        .Times(AnyNumber());
+    EXPECT_CALL(*leafB, on_connection_destroyed(Ref(*channelB)));
+    channelB.reset();
+}
+
+TEST_F(TcpConnectionTest, ConcurrentChannelSends)
+{
+    auto leafB = std::make_shared<mocks::LeafCommunicatorMock>(*scheduler);
+
+    leafConn->assign_multiplexed(std::chrono::milliseconds::max());
+
+    std::vector<IConnection*> nodeChannels;
+    std::atomic<int> channelsRemaining{4};
+    EXPECT_CALL(*node, on_new_connection(_))
+        .Times(2);
+    EXPECT_CALL(*node, on_connection_started(_))
+        .Times(2)
+        .WillRepeatedly(Invoke([&](IConnection& conn) {
+            nodeChannels.push_back(&conn);
+            --channelsRemaining;
+        }));
+    EXPECT_CALL(*node, on_new_connection(Ref(*nodeConn)));
+
+    EXPECT_CALL(*leaf, on_new_connection(_));
+    EXPECT_CALL(*leaf, on_connection_started(_))
+        .WillOnce(InvokeWithoutArgs([&] { --channelsRemaining; }));
+    std::unique_ptr<TcpChannel> channelA{new TcpChannel(*leafConn, *leaf)};
+
+    EXPECT_CALL(*leafB, on_new_connection(_));
+    EXPECT_CALL(*leafB, on_connection_started(_))
+        .WillOnce(InvokeWithoutArgs([&] { --channelsRemaining; }));
+    std::unique_ptr<TcpChannel> channelB{new TcpChannel(*leafConn, *leafB)};
+
+    nodeConn->assign(*node, std::chrono::milliseconds::max());
+
+    while (channelsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    // leafs on different channels send without a common lock; their frames
+    // are larger than the free space in the out buffer and must not interleave
+    std::vector<char> dataA(LockFreeRingBuffer::capacity() / 2, 'a');
+    auto msgA = messages::ServiceClient::Scatter::create(Id{3}, Id{5555}, 0, 0,
+        0, false, 0, Buffer{dataA.data(), dataA.size()});
+    std::vector<char> dataB(LockFreeRingBuffer::capacity() / 3, 'b');
+    auto msgB = messages::ServiceClient::Scatter::create(Id{4}, Id{6666}, 0, 0,
+        0, false, 0, Buffer{dataB.data(), dataB.size()});
+
+    const int n = 20;
+    std::atomic<int> msgsRemaining{n * 3};
+
+    EXPECT_CALL(*node, on_message_received_(Msg(msgA), Ref(*nodeChannels[0])))
+        .Times(n)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+    EXPECT_CALL(*node, on_message_received_(Msg(msgB), Ref(*nodeChannels[1])))
+        .Times(n * 2)
+        .WillRepeatedly(InvokeWithoutArgs([&]{ --msgsRemaining; }));
+
+    std::thread threadA([&] {
+        for (int i = 0; i < n; ++i) {
+            channelA->send(msgA);
+        }
+    });
+
+    std::thread threadB([&] {
+        std::vector<const IMessage*> msgs(2, &msgB);
+        for (int i = 0; i < n; ++i) {
+            channelB->send_batch(msgs);
+        }
+    });
+
+    threadA.join();
+    threadB.join();
+
+    while (msgsRemaining) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    EXPECT_CALL(*node, on_connection_destroyed(_))
+        .Times(AnyNumber());
+    EXPECT_CALL(*leaf, on_connection_destroyed(Ref(*channelA)));
+    channelA.reset();
+    EXPECT_CALL(*leafB, on_connection_destroyed(Ref(*channelB)));
+    channelB.reset();
+}
+
+TEST_F(TcpConnectionTest, RefusedChannel)
+{
+    leafConn->assign_multiplexed(std::chrono::milliseconds::max());
+
+    EXPECT_CALL(*leaf, on_new_connection(_));
+    TcpChannel channel(*leafConn, *leaf);
+
+    std::atomic<int> errorCode{YOGI_OK};
+    channel.async_await_death([&](const api::Exception& e) {
+        errorCode = e.error_code();
+    });
+
+    // the channel gets disconnected from the leaf once it has been refused
+    EXPECT_CALL(*leaf, on_connection_destroyed(Ref(channel)));
+    EXPECT_CALL(*node, on_new_connection(Ref(*nodeConn)));
+    EXPECT_CALL(*node, on_new_connection(Not(Ref(*nodeConn))))
+        .WillOnce(Throw(api::ExceptionT<YOGI_ERR_ALREADY_CONNECTED>{}));
+    nodeConn->assign(*node, std::chrono::milliseconds::max());
+
+    wait_for_error(&errorCode);
+    EXPECT_EQ(YOGI_ERR_CONNECTION_REFUSED, errorCode);
+    EXPECT_THROW(channel.async_await_death([](const api::Exception&) {}),
+        api::ExceptionT<YOGI_ERR_CONNECTION_DEAD>);
+}
+
+TEST_F(TcpConnectionTest, MultiplexingRequiresNewerRemoteVersion)
+{
+    leafConn.reset();
+    nodeConn.reset();
+    connect("0.0.2-alpha", "0.1.0-alpha");
+
+    EXPECT_THROW(leafConn->assign_multiplexed(
+        std::chrono::milliseconds::max()),
+        api::ExceptionT<YOGI_ERR_INCOMPATIBLE_VERSION>);
+    EXPECT_NO_THROW(nodeConn->assign_multiplexed(
+        std::chrono::milliseconds::max()));
+}
+
 TEST_F(TcpConnectionTest, AsyncAwaitDeath)
 {
     prepare_and_await_connection_ready();
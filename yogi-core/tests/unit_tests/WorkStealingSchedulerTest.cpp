@@ -0,0 +1,121 @@
+#include "../../src/scheduling/WorkStealingScheduler.hpp"
+using namespace yogi::scheduling;
+
+#include <gmock/gmock.h>
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <set>
+
+
+struct WorkStealingSchedulerTest : public testing::Test
+{
+    std::shared_ptr<WorkStealingScheduler> uut;
+    std::mutex                             mutex;
+
+    virtual void SetUp() override
+    {
+        uut = std::make_shared<WorkStealingScheduler>();
+    }
+
+    void check_parallel_tasks(size_t parallelTasks)
+    {
+        std::atomic<size_t> n{0};
+        std::atomic<size_t> m{0};
+
+        auto fn = [&] {
+            ++n;
+            {{ std::lock_guard<std::mutex> lock(mutex); }}
+            ++m;
+        };
+
+        {{
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < parallelTasks + 1; ++i)
+                uut->post(fn);
+
+            while (n < parallelTasks)
+                std::this_thread::yield();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+            EXPECT_EQ(parallelTasks, n);
+        }}
+
+        while (m != parallelTasks + 1)
+            std::this_thread::yield();
+    }
+};
+
+TEST_F(WorkStealingSchedulerTest, DefaultThreadPoolSize)
+{
+    check_parallel_tasks(YOGI_DEFAULT_SCHEDULER_THREAD_POOL_SIZE);
+}
+
+TEST_F(WorkStealingSchedulerTest, ResizeThreadPool)
+{
+    uut->resize_thread_pool(3);
+    check_parallel_tasks(3);
+
+    uut->resize_thread_pool(1);
+    check_parallel_tasks(1);
+
+    uut->resize_thread_pool(4);
+    check_parallel_tasks(4);
+}
+
+TEST_F(WorkStealingSchedulerTest, HomeEventLoops)
+{
+    uut->resize_thread_pool(3);
+
+    std::set<boost::asio::io_service*> loops;
+    for (int i = 0; i < 6; ++i) {
+        loops.insert(&uut->io_service());
+    }
+
+    EXPECT_EQ(3u, loops.size());
+}
+
+TEST_F(WorkStealingSchedulerTest, StealWork)
+{
+    uut->resize_thread_pool(2);
+
+    // block the home thread of the event loop with the first handler; the
+    // second handler has to be executed by the other thread
+    auto& loop = uut->io_service();
+    std::atomic<bool> stolen{false};
+
+    loop.post([&] {
+        while (!stolen) {
+            std::this_thread::yield();
+        }
+    });
+
+    loop.post([&] {
+        stolen = true;
+    });
+
+    while (!stolen)
+        std::this_thread::yield();
+}
+
+TEST_F(WorkStealingSchedulerTest, AdoptEventLoops)
+{
+    uut->resize_thread_pool(3);
+    std::vector<boost::asio::io_service*> loops;
+    for (int i = 0; i < 3; ++i) {
+        loops.push_back(&uut->io_service());
+    }
+
+    // handlers on the event loops of removed threads must still get executed
+    uut->resize_thread_pool(1);
+
+    std::atomic<int> n{0};
+    for (auto loop : loops) {
+        loop->post([&] { ++n; });
+    }
+
+    while (n != 3)
+        std::this_thread::yield();
+}
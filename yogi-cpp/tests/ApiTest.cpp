@@ -25,3 +25,10 @@ TEST_F(ApiTest, SetLogFile)
     EXPECT_TRUE(fs::exists(file));
     EXPECT_GT(fs::file_size(file), 0u);
 }
+
+TEST_F(ApiTest, LockMemory)
+{
+    auto res = yogi::lock_memory();
+    EXPECT_TRUE(res == yogi::Success() || res == yogi::Failure(YOGI_ERR_LOCK_MEMORY_FAILED));
+    EXPECT_EQ(yogi::Success(), yogi::lock_memory(false));
+}
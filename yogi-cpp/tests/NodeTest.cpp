@@ -43,6 +43,29 @@ TEST_F(NodeTest, GetKnownTerminals)
     EXPECT_EQ("Two",          terminals[1].name);
 }
 
+TEST_F(NodeTest, FindKnownTerminals)
+{
+    RawProducerTerminal a(leaf, "/Test/One", Signature(123));
+    RawServiceTerminal  b(leaf, "/Test/Two", Signature(456));
+    RawServiceTerminal  c(leaf, "/Three", Signature(789));
+
+    while (node.get_known_terminals().size() < 3);
+
+    auto terminals = node.find_known_terminals("/Test/");
+    ASSERT_EQ(2u, terminals.size());
+    EXPECT_EQ("/Test/One", terminals[0].name);
+    EXPECT_EQ("/Test/Two", terminals[1].name);
+
+    terminals = node.find_known_terminals("T", FIND_SUBSTRING);
+    ASSERT_EQ(3u, terminals.size());
+    EXPECT_EQ("/Three", terminals[0].name);
+
+    terminals = node.find_known_terminals("/test/t", FIND_PREFIX, false);
+    ASSERT_EQ(1u, terminals.size());
+    EXPECT_EQ(SERVICE,        terminals[0].type);
+    EXPECT_EQ(Signature(456), terminals[0].signature);
+}
+
 TEST_F(NodeTest, AwaitKnownTerminalsChange)
 {
     std::atomic<bool> called{false};
@@ -2,6 +2,7 @@
 
 #include "../yogi/scheduler.hpp"
 #include "../yogi/leaf.hpp"
+#include "../yogi/node.hpp"
 #include "../yogi/binding.hpp"
 #include "../yogi/terminals.hpp"
 #include "../yogi/observers.hpp"
@@ -152,6 +153,36 @@ TEST_F(ObserversTest, SubscriptionObserver)
     EXPECT_EQ(4, j);
 }
 
+TEST_F(ObserversTest, CreditObserver)
+{
+    Node node(scheduler);
+    RawPublishSubscribeTerminal publisher(leafA, "P", Signature(0));
+    RawPublishSubscribeTerminal subscriber(leafB, "S", Signature(0));
+    Binding binding(subscriber, "P");
+
+    CreditObserver observer(publisher);
+
+    std::atomic<int> credit(0);
+    observer.add([&](int newCredit) {
+        credit = newCredit;
+    });
+
+    observer.start();
+    EXPECT_EQ(-1, credit);
+
+    LocalConnection connA(leafA, node);
+    LocalConnection connB(leafB, node);
+    while (binding.get_binding_state() == RELEASED);
+
+    binding.set_receive_window(3);
+    while (credit != 3);
+
+    binding.set_receive_window(0);
+    while (credit != -1);
+
+    observer.stop();
+}
+
 TEST_F(ObserversTest, AllTerminalTypesCompile)
 {
     {{
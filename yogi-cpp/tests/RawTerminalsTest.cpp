@@ -158,6 +158,138 @@ TEST_F(RawTerminalsTest, PublishSubscribeTerminal)
     EXPECT_TRUE(terminalsB.ps.try_publish(msg));
 }
 
+TEST_F(RawTerminalsTest, ReceiveQueue)
+{
+    std::vector<char> msg{12, 34};
+
+    terminalsA.ps.set_receive_queue(2, DROP_OLDEST);
+    connect(bindings.ps, terminalsB.ps);
+
+    for (int i = 0; i < 3; ++i) {
+        msg[0] = static_cast<char>(i);
+        terminalsB.ps.publish(msg);
+    }
+
+    while (terminalsA.ps.get_dropped_message_count() == 0);
+    EXPECT_EQ(1u, terminalsA.ps.get_dropped_message_count());
+
+    std::atomic<bool> called{false};
+    terminalsA.ps.async_receive_messages([&](auto& res, auto msgs) {
+        EXPECT_EQ(res, Success());
+        ASSERT_EQ(2u, msgs.size());
+        EXPECT_EQ(1, msgs[0].data[0]);
+        EXPECT_EQ(2, msgs[1].data[0]);
+        EXPECT_FALSE(msgs[1].cached);
+        called = true;
+    });
+
+    while (!called);
+
+    called = false;
+    terminalsA.ps.async_receive_messages([&](auto& res, auto msgs) {
+        EXPECT_EQ(res, Canceled());
+        EXPECT_TRUE(msgs.empty());
+        called = true;
+    });
+
+    terminalsA.ps.cancel_receive_messages();
+    while (!called);
+}
+
+TEST_F(RawTerminalsTest, ReceiveLoanedMessage)
+{
+    std::vector<char> msg{12, 34};
+    connect(bindings.ps, terminalsB.ps);
+
+    LoanedMessage loaned;
+    std::atomic<bool> called{false};
+    terminalsA.ps.async_receive_loaned_message([&](auto& res, auto&& loanedMsg) {
+        EXPECT_EQ(res, Success());
+        loaned = std::move(loanedMsg);
+        called = true;
+    });
+
+    terminalsB.ps.publish(msg);
+    while (!called);
+
+    ASSERT_EQ(2u, loaned.size());
+    EXPECT_EQ(12, loaned.data()[0]);
+    EXPECT_EQ(34, loaned.data()[1]);
+    EXPECT_FALSE(loaned.cached());
+
+    loaned.release();
+    EXPECT_EQ(nullptr, loaned.data());
+
+    called = false;
+    terminalsA.ps.async_receive_loaned_message([&](auto& res, auto&& loanedMsg) {
+        EXPECT_EQ(res, Canceled());
+        EXPECT_EQ(0u, loanedMsg.size());
+        called = true;
+    });
+
+    terminalsA.ps.cancel_receive_loaned_message();
+    while (!called);
+}
+
+TEST_F(RawTerminalsTest, PublishBatch)
+{
+    std::vector<std::vector<char>> msgs{{1, 2}, {3}, {4, 5, 6}};
+
+    // publish without the terminal being bound
+    EXPECT_THROW(terminalsB.ps.publish_batch(msgs), Failure);
+    EXPECT_FALSE(terminalsB.ps.try_publish_batch(msgs));
+
+    terminalsA.ps.set_receive_queue(3);
+    connect(bindings.ps, terminalsB.ps);
+    EXPECT_NO_THROW(terminalsB.ps.publish_batch(msgs));
+
+    std::vector<std::vector<char>> received;
+    while (received.size() < msgs.size()) {
+        std::atomic<bool> called{false};
+        terminalsA.ps.async_receive_messages([&](auto& res, auto batch) {
+            EXPECT_EQ(res, Success());
+            for (auto& msg : batch) {
+                received.push_back(msg.data);
+            }
+
+            called = true;
+        });
+
+        while (!called);
+    }
+
+    EXPECT_EQ(msgs, received);
+}
+
+TEST_F(RawTerminalsTest, AsyncPublish)
+{
+    std::vector<char> msg{12, 34};
+
+    // publish without the terminal being bound
+    EXPECT_THROW(terminalsB.ps.async_publish(msg, [](auto&) {}), Failure);
+
+    terminalsA.ps.set_receive_queue(1);
+    connect(bindings.ps, terminalsB.ps);
+
+    std::atomic<bool> called{false};
+    terminalsB.ps.async_publish(msg, [&](auto& res) {
+        EXPECT_EQ(res, Success());
+        called = true;
+    });
+
+    while (!called);
+
+    called = false;
+    terminalsA.ps.async_receive_messages([&](auto& res, auto msgs) {
+        EXPECT_EQ(res, Success());
+        ASSERT_EQ(1u, msgs.size());
+        EXPECT_EQ(msg, msgs[0].data);
+        called = true;
+    });
+
+    while (!called);
+}
+
 TEST_F(RawTerminalsTest, CachedPublishSubscribeTerminal)
 {
     std::vector<char> msg{12, 34};
@@ -14,3 +14,57 @@ TEST_F(SchedulerTest, SetThreadPoolSize)
     EXPECT_NO_THROW(scheduler.set_thread_pool_size(3));
     EXPECT_THROW(scheduler.set_thread_pool_size(999999), Failure);
 }
+
+TEST_F(SchedulerTest, WorkStealing)
+{
+    Scheduler scheduler(WORK_STEALING);
+    EXPECT_NO_THROW(scheduler.set_thread_pool_size(3));
+    EXPECT_NO_THROW(scheduler.set_cpu_affinity({0}));
+    EXPECT_NO_THROW(scheduler.set_cpu_affinity({}));
+    EXPECT_THROW(scheduler.set_cpu_affinity({-1}), Failure);
+}
+
+TEST_F(SchedulerTest, Statistics)
+{
+    Scheduler scheduler;
+    EXPECT_NO_THROW(scheduler.enable_statistics());
+
+    auto stats = scheduler.statistics();
+    EXPECT_EQ(5u, stats.size());
+    EXPECT_EQ(static_cast<std::size_t>(YOGI_HISTOGRAM_BUCKETS),
+        stats[handler_category::DISPATCH].runtimes.size());
+
+    EXPECT_NO_THROW(scheduler.reset_statistics());
+    EXPECT_NO_THROW(scheduler.enable_statistics(false));
+}
+
+TEST_F(SchedulerTest, CallbackExecutor)
+{
+    Scheduler scheduler;
+    EXPECT_THROW(scheduler.set_callback_executor(2), Failure);
+    EXPECT_NO_THROW(scheduler.set_callback_executor(2, 100));
+    EXPECT_NO_THROW(scheduler.set_callback_executor(1, 10, RUN_INLINE_WHEN_FULL));
+    EXPECT_NO_THROW(scheduler.set_callback_executor(0));
+}
+
+TEST_F(SchedulerTest, BusyPoll)
+{
+    Scheduler scheduler(BUSY_POLL);
+    EXPECT_NO_THROW(scheduler.set_thread_pool_size(2));
+    EXPECT_NO_THROW(scheduler.set_spin_duration(std::chrono::microseconds(50)));
+    EXPECT_NO_THROW(scheduler.set_realtime_priority(0));
+    EXPECT_THROW(scheduler.set_realtime_priority(-1), Failure);
+
+    Scheduler sharedQueueScheduler;
+    EXPECT_THROW(sharedQueueScheduler.set_spin_duration(std::chrono::microseconds(50)), Failure);
+}
+
+TEST_F(SchedulerTest, AutoScaling)
+{
+    Scheduler scheduler;
+    EXPECT_NO_THROW(scheduler.enable_auto_scaling(1, 4, std::chrono::microseconds(500),
+        std::chrono::milliseconds(1000)));
+    EXPECT_THROW(scheduler.enable_auto_scaling(4, 1, std::chrono::microseconds(500),
+        std::chrono::milliseconds(1000)), Failure);
+    EXPECT_NO_THROW(scheduler.disable_auto_scaling());
+}
@@ -8,8 +8,10 @@
 #include "yogi/connection.hpp"
 #include "yogi/endpoint.hpp"
 #include "yogi/errors.hpp"
+#include "yogi/flow_controlled.hpp"
 #include "yogi/leaf.hpp"
 #include "yogi/logging.hpp"
+#include "yogi/message_receiver.hpp"
 #include "yogi/node.hpp"
 #include "yogi/object.hpp"
 #include "yogi/observers.hpp"
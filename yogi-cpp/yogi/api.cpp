@@ -18,4 +18,9 @@ Result set_log_file(const std::string& file, verbosity verb)
     return Result(YOGI_SetLogFile(file.c_str(), vb));
 }
 
+Result lock_memory(bool lock)
+{
+    return Result(YOGI_LockMemory(lock ? 1 : 0));
+}
+
 } // namespace yogi
@@ -11,6 +11,7 @@ namespace yogi {
 
 const std::string& get_version();
 Result set_log_file(const std::string& file, verbosity verb);
+Result lock_memory(bool lock = true);
 
 } // namespace yogi
 
@@ -24,4 +24,67 @@ const std::string& Binding::class_name() const
     return s;
 }
 
+void Binding::set_receive_window(std::size_t window)
+{
+    int res = YOGI_PS_SetReceiveWindow(this->handle(), static_cast<unsigned>(window));
+    internal::throw_on_failure(res);
+}
+
+void Binding::conflate(std::chrono::milliseconds interval)
+{
+    int res = YOGI_PS_SetDecimation(this->handle(), YOGI_DC_CONFLATE, static_cast<unsigned>(interval.count()));
+    internal::throw_on_failure(res);
+}
+
+void Binding::decimate(std::size_t everyNth)
+{
+    int res = YOGI_PS_SetDecimation(this->handle(), YOGI_DC_EVERYNTH, static_cast<unsigned>(everyNth));
+    internal::throw_on_failure(res);
+}
+
+void Binding::disable_decimation()
+{
+    int res = YOGI_PS_SetDecimation(this->handle(), YOGI_DC_NONE, 0);
+    internal::throw_on_failure(res);
+}
+
+void Binding::add_filter_mask(std::size_t offset, const std::vector<char>& value)
+{
+    int res = YOGI_PS_AddFilterMask(this->handle(), static_cast<unsigned>(offset), value.data(), nullptr,
+        static_cast<unsigned>(value.size()));
+    internal::throw_on_failure(res);
+}
+
+void Binding::add_filter_mask(std::size_t offset, const std::vector<char>& value, const std::vector<char>& mask)
+{
+    if (mask.size() != value.size()) {
+        throw Failure(YOGI_ERR_INVALID_PARAM);
+    }
+
+    int res = YOGI_PS_AddFilterMask(this->handle(), static_cast<unsigned>(offset), value.data(), mask.data(),
+        static_cast<unsigned>(value.size()));
+    internal::throw_on_failure(res);
+}
+
+void Binding::add_filter_range(std::size_t offset, std::size_t width, unsigned long long min, unsigned long long max)
+{
+    int res = YOGI_PS_AddFilterRange(this->handle(), static_cast<unsigned>(offset), static_cast<unsigned>(width), min,
+        max);
+    internal::throw_on_failure(res);
+}
+
+void Binding::clear_filter()
+{
+    int res = YOGI_PS_ClearFilter(this->handle());
+    internal::throw_on_failure(res);
+}
+
+void Binding::request_replay(std::size_t maxMessages, std::chrono::system_clock::time_point since)
+{
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(since.time_since_epoch()).count();
+    int res = YOGI_RequestReplay(this->handle(), static_cast<unsigned>(maxMessages),
+        static_cast<unsigned long long>(ns));
+    internal::throw_on_failure(res);
+}
+
 } // namespace yogi
@@ -4,6 +4,9 @@
 #include "object.hpp"
 #include "binder.hpp"
 
+#include <chrono>
+#include <vector>
+
 
 namespace yogi {
 
@@ -35,6 +38,29 @@ public:
     {
         return m_targets;
     }
+
+    // only for bindings of publish-subscribe terminals; 0 disables flow control
+    void set_receive_window(std::size_t window);
+
+    // only for bindings of publish-subscribe terminals; asks the node to send
+    // at most one message per interval or every Nth message only
+    void conflate(std::chrono::milliseconds interval);
+    void decimate(std::size_t everyNth);
+    void disable_decimation();
+
+    // only for bindings of publish-subscribe terminals; all conditions added
+    // have to be met for a message to be received
+    void add_filter_mask(std::size_t offset, const std::vector<char>& value);
+    void add_filter_mask(std::size_t offset, const std::vector<char>& value,
+        const std::vector<char>& mask);
+    void add_filter_range(std::size_t offset, std::size_t width,
+        unsigned long long min, unsigned long long max);
+    void clear_filter();
+
+    // only for bindings of cached terminals; asks the node to replay recent
+    // messages (maxMessages == 0 and since == time_point{} for no limit)
+    void request_replay(std::size_t maxMessages,
+        std::chrono::system_clock::time_point since = std::chrono::system_clock::time_point{});
 };
 
 } // namespace yogi
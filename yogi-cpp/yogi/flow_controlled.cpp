@@ -0,0 +1,37 @@
+#include "flow_controlled.hpp"
+#include "object.hpp"
+#include "internal/async.hpp"
+#include "internal/utility.hpp"
+
+#include <yogi_core.h>
+
+
+namespace yogi {
+
+FlowControlled::FlowControlled(Object* self)
+: m_obj(*self)
+{
+}
+
+int FlowControlled::get_available_credit() const
+{
+    int credit;
+    int res = YOGI_PS_GetAvailableCredit(m_obj.handle(), &credit);
+    internal::throw_on_failure(res);
+    return credit;
+}
+
+void FlowControlled::async_await_credit_change(std::function<void (const Result&, int)> completionHandler)
+{
+    internal::async_call<int>(completionHandler, [&](auto fn, void* userArg) {
+        return YOGI_PS_AsyncAwaitCreditChange(m_obj.handle(), fn, userArg);
+    });
+}
+
+void FlowControlled::cancel_await_credit_change()
+{
+    int res = YOGI_PS_CancelAwaitCreditChange(m_obj.handle());
+    internal::throw_on_failure(res);
+}
+
+} // namespace yogi
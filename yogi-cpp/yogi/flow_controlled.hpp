@@ -0,0 +1,30 @@
+#ifndef YOGI_FLOW_CONTROLLED_HPP
+#define YOGI_FLOW_CONTROLLED_HPP
+
+#include "result.hpp"
+
+#include <functional>
+
+
+namespace yogi {
+
+class Object;
+
+class FlowControlled
+{
+private:
+    Object& m_obj;
+
+protected:
+    FlowControlled(Object* self);
+
+public:
+    // -1 if the terminal is not limited by flow control
+    int get_available_credit() const;
+    void async_await_credit_change(std::function<void (const Result&, int)> completionHandler);
+    void cancel_await_credit_change();
+};
+
+} // namespace yogi
+
+#endif // YOGI_FLOW_CONTROLLED_HPP
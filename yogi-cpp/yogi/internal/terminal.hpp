@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <vector>
+#include <functional>
 
 
 namespace yogi {
@@ -36,6 +37,18 @@ inline void publish_raw_message(int (*apiFn)(void*, const void*, unsigned), cons
     throw_on_failure(res);
 }
 
+inline void async_publish_raw_message(int (*apiFn)(void*, const void*, unsigned, void (*)(int, void*), void*), const Object* terminal,
+    const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    if (size > MAX_MESSAGE_SIZE) {
+        throw Failure(YOGI_ERR_BUFFER_TOO_SMALL);
+    }
+
+    async_call<>(completionHandler, [&](auto fn, void* userArg) {
+        return apiFn(terminal->handle(), data, static_cast<unsigned>(size), fn, userArg);
+    });
+}
+
 template <typename Message>
 inline int invoke_publish_proto_message(int (*apiFn)(void*, const void*, unsigned), const Object* terminal, Message msg)
 {
@@ -64,6 +77,90 @@ inline void publish_proto_message(int (*apiFn)(void*, const void*, unsigned), co
     throw_on_failure(res);
 }
 
+inline int invoke_publish_raw_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<std::vector<char>>& msgs)
+{
+    if (msgs.empty()) {
+        return YOGI_OK;
+    }
+
+    std::vector<const void*> buffers;
+    std::vector<unsigned> bufferSizes;
+    buffers.reserve(msgs.size());
+    bufferSizes.reserve(msgs.size());
+
+    for (auto& msg : msgs) {
+        if (msg.size() > MAX_MESSAGE_SIZE) {
+            return YOGI_ERR_BUFFER_TOO_SMALL;
+        }
+
+        buffers.push_back(msg.data());
+        bufferSizes.push_back(static_cast<unsigned>(msg.size()));
+    }
+
+    return apiFn(terminal->handle(), buffers.data(), bufferSizes.data(), static_cast<unsigned>(msgs.size()));
+}
+
+inline bool try_publish_raw_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<std::vector<char>>& msgs)
+{
+    int res = invoke_publish_raw_messages(apiFn, terminal, msgs);
+    return res == YOGI_OK;
+}
+
+inline void publish_raw_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<std::vector<char>>& msgs)
+{
+    int res = invoke_publish_raw_messages(apiFn, terminal, msgs);
+    throw_on_failure(res);
+}
+
+template <typename Message>
+inline void async_publish_proto_message(int (*apiFn)(void*, const void*, unsigned, void (*)(int, void*), void*), const Object* terminal,
+    Message msg, std::function<void (const Result&)> completionHandler)
+{
+    auto size = static_cast<std::size_t>(msg.ByteSize());
+    if (size > MAX_MESSAGE_SIZE) {
+        throw Failure(YOGI_ERR_BUFFER_TOO_SMALL);
+    }
+
+    std::vector<unsigned char> buffer(size);
+    msg.SerializeWithCachedSizesToArray(buffer.data());
+
+    async_publish_raw_message(apiFn, terminal, buffer.data(), size, completionHandler);
+}
+
+template <typename Message>
+inline int invoke_publish_proto_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<Message>& msgs)
+{
+    std::vector<std::vector<char>> data;
+    data.reserve(msgs.size());
+
+    for (auto& msg : msgs) {
+        data.emplace_back(static_cast<std::size_t>(msg.ByteSize()));
+        msg.SerializeWithCachedSizesToArray(reinterpret_cast<unsigned char*>(data.back().data()));
+    }
+
+    return invoke_publish_raw_messages(apiFn, terminal, data);
+}
+
+template <typename Message>
+inline bool try_publish_proto_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<Message>& msgs)
+{
+    int res = invoke_publish_proto_messages(apiFn, terminal, msgs);
+    return res == YOGI_OK;
+}
+
+template <typename Message>
+inline void publish_proto_messages(int (*apiFn)(void*, const void* const*, const unsigned*, unsigned), const Object* terminal,
+    const std::vector<Message>& msgs)
+{
+    int res = invoke_publish_proto_messages(apiFn, terminal, msgs);
+    throw_on_failure(res);
+}
+
 inline std::vector<char> get_cached_raw_message(int (*apiFn)(void*, void*, unsigned, unsigned*), const Object* terminal)
 {
     unsigned char buffer[MAX_MESSAGE_SIZE]; // TODO: Potentially nasty
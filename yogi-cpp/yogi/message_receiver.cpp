@@ -0,0 +1,133 @@
+#include "message_receiver.hpp"
+#include "object.hpp"
+#include "internal/async.hpp"
+#include "internal/utility.hpp"
+
+#include <yogi_core.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+
+namespace yogi {
+
+LoanedMessage::LoanedMessage()
+: m_data(nullptr)
+, m_size(0)
+, m_cached(false)
+, m_loan(nullptr)
+{
+}
+
+LoanedMessage::LoanedMessage(const void* data, std::size_t size, cached_flag cached, void* loan)
+: m_data(static_cast<const char*>(data))
+, m_size(size)
+, m_cached(cached)
+, m_loan(loan)
+{
+}
+
+LoanedMessage::LoanedMessage(LoanedMessage&& other)
+: LoanedMessage()
+{
+    *this = std::move(other);
+}
+
+LoanedMessage::~LoanedMessage()
+{
+    release();
+}
+
+LoanedMessage& LoanedMessage::operator= (LoanedMessage&& other)
+{
+    if (this != &other) {
+        release();
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_cached, other.m_cached);
+        std::swap(m_loan, other.m_loan);
+    }
+
+    return *this;
+}
+
+void LoanedMessage::release()
+{
+    if (m_loan) {
+        YOGI_ReleaseMessageLoan(m_loan);
+    }
+
+    m_data   = nullptr;
+    m_size   = 0;
+    m_cached = false;
+    m_loan   = nullptr;
+}
+
+MessageReceiver::MessageReceiver(Object* self)
+: m_obj(*self)
+{
+}
+
+void MessageReceiver::set_receive_queue(std::size_t depth, receive_queue_policy policy)
+{
+    int res = YOGI_SetReceiveQueue(m_obj.handle(), static_cast<unsigned>(depth), policy);
+    internal::throw_on_failure(res);
+}
+
+unsigned long long MessageReceiver::get_dropped_message_count() const
+{
+    unsigned long long count;
+    int res = YOGI_GetDroppedMessageCount(m_obj.handle(), &count);
+    internal::throw_on_failure(res);
+    return count;
+}
+
+void MessageReceiver::async_receive_messages(std::function<void (const Result&, std::vector<ReceivedMessage>&&)> completionHandler)
+{
+    // large enough for at least one message of the maximum size
+    auto buffer = std::make_shared<std::vector<char>>(MAX_MESSAGE_SIZE + YOGI_RQ_MESSAGE_HEADER_SIZE);
+    internal::async_call<unsigned, unsigned>([=](const Result& res, unsigned numMessages, unsigned size) {
+        std::vector<ReceivedMessage> msgs;
+        msgs.reserve(numMessages);
+
+        if (res == Success()) {
+            auto p = buffer->data();
+            while (p < buffer->data() + size) {
+                std::uint32_t msgSize;
+                std::memcpy(&msgSize, p, 4);
+                auto data = p + YOGI_RQ_MESSAGE_HEADER_SIZE;
+                msgs.push_back(ReceivedMessage{std::vector<char>(data, data + msgSize), !!p[4]});
+                p = data + msgSize;
+            }
+        }
+
+        completionHandler(res, std::move(msgs));
+    }, [&](auto fn, void* userArg) {
+        return YOGI_AsyncReceiveMessages(m_obj.handle(), buffer->data(), static_cast<unsigned>(buffer->size()), fn, userArg);
+    });
+}
+
+void MessageReceiver::cancel_receive_messages()
+{
+    int res = YOGI_CancelReceiveMessages(m_obj.handle());
+    internal::throw_on_failure(res);
+}
+
+void MessageReceiver::async_receive_loaned_message(std::function<void (const Result&, LoanedMessage&&)> completionHandler)
+{
+    internal::async_call<const void*, unsigned, int, void*>([=](const Result& res, const void* data, unsigned size, int cached, void* loan) {
+        completionHandler(res, LoanedMessage(data, size, !!cached, loan));
+    }, [&](auto fn, void* userArg) {
+        return YOGI_AsyncReceiveMessageLoan(m_obj.handle(), fn, userArg);
+    });
+}
+
+void MessageReceiver::cancel_receive_loaned_message()
+{
+    int res = YOGI_CancelReceiveMessageLoan(m_obj.handle());
+    internal::throw_on_failure(res);
+}
+
+} // namespace yogi
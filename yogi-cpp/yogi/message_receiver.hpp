@@ -0,0 +1,76 @@
+#ifndef YOGI_MESSAGE_RECEIVER_HPP
+#define YOGI_MESSAGE_RECEIVER_HPP
+
+#include "types.hpp"
+#include "result.hpp"
+
+#include <functional>
+#include <vector>
+
+
+namespace yogi {
+
+class Object;
+
+class LoanedMessage
+{
+private:
+    const char*  m_data;
+    std::size_t  m_size;
+    cached_flag  m_cached;
+    void*        m_loan;
+
+public:
+    LoanedMessage();
+    LoanedMessage(const void* data, std::size_t size, cached_flag cached, void* loan);
+    LoanedMessage(LoanedMessage&& other);
+    LoanedMessage(const LoanedMessage&) = delete;
+    ~LoanedMessage();
+
+    LoanedMessage& operator= (LoanedMessage&& other);
+    LoanedMessage& operator= (const LoanedMessage&) = delete;
+
+    const char* data() const
+    {
+        return m_data;
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    cached_flag cached() const
+    {
+        return m_cached;
+    }
+
+    void release();
+};
+
+class MessageReceiver
+{
+public:
+    struct ReceivedMessage {
+        std::vector<char> data;
+        cached_flag       cached;
+    };
+
+private:
+    Object& m_obj;
+
+protected:
+    MessageReceiver(Object* self);
+
+public:
+    void set_receive_queue(std::size_t depth, receive_queue_policy policy = DROP_OLDEST);
+    unsigned long long get_dropped_message_count() const;
+    void async_receive_messages(std::function<void (const Result&, std::vector<ReceivedMessage>&&)> completionHandler);
+    void cancel_receive_messages();
+    void async_receive_loaned_message(std::function<void (const Result&, LoanedMessage&&)> completionHandler);
+    void cancel_receive_loaned_message();
+};
+
+} // namespace yogi
+
+#endif // YOGI_MESSAGE_RECEIVER_HPP
@@ -63,6 +63,49 @@ std::vector<terminal_info> Node::get_known_terminals()
     return terminals;
 }
 
+std::vector<terminal_info> Node::find_known_terminals(const std::string& pattern, find_mode mode, bool caseSensitive)
+{
+    int mode_ = static_cast<int>(mode) | (caseSensitive ? 0 : YOGI_KT_IGNORECASE);
+
+    // pages continue after the last terminal of the previous page which keeps
+    // the result consistent even if terminals change between the calls
+    std::vector<char> buffer(1024);
+    std::vector<char> lastTerminal;
+    std::vector<terminal_info> terminals;
+    while (true) {
+        unsigned numTerminals;
+        int res = YOGI_FindKnownTerminals(this->handle(), mode_, pattern.c_str(),
+            lastTerminal.empty() ? nullptr : lastTerminal.data(), 0, buffer.data(),
+            static_cast<unsigned>(buffer.size()), &numTerminals, nullptr);
+        if (res != YOGI_ERR_BUFFER_TOO_SMALL) {
+            internal::throw_on_failure(res);
+        }
+
+        auto it = buffer.begin();
+        for (unsigned i = 0; i < numTerminals; ++i) {
+            auto start = it;
+            terminals.emplace_back();
+            it = extract_terminal_info(&terminals.back(), it);
+
+            if (i + 1 == numTerminals) {
+                lastTerminal.assign(start, it);
+            }
+        }
+
+        if (res == YOGI_ERR_BUFFER_TOO_SMALL) {
+            if (numTerminals == 0) {
+                buffer.resize(buffer.size() * 2);
+            }
+
+            continue;
+        }
+
+        break;
+    }
+
+    return terminals;
+}
+
 void Node::async_await_known_terminals_change(std::function<void (const Result&, terminal_info&&, change_type)> completionHandler)
 {
     internal::async_call([=](const Result& res) {
@@ -87,4 +130,16 @@ void Node::cancel_await_known_terminals_change()
     internal::throw_on_failure(res);
 }
 
+void Node::set_history_limits(std::size_t maxMessages, std::size_t maxBytes)
+{
+    int res = YOGI_SetHistoryLimits(this->handle(), static_cast<unsigned>(maxMessages), static_cast<unsigned>(maxBytes));
+    internal::throw_on_failure(res);
+}
+
+void Node::set_last_value_store(const std::string& path)
+{
+    int res = YOGI_SetLastValueStore(this->handle(), path.empty() ? nullptr : path.c_str());
+    internal::throw_on_failure(res);
+}
+
 } // namespace yogi
@@ -25,8 +25,16 @@ public:
     virtual const std::string& class_name() const override;
 
     std::vector<terminal_info> get_known_terminals();
+    std::vector<terminal_info> find_known_terminals(const std::string& pattern, find_mode mode = FIND_PREFIX,
+        bool caseSensitive = true);
     void async_await_known_terminals_change(std::function<void (const Result&, terminal_info&&, change_type)> completionHandler);
     void cancel_await_known_terminals_change();
+
+    // history kept for each cached terminal; 0 messages disables it
+    void set_history_limits(std::size_t maxMessages, std::size_t maxBytes = 0);
+
+    // file for persisting the last message of each cached terminal; empty to stop persisting
+    void set_last_value_store(const std::string& path);
 };
 
 } // namespace yogi
@@ -1,6 +1,7 @@
 #include "observers.hpp"
 #include "binder.hpp"
 #include "subscribable.hpp"
+#include "flow_controlled.hpp"
 #include "process.hpp"
 #include "errors.hpp"
 
@@ -130,6 +131,35 @@ SubscriptionObserver::~SubscriptionObserver()
     auto lock = this->_make_lock();
 }
 
+void CreditObserver::_async_get_state(std::function<void (const Result&, int)> completionHandler)
+{
+    // the core library only offers a synchronous way to get the credit
+    completionHandler(Success(), m_flowControlled.get_available_credit());
+}
+
+void CreditObserver::_async_await_state_change(std::function<void (const Result&, int)> completionHandler)
+{
+    m_flowControlled.async_await_credit_change(completionHandler);
+}
+
+void CreditObserver::_cancel_await_state()
+{
+    m_flowControlled.cancel_await_credit_change();
+}
+
+CreditObserver::CreditObserver(FlowControlled& flowControlled)
+: m_flowControlled(flowControlled)
+{
+}
+
+CreditObserver::~CreditObserver()
+{
+    this->stop();
+
+    // make sure m_mutex exists as long as it is used by _on_message_received()
+    auto lock = this->_make_lock();
+}
+
 void OperationalObserver::_async_get_state(std::function<void (const Result&, operational_flag)> completionHandler)
 {
     ProcessInterface::_add_operational_observer(this, completionHandler);
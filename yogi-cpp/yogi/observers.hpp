@@ -17,6 +17,7 @@ namespace yogi {
 
 class Binder;
 class Subscribable;
+class FlowControlled;
 class ProcessInterface;
 
 class CalledFromHandler : public std::exception
@@ -130,6 +131,36 @@ public:
 };
 
 
+class CreditObserver final
+: public internal::StateObserver<Observer, int, BadCallbackId>
+{
+public:
+    using internal::StateObserver<Observer, int, BadCallbackId>::CallbackId;
+
+private:
+    FlowControlled& m_flowControlled;
+
+protected:
+    virtual void _async_get_state(std::function<void (const Result&, int)> completionHandler) override;
+    virtual void _async_await_state_change(std::function<void (const Result&, int)> completionHandler) override;
+    virtual void _cancel_await_state() override;
+
+public:
+    CreditObserver(FlowControlled& flowControlled);
+    virtual ~CreditObserver();
+
+    const FlowControlled& flow_controlled() const
+    {
+        return m_flowControlled;
+    }
+
+    FlowControlled& flow_controlled()
+    {
+        return m_flowControlled;
+    }
+};
+
+
 template <typename Terminal>
 class MessageObserver;
 
@@ -9,6 +9,11 @@ Scheduler::Scheduler()
 {
 }
 
+Scheduler::Scheduler(scheduler_type type)
+: Object(YOGI_CreateSchedulerEx, static_cast<int>(type))
+{
+}
+
 Scheduler::~Scheduler()
 {
     this->_destroy();
@@ -20,6 +25,76 @@ void Scheduler::set_thread_pool_size(std::size_t n)
     internal::throw_on_failure(res);
 }
 
+void Scheduler::enable_auto_scaling(std::size_t minThreads, std::size_t maxThreads,
+    std::chrono::microseconds queueDelayThreshold, std::chrono::milliseconds idleTimeout)
+{
+    int res = YOGI_SetSchedulerAutoScaling(this->handle(), static_cast<unsigned>(minThreads),
+        static_cast<unsigned>(maxThreads), static_cast<unsigned>(queueDelayThreshold.count()),
+        static_cast<unsigned>(idleTimeout.count()));
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::disable_auto_scaling()
+{
+    int res = YOGI_SetSchedulerAutoScaling(this->handle(), 0, 0, 0, 0);
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::set_cpu_affinity(const std::vector<int>& cpus)
+{
+    int res = YOGI_SetSchedulerCpuAffinity(this->handle(), cpus.data(), static_cast<unsigned>(cpus.size()));
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::set_realtime_priority(int priority)
+{
+    int res = YOGI_SetSchedulerRealtimePriority(this->handle(), priority);
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::set_spin_duration(std::chrono::microseconds duration)
+{
+    int res = YOGI_SetSchedulerSpinDuration(this->handle(), static_cast<int>(duration.count()));
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::enable_statistics(bool enabled)
+{
+    int res = YOGI_EnableSchedulerStatistics(this->handle(), enabled ? 1 : 0);
+    internal::throw_on_failure(res);
+}
+
+scheduler_statistics Scheduler::statistics() const
+{
+    scheduler_statistics stats;
+    for (auto category : {handler_category::TCP_RECEIVE, handler_category::DESERIALIZE,
+        handler_category::DISPATCH, handler_category::USER_CALLBACK, handler_category::OTHER}) {
+        auto& hists = stats[category];
+        hists.queueDelays.resize(YOGI_HISTOGRAM_BUCKETS);
+        hists.runtimes.resize(YOGI_HISTOGRAM_BUCKETS);
+
+        int res = YOGI_GetSchedulerStatistics(this->handle(), static_cast<int>(category),
+            hists.queueDelays.data(), hists.runtimes.data());
+        internal::throw_on_failure(res);
+    }
+
+    return stats;
+}
+
+void Scheduler::reset_statistics()
+{
+    int res = YOGI_ResetSchedulerStatistics(this->handle());
+    internal::throw_on_failure(res);
+}
+
+void Scheduler::set_callback_executor(std::size_t numThreads, std::size_t queueSize,
+    overflow_policy policy)
+{
+    int res = YOGI_SetSchedulerCallbackExecutor(this->handle(), static_cast<unsigned>(numThreads),
+        static_cast<unsigned>(queueSize), static_cast<int>(policy));
+    internal::throw_on_failure(res);
+}
+
 const std::string& Scheduler::class_name() const
 {
     static std::string s = "Scheduler";
@@ -2,18 +2,51 @@
 #define YOGI_SCHEDULER_HPP
 
 #include "object.hpp"
+#include "types.hpp"
+
+#include <vector>
+#include <map>
+#include <chrono>
 
 
 namespace yogi {
 
+struct handler_statistics {
+    // bucket i counts durations in [2^(i-1), 2^i) us; bucket 0 counts < 1 us
+    std::vector<unsigned long long> queueDelays;
+    std::vector<unsigned long long> runtimes;
+};
+
+typedef std::map<handler_category, handler_statistics> scheduler_statistics;
+
 class Scheduler : public Object
 {
 public:
     Scheduler();
+    explicit Scheduler(scheduler_type type);
     virtual ~Scheduler();
 
     void set_thread_pool_size(std::size_t n);
 
+    // only supported by SHARED_QUEUE schedulers
+    void enable_auto_scaling(std::size_t minThreads, std::size_t maxThreads,
+        std::chrono::microseconds queueDelayThreshold, std::chrono::milliseconds idleTimeout);
+    void disable_auto_scaling();
+
+    void set_cpu_affinity(const std::vector<int>& cpus);
+    void set_realtime_priority(int priority);
+
+    // only supported by BUSY_POLL schedulers; negative values spin forever
+    void set_spin_duration(std::chrono::microseconds duration);
+
+    void enable_statistics(bool enabled = true);
+    scheduler_statistics statistics() const;
+    void reset_statistics();
+
+    // numThreads = 0 executes user callbacks on the scheduler's threads
+    void set_callback_executor(std::size_t numThreads, std::size_t queueSize = 0,
+        overflow_policy policy = BLOCK_WHEN_FULL);
+
     virtual const std::string& class_name() const override;
 };
 
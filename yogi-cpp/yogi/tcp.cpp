@@ -31,6 +31,56 @@ const std::string& TcpConnection::class_name() const
     return s;
 }
 
+void TcpConnection::assign_multiplexed(std::chrono::milliseconds timeout)
+{
+    int timeout_ = static_cast<int>(timeout == timeout.max() ? -1 : timeout.count());
+    int res = YOGI_AssignMultiplexedConnection(handle(), timeout_);
+    internal::throw_on_failure(res);
+}
+
+namespace {
+
+void* make_tcp_channel(TcpConnection& connection, Endpoint& endpoint)
+{
+    void* handle;
+    int res = YOGI_CreateTcpChannel(&handle, connection.handle(), endpoint.handle());
+    internal::throw_on_failure(res);
+    return handle;
+}
+
+} // anonymous namespace
+
+TcpChannel::TcpChannel(TcpConnection& connection, Endpoint& endpoint)
+: Connection(make_tcp_channel(connection, endpoint))
+{
+}
+
+TcpChannel::~TcpChannel()
+{
+    this->_destroy();
+}
+
+const std::string& TcpChannel::class_name() const
+{
+    static std::string s = "TcpChannel";
+    return s;
+}
+
+void TcpChannel::async_await_death(std::function<void (const Failure&)> completionHandler)
+{
+    internal::async_call([=](const Result& res) {
+        completionHandler(static_cast<const Failure&>(res));
+    }, [&](auto fn, void* userArg) {
+        return YOGI_AsyncAwaitConnectionDeath(this->handle(), fn, userArg);
+    });
+}
+
+void TcpChannel::cancel_await_death()
+{
+    int res = YOGI_CancelAwaitConnectionDeath(this->handle());
+    internal::throw_on_failure(res);
+}
+
 TcpClient::TcpClient(Scheduler& scheduler, const Optional<std::string>& identification)
 : Object(YOGI_CreateTcpClient, scheduler.handle(), internal::get_raw_string_pointer(identification),
     internal::get_string_size(identification))
@@ -25,6 +25,24 @@ protected:
 public:
     virtual ~TcpConnection();
     virtual const std::string& class_name() const override;
+
+    // carries TcpChannels instead of being assigned to a single endpoint
+    void assign_multiplexed(std::chrono::milliseconds timeout);
+};
+
+
+// must be destroyed before the multiplexed connection it has been created on
+class TcpChannel : public Connection
+{
+public:
+    TcpChannel(TcpConnection& connection, Endpoint& endpoint);
+    virtual ~TcpChannel();
+
+    virtual const std::string& class_name() const override;
+
+    // also completes if the remote end refuses the channel
+    void async_await_death(std::function<void (const Failure&)> completionHandler);
+    void cancel_await_death();
 };
 
 
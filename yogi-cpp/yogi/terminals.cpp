@@ -104,7 +104,7 @@ void RawPublishSubscribeTerminal::publish(const std::vector<char>& data)
 
 bool RawPublishSubscribeTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_PS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_PS_TryPublish, this, data, size);
 }
 
 bool RawPublishSubscribeTerminal::try_publish(const std::vector<char>& data)
@@ -112,6 +112,26 @@ bool RawPublishSubscribeTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawPublishSubscribeTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_PS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawPublishSubscribeTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawPublishSubscribeTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_PS_PublishBatch, this, msgs);
+}
+
+bool RawPublishSubscribeTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_PS_PublishBatch, this, msgs);
+}
+
 void RawPublishSubscribeTerminal::async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler)
 {
     internal::async_receive_raw_message(YOGI_PS_AsyncReceiveMessage, this, completionHandler);
@@ -150,7 +170,7 @@ void RawCachedPublishSubscribeTerminal::publish(const std::vector<char>& data)
 
 bool RawCachedPublishSubscribeTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_CPS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_CPS_TryPublish, this, data, size);
 }
 
 bool RawCachedPublishSubscribeTerminal::try_publish(const std::vector<char>& data)
@@ -158,6 +178,26 @@ bool RawCachedPublishSubscribeTerminal::try_publish(const std::vector<char>& dat
     return try_publish(data.data(), data.size());
 }
 
+void RawCachedPublishSubscribeTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_CPS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawCachedPublishSubscribeTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawCachedPublishSubscribeTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_CPS_PublishBatch, this, msgs);
+}
+
+bool RawCachedPublishSubscribeTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_CPS_PublishBatch, this, msgs);
+}
+
 std::vector<char> RawCachedPublishSubscribeTerminal::get_cached_message()
 {
     return internal::get_cached_raw_message(YOGI_CPS_GetCachedMessage, this);
@@ -348,7 +388,7 @@ void RawProducerTerminal::publish(const std::vector<char>& data)
 
 bool RawProducerTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_PC_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_PC_TryPublish, this, data, size);
 }
 
 bool RawProducerTerminal::try_publish(const std::vector<char>& data)
@@ -356,6 +396,26 @@ bool RawProducerTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawProducerTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_PC_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawProducerTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawProducerTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_PC_PublishBatch, this, msgs);
+}
+
+bool RawProducerTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_PC_PublishBatch, this, msgs);
+}
+
 RawConsumerTerminal::~RawConsumerTerminal()
 {
     this->_destroy();
@@ -382,6 +442,18 @@ void RawConsumerTerminal::cancel_receive_message()
     internal::cancel(YOGI_PC_CancelReceiveMessage, this);
 }
 
+void RawConsumerTerminal::set_capacity(unsigned capacity)
+{
+    int res = YOGI_PC_SetConsumerCapacity(handle(), capacity);
+    internal::throw_on_failure(res);
+}
+
+void RawConsumerTerminal::acknowledge_messages(unsigned numMessages)
+{
+    int res = YOGI_PC_AcknowledgeMessages(handle(), numMessages);
+    internal::throw_on_failure(res);
+}
+
 RawCachedProducerTerminal::~RawCachedProducerTerminal()
 {
     this->_destroy();
@@ -410,7 +482,7 @@ void RawCachedProducerTerminal::publish(const std::vector<char>& data)
 
 bool RawCachedProducerTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_CPC_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_CPC_TryPublish, this, data, size);
 }
 
 bool RawCachedProducerTerminal::try_publish(const std::vector<char>& data)
@@ -418,6 +490,26 @@ bool RawCachedProducerTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawCachedProducerTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_CPC_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawCachedProducerTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawCachedProducerTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_CPC_PublishBatch, this, msgs);
+}
+
+bool RawCachedProducerTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_CPC_PublishBatch, this, msgs);
+}
+
 RawCachedConsumerTerminal::~RawCachedConsumerTerminal()
 {
     this->_destroy();
@@ -477,7 +569,7 @@ void RawMasterTerminal::publish(const std::vector<char>& data)
 
 bool RawMasterTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_MS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_MS_TryPublish, this, data, size);
 }
 
 bool RawMasterTerminal::try_publish(const std::vector<char>& data)
@@ -485,6 +577,26 @@ bool RawMasterTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawMasterTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_MS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawMasterTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawMasterTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_MS_PublishBatch, this, msgs);
+}
+
+bool RawMasterTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_MS_PublishBatch, this, msgs);
+}
+
 void RawMasterTerminal::async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler)
 {
     internal::async_receive_raw_message(YOGI_MS_AsyncReceiveMessage, this, completionHandler);
@@ -523,7 +635,7 @@ void RawSlaveTerminal::publish(const std::vector<char>& data)
 
 bool RawSlaveTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_MS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_MS_TryPublish, this, data, size);
 }
 
 bool RawSlaveTerminal::try_publish(const std::vector<char>& data)
@@ -531,6 +643,26 @@ bool RawSlaveTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawSlaveTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_MS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawSlaveTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawSlaveTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_MS_PublishBatch, this, msgs);
+}
+
+bool RawSlaveTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_MS_PublishBatch, this, msgs);
+}
+
 void RawSlaveTerminal::async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler)
 {
     internal::async_receive_raw_message(YOGI_MS_AsyncReceiveMessage, this, completionHandler);
@@ -569,7 +701,7 @@ void RawCachedMasterTerminal::publish(const std::vector<char>& data)
 
 bool RawCachedMasterTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_CMS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_CMS_TryPublish, this, data, size);
 }
 
 bool RawCachedMasterTerminal::try_publish(const std::vector<char>& data)
@@ -577,6 +709,26 @@ bool RawCachedMasterTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawCachedMasterTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_CMS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawCachedMasterTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawCachedMasterTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_CMS_PublishBatch, this, msgs);
+}
+
+bool RawCachedMasterTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_CMS_PublishBatch, this, msgs);
+}
+
 std::vector<char> RawCachedMasterTerminal::get_cached_message()
 {
     return internal::get_cached_raw_message(YOGI_CMS_GetCachedMessage, this);
@@ -620,7 +772,7 @@ void RawCachedSlaveTerminal::publish(const std::vector<char>& data)
 
 bool RawCachedSlaveTerminal::try_publish(const void* data, std::size_t size)
 {
-    return internal::try_publish_raw_message(YOGI_CMS_Publish, this, data, size);
+    return internal::try_publish_raw_message(YOGI_CMS_TryPublish, this, data, size);
 }
 
 bool RawCachedSlaveTerminal::try_publish(const std::vector<char>& data)
@@ -628,6 +780,26 @@ bool RawCachedSlaveTerminal::try_publish(const std::vector<char>& data)
     return try_publish(data.data(), data.size());
 }
 
+void RawCachedSlaveTerminal::async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler)
+{
+    internal::async_publish_raw_message(YOGI_CMS_AsyncPublish, this, data, size, completionHandler);
+}
+
+void RawCachedSlaveTerminal::async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler)
+{
+    async_publish(data.data(), data.size(), completionHandler);
+}
+
+void RawCachedSlaveTerminal::publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    internal::publish_raw_messages(YOGI_CMS_PublishBatch, this, msgs);
+}
+
+bool RawCachedSlaveTerminal::try_publish_batch(const std::vector<std::vector<char>>& msgs)
+{
+    return internal::try_publish_raw_messages(YOGI_CMS_PublishBatch, this, msgs);
+}
+
 std::vector<char> RawCachedSlaveTerminal::get_cached_message()
 {
     return internal::get_cached_raw_message(YOGI_CMS_GetCachedMessage, this);
@@ -5,6 +5,8 @@
 #include "binder.hpp"
 #include "path.hpp"
 #include "subscribable.hpp"
+#include "flow_controlled.hpp"
+#include "message_receiver.hpp"
 #include "signature.hpp"
 #include "internal/terminal.hpp"
 
@@ -197,7 +199,7 @@ public:
 
 
 template <typename ProtoDescription>
-class PublishSubscribeTerminal : public PrimitiveTerminalT<ProtoDescription>, public Subscribable
+class PublishSubscribeTerminal : public PrimitiveTerminalT<ProtoDescription>, public Subscribable, public FlowControlled, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::PublishMessage message_type;
@@ -211,6 +213,8 @@ public:
     PublishSubscribeTerminal(Leaf& leaf, Name&& name)
     : PrimitiveTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Subscribable(this)
+    , FlowControlled(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -218,6 +222,8 @@ public:
     PublishSubscribeTerminal(Name&& name)
     : PrimitiveTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Subscribable(this)
+    , FlowControlled(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -249,7 +255,22 @@ public:
 
     bool try_publish(message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_PS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_PS_TryPublish, this, msg);
+    }
+
+    void async_publish(message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_PS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_PS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_PS_PublishBatch, this, msgs);
     }
 
     void async_receive_message(std::function<void (const Result&, message_type&&)> completionHandler)
@@ -264,7 +285,7 @@ public:
 };
 
 
-class RawPublishSubscribeTerminal : public PrimitiveTerminal, public Subscribable
+class RawPublishSubscribeTerminal : public PrimitiveTerminal, public Subscribable, public FlowControlled, public MessageReceiver
 {
 public:
     enum {
@@ -276,6 +297,8 @@ public:
     RawPublishSubscribeTerminal(Leaf& leaf, Name&& name, Signature signature)
     : PrimitiveTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Subscribable(this)
+    , FlowControlled(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -283,6 +306,8 @@ public:
     RawPublishSubscribeTerminal(Name&& name, Signature signature)
     : PrimitiveTerminal(type(), std::forward<Name>(name), signature)
     , Subscribable(this)
+    , FlowControlled(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -293,13 +318,17 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler);
     void cancel_receive_message();
 };
 
 
 template <typename ProtoDescription>
-class CachedPublishSubscribeTerminal : public PrimitiveTerminalT<ProtoDescription>, public Subscribable
+class CachedPublishSubscribeTerminal : public PrimitiveTerminalT<ProtoDescription>, public Subscribable, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::PublishMessage message_type;
@@ -313,6 +342,7 @@ public:
     CachedPublishSubscribeTerminal(Leaf& leaf, Name&& name)
     : PrimitiveTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -320,6 +350,7 @@ public:
     CachedPublishSubscribeTerminal(Name&& name)
     : PrimitiveTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -351,7 +382,22 @@ public:
 
     bool try_publish(message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_CPS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_CPS_TryPublish, this, msg);
+    }
+
+    void async_publish(message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_CPS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_CPS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_CPS_PublishBatch, this, msgs);
     }
 
     message_type get_cached_message()
@@ -371,7 +417,7 @@ public:
 };
 
 
-class RawCachedPublishSubscribeTerminal : public PrimitiveTerminal, public Subscribable
+class RawCachedPublishSubscribeTerminal : public PrimitiveTerminal, public Subscribable, public MessageReceiver
 {
 public:
     enum {
@@ -383,6 +429,7 @@ public:
     RawCachedPublishSubscribeTerminal(Leaf& leaf, Name&& name, Signature signature)
     : PrimitiveTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -390,6 +437,7 @@ public:
     RawCachedPublishSubscribeTerminal(Name&& name, Signature signature)
     : PrimitiveTerminal(type(), std::forward<Name>(name), signature)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -400,6 +448,10 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     std::vector<char> get_cached_message();
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&, cached_flag)> completionHandler);
     void cancel_receive_message();
@@ -942,7 +994,22 @@ public:
 
     bool try_publish(message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_PC_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_PC_TryPublish, this, msg);
+    }
+
+    void async_publish(message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_PC_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_PC_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_PC_PublishBatch, this, msgs);
     }
 };
 
@@ -976,11 +1043,15 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
 };
 
 
 template <typename ProtoDescription>
-class ConsumerTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder
+class ConsumerTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::PublishMessage message_type;
@@ -994,6 +1065,7 @@ public:
     ConsumerTerminal(Leaf& leaf, Name&& name)
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1001,6 +1073,7 @@ public:
     ConsumerTerminal(Name&& name)
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1034,10 +1107,22 @@ public:
     {
         internal::cancel(YOGI_PC_CancelReceiveMessage, this);
     }
+
+    void set_capacity(unsigned capacity)
+    {
+        int res = YOGI_PC_SetConsumerCapacity(this->handle(), capacity);
+        internal::throw_on_failure(res);
+    }
+
+    void acknowledge_messages(unsigned numMessages = 1)
+    {
+        int res = YOGI_PC_AcknowledgeMessages(this->handle(), numMessages);
+        internal::throw_on_failure(res);
+    }
 };
 
 
-class RawConsumerTerminal : public ConvenienceTerminal, public Binder
+class RawConsumerTerminal : public ConvenienceTerminal, public Binder, public MessageReceiver
 {
 public:
     enum {
@@ -1049,6 +1134,7 @@ public:
     RawConsumerTerminal(Leaf& leaf, Name&& name, Signature signature)
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1056,6 +1142,7 @@ public:
     RawConsumerTerminal(Name&& name, Signature signature)
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1065,6 +1152,8 @@ public:
     virtual terminal_type type() const override;
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler);
     void cancel_receive_message();
+    void set_capacity(unsigned capacity);
+    void acknowledge_messages(unsigned numMessages = 1);
 };
 
 
@@ -1121,7 +1210,22 @@ public:
 
     bool try_publish(message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_CPC_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_CPC_TryPublish, this, msg);
+    }
+
+    void async_publish(message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_CPC_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_CPC_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_CPC_PublishBatch, this, msgs);
     }
 };
 
@@ -1156,11 +1260,15 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
 };
 
 
 template <typename ProtoDescription>
-class CachedConsumerTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder
+class CachedConsumerTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::PublishMessage message_type;
@@ -1174,6 +1282,7 @@ public:
     CachedConsumerTerminal(Leaf& leaf, Name&& name)
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1181,6 +1290,7 @@ public:
     CachedConsumerTerminal(Name&& name)
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1222,7 +1332,7 @@ public:
 };
 
 
-class RawCachedConsumerTerminal : public ConvenienceTerminal, public Binder
+class RawCachedConsumerTerminal : public ConvenienceTerminal, public Binder, public MessageReceiver
 {
 public:
     enum {
@@ -1234,6 +1344,7 @@ public:
     RawCachedConsumerTerminal(Leaf& leaf, Name&& name, Signature signature)
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1241,6 +1352,7 @@ public:
     RawCachedConsumerTerminal(Name&& name, Signature signature)
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1255,7 +1367,7 @@ public:
 
 
 template <typename ProtoDescription>
-class MasterTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable
+class MasterTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::MasterMessage master_message_type;
@@ -1271,6 +1383,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1279,6 +1392,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1310,7 +1424,22 @@ public:
 
     bool try_publish(master_message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_MS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_MS_TryPublish, this, msg);
+    }
+
+    void async_publish(master_message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_MS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<master_message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_MS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<master_message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_MS_PublishBatch, this, msgs);
     }
 
     void async_receive_message(std::function<void (const Result&, slave_message_type&&)> completionHandler)
@@ -1325,7 +1454,7 @@ public:
 };
 
 
-class RawMasterTerminal : public ConvenienceTerminal, public Binder, public Subscribable
+class RawMasterTerminal : public ConvenienceTerminal, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     enum {
@@ -1338,6 +1467,7 @@ public:
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1346,6 +1476,7 @@ public:
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1357,13 +1488,17 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler);
     void cancel_receive_message();
 };
 
 
 template <typename ProtoDescription>
-class SlaveTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable
+class SlaveTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::MasterMessage master_message_type;
@@ -1379,6 +1514,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1387,6 +1523,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1418,7 +1555,22 @@ public:
 
     bool try_publish(slave_message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_MS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_MS_TryPublish, this, msg);
+    }
+
+    void async_publish(slave_message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_MS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<slave_message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_MS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<slave_message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_MS_PublishBatch, this, msgs);
     }
 
     void async_receive_message(std::function<void (const Result&, master_message_type&&)> completionHandler)
@@ -1433,7 +1585,7 @@ public:
 };
 
 
-class RawSlaveTerminal : public ConvenienceTerminal, public Binder, public Subscribable
+class RawSlaveTerminal : public ConvenienceTerminal, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     enum {
@@ -1446,6 +1598,7 @@ public:
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1454,6 +1607,7 @@ public:
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1465,13 +1619,17 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&)> completionHandler);
     void cancel_receive_message();
 };
 
 
 template <typename ProtoDescription>
-class CachedMasterTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable
+class CachedMasterTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::MasterMessage master_message_type;
@@ -1487,6 +1645,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1495,6 +1654,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1526,7 +1686,22 @@ public:
 
     bool try_publish(master_message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_CMS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_CMS_TryPublish, this, msg);
+    }
+
+    void async_publish(master_message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_CMS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<master_message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_CMS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<master_message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_CMS_PublishBatch, this, msgs);
     }
 
     slave_message_type get_cached_message()
@@ -1546,7 +1721,7 @@ public:
 };
 
 
-class RawCachedMasterTerminal : public ConvenienceTerminal, public Binder, public Subscribable
+class RawCachedMasterTerminal : public ConvenienceTerminal, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     enum {
@@ -1559,6 +1734,7 @@ public:
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1567,6 +1743,7 @@ public:
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1578,6 +1755,10 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     std::vector<char> get_cached_message();
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&, cached_flag)> completionHandler);
     void cancel_receive_message();
@@ -1585,7 +1766,7 @@ public:
 
 
 template <typename ProtoDescription>
-class CachedSlaveTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable
+class CachedSlaveTerminal : public ConvenienceTerminalT<ProtoDescription>, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     typedef typename ProtoDescription::MasterMessage master_message_type;
@@ -1601,6 +1782,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(leaf, type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1609,6 +1791,7 @@ public:
     : ConvenienceTerminalT<ProtoDescription>(type(), std::forward<Name>(name))
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1640,7 +1823,22 @@ public:
 
     bool try_publish(slave_message_type msg)
     {
-        return internal::try_publish_proto_message(YOGI_CMS_Publish, this, msg);
+        return internal::try_publish_proto_message(YOGI_CMS_TryPublish, this, msg);
+    }
+
+    void async_publish(slave_message_type msg, std::function<void (const Result&)> completionHandler)
+    {
+        internal::async_publish_proto_message(YOGI_CMS_AsyncPublish, this, msg, completionHandler);
+    }
+
+    void publish_batch(const std::vector<slave_message_type>& msgs)
+    {
+        internal::publish_proto_messages(YOGI_CMS_PublishBatch, this, msgs);
+    }
+
+    bool try_publish_batch(const std::vector<slave_message_type>& msgs)
+    {
+        return internal::try_publish_proto_messages(YOGI_CMS_PublishBatch, this, msgs);
     }
 
     master_message_type get_cached_message()
@@ -1660,7 +1858,7 @@ public:
 };
 
 
-class RawCachedSlaveTerminal : public ConvenienceTerminal, public Binder, public Subscribable
+class RawCachedSlaveTerminal : public ConvenienceTerminal, public Binder, public Subscribable, public MessageReceiver
 {
 public:
     enum {
@@ -1673,6 +1871,7 @@ public:
     : ConvenienceTerminal(leaf, type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1681,6 +1880,7 @@ public:
     : ConvenienceTerminal(type(), std::forward<Name>(name), signature)
     , Binder(this)
     , Subscribable(this)
+    , MessageReceiver(this)
     {
     }
 
@@ -1692,6 +1892,10 @@ public:
     void publish(const std::vector<char>& data);
     bool try_publish(const void* data, std::size_t size);
     bool try_publish(const std::vector<char>& data);
+    void async_publish(const void* data, std::size_t size, std::function<void (const Result&)> completionHandler);
+    void async_publish(const std::vector<char>& data, std::function<void (const Result&)> completionHandler);
+    void publish_batch(const std::vector<std::vector<char>>& msgs);
+    bool try_publish_batch(const std::vector<std::vector<char>>& msgs);
     std::vector<char> get_cached_message();
     void async_receive_message(std::function<void (const Result&, std::vector<char>&&, cached_flag)> completionHandler);
     void cancel_receive_message();
@@ -51,6 +51,12 @@ std::ostream& operator<< (std::ostream& os, yogi::gather_flags flags)
         if (flags & gather_flags::CONNECTION_LOST) {
             v.push_back("CONNECTION_LOST");
         }
+        if (flags & gather_flags::TIMEOUT) {
+            v.push_back("TIMEOUT");
+        }
+        if (flags & gather_flags::QUORUM) {
+            v.push_back("QUORUM");
+        }
     }
 
     for (std::size_t i = 0; i < v.size(); ++i) {
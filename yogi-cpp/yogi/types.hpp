@@ -49,7 +49,9 @@ enum gather_flags {
     IGNORED                  = YOGI_SG_IGNORED,
     DEAF                     = YOGI_SG_DEAF,
     BINDING_DESTROYED        = YOGI_SG_BINDINGDESTROYED,
-    CONNECTION_LOST          = YOGI_SG_CONNECTIONLOST
+    CONNECTION_LOST          = YOGI_SG_CONNECTIONLOST,
+    TIMEOUT                  = YOGI_SG_TIMEOUT,
+    QUORUM                   = YOGI_SG_QUORUM
 };
 
 enum terminal_type {
@@ -74,6 +76,35 @@ enum change_type {
     ADDED
 };
 
+enum find_mode {
+    FIND_PREFIX              = YOGI_KT_PREFIX,
+    FIND_SUBSTRING           = YOGI_KT_SUBSTRING
+};
+
+enum scheduler_type {
+    SHARED_QUEUE             = YOGI_ST_SHAREDQUEUE,
+    WORK_STEALING            = YOGI_ST_WORKSTEALING,
+    BUSY_POLL                = YOGI_ST_BUSYPOLL
+};
+
+enum class handler_category {
+    TCP_RECEIVE              = YOGI_HC_TCPRECEIVE,
+    DESERIALIZE              = YOGI_HC_DESERIALIZE,
+    DISPATCH                 = YOGI_HC_DISPATCH,
+    USER_CALLBACK            = YOGI_HC_USERCALLBACK,
+    OTHER                    = YOGI_HC_OTHER
+};
+
+enum overflow_policy {
+    BLOCK_WHEN_FULL          = YOGI_OP_BLOCK,
+    RUN_INLINE_WHEN_FULL     = YOGI_OP_RUNINLINE
+};
+
+enum receive_queue_policy {
+    DROP_OLDEST              = YOGI_RQ_DROPOLDEST,
+    DROP_NEWEST              = YOGI_RQ_DROPNEWEST
+};
+
 struct terminal_info {
     terminal_type type;
     Signature     signature;
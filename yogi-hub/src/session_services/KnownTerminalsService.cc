@@ -3,7 +3,6 @@
 
 #include <yogi_core.h>
 
-#include <cctype>
 #include <algorithm>
 
 using namespace std::placeholders;
@@ -77,26 +76,6 @@ KnownTerminalsService::TreeNode     KnownTerminalsService::ms_absoluteTerminalsT
 KnownTerminalsService::TreeNode     KnownTerminalsService::ms_relativeTerminalsTree;
 QMutex                              KnownTerminalsService::ms_mutex;
 
-bool KnownTerminalsService::string_contains(const char* str, const char* substr, bool caseSensitive)
-{
-	auto charsAreEqual = caseSensitive
-                       ? [](char a, char b) { return a == b; }
-                       : [](char a, char b) { return std::tolower(a) == std::tolower(b); };
-
-	do {
-		while (charsAreEqual(*str, *substr) && *substr) {
-			++str;
-			++substr;
-		}
-
-		if (*substr == '\0') {
-			return true;
-		}
-	} while (*str++);
-
-	return false;
-}
-
 void KnownTerminalsService::start_await_known_terminals_change()
 {
     ms_node->async_await_known_terminals_change([=](auto& res, auto&& info, auto change) {
@@ -264,20 +243,15 @@ Service::response_pair KnownTerminalsService::handle_known_terminals_subtree_req
 
 Service::response_pair KnownTerminalsService::handle_find_known_terminals_request(const QByteArray& request)
 {
-	bool caseSensitive = request.at(1) ? true : false;
-    QByteArray nameSubstr = request.mid(2);
-
-	QByteArray response;
-
-    {{
-        QMutexLocker lock(&ms_mutex);
+    bool caseSensitive = request.at(1) ? true : false;
+    std::string nameSubstr = request.mid(2).constData();
 
-        for (const auto& terminal : ms_terminals) {
-            if (string_contains(terminal.constData() + 1 + 4, nameSubstr.constData(), caseSensitive)) {
-                response += terminal;
-            }
-        }
-    }}
+    QByteArray response;
+    for (auto& info : ms_node->find_known_terminals(nameSubstr, yogi::FIND_SUBSTRING, caseSensitive)) {
+        response += helpers::to_byte_array(info.type);
+        response += helpers::to_byte_array(info.signature);
+        response += helpers::to_byte_array(info.name);
+    }
 
     return {RES_OK, response};
 }
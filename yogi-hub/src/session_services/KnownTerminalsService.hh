@@ -55,7 +55,6 @@ private:
     yogi_network::YogiSession* m_session;
     std::atomic<bool>          m_monitorTerminals;
 
-	static bool string_contains(const char* str, const char* substr, bool caseSensitive);
     static void start_await_known_terminals_change();
     static void on_known_terminals_changed(const yogi::terminal_info& info, yogi::change_type change);
     static void update_known_terminals_state_and_notify_sessions(const yogi::terminal_info& info, yogi::change_type change);
@@ -64,6 +64,8 @@ class GatherFlags:
     DEAF = 1 << 2
     BINDING_DESTROYED = 1 << 3
     CONNECTION_LOST = 1 << 4
+    TIMEOUT = 1 << 5
+    QUORUM = 1 << 6
 
 
 yogi.YOGI_CreateTerminal.restype = api_result_handler